@@ -52,6 +52,19 @@
 #include "command_get_almanac_dates.h"
 #include "command_start_demo.h"
 #include "command_fetch_result.h"
+#include "command_fetch_gnss_history.h"
+#include "command_fetch_gui_memory.h"
+#include "command_fetch_wifi_channel_stats.h"
+#include "command_consumption_model.h"
+#include "command_crypto_benchmark.h"
+#include "command_crypto_select.h"
+#include "command_crypto_set_key.h"
+#include "command_crypto_process.h"
+#include "command_firmware_update_start.h"
+#include "command_firmware_update_chunk.h"
+#include "command_firmware_update_finish.h"
+#include "command_get_random.h"
+#include "command_fetch_telemetry.h"
 #include "command_set_date_loc.h"
 #include "command_reset.h"
 #include "command_update_almanac.h"
@@ -62,6 +75,7 @@
 #include "lvgl.h"
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
+#include "lv_img_rle.h"
 
 radio_t radio = {
     SPI1,
@@ -216,6 +230,7 @@ int main( void )
     system_time_wait_ms( 500 );
 
     lv_init( );
+    lv_img_rle_init( );
     lv_port_disp_init( );
     lv_port_indev_init( );
 
@@ -233,25 +248,58 @@ int main( void )
 
     Demo demo( &device_transceiver, &environment, &antenna_selector, &signaling, &timer, &communication_manager );
 
-    CommandGetVersion         com_get_version( hci );
-    CommandGetAlmanacDates    com_get_almanac_dates( &device_transceiver, hci );
-    CommandStartDemo          com_start( &device_transceiver, hci, demo );
-    CommandFetchResult        com_fetch_result( hci, environment, demo );
-    CommandSetDateLoc         com_set_date_loc( &device_transceiver, hci, environment );
-    CommandReset              com_reset( &device_transceiver, hci );
-    CommandUpdateAlmanac      com_update_almanac( &device_transceiver, hci );
-    CommandCheckAlmanacUpdate com_check_almanac_update( &device_transceiver, hci );
+    DeviceFirmwareUpdate firmware_update( &device_transceiver );
+    EntropyPool          entropy_pool( &device_transceiver );
+    TelemetrySampler     telemetry_sampler( &device_transceiver );
+
+    demo.SetEntropyPool( &entropy_pool );
+
+    CommandGetVersion            com_get_version( hci );
+    CommandGetAlmanacDates       com_get_almanac_dates( &device_transceiver, hci );
+    CommandStartDemo             com_start( &device_transceiver, hci, demo );
+    CommandFetchResult           com_fetch_result( hci, environment, demo );
+    CommandFetchGnssHistory      com_fetch_gnss_history( hci, environment, demo );
+    CommandFetchGuiMemory        com_fetch_gui_memory( hci, gui );
+    CommandFetchWifiChannelStats com_fetch_wifi_channel_stats( hci, demo );
+    CommandConsumptionModel      com_consumption_model( hci, demo );
+    CommandCryptoSelect          com_crypto_select( &device_transceiver, hci, demo );
+    CommandCryptoBenchmark       com_crypto_benchmark( &device_transceiver, hci, demo, com_crypto_select );
+    CommandCryptoSetKey          com_crypto_set_key( &device_transceiver, hci, demo );
+    CommandCryptoProcess         com_crypto_process( &device_transceiver, hci, demo );
+    CommandFirmwareUpdateStart   com_firmware_update_start( hci, demo, firmware_update );
+    CommandFirmwareUpdateChunk   com_firmware_update_chunk( hci, firmware_update );
+    CommandFirmwareUpdateFinish  com_firmware_update_finish( hci, firmware_update );
+    CommandGetRandom             com_get_random( hci, entropy_pool );
+    CommandFetchTelemetry        com_fetch_telemetry( hci, environment, telemetry_sampler );
+    CommandSetDateLoc            com_set_date_loc( &device_transceiver, hci, environment );
+    CommandReset                 com_reset( &device_transceiver, hci );
+    CommandUpdateAlmanac         com_update_almanac( &device_transceiver, hci );
+    CommandCheckAlmanacUpdate    com_check_almanac_update( &device_transceiver, hci );
 
     command_factory.AddCommandToPool( com_get_version );
     command_factory.AddCommandToPool( com_get_almanac_dates );
     command_factory.AddCommandToPool( com_start );
     command_factory.AddCommandToPool( com_fetch_result );
+    command_factory.AddCommandToPool( com_fetch_gnss_history );
+    command_factory.AddCommandToPool( com_fetch_gui_memory );
+    command_factory.AddCommandToPool( com_fetch_wifi_channel_stats );
+    command_factory.AddCommandToPool( com_consumption_model );
+    command_factory.AddCommandToPool( com_crypto_benchmark );
+    command_factory.AddCommandToPool( com_crypto_select );
+    command_factory.AddCommandToPool( com_crypto_set_key );
+    command_factory.AddCommandToPool( com_crypto_process );
+    command_factory.AddCommandToPool( com_firmware_update_start );
+    command_factory.AddCommandToPool( com_firmware_update_chunk );
+    command_factory.AddCommandToPool( com_firmware_update_finish );
+    command_factory.AddCommandToPool( com_get_random );
+    command_factory.AddCommandToPool( com_fetch_telemetry );
     command_factory.AddCommandToPool( com_set_date_loc );
     command_factory.AddCommandToPool( com_reset );
     command_factory.AddCommandToPool( com_update_almanac );
     command_factory.AddCommandToPool( com_check_almanac_update );
 
-    Supervisor supervisor( &gui, &device_transceiver, &demo, &environment, &communication_manager );
+    Supervisor supervisor( &gui, &device_transceiver, &demo, &environment, &communication_manager,
+                           &telemetry_sampler );
     supervisor.Init( );
     com_get_version.SetVersion( supervisor.GetVersionHandler( ) );
 
@@ -261,5 +309,13 @@ int main( void )
     {
         signaling.Runtime( );
         supervisor.Runtime( );
+
+        // The random words, VBAT and temperature of the LR1110 are only read while no demo uses the radio, which
+        // includes the waits between the scans of the GNSS scheduler
+        if( ( demo.IsRadioIdle( ) == true ) && ( firmware_update.IsInBootloader( ) == false ) )
+        {
+            entropy_pool.Harvest( );
+            telemetry_sampler.Runtime( );
+        }
     };
 }
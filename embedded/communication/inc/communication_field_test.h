@@ -56,6 +56,7 @@ class CommunicationFieldTest : public CommunicationInterface
                              const uint8_t geo_coding_max_length ) override;
     virtual void vLog( const char* fmt, va_list argp ) override;
     virtual void EventNotify( ) override;
+    virtual void StreamRadioSpectrum( const demo_radio_spectrum_results_t& spectrum_results ) override;
     virtual bool HasNewCommand( ) const override;
     virtual CommandInterface* FetchCommand( ) override;
 
@@ -37,6 +37,7 @@
 #include "version.h"
 #include "demo_wifi_types.h"
 #include "demo_gnss_types.h"
+#include "demo_radio_spectrum_types.h"
 
 class CommunicationInterface
 {
@@ -57,6 +58,7 @@ class CommunicationInterface
     virtual bool GetResults( float& latitude, float& longitude, float& altitude, float& accuracy, char* geo_coding,
                              const uint8_t geo_coding_max_length )                                  = 0;
     virtual void EventNotify( );
+    virtual void StreamRadioSpectrum( const demo_radio_spectrum_results_t& spectrum_results );
     virtual bool HasNewCommand( ) const       = 0;
     virtual CommandInterface* FetchCommand( ) = 0;
 
@@ -65,6 +65,7 @@ class CommunicationManager : public CommunicationInterface
     virtual bool HasNewCommand( ) const override;
     virtual CommandInterface* FetchCommand( ) override;
     virtual void              EventNotify( ) override;
+    virtual void              StreamRadioSpectrum( const demo_radio_spectrum_results_t& spectrum_results ) override;
 
     CommunicationManagerHostType_t GetHostType( ) const;
     bool                           HasHostJustChanged( CommunicationManagerHostType_t* host_type );
@@ -31,6 +31,11 @@
 
 #include "communication_field_test.h"
 #include "field_test_log.h"
+#include "com_code.h"
+
+#define COMMUNICATION_FIELD_TEST_SPECTRUM_HEADER_LENGTH ( 17 )
+#define COMMUNICATION_FIELD_TEST_SPECTRUM_FRAME_MAX_LENGTH \
+    ( COMMUNICATION_FIELD_TEST_SPECTRUM_HEADER_LENGTH + ( 2 * DEMO_RADIO_SPECTRUM_MAX_BINS ) )
 
 CommunicationFieldTest::CommunicationFieldTest( Hci* hci ) : hci( hci ) {}
 
@@ -74,6 +79,35 @@ void CommunicationFieldTest::vLog( const char* fmt, va_list argp )
 
 void CommunicationFieldTest::EventNotify( ) { this->hci->EventNotify( ); }
 
+void CommunicationFieldTest::StreamRadioSpectrum( const demo_radio_spectrum_results_t& spectrum_results )
+{
+    uint8_t  frame[COMMUNICATION_FIELD_TEST_SPECTRUM_FRAME_MAX_LENGTH];
+    uint16_t frame_length = 0;
+
+    const uint32_t header_fields[] = {
+        spectrum_results.sweep_index,
+        spectrum_results.start_frequency_hz,
+        spectrum_results.step_hz,
+        spectrum_results.sweep_duration_ms,
+    };
+    for( uint8_t index = 0; index < ( sizeof( header_fields ) / sizeof( *header_fields ) ); index++ )
+    {
+        frame[frame_length++] = ( uint8_t )( ( header_fields[index] & 0x000000FF ) >> 0 );
+        frame[frame_length++] = ( uint8_t )( ( header_fields[index] & 0x0000FF00 ) >> 8 );
+        frame[frame_length++] = ( uint8_t )( ( header_fields[index] & 0x00FF0000 ) >> 16 );
+        frame[frame_length++] = ( uint8_t )( ( header_fields[index] & 0xFF000000 ) >> 24 );
+    }
+    frame[frame_length++] = spectrum_results.nb_bins;
+
+    for( uint8_t index = 0; index < spectrum_results.nb_bins; index++ )
+    {
+        frame[frame_length++] = ( uint8_t ) spectrum_results.bins[index].peak_rssi;
+        frame[frame_length++] = ( uint8_t ) spectrum_results.bins[index].average_rssi;
+    }
+
+    this->hci->SendResponse( RESP_CODE_RADIO_SPECTRUM, frame, frame_length );
+}
+
 bool CommunicationFieldTest::HasNewCommand( ) const { return this->hci->HasNewCommand( ); }
 
 CommandInterface* CommunicationFieldTest::FetchCommand( ) { return this->hci->FetchCommand( ); }
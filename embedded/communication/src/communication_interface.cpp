@@ -35,6 +35,8 @@ CommunicationInterface::~CommunicationInterface( ) {}
 
 void CommunicationInterface::EventNotify( ) { return; }
 
+void CommunicationInterface::StreamRadioSpectrum( const demo_radio_spectrum_results_t& spectrum_results ) { return; }
+
 const char* CommunicationInterface::WifiTypeToStr( const demo_wifi_signal_type_t type )
 {
     switch( type )
@@ -152,6 +152,11 @@ CommandInterface* CommunicationManager::FetchCommand( ) { return this->active_in
 
 void CommunicationManager::EventNotify( ) { this->active_interface->EventNotify( ); }
 
+void CommunicationManager::StreamRadioSpectrum( const demo_radio_spectrum_results_t& spectrum_results )
+{
+    this->active_interface->StreamRadioSpectrum( spectrum_results );
+}
+
 CommunicationManagerHostType_t CommunicationManager::GetHostType( ) const { return this->host_type; }
 
 bool CommunicationManager::HasHostJustChanged( CommunicationManagerHostType_t* host_type )
@@ -36,9 +36,13 @@
 #include "demo_wifi_country_code.h"
 #include "demo_gnss_autonomous.h"
 #include "demo_gnss_assisted.h"
+#include "demo_gnss_scheduler.h"
 #include "demo_ping_pong.h"
 #include "demo_tx_cw.h"
 #include "demo_radio_per.h"
+#include "demo_radio_spectrum.h"
+#include "demo_radio_cad.h"
+#include "entropy_pool.h"
 #include <stddef.h>
 #include "lr1110_system.h"
 #include "lr1110_bootloader.h"
@@ -56,6 +60,9 @@ typedef enum
     DEMO_TYPE_TX_CW,
     DEMO_TYPE_RADIO_PER_TX,
     DEMO_TYPE_RADIO_PER_RX,
+    DEMO_TYPE_GNSS_SCHEDULER,
+    DEMO_TYPE_RADIO_SPECTRUM,
+    DEMO_TYPE_RADIO_CAD,
 } demo_type_t;
 
 class Demo
@@ -67,6 +74,11 @@ class Demo
 
     void Init( );
 
+    /*!
+     * \brief Set the pool the demos draw their random numbers from
+     */
+    void SetEntropyPool( EntropyPool* entropy_pool );
+
     void SetConfigToDefault( demo_type_t demo_type );
     void GetConfigDefault( demo_all_settings_t* settings );
     void GetConfig( demo_all_settings_t* settings );
@@ -74,22 +86,47 @@ class Demo
     void GetConfigWifi( demo_wifi_settings_t* settings );
     void GetConfigAutonomousGnss( demo_gnss_settings_t* settings );
     void GetConfigAssistedGnss( demo_gnss_settings_t* settings );
+    void GetConfigGnssScheduler( demo_gnss_scheduler_settings_t* settings );
+    void GetConfigRadioSpectrum( demo_radio_spectrum_settings_t* settings );
+    void GetConfigRadioCad( demo_radio_cad_settings_t* settings );
+    void GetConfigRadioPerRx( demo_radio_per_rx_settings_t* settings );
+    void GetConfigPingPong( demo_ping_pong_settings_t* settings );
     void UpdateConfigRadio( demo_radio_settings_t* radio_config );
+    void UpdateConfigRadioSpectrum( const demo_radio_spectrum_settings_t* radio_spectrum_config );
+    void UpdateConfigRadioCad( const demo_radio_cad_settings_t* radio_cad_config );
+    void UpdateConfigRadioPerRx( const demo_radio_per_rx_settings_t* radio_per_rx_config );
+    void UpdateConfigPingPong( const demo_ping_pong_settings_t* ping_pong_config );
     void UpdateConfigWifiScan( const demo_wifi_settings_t* wifi_config );
     void UpdateConfigWifiCountryCode( const demo_wifi_country_code_settings_t* wifi_config );
+    void GetConfigConsumptionModel( demo_consumption_model_settings_t* coefficients ) const;
+    void UpdateConfigConsumptionModel( const demo_consumption_model_settings_t* coefficients );
     void UpdateConfigAutonomousGnss( const demo_gnss_settings_t* gnss_autonomous_config );
     void UpdateConfigAssistedGnss( const demo_gnss_settings_t* gnss_assisted_config );
+    void UpdateConfigGnssScheduler( const demo_gnss_scheduler_settings_t* gnss_scheduler_config );
 
     void Start( demo_type_t demo_type );
     void Stop( );
     void Reset( );
     bool HasIntermediateResults( ) const;
+    bool IsRunning( ) const;
+
+    /*!
+     * \brief Tell if the radio can be used out of the demos, when none is running or the running one is idle
+     */
+    bool IsRadioIdle( ) const;
 
     demo_status_t Runtime( );
 
     demo_type_t GetType( );
     void*       GetResults( );
 
+    const DemoWifiApTable*      GetWifiApTable( ) const;
+    const DemoWifiChannelStats* GetWifiChannelStats( ) const;
+    void                        ClearWifiChannelStats( );
+
+    uint8_t                              GetGnssHistoryCount( ) const;
+    const demo_gnss_nav_history_entry_t* GetGnssHistoryEntry( const uint8_t index ) const;
+
    private:
     DeviceTransceiver*                device;
     EnvironmentInterface*             environment;
@@ -106,9 +143,24 @@ class Demo
     demo_gnss_settings_t              demo_gnss_autonomous_settings_default;
     demo_gnss_settings_t              demo_gnss_assisted_settings;
     demo_gnss_settings_t              demo_gnss_assisted_settings_default;
+    demo_gnss_scheduler_settings_t    demo_gnss_scheduler_settings;
+    demo_gnss_scheduler_settings_t    demo_gnss_scheduler_settings_default;
     demo_radio_settings_t             demo_radio_settings;
     demo_radio_settings_t             demo_radio_settings_default;
+    demo_radio_spectrum_settings_t    demo_radio_spectrum_settings;
+    demo_radio_spectrum_settings_t    demo_radio_spectrum_settings_default;
+    demo_radio_cad_settings_t         demo_radio_cad_settings;
+    demo_radio_cad_settings_t         demo_radio_cad_settings_default;
+    demo_radio_per_rx_settings_t      demo_radio_per_rx_settings;
+    demo_radio_per_rx_settings_t      demo_radio_per_rx_settings_default;
+    demo_ping_pong_settings_t         demo_ping_pong_settings;
+    demo_ping_pong_settings_t         demo_ping_pong_settings_default;
     CommunicationInterface*           communication_interface;
+    EntropyPool*                      entropy_pool;
+    DemoWifiApTable                   wifi_ap_table;
+    DemoWifiChannelStats              wifi_channel_stats;
+    DemoWifiAdaptiveScan              wifi_adaptive_scan;
+    DemoConsumptionModel              consumption_model;
 };
 
 #endif
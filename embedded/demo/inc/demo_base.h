@@ -61,6 +61,7 @@ class DemoBase
 
     void         ResetAndInitLr1110( );
     virtual bool HasIntermediateResults( ) const;
+    virtual bool IsRadioIdle( ) const;
 
     bool          IsStarted( ) const;
     demo_status_t GetStatus( ) const;
@@ -35,6 +35,7 @@
 #include "lr1110_wifi.h"
 #include "lr1110_gnss_types.h"
 #include "lr1110_radio_types.h"
+#include "demo_configuration_tables.h"
 
 #define DEMO_COMMON_RF_SWITCH_ENABLE \
     ( LR1110_SYSTEM_RFSW0_HIGH | LR1110_SYSTEM_RFSW1_HIGH | LR1110_SYSTEM_RFSW2_HIGH | LR1110_SYSTEM_RFSW3_HIGH )
@@ -53,6 +54,8 @@
 #define DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT 110
 #define DEMO_WIFI_RESULT_TYPE_DEFAULT ( DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE )
 #define DEMO_WIFI_DOES_ABORT_ON_TIMEOUT_DEFAULT ( false )
+#define DEMO_WIFI_IS_ADAPTIVE_DEFAULT ( false )
+#define DEMO_WIFI_TIME_BUDGET_IN_MS_DEFAULT ( 0 )
 
 #define DEMO_GNSS_AUTONOMOUS_OPTION_DEFAULT ( LR1110_GNSS_OPTION_DEFAULT )
 #define DEMO_GNSS_AUTONOMOUS_CAPTURE_MODE_DEFAULT ( LR1110_GNSS_SINGLE_SCAN_MODE )
@@ -66,6 +69,31 @@
 #define DEMO_GNSS_ASSISTED_ANTENNA_SELECTION_DEFAULT ( DEMO_GNSS_NO_ANTENNA_SELECTION )
 #define DEMO_GNSS_ASSISTED_CONSTELLATION_MASK_DEFAULT ( LR1110_GNSS_GPS_MASK | LR1110_GNSS_BEIDOU_MASK )
 
+// The second scan of a dual scan is skipped when the first one detected enough satellites above the CN0 threshold.
+// Skipping on too few detected satellites is disabled by default
+#define DEMO_GNSS_DUAL_SCAN_SKIP_NB_SV_DEFAULT ( 6 )
+#define DEMO_GNSS_DUAL_SCAN_CNR_MIN_DEFAULT ( 35 )
+#define DEMO_GNSS_DUAL_SCAN_MIN_SV_DEFAULT ( 0 )
+
+#define DEMO_GNSS_SCHEDULER_SCAN_TYPE_DEFAULT ( DEMO_GNSS_SCHEDULER_SCAN_AUTONOMOUS )
+#define DEMO_GNSS_SCHEDULER_INTERVAL_S_DEFAULT ( 60 )
+
+// Datasheet currents of the LR1110, to be replaced by the coefficients measured on the board. The Wi-Fi detection
+// phase is not accounted for by these defaults
+#define DEMO_CONSUMPTION_WIFI_DCDC_DETECTION_UA_DEFAULT ( 0 )
+#define DEMO_CONSUMPTION_WIFI_DCDC_CORRELATION_UA_DEFAULT ( 12000 )
+#define DEMO_CONSUMPTION_WIFI_DCDC_CAPTURE_UA_DEFAULT ( 12000 )
+#define DEMO_CONSUMPTION_WIFI_DCDC_DEMODULATION_UA_DEFAULT ( 4000 )
+#define DEMO_CONSUMPTION_WIFI_LDO_DETECTION_UA_DEFAULT ( 0 )
+#define DEMO_CONSUMPTION_WIFI_LDO_CORRELATION_UA_DEFAULT ( 24000 )
+#define DEMO_CONSUMPTION_WIFI_LDO_CAPTURE_UA_DEFAULT ( 24000 )
+#define DEMO_CONSUMPTION_WIFI_LDO_DEMODULATION_UA_DEFAULT ( 8000 )
+#define DEMO_CONSUMPTION_GNSS_DCDC_ACQUISITION_UA_DEFAULT ( 11000 )
+#define DEMO_CONSUMPTION_GNSS_DCDC_COMPUTATION_UA_DEFAULT ( 6000 )
+#define DEMO_CONSUMPTION_RADIO_DCDC_CAD_UA_DEFAULT ( 5400 )
+#define DEMO_CONSUMPTION_RADIO_DCDC_RX_UA_DEFAULT ( 5400 )
+#define DEMO_CONSUMPTION_RADIO_SLEEP_UA_DEFAULT ( 2 )
+
 #define DEMO_RADIO_RF_FREQUENCY_DEFAULT ( 868200000 )
 #define DEMO_RADIO_TX_POWER_DEFAULT ( 14 )
 #define DEMO_RADIO_PAYLOAD_LENGTH_DEFAULT ( 20 )
@@ -94,9 +122,38 @@
 #define DEMO_RADIO_GFSK_PBL_LENGTH_DEFAULT ( 16 )
 #define DEMO_RADIO_GFSK_SW_LENGTH_DEFAULT ( 24 )
 
+// The whole 863-870 MHz band in 125 kHz bins. The first RSSI sample of a bin is discarded, the receiver settling
+#define DEMO_RADIO_SPECTRUM_START_FREQUENCY_DEFAULT ( 863000000 )
+#define DEMO_RADIO_SPECTRUM_STOP_FREQUENCY_DEFAULT ( 870000000 )
+#define DEMO_RADIO_SPECTRUM_STEP_DEFAULT ( 125000 )
+#define DEMO_RADIO_SPECTRUM_NB_SAMPLES_DEFAULT ( 4 )
+#define DEMO_RADIO_SPECTRUM_NB_SWEEPS_DEFAULT ( 0 )
+
+// One CAD every 100 ms on the default radio channel with SF7, detection thresholds being the driver defaults
+#define DEMO_RADIO_CAD_SF_MASK_DEFAULT ( 1 << ( LR1110_RADIO_LORA_SF7 - LR1110_RADIO_LORA_SF5 ) )
+#define DEMO_RADIO_CAD_BW_DEFAULT ( LR1110_RADIO_LORA_BW_125 )
+#define DEMO_RADIO_CAD_START_FREQUENCY_DEFAULT ( DEMO_RADIO_RF_FREQUENCY_DEFAULT )
+#define DEMO_RADIO_CAD_CHANNEL_SPACING_DEFAULT ( 200000 )
+#define DEMO_RADIO_CAD_NB_CHANNELS_DEFAULT ( 1 )
+#define DEMO_RADIO_CAD_PERIOD_MS_DEFAULT ( 100 )
+#define DEMO_RADIO_CAD_SYMB_NB_DEFAULT ( 2 )
+#define DEMO_RADIO_CAD_DETECT_PEAK_DEFAULT ( 0x32 )
+#define DEMO_RADIO_CAD_DETECT_MIN_DEFAULT ( 0x0A )
+#define DEMO_RADIO_CAD_NB_CADS_DEFAULT ( 0 )
+
+// The PER receiver listens continuously unless a sleep period is set
+#define DEMO_RADIO_PER_RX_PERIOD_MS_DEFAULT ( 10 )
+#define DEMO_RADIO_PER_SLEEP_PERIOD_MS_DEFAULT ( 0 )
+
 #define DEMO_PING_PONG_RX_TIMEOUT_DEFAULT ( 0xFFFFFFFF )
 #define DEMO_PING_PONG_TX_TIMEOUT_DEFAULT ( 0xFFFFFFFF )
 
+// With the hardware timing, the slave answers 5 ms after the end of the ping and the master sends the next ping 10 ms
+// after the pong, leaving the slave the time to re-arm its reception
+#define DEMO_PING_PONG_TIMING_DEFAULT ( DEMO_PING_PONG_TIMING_FIRMWARE )
+#define DEMO_PING_PONG_TURNAROUND_DELAY_MS_DEFAULT ( 5 )
+#define DEMO_PING_PONG_GUARD_DELAY_MS_DEFAULT ( 10 )
+
 typedef struct
 {
     uint32_t                       rf_frequency;
@@ -112,6 +169,54 @@ typedef struct
     lr1110_radio_pkt_params_lora_t packet_lora;
 } demo_radio_settings_t;
 
+typedef struct
+{
+    uint32_t start_frequency_hz;
+    uint32_t stop_frequency_hz;
+    uint32_t step_hz;     //!< Width of a bin, also used as the receiver bandwidth
+    uint8_t  nb_samples;  //!< RSSI samples averaged on each bin
+    uint16_t nb_sweeps;   //!< Sweeps before the demo terminates, 0 to sweep until stopped
+} demo_radio_spectrum_settings_t;
+
+typedef struct
+{
+    uint8_t                sf_mask;  //!< Bit n set to run CADs with spreading factor 5 + n
+    lr1110_radio_lora_bw_t bw;
+    uint32_t               start_frequency_hz;
+    uint32_t               channel_spacing_hz;
+    uint8_t                nb_channels;  //!< Up to DEMO_RADIO_CAD_MAX_CHANNELS, spaced by channel_spacing_hz
+    uint16_t               period_ms;    //!< Time between the start of two consecutive CADs
+    uint8_t                cad_symb_nb;
+    uint8_t                cad_detect_peak;
+    uint8_t                cad_detect_min;
+    uint32_t               nb_cads;  //!< CADs before the demo terminates, 0 to run until stopped
+} demo_radio_cad_settings_t;
+
+typedef enum
+{
+    DEMO_PING_PONG_TIMING_FIRMWARE = 0,  //!< The MCU turns the radio around, once per second
+    DEMO_PING_PONG_TIMING_HARDWARE = 1,  //!< The LR1110 turns around by itself with AutoTxRx
+} demo_ping_pong_timing_t;
+
+typedef struct
+{
+    demo_ping_pong_timing_t timing;
+    uint16_t                turnaround_delay_ms;  //!< Hardware timing: from the end of the ping to the pong
+    uint16_t                guard_delay_ms;       //!< Hardware timing: from the end of the pong to the next ping
+} demo_ping_pong_settings_t;
+
+/*!
+ * \brief Listening mode of the PER receiver
+ *
+ * With a sleep period, the LR1110 alternates RX and sleep periods until it detects a preamble. A packet is only
+ * captured if its preamble lasts longer than the sleep period plus the RX period.
+ */
+typedef struct
+{
+    uint32_t rx_period_ms;
+    uint32_t sleep_period_ms;  //!< 0 to listen continuously
+} demo_radio_per_rx_settings_t;
+
 typedef enum
 {
     DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE,
@@ -127,6 +232,8 @@ typedef struct
     uint8_t                        max_results;
     uint16_t                       timeout;
     demo_wifi_result_type_t        result_type;
+    bool                           is_adaptive;     //!< Tune the per-channel timeouts from the previous scans
+    uint16_t                       time_budget_ms;  //!< Adaptive scan time budget, 0 to derive it from timeout
 } demo_wifi_settings_t;
 
 typedef struct
@@ -152,14 +259,66 @@ typedef struct
     uint8_t                       nb_satellites;
     demo_gnss_antenna_selection_t antenna_selection;
     uint8_t                       constellation_mask;
+    uint8_t                       dual_scan_skip_nb_sv;  //!< Strong satellites to skip the second scan, 0 to never skip
+    int8_t                        dual_scan_cnr_min;     //!< CN0 of a strong satellite, in dB
+    uint8_t                       dual_scan_min_sv;      //!< Satellites to detect to execute the second scan
 } demo_gnss_settings_t;
 
+typedef enum
+{
+    DEMO_GNSS_SCHEDULER_SCAN_AUTONOMOUS = 0,
+    DEMO_GNSS_SCHEDULER_SCAN_ASSISTED   = 1,
+} demo_gnss_scheduler_scan_type_t;
+
+typedef struct
+{
+    demo_gnss_scheduler_scan_type_t scan_type;
+    uint16_t                        interval_s;
+} demo_gnss_scheduler_settings_t;
+
+/*!
+ * \brief Currents drawn by the LR1110 in each phase of the scans and of the receptions, in micro ampere
+ *
+ * The energy of a phase is its duration multiplied by its current.
+ */
+typedef struct
+{
+    uint32_t wifi_dcdc_detection_ua;
+    uint32_t wifi_dcdc_correlation_ua;
+    uint32_t wifi_dcdc_capture_ua;
+    uint32_t wifi_dcdc_demodulation_ua;
+    uint32_t wifi_ldo_detection_ua;
+    uint32_t wifi_ldo_correlation_ua;
+    uint32_t wifi_ldo_capture_ua;
+    uint32_t wifi_ldo_demodulation_ua;
+    uint32_t gnss_dcdc_acquisition_ua;
+    uint32_t gnss_dcdc_computation_ua;
+    uint32_t radio_dcdc_cad_ua;
+    uint32_t radio_dcdc_rx_ua;
+    uint32_t radio_sleep_ua;
+} demo_consumption_model_settings_t;
+
 typedef struct
 {
     demo_wifi_settings_t              wifi_settings;
     demo_wifi_country_code_settings_t wifi_country_code_settings;
     demo_gnss_settings_t              gnss_autonomous_settings;
     demo_gnss_settings_t              gnss_assisted_settings;
+    demo_gnss_scheduler_settings_t    gnss_scheduler_settings;
     demo_radio_settings_t             radio_settings;
+    demo_radio_spectrum_settings_t    radio_spectrum_settings;
+    demo_radio_cad_settings_t         radio_cad_settings;
+    demo_radio_per_rx_settings_t      radio_per_rx_settings;
+    demo_ping_pong_settings_t         ping_pong_settings;
 } demo_all_settings_t;
+
+static_assert( demo_configuration_is_pa_in_table( ( DEMO_RADIO_PA_SEL_DEFAULT == LR1110_RADIO_PA_SEL_HP )
+                                                      ? demo_configuration_hp_pa_table
+                                                      : demo_configuration_lp_pa_table,
+                                                  ( DEMO_RADIO_PA_SEL_DEFAULT == LR1110_RADIO_PA_SEL_HP )
+                                                      ? DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_hp_pa_table )
+                                                      : DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_lp_pa_table ),
+                                                  DEMO_RADIO_TX_POWER_DEFAULT, DEMO_RADIO_PA_REG_SUPPLY_DEFAULT,
+                                                  DEMO_RADIO_PA_DUTY_CYCLE_DEFAULT, DEMO_RADIO_PA_HP_SEL_DEFAULT ),
+               "Default PA configuration is not available in the GUI PA tables" );
 #endif
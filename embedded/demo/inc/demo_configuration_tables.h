@@ -0,0 +1,253 @@
+/**
+ * @file      demo_configuration_tables.h
+ *
+ * @brief     Lookup tables translating demonstration settings to and from the GUI.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_CONFIGURATION_TABLES_H__
+#define __DEMO_CONFIGURATION_TABLES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lr1110_radio_types.h"
+#include "lr1110_wifi_types.h"
+
+/*!
+ * \brief Number of entries of a constant table
+ */
+#define DEMO_CONFIGURATION_TABLE_SIZE( table ) ( sizeof( table ) / sizeof( ( table )[0] ) )
+
+/*!
+ * \brief Count the options of a '\n' separated option string, as expected by LVGL drop-down lists
+ */
+constexpr size_t demo_configuration_count_options( const char* options )
+{
+    return ( *options == '\0' ) ? 1
+                                 : ( ( *options == '\n' ) ? 1 : 0 ) + demo_configuration_count_options( options + 1 );
+}
+
+typedef struct
+{
+    int8_t                             pwr_in_dbm;
+    int8_t                             tx_power;
+    lr1110_radio_pa_regulator_supply_t pa_reg_supply;
+    uint8_t                            pa_duty_cycle;
+    uint8_t                            pa_hp_sel;
+} demo_configuration_pa_setting_t;
+
+/*!
+ * \brief Low power PA settings, one entry per option of demo_configuration_lp_pa_options
+ */
+constexpr demo_configuration_pa_setting_t demo_configuration_lp_pa_table[] = {
+    { 10, 14, LR1110_RADIO_PA_REG_SUPPLY_DCDC, 0, 0 },
+    { 14, 14, LR1110_RADIO_PA_REG_SUPPLY_DCDC, 4, 0 },
+    { 15, 14, LR1110_RADIO_PA_REG_SUPPLY_DCDC, 7, 0 },
+};
+constexpr char demo_configuration_lp_pa_options[] = "10\n14\n15";
+
+/*!
+ * \brief High power PA settings, one entry per option of demo_configuration_hp_pa_options
+ */
+constexpr demo_configuration_pa_setting_t demo_configuration_hp_pa_table[] = {
+    { 14, 22, LR1110_RADIO_PA_REG_SUPPLY_VBAT, 2, 2 },
+    { 17, 22, LR1110_RADIO_PA_REG_SUPPLY_VBAT, 1, 5 },
+    { 20, 22, LR1110_RADIO_PA_REG_SUPPLY_VBAT, 2, 7 },
+    { 22, 22, LR1110_RADIO_PA_REG_SUPPLY_VBAT, 4, 7 },
+};
+constexpr char demo_configuration_hp_pa_options[] = "14\n17\n20\n22";
+
+constexpr lr1110_radio_lora_sf_t demo_configuration_lora_sf_table[] = {
+    LR1110_RADIO_LORA_SF5, LR1110_RADIO_LORA_SF6,  LR1110_RADIO_LORA_SF7,  LR1110_RADIO_LORA_SF8,
+    LR1110_RADIO_LORA_SF9, LR1110_RADIO_LORA_SF10, LR1110_RADIO_LORA_SF11, LR1110_RADIO_LORA_SF12,
+};
+constexpr char demo_configuration_lora_sf_options[] = "SF5\nSF6\nSF7\nSF8\nSF9\nSF10\nSF11\nSF12";
+
+constexpr lr1110_radio_lora_bw_t demo_configuration_lora_bw_table[] = {
+    LR1110_RADIO_LORA_BW_125,
+    LR1110_RADIO_LORA_BW_250,
+    LR1110_RADIO_LORA_BW_500,
+};
+constexpr char demo_configuration_lora_bw_options[] = "125kHz\n250kHz\n500kHz";
+
+constexpr lr1110_radio_lora_cr_t demo_configuration_lora_cr_table[] = {
+    LR1110_RADIO_LORA_CR_4_5,
+    LR1110_RADIO_LORA_CR_4_6,
+    LR1110_RADIO_LORA_CR_4_7,
+    LR1110_RADIO_LORA_CR_4_8,
+};
+constexpr char demo_configuration_lora_cr_options[] = "4/5\n4/6\n4/7\n4/8";
+
+constexpr lr1110_radio_gfsk_crc_type_t demo_configuration_gfsk_crc_table[] = {
+    LR1110_RADIO_GFSK_CRC_OFF,        LR1110_RADIO_GFSK_CRC_1_BYTE,      LR1110_RADIO_GFSK_CRC_2_BYTES,
+    LR1110_RADIO_GFSK_CRC_1_BYTE_INV, LR1110_RADIO_GFSK_CRC_2_BYTES_INV,
+};
+constexpr char demo_configuration_gfsk_crc_options[] = "OFF\n1B\n2B\n1B inv.\n2B inv.";
+
+/*!
+ * \brief Wi-Fi signal types, in the order of the GUI type selector
+ */
+constexpr lr1110_wifi_signal_type_scan_t demo_configuration_wifi_type_table[] = {
+    LR1110_WIFI_TYPE_SCAN_B,
+    LR1110_WIFI_TYPE_SCAN_G,
+    LR1110_WIFI_TYPE_SCAN_N,
+    LR1110_WIFI_TYPE_SCAN_B_G_N,
+};
+
+static_assert( demo_configuration_count_options( demo_configuration_lp_pa_options ) ==
+                   DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_lp_pa_table ),
+               "LP PA options and table are not consistent" );
+static_assert( demo_configuration_count_options( demo_configuration_hp_pa_options ) ==
+                   DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_hp_pa_table ),
+               "HP PA options and table are not consistent" );
+static_assert( demo_configuration_count_options( demo_configuration_lora_sf_options ) ==
+                   DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_lora_sf_table ),
+               "LoRa SF options and table are not consistent" );
+static_assert( demo_configuration_count_options( demo_configuration_lora_bw_options ) ==
+                   DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_lora_bw_table ),
+               "LoRa BW options and table are not consistent" );
+static_assert( demo_configuration_count_options( demo_configuration_lora_cr_options ) ==
+                   DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_lora_cr_table ),
+               "LoRa CR options and table are not consistent" );
+static_assert( demo_configuration_count_options( demo_configuration_gfsk_crc_options ) ==
+                   DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_gfsk_crc_table ),
+               "GFSK CRC options and table are not consistent" );
+
+/*!
+ * \brief Get the value stored at a GUI index, falling back to the first entry if the index is out of range
+ */
+template< typename T, size_t N >
+inline T demo_configuration_get_value( const T ( &table )[N], uint8_t index )
+{
+    return table[( index < N ) ? index : 0];
+}
+
+/*!
+ * \brief Find the GUI index of a value
+ *
+ * \param [in] table Table to search
+ * \param [in] value Value to look for
+ * \param [out] index GUI index of the value, left untouched if the value is not in the table
+ *
+ * \returns true if the value is in the table, false otherwise
+ */
+template< typename T, size_t N, typename I >
+inline bool demo_configuration_find_index( const T ( &table )[N], T value, I* index )
+{
+    for( uint8_t table_index = 0; table_index < N; table_index++ )
+    {
+        if( table[table_index] == value )
+        {
+            *index = table_index;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * \brief Get the PA table corresponding to a PA selection
+ */
+inline const demo_configuration_pa_setting_t* demo_configuration_get_pa_table( lr1110_radio_pa_selection_t pa_sel,
+                                                                               uint8_t* table_size )
+{
+    if( pa_sel == LR1110_RADIO_PA_SEL_HP )
+    {
+        *table_size = DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_hp_pa_table );
+        return demo_configuration_hp_pa_table;
+    }
+    *table_size = DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_lp_pa_table );
+    return demo_configuration_lp_pa_table;
+}
+
+/*!
+ * \brief Get the GUI index of an output power, falling back to the first entry if it is not in the table
+ */
+inline uint8_t demo_configuration_get_pa_index( lr1110_radio_pa_selection_t pa_sel, int8_t pwr_in_dbm )
+{
+    uint8_t                                table_size = 0;
+    const demo_configuration_pa_setting_t* table      = demo_configuration_get_pa_table( pa_sel, &table_size );
+
+    for( uint8_t index = 0; index < table_size; index++ )
+    {
+        if( table[index].pwr_in_dbm == pwr_in_dbm )
+        {
+            return index;
+        }
+    }
+    return 0;
+}
+
+/*!
+ * \brief Get the PA setting of an output power, falling back to the first entry if it is not in the table
+ */
+inline const demo_configuration_pa_setting_t* demo_configuration_get_pa_setting( lr1110_radio_pa_selection_t pa_sel,
+                                                                                int8_t pwr_in_dbm )
+{
+    uint8_t                                table_size = 0;
+    const demo_configuration_pa_setting_t* table      = demo_configuration_get_pa_table( pa_sel, &table_size );
+
+    return &table[demo_configuration_get_pa_index( pa_sel, pwr_in_dbm )];
+}
+
+/*!
+ * \brief Get the output power of a PA configuration, falling back to the first entry if it is not in the table
+ */
+inline int8_t demo_configuration_get_pa_pwr_in_dbm( const lr1110_radio_pa_cfg_t* pa_configuration, int8_t tx_power )
+{
+    uint8_t                                table_size = 0;
+    const demo_configuration_pa_setting_t* table =
+        demo_configuration_get_pa_table( pa_configuration->pa_sel, &table_size );
+
+    for( uint8_t index = 0; index < table_size; index++ )
+    {
+        if( ( table[index].tx_power == tx_power ) &&
+            ( table[index].pa_reg_supply == pa_configuration->pa_reg_supply ) &&
+            ( table[index].pa_duty_cycle == pa_configuration->pa_duty_cycle ) &&
+            ( table[index].pa_hp_sel == pa_configuration->pa_hp_sel ) )
+        {
+            return table[index].pwr_in_dbm;
+        }
+    }
+    return table[0].pwr_in_dbm;
+}
+
+/*!
+ * \brief Compile-time check that a PA configuration is present in a PA table
+ */
+constexpr bool demo_configuration_is_pa_in_table( const demo_configuration_pa_setting_t* table, size_t table_size,
+                                                  int8_t tx_power, lr1110_radio_pa_regulator_supply_t pa_reg_supply,
+                                                  uint8_t pa_duty_cycle, uint8_t pa_hp_sel )
+{
+    return ( table_size != 0 ) &&
+           ( ( ( table->tx_power == tx_power ) && ( table->pa_reg_supply == pa_reg_supply ) &&
+               ( table->pa_duty_cycle == pa_duty_cycle ) && ( table->pa_hp_sel == pa_hp_sel ) ) ||
+             demo_configuration_is_pa_in_table( table + 1, table_size - 1, tx_power, pa_reg_supply, pa_duty_cycle,
+                                                pa_hp_sel ) );
+}
+
+#endif  // __DEMO_CONFIGURATION_TABLES_H__
@@ -0,0 +1,122 @@
+/**
+ * @file      demo_consumption_model.h
+ *
+ * @brief     Consumption model of the LR1110 scans
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_CONSUMPTION_MODEL_H__
+#define __DEMO_CONSUMPTION_MODEL_H__
+
+#include <stdint.h>
+#include "demo_configuration.h"
+#include "demo_wifi_types.h"
+#include "demo_gnss_types.h"
+#include "demo_radio_cad_types.h"
+#include "lr1110_system_types.h"
+
+/*!
+ * \brief Estimate the energy of the scans and of the receptions from their timings
+ *
+ * The current of each phase comes from a settings record, so that the coefficients measured on a given board can
+ * replace the datasheet values.
+ */
+class DemoConsumptionModel
+{
+   public:
+    DemoConsumptionModel( );
+    virtual ~DemoConsumptionModel( );
+
+    void SetToDefault( );
+    void GetCoefficients( demo_consumption_model_settings_t* coefficients ) const;
+    void SetCoefficients( const demo_consumption_model_settings_t* coefficients );
+
+    /*!
+     * \brief Compute the energy of a Wi-Fi scan
+     *
+     * \param [in] reg_mode Regulator used during the scan
+     *
+     * \param [in] timings Cumulative timings of the scan
+     *
+     * \param [out] energy Energy of each phase
+     *
+     * \retval Total energy in micro ampere second (uas)
+     */
+    uint32_t ComputeWifiEnergy( const lr1110_system_reg_mode_t          reg_mode,
+                                const lr1110_wifi_cumulative_timings_t& timings, demo_wifi_energy_t& energy ) const;
+
+    /*!
+     * \brief Compute the energy of a GNSS scan, the LR1110 being supplied by its DC-DC converter
+     *
+     * \param [in] timings Timings of the scan
+     *
+     * \param [out] energy Energy of each phase
+     *
+     * \retval Total energy in micro ampere second (uas)
+     */
+    uint32_t ComputeGnssEnergy( const lr1110_gnss_timings_t& timings, demo_gnss_energy_t& energy ) const;
+
+    /*!
+     * \brief Compute the energy of a CAD, the LR1110 being supplied by its DC-DC converter
+     *
+     * \param [in] cad_duration_us Duration of the CAD
+     *
+     * \param [in] rx_duration_us Duration of the reception following the CAD, 0 if no activity was detected
+     *
+     * \param [out] energy Energy of each phase
+     *
+     * \retval Total energy in nano ampere second (nas)
+     */
+    uint32_t ComputeRadioCadEnergy( const uint32_t cad_duration_us, const uint32_t rx_duration_us,
+                                    demo_radio_cad_energy_t& energy ) const;
+
+    /*!
+     * \brief Compute the average current of the LR1110 listening with an RX duty cycle, supplied by its DC-DC converter
+     *
+     * \param [in] rx_period_ms RX period of the duty cycle
+     *
+     * \param [in] sleep_period_ms Sleep period of the duty cycle, 0 for a continuous reception
+     *
+     * \param [in] listening_duration_ms Time elapsed since the start of the reception
+     *
+     * \param [in] reception_duration_ms Part of the listening duration spent receiving packets, in continuous RX
+     *
+     * \retval Average current in micro ampere (ua)
+     */
+    uint32_t ComputeRadioRxAverageCurrent( const uint32_t rx_period_ms, const uint32_t sleep_period_ms,
+                                           const uint32_t listening_duration_ms,
+                                           const uint32_t reception_duration_ms ) const;
+
+   protected:
+    static uint32_t ComputeCharge( const uint32_t duration_us, const uint32_t current_ua );
+    static uint32_t ComputeChargeNas( const uint32_t duration_us, const uint32_t current_ua );
+
+   private:
+    demo_consumption_model_settings_t coefficients;
+};
+
+#endif  // __DEMO_CONSUMPTION_MODEL_H__
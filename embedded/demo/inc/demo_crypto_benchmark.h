@@ -0,0 +1,78 @@
+/**
+ * @file      demo_crypto_benchmark.h
+ *
+ * @brief     Latency of the LR1110 crypto engine primitives, SPI transfers included
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_CRYPTO_BENCHMARK_H__
+#define __DEMO_CRYPTO_BENCHMARK_H__
+
+#include "demo_crypto_benchmark_types.h"
+#include "device_base.h"
+#include "lr1110_crypto_engine_types.h"
+
+/*!
+ * \brief Time the primitives of the LR1110 crypto engine over several payload sizes
+ *
+ * Each call is timed with the cycle counter of the MCU, from the start of the SPI command to the end of the reading of
+ * the response, so that the figures include the SPI overhead. The SPI reference gives the share of the bus in them.
+ *
+ * The benchmark selects the crypto engine, and selects back the element given to Run once done. It sets a test key in
+ * the general purpose key slot GP0 and derives a key into GP1, without storing them to flash: the keys previously set
+ * in GP0 and GP1 are lost, as the crypto engine does not allow to read them back to restore them. It blocks until all
+ * the calls are done, and must not run while a demo is using the radio.
+ *
+ * The payload, output and results buffers (about 1 KB) have static storage so that they do not weigh on the stack
+ * of main, where the HCI command holding the benchmark lives: only one benchmark can be used at a time.
+ */
+class DemoCryptoBenchmark
+{
+   public:
+    explicit DemoCryptoBenchmark( DeviceBase* device );
+    virtual ~DemoCryptoBenchmark( );
+
+    static bool IsSettingsValid( const demo_crypto_benchmark_settings_t& settings );
+
+    void Run( const demo_crypto_benchmark_settings_t& settings, const lr1110_crypto_element_t element_to_restore );
+    const demo_crypto_benchmark_results_t* GetResults( ) const;
+
+   protected:
+    void                   TimePrimitive( const demo_crypto_benchmark_primitive_t primitive,
+                                          const uint16_t payload_size, const uint16_t nb_iterations );
+    lr1110_crypto_status_t CallPrimitive( const demo_crypto_benchmark_primitive_t primitive,
+                                          const uint16_t                          payload_size );
+
+   private:
+    DeviceBase*                            device;
+    static demo_crypto_benchmark_results_t results;
+    static uint8_t                         payload[DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX];
+    static uint8_t                         output[DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX];
+    static lr1110_crypto_mic_t             mic;
+};
+
+#endif  // __DEMO_CRYPTO_BENCHMARK_H__
@@ -0,0 +1,60 @@
+#ifndef __DEMO_CRYPTO_BENCHMARK_TYPES_H__
+#define __DEMO_CRYPTO_BENCHMARK_TYPES_H__
+
+#include <stdint.h>
+
+#define DEMO_CRYPTO_BENCHMARK_MAX_PAYLOAD_SIZES ( 4 )
+#define DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_STEP ( 16 )
+#define DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX ( 240 )
+#define DEMO_CRYPTO_BENCHMARK_MAX_ITERATIONS ( 1000 )
+
+/*!
+ * \brief Operations timed by the benchmark
+ *
+ * The SPI reference writes the payload to the radio buffer then reads as many bytes back: it moves the same amount of
+ * data on the bus as an AES call, without any computation.
+ */
+typedef enum
+{
+    DEMO_CRYPTO_BENCHMARK_SPI_REFERENCE = 0,
+    DEMO_CRYPTO_BENCHMARK_AES_ENCRYPT,
+    DEMO_CRYPTO_BENCHMARK_AES_DECRYPT,
+    DEMO_CRYPTO_BENCHMARK_AES_CMAC_COMPUTE,
+    DEMO_CRYPTO_BENCHMARK_AES_CMAC_VERIFY,
+    DEMO_CRYPTO_BENCHMARK_DERIVE_KEY,
+    DEMO_CRYPTO_BENCHMARK_NB_PRIMITIVES,
+} demo_crypto_benchmark_primitive_t;
+
+#define DEMO_CRYPTO_BENCHMARK_MAX_RESULTS \
+    ( DEMO_CRYPTO_BENCHMARK_NB_PRIMITIVES * DEMO_CRYPTO_BENCHMARK_MAX_PAYLOAD_SIZES )
+
+typedef struct
+{
+    uint16_t nb_iterations;  //!< Calls of each primitive for each payload size
+    uint8_t  nb_payload_sizes;
+    uint16_t payload_sizes[DEMO_CRYPTO_BENCHMARK_MAX_PAYLOAD_SIZES];  //!< In bytes, multiples of 16
+} demo_crypto_benchmark_settings_t;
+
+/*!
+ * \brief Duration of the calls of one primitive for one payload size, SPI transfers included
+ *
+ * The key derivation does not depend on the payload: it is only timed once, with the 16-byte nonce as payload size.
+ */
+typedef struct
+{
+    demo_crypto_benchmark_primitive_t primitive;
+    uint16_t                          payload_size;
+    uint16_t                          nb_iterations;
+    uint16_t                          nb_errors;  //!< Calls for which the crypto engine did not report a success
+    uint32_t                          min_us;
+    uint32_t                          max_us;
+    uint32_t                          total_us;
+} demo_crypto_benchmark_result_t;
+
+typedef struct
+{
+    uint8_t                        nb_results;
+    demo_crypto_benchmark_result_t results[DEMO_CRYPTO_BENCHMARK_MAX_RESULTS];
+} demo_crypto_benchmark_results_t;
+
+#endif  // __DEMO_CRYPTO_BENCHMARK_TYPES_H__
@@ -0,0 +1,106 @@
+/**
+ * @file      demo_gnss_assistance_position.h
+ *
+ * @brief     Definition of the manager of the GNSS assistance position.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_GNSS_ASSISTANCE_POSITION_H__
+#define __DEMO_GNSS_ASSISTANCE_POSITION_H__
+
+#include <stdint.h>
+#include <time.h>
+
+typedef struct
+{
+    float latitude;
+    float longitude;
+    float altitude;
+} environment_location_t;
+
+typedef enum
+{
+    DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_HOST   = 0,  //!< Approximate location provided by the host application
+    DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_MANUAL = 1,  //!< Location set by the user with the set date/location command
+    DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_SOLVE  = 2,  //!< Location returned by the solver for a previous scan
+    DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES    = 3,
+} demo_gnss_assistance_position_source_t;
+
+typedef struct
+{
+    environment_location_t                 location;
+    demo_gnss_assistance_position_source_t source;
+    time_t                                 timestamp_s;    //!< Local time of the update of the position
+    uint32_t                               uncertainty_m;  //!< Uncertainty when the position was updated
+} demo_gnss_assistance_position_t;
+
+/*!
+ * \brief Keeps the best known position to assist the GNSS scans
+ *
+ * One position is kept per source. The uncertainty of a position grows with its age as the device may have moved
+ * since, and the position with the lowest current uncertainty is the one used for assistance. A position is
+ * considered fresh while its uncertainty and its age stay below the limits, and fresh positions are always preferred.
+ * Once all the positions are stale, the one with the lowest current uncertainty is still used, as a position once set
+ * stays the best guess until a new one is obtained.
+ */
+class DemoGnssAssistancePosition
+{
+   public:
+    DemoGnssAssistancePosition( );
+    virtual ~DemoGnssAssistancePosition( );
+
+    void Clear( );
+
+    void Update( const environment_location_t& location, const demo_gnss_assistance_position_source_t source,
+                 const uint32_t uncertainty_m, const time_t now_s );
+
+    /*!
+     * \brief Get the position with the lowest current uncertainty
+     *
+     * \param [in] now_s Local time, in seconds
+     *
+     * \param [out] position Best position, its uncertainty being updated to now_s
+     *
+     * \returns True if a position has ever been set, false otherwise
+     */
+    bool GetBest( const time_t now_s, demo_gnss_assistance_position_t& position ) const;
+
+    bool HasPosition( ) const;
+    bool HasFreshPosition( const time_t now_s ) const;
+
+    static uint32_t GetDefaultUncertainty( const demo_gnss_assistance_position_source_t source );
+
+   protected:
+    static uint32_t GetCurrentUncertainty( const demo_gnss_assistance_position_t& position, const time_t now_s );
+    static bool     IsFresh( const demo_gnss_assistance_position_t& position, const time_t now_s );
+
+   private:
+    demo_gnss_assistance_position_t positions[DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES];
+    bool                            is_valid[DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES];
+};
+
+#endif  // __DEMO_GNSS_ASSISTANCE_POSITION_H__
@@ -44,7 +44,7 @@ class DemoGnssAssisted : public DemoGnssBase
     virtual ~DemoGnssAssisted( );
 
    protected:
-    virtual void CallScan( );
+    virtual bool CallScan( );
     static void  GnssPositionFromEnvironment( const environment_location_t&             location,
                                               lr1110_gnss_solver_assistance_position_t& gnss_position );
 };
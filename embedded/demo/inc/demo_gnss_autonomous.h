@@ -43,7 +43,7 @@ class DemoGnssAutonomous : public DemoGnssBase
     virtual ~DemoGnssAutonomous( );
 
    protected:
-    virtual void CallScan( );
+    virtual bool CallScan( );
 };
 
 #endif  // __DEMO_GNSS_AUTONOMOUS_H__
@@ -38,6 +38,7 @@
 #include "antenna_selector_interface.h"
 #include "timer_interface.h"
 #include "demo_gnss_types.h"
+#include "demo_gnss_scan_policy.h"
 
 typedef enum
 {
@@ -122,13 +123,26 @@ class DemoGnssBase : public DemoTransceiverBase
      *
      * This method must be implemented in base class. It just needs to call
      * the call scan driver function.
+     *
+     * \returns False if the scan could not be started for lack of a location
      */
-    virtual void CallScan( ) = 0;
+    virtual bool CallScan( ) = 0;
 
     static lr1110_gnss_date_t GnssTimeFromEnvironment( environment_date_time_t date_time );
     void                      AskAndStoreDate( void );
     TimerInterface*           timer;
 
+    /*!
+     * \brief Decide from the satellites detected by the first scan of a dual scan whether the second one is executed
+     *
+     * The decision is logged for later analysis
+     *
+     * \retval true The second scan has to be executed
+     *
+     * \retval false The results of the first scan are used
+     */
+    bool IsSecondScanNeeded( );
+
    private:
     uint32_t                  gnss_irq;
     demo_gnss_state_t         state;
@@ -139,6 +153,7 @@ class DemoGnssBase : public DemoTransceiverBase
     uint16_t                  instant_start_capture_ms;
     uint16_t                  instant_second_capture_ms;
     AntennaSelectorInterface* antenna_selector;
+    DemoGnssScanPolicy        scan_policy;
 };
 
 #endif  // __DEMO_GNSS_BASE_H__
@@ -0,0 +1,76 @@
+/**
+ * @file      demo_gnss_scan_policy.h
+ *
+ * @brief     Definition of the policy deciding whether the second scan of a dual scan is executed.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_GNSS_SCAN_POLICY_H__
+#define __DEMO_GNSS_SCAN_POLICY_H__
+
+#include <stdint.h>
+#include "demo_configuration.h"
+#include "lr1110_gnss_types.h"
+
+typedef enum
+{
+    DEMO_GNSS_SCAN_POLICY_EXECUTE_SECOND_SCAN,
+    DEMO_GNSS_SCAN_POLICY_SKIP_ENOUGH_SATELLITES,   //!< The first scan already detected enough strong satellites
+    DEMO_GNSS_SCAN_POLICY_SKIP_TOO_FEW_SATELLITES,  //!< The first scan detected too few satellites to expect better
+} demo_gnss_scan_policy_decision_t;
+
+/*!
+ * \brief Decides after the first scan of a dual scan whether the second one is worth its energy and latency
+ *
+ * The satellites detected by the first scan are compared to the thresholds of the GNSS settings: the second scan is
+ * skipped when enough satellites are above the CN0 threshold, or when too few satellites were detected at all.
+ */
+class DemoGnssScanPolicy
+{
+   public:
+    DemoGnssScanPolicy( );
+    virtual ~DemoGnssScanPolicy( );
+
+    void Clear( );
+
+    demo_gnss_scan_policy_decision_t Decide( const demo_gnss_settings_t&             settings,
+                                             const lr1110_gnss_detected_satellite_t* satellites,
+                                             const uint8_t                           nb_satellites );
+
+    uint8_t  GetNbStrongSatellites( ) const;
+    uint16_t GetNbSecondScansExecuted( ) const;
+    uint16_t GetNbSecondScansSkipped( ) const;
+
+    static const char* decision2str( const demo_gnss_scan_policy_decision_t decision );
+
+   private:
+    uint8_t  nb_strong_satellites;  //!< Number of satellites above the CN0 threshold at the last decision
+    uint16_t nb_executed;
+    uint16_t nb_skipped;
+};
+
+#endif  // __DEMO_GNSS_SCAN_POLICY_H__
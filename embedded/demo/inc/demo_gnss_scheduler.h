@@ -0,0 +1,133 @@
+/**
+ * @file      demo_gnss_scheduler.h
+ *
+ * @brief     Periodic GNSS scan scheduler with NAV message history.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_GNSS_SCHEDULER_H__
+#define __DEMO_GNSS_SCHEDULER_H__
+
+#include "demo_base.h"
+#include "demo_gnss_autonomous.h"
+#include "demo_gnss_assisted.h"
+#include "entropy_pool.h"
+
+typedef enum
+{
+    DEMO_GNSS_SCHEDULER_START_SCAN,
+    DEMO_GNSS_SCHEDULER_WAIT_FOR_SCAN,
+    DEMO_GNSS_SCHEDULER_WAIT_FOR_NEXT_SCAN,
+} demo_gnss_scheduler_state_t;
+
+/*!
+ * \brief Re-arm GNSS autonomous or assisted scans at a fixed interval
+ *
+ * Each scan is run by a DemoGnssAutonomous or DemoGnssAssisted instance owned
+ * by the scheduler. Scans are spaced from start to start using the timer,
+ * which is free while no double scan is ongoing. The NAV messages of the
+ * successful scans are kept in a ring of GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES
+ * entries, the oldest entry being overwritten first.
+ *
+ * If an entropy pool is set and seeded, each wait for the next scan is
+ * lengthened by a random jitter of up to a tenth of the interval, so that
+ * several devices started together do not keep scanning in step. Without
+ * a seeded pool the scans are spaced by the exact interval.
+ */
+class DemoGnssScheduler : public DemoBase
+{
+   public:
+    DemoGnssScheduler( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
+                       AntennaSelectorInterface* antenna_selector, TimerInterface* timer,
+                       CommunicationInterface* communication_interface );
+    virtual ~DemoGnssScheduler( );
+
+    virtual void Reset( );
+    virtual void SpecificRuntime( );
+    virtual void SpecificStop( );
+    virtual void SpecificInterruptHandler( );
+    virtual bool HasIntermediateResults( ) const;
+
+    /*!
+     * \brief Tell if the radio is free, which is the case while waiting for the next scan
+     */
+    virtual bool IsRadioIdle( ) const;
+
+    void Configure( const demo_gnss_scheduler_settings_t& scheduler_settings, demo_gnss_settings_t& gnss_settings );
+
+    /*!
+     * \brief Set the model estimating the energy of the scans run by the scheduler
+     */
+    void SetConsumptionModel( const DemoConsumptionModel* consumption_model );
+
+    /*!
+     * \brief Set the pool providing the jitter of the scan schedule, NULL to disable the jitter
+     */
+    void SetEntropyPool( EntropyPool* entropy_pool );
+
+    /*!
+     * \brief Get the result of the last scan
+     */
+    const demo_gnss_all_results_t* GetResult( ) const;
+
+    /*!
+     * \brief Get the number of NAV messages available in the history
+     */
+    uint8_t GetHistoryCount( ) const;
+
+    /*!
+     * \brief Get a NAV message from the history
+     *
+     * \param [in] index Index of the entry, 0 being the oldest one
+     *
+     * \retval Pointer to the entry, NULL if index is out of range
+     */
+    const demo_gnss_nav_history_entry_t* GetHistoryEntry( const uint8_t index ) const;
+
+   protected:
+    virtual void ClearRegisteredIrqs( ) const;
+
+    void     StoreResultInHistory( const demo_gnss_all_results_t* result );
+    uint32_t GetJitterMs( const uint32_t interval_ms );
+
+   private:
+    DemoGnssAutonomous             gnss_autonomous;
+    DemoGnssAssisted               gnss_assisted;
+    DemoGnssBase*                  gnss_demo;
+    EnvironmentInterface*          environment;
+    TimerInterface*                timer;
+    EntropyPool*                   entropy_pool;
+    demo_gnss_scheduler_settings_t settings;
+    demo_gnss_scheduler_state_t    state;
+    uint32_t                       instant_scan_start_ms;
+    bool                           has_intermediate_results;
+    demo_gnss_nav_history_entry_t  history[GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES];
+    uint8_t                        history_next_index;
+    uint8_t                        history_count;
+};
+
+#endif  // __DEMO_GNSS_SCHEDULER_H__
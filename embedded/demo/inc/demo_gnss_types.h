@@ -3,9 +3,11 @@
 
 #include <stdint.h>
 #include "lr1110_gnss_types.h"
+#include "telemetry_sampler_types.h"
 
 #define GNSS_DEMO_MAX_RESULT_TOTAL ( 32 )
 #define GNSS_DEMO_NAV_MESSAGE_MAX_LENGTH ( 259 )
+#define GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES ( 8 )
 
 typedef enum
 {
@@ -37,11 +39,21 @@ typedef enum
     DEMO_GNSS_BASE_ERROR_UNKNOWN,
 } demo_gnss_error_t;
 
+/*!
+ * \brief Energy spent in each phase of a scan, in micro ampere second
+ */
+typedef struct
+{
+    uint32_t acquisition_uas;
+    uint32_t computation_uas;
+} demo_gnss_energy_t;
+
 typedef struct
 {
     demo_gnss_error_t         error;
     uint8_t                   nb_result;
     uint32_t                  consumption_uas;
+    demo_gnss_energy_t        energy;  //!< Breakdown of consumption_uas
     lr1110_gnss_timings_t     timings;
     demo_gnss_single_result_t result[GNSS_DEMO_MAX_RESULT_TOTAL];
     demo_gnss_nav_result_t    nav_message;
@@ -49,6 +61,14 @@ typedef struct
     uint32_t                  local_instant_measurement_second_capture;
     uint16_t                  almanac_age_days;
     bool                      almanac_too_old;
+    telemetry_sample_t        telemetry;  //!< Latest VBAT and temperature when the scan ended
 } demo_gnss_all_results_t;
 
+typedef struct
+{
+    uint32_t               local_instant_measurement;
+    uint8_t                nb_satellites;
+    demo_gnss_nav_result_t nav_message;
+} demo_gnss_nav_history_entry_t;
+
 #endif  // __DEMO_GNSS_TYPES_H__
\ No newline at end of file
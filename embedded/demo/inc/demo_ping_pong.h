@@ -90,6 +90,10 @@ typedef struct
     demo_ping_pong_status_t   status;
     demo_ping_pong_mode_t     mode;
     int8_t                    last_rssi;
+    uint32_t                  count_round_trip;     //!< Number of pongs received as master
+    uint32_t                  round_trip_min_ms;    //!< From the start of the ping to the reception of the pong
+    uint32_t                  round_trip_max_ms;    //!< From the start of the ping to the reception of the pong
+    uint32_t                  round_trip_total_ms;  //!< Sum of all round trips, to compute the average
 } demo_ping_pong_results_t;
 
 class DemoPingPong : public DemoRadioInterface
@@ -99,6 +103,7 @@ class DemoPingPong : public DemoRadioInterface
                   CommunicationInterface* communication_interface );
     virtual ~DemoPingPong( );
 
+    void                            ConfigureTiming( const demo_ping_pong_settings_t& timing_settings );
     const demo_ping_pong_results_t* GetResult( ) const;
 
    protected:
@@ -117,6 +122,11 @@ class DemoPingPong : public DemoRadioInterface
     bool                    IsPongPayload( const demo_ping_pong_rf_payload_t& payload ) const;
     bool                    IsPingPayload( const demo_ping_pong_rf_payload_t& payload ) const;
     bool                    HasIntermediateResults( ) const;
+    bool                    IsHardwareTimed( ) const;
+    bool                    IsTimeToSendPing( const uint32_t now_ms ) const;
+    bool                    HasRadioEvent( );
+    void                    ClearHandledIrqs( const uint32_t handled_irqs );
+    void                    UpdateRoundTrip( const uint32_t round_trip_ms );
 
     static void TransmitPayload( const void* radio, const uint8_t* payload, const uint8_t payload_size,
                                  const uint32_t timeout );
@@ -126,6 +136,8 @@ class DemoPingPong : public DemoRadioInterface
 
     static const char* ModeToString( const demo_ping_pong_mode_t mode );
 
+    static uint32_t ConvertMsToRtcSteps( const uint32_t duration_ms );
+
    private:
     EnvironmentInterface*            environment;
     demo_ping_pong_mode_t            mode;
@@ -133,6 +145,11 @@ class DemoPingPong : public DemoRadioInterface
     volatile uint32_t                last_irq_received_instant_ms;
     uint32_t                         last_tx_done_instant_ms;
     uint32_t                         last_rx_done_instant_ms;
+    uint32_t                         last_ping_start_instant_ms;
+    demo_ping_pong_settings_t        timing_settings;
+    uint32_t                         time_on_air_ms;
+    bool                             is_link_established;
+    bool                             has_pending_radio_event;
     demo_ping_pong_results_t         results;
     uint8_t                          payload_ping[DEMO_PING_PONG_MAX_PAYLOAD_SIZE];
     uint8_t                          payload_pong[DEMO_PING_PONG_MAX_PAYLOAD_SIZE];
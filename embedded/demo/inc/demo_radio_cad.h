@@ -0,0 +1,104 @@
+/**
+ * @file      demo_radio_cad.h
+ *
+ * @brief     Definition of the channel activity detection demo
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_RADIO_CAD_H__
+#define __DEMO_RADIO_CAD_H__
+
+#include "demo_configuration.h"
+#include "demo_radio_interface.h"
+#include "demo_radio_cad_types.h"
+#include "environment_interface.h"
+
+typedef enum
+{
+    DEMO_RADIO_CAD_STATE_INIT,
+    DEMO_RADIO_CAD_STATE_START_CAD,
+    DEMO_RADIO_CAD_STATE_WAIT_FOR_CAD_DONE,
+    DEMO_RADIO_CAD_STATE_WAIT_FOR_RX_DONE,
+} demo_radio_cad_state_t;
+
+/*!
+ * \brief Run LoRa channel activity detections periodically and count the detections and the false alarms
+ *
+ * The CADs cycle through every combination of the enabled spreading factors and of the channels. A detected activity
+ * is followed by a reception: it is a detection if a packet is received, a false alarm otherwise. The packet
+ * parameters of the reception are the ones of the radio settings, so that a board running the PER transmitter with
+ * the same settings acts as the known transmitter.
+ */
+class DemoRadioCad : public DemoRadioInterface
+{
+   public:
+    DemoRadioCad( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
+                  CommunicationInterface* communication_interface );
+    virtual ~DemoRadioCad( );
+
+    void ConfigureCad( const demo_radio_cad_settings_t& cad_settings );
+
+    const demo_radio_cad_results_t* GetResult( ) const;
+
+    /*!
+     * \brief Number of spreading factor and channel combinations run with the given settings
+     *
+     * \retval 0 if the settings enable no spreading factor or no channel
+     */
+    static uint8_t GetNbCombinations( const demo_radio_cad_settings_t& cad_settings );
+
+   protected:
+    virtual void SpecificRuntime( );
+    virtual void SpecificStop( );
+    virtual void SpecificInterruptHandler( );
+    virtual void ClearRegisteredIrqs( ) const;
+
+    void ConfigureRadio( ) const;
+    void BuildCombinations( );
+    void StartCad( const demo_radio_cad_combination_results_t& combination ) const;
+    void EndCad( );
+
+    uint32_t GetSymbolDurationUs( const lr1110_radio_lora_sf_t sf ) const;
+
+    /*!
+     * \brief RX timeout following a detection, in RTC steps
+     *
+     * The reception stops its timeout on the packet header, so it only has to last the preamble and the header.
+     */
+    uint32_t GetRxTimeout( const lr1110_radio_lora_sf_t sf ) const;
+
+   private:
+    EnvironmentInterface*     environment;
+    demo_radio_cad_state_t    state;
+    demo_radio_cad_settings_t cad_settings;
+    demo_radio_cad_results_t  results;
+    uint8_t                   combination_index;
+    uint32_t                  cad_start_ms;
+    uint32_t                  rx_start_ms;
+};
+
+#endif  // __DEMO_RADIO_CAD_H__
@@ -0,0 +1,43 @@
+#ifndef __DEMO_RADIO_CAD_TYPES_H__
+#define __DEMO_RADIO_CAD_TYPES_H__
+
+#include <stdint.h>
+#include "lr1110_radio_types.h"
+
+#define DEMO_RADIO_CAD_MAX_CHANNELS ( 4 )
+#define DEMO_RADIO_CAD_MAX_COMBINATIONS ( 8 * DEMO_RADIO_CAD_MAX_CHANNELS )
+
+/*!
+ * \brief Energy spent in each phase of a CAD, in nano ampere second
+ *
+ * A single CAD draws a few micro ampere second at most, hence the finer unit.
+ */
+typedef struct
+{
+    uint32_t cad_nas;
+    uint32_t rx_nas;  //!< Reception following a detection, averaged over all the CADs
+} demo_radio_cad_energy_t;
+
+/*!
+ * \brief Statistics of the CADs run with one spreading factor on one channel
+ */
+typedef struct
+{
+    uint32_t                frequency_hz;
+    lr1110_radio_lora_sf_t  sf;
+    uint32_t                nb_cads;
+    uint32_t                nb_detections;    //!< Activity detected and confirmed by the reception of a packet
+    uint32_t                nb_false_alarms;  //!< Activity detected but no packet received
+    uint32_t                cad_duration_us;  //!< Duration of one CAD
+    uint32_t                rx_duration_ms;   //!< Time spent receiving after the detections
+    demo_radio_cad_energy_t energy_per_cad;
+} demo_radio_cad_combination_results_t;
+
+typedef struct
+{
+    uint32_t                             nb_cads;
+    uint8_t                              nb_combinations;
+    demo_radio_cad_combination_results_t combinations[DEMO_RADIO_CAD_MAX_COMBINATIONS];
+} demo_radio_cad_results_t;
+
+#endif  // __DEMO_RADIO_CAD_TYPES_H__
@@ -59,6 +59,9 @@ typedef struct
     uint32_t count_rx_wrong_packet;
     uint32_t count_tx;
     uint32_t count_rx_timeout;
+    uint32_t listening_duration_ms;
+    uint32_t count_rx_expected_packet;  //!< Packets sent since the first one received, 0 if the payload is too short
+    uint32_t average_current_ua;        //!< Estimated current of the LR1110 while listening, 0 without model
     int8_t   last_rssi;
 } demo_radio_per_results_t;
 
@@ -69,25 +72,53 @@ class DemoRadioPer : public DemoRadioInterface
                   CommunicationInterface* communication_interface, demo_radio_per_mode_t mode );
     virtual ~DemoRadioPer( );
 
+    /*!
+     * \brief Set the listening mode of the receiver
+     *
+     * \param [in] rx_settings RX and sleep periods of the duty cycle
+     */
+    void ConfigureRx( const demo_radio_per_rx_settings_t& rx_settings );
+
     bool                            HasIntermediateResults( ) const;
     const demo_radio_per_results_t* GetResult( ) const;
 
+    /*!
+     * \brief Check that the LR1110 can run an RX duty cycle with these periods
+     *
+     * \param [in] rx_settings RX and sleep periods of the duty cycle
+     *
+     * \retval True if the periods are supported
+     */
+    static bool IsRxDutyCycleValid( const demo_radio_per_rx_settings_t& rx_settings );
+
    protected:
     virtual void SpecificRuntime( );
     virtual void SpecificStop( );
     virtual void SpecificInterruptHandler( );
     void         LogInfo( ) const;
     void         ClearRegisteredIrqs( ) const;
+    void         StartRx( ) const;
+    void         UpdateSequenceNumber( );
+    void         UpdateAverageCurrent( const uint32_t now_ms );
+
+    static uint32_t ConvertMsToRtcSteps( const uint32_t duration_ms );
 
    private:
-    EnvironmentInterface*    environment;
-    demo_radio_per_state_t   state;
-    demo_radio_per_results_t results;
-    uint8_t                  buffer[255];
-    uint32_t                 nb_of_packets_remaining;
-    uint32_t                 last_event;
-    bool                     has_intermediate_results;
-    demo_radio_per_mode_t    mode;
+    EnvironmentInterface*        environment;
+    demo_radio_per_state_t       state;
+    demo_radio_per_results_t     results;
+    demo_radio_per_rx_settings_t rx_settings;
+    uint8_t                      buffer[255];
+    uint32_t                     nb_of_packets_remaining;
+    uint32_t                     last_event;
+    uint32_t                     listening_start_ms;
+    uint32_t                     reception_duration_ms;
+    uint32_t                     time_on_air_ms;
+    uint32_t                     first_sequence_number;
+    uint32_t                     last_sequence_number;
+    bool                         has_sequence_number;
+    bool                         has_intermediate_results;
+    demo_radio_per_mode_t        mode;
 };
 
 #endif  // __DEMO_RADIO_PER_H__
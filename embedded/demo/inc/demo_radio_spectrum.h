@@ -0,0 +1,93 @@
+/**
+ * @file      demo_radio_spectrum.h
+ *
+ * @brief     Definition of RSSI spectrum sweep demo.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_RADIO_SPECTRUM_H__
+#define __DEMO_RADIO_SPECTRUM_H__
+
+#include "demo_configuration.h"
+#include "demo_transceiver_base.h"
+#include "demo_radio_spectrum_types.h"
+#include "environment_interface.h"
+
+typedef enum
+{
+    DEMO_RADIO_SPECTRUM_STATE_INIT,
+    DEMO_RADIO_SPECTRUM_STATE_SWEEP,
+} demo_radio_spectrum_state_t;
+
+/*!
+ * \brief Sweep a frequency range and measure the instantaneous RSSI on each bin
+ *
+ * A bin is measured by tuning the receiver on its center frequency, with a bandwidth matching the bin width, and by
+ * sampling the instantaneous RSSI. Each complete sweep is published as an intermediate result.
+ */
+class DemoRadioSpectrum : public DemoTransceiverBase
+{
+   public:
+    DemoRadioSpectrum( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
+                       CommunicationInterface* communication_interface );
+    virtual ~DemoRadioSpectrum( );
+
+    void Configure( const demo_radio_spectrum_settings_t& settings );
+
+    bool                                 HasIntermediateResults( ) const;
+    const demo_radio_spectrum_results_t* GetResult( ) const;
+
+    /*!
+     * \brief Number of bins swept with the given settings
+     *
+     * \retval 0 if the settings do not describe a valid frequency range
+     */
+    static uint8_t GetNbBins( const demo_radio_spectrum_settings_t& settings );
+
+   protected:
+    virtual void SpecificRuntime( );
+    virtual void SpecificStop( );
+    virtual void SpecificInterruptHandler( );
+    virtual void ClearRegisteredIrqs( ) const;
+
+    void ConfigureRadio( ) const;
+    void MeasureBin( const uint8_t bin_index );
+
+   private:
+    EnvironmentInterface*          environment;
+    demo_radio_spectrum_state_t    state;
+    demo_radio_spectrum_settings_t settings;
+    demo_radio_spectrum_results_t  results;
+    demo_radio_spectrum_bin_t      sweep_bins[DEMO_RADIO_SPECTRUM_MAX_BINS];  //!< Bins of the sweep in progress
+    uint8_t                        nb_bins;
+    uint8_t                        next_bin;
+    uint32_t                       nb_sweeps;
+    uint32_t                       sweep_start_ms;
+    bool                           has_intermediate_results;
+};
+
+#endif  // __DEMO_RADIO_SPECTRUM_H__
@@ -0,0 +1,32 @@
+#ifndef __DEMO_RADIO_SPECTRUM_TYPES_H__
+#define __DEMO_RADIO_SPECTRUM_TYPES_H__
+
+#include <stdint.h>
+
+#define DEMO_RADIO_SPECTRUM_MAX_BINS ( 128 )
+
+/*!
+ * \brief RSSI measured on one frequency bin during a sweep, in dBm
+ */
+typedef struct
+{
+    int8_t peak_rssi;
+    int8_t average_rssi;
+} demo_radio_spectrum_bin_t;
+
+/*!
+ * \brief Last complete sweep of the spectrum
+ *
+ * The center frequency of bin i is start_frequency_hz + ( i * step_hz ) + ( step_hz / 2 ).
+ */
+typedef struct
+{
+    uint32_t                  sweep_index;  //!< Number of sweeps completed since the start, this one included
+    uint32_t                  sweep_duration_ms;
+    uint32_t                  start_frequency_hz;
+    uint32_t                  step_hz;
+    uint8_t                   nb_bins;
+    demo_radio_spectrum_bin_t bins[DEMO_RADIO_SPECTRUM_MAX_BINS];
+} demo_radio_spectrum_results_t;
+
+#endif  // __DEMO_RADIO_SPECTRUM_TYPES_H__
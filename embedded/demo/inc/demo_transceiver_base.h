@@ -35,12 +35,26 @@
 #include "demo_base.h"
 #include "device_transceiver.h"
 #include "lr1110_system.h"
+#include "demo_consumption_model.h"
 
 class DemoTransceiverBase : public DemoBase
 {
    public:
     DemoTransceiverBase( DeviceTransceiver* device, SignalingInterface* signaling,
                          CommunicationInterface* communication_interface );
+
+    /*!
+     * \brief Set the model estimating the energy of the scans
+     *
+     * \param [in] consumption_model Consumption model, NULL to report no energy
+     */
+    void SetConsumptionModel( const DemoConsumptionModel* consumption_model );
+
+   protected:
+    const DemoConsumptionModel* GetConsumptionModel( ) const;
+
+   private:
+    const DemoConsumptionModel* consumption_model;
 };
 
 #endif  // __DEMO_TRANSCEIVER_BASE_H__
\ No newline at end of file
@@ -0,0 +1,102 @@
+/**
+ * @file      demo_wifi_adaptive_scan.h
+ *
+ * @brief     Adaptive tuning of the Wi-Fi scan timeouts
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_WIFI_ADAPTIVE_SCAN_H__
+#define __DEMO_WIFI_ADAPTIVE_SCAN_H__
+
+#include <stdint.h>
+#include "demo_wifi_types.h"
+
+/*!
+ * \brief Controller choosing the order and the timeout of the channels of a Wi-Fi scan
+ *
+ * The number of access points found on each channel and the time spent scanning it are averaged over the previous
+ * scans. A plan then scans the channels with the best yield first, gives them a share of the time budget proportional
+ * to the expected number of access points, and only probes briefly the channels that stayed empty. Every few plans,
+ * all the channels get their nominal timeout again so that new access points are not missed.
+ */
+class DemoWifiAdaptiveScan
+{
+   public:
+    DemoWifiAdaptiveScan( );
+    virtual ~DemoWifiAdaptiveScan( );
+
+    void Clear( );
+
+    /*!
+     * \brief Build the plan of the next scan
+     *
+     * \param [in] channels Mask of the channels allowed, bit 0 being channel 1
+     *
+     * \param [in] timeout_ms Nominal timeout of each retrial on a channel
+     *
+     * \param [in] nbr_retrials Number of retrials on each channel
+     *
+     * \param [in] time_budget_ms Maximum time of the whole scan, 0 for the time of a non-adaptive scan
+     *
+     * \param [out] plan Channels to scan, in order, with their timeout. At least one channel is planned if the mask is
+     * not empty
+     */
+    void Plan( const lr1110_wifi_channel_mask_t channels, const uint16_t timeout_ms, const uint8_t nbr_retrials,
+               const uint16_t time_budget_ms, demo_wifi_adaptive_scan_plan_t& plan );
+
+    /*!
+     * \brief Update the history of a channel with the result of its scan
+     *
+     * \param [in] channel Channel number, from 1 to DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS
+     *
+     * \param [in] nb_results Number of access points found on the channel
+     *
+     * \param [in] duration_us Time spent scanning the channel, from the cumulative timings
+     */
+    void Update( const demo_wifi_channel_t channel, const uint8_t nb_results, const uint32_t duration_us );
+
+    uint16_t GetNbPlans( ) const;
+
+   protected:
+    typedef struct
+    {
+        uint16_t expected_results_x16;  //!< Moving average of the number of results, in 1/16th
+        uint16_t duration_ms;           //!< Moving average of the scan duration
+        uint8_t  nb_updates;
+        uint8_t  empty_streak;  //!< Number of consecutive scans without result
+    } channel_history_t;
+
+    bool     IsProbeOnly( const channel_history_t& history ) const;
+    uint32_t GetYield( const channel_history_t& history ) const;
+
+   private:
+    channel_history_t history[DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS];
+    uint16_t          nb_plans;                  //!< Saturates, only reported
+    uint8_t           nb_plans_since_full_plan;  //!< Wraps every full plan period
+};
+
+#endif  // __DEMO_WIFI_ADAPTIVE_SCAN_H__
@@ -0,0 +1,88 @@
+/**
+ * @file      demo_wifi_ap_table.h
+ *
+ * @brief     Aggregation of the Wi-Fi access points detected across scans
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_WIFI_AP_TABLE_H__
+#define __DEMO_WIFI_AP_TABLE_H__
+
+#include <stdint.h>
+#include "demo_wifi_types.h"
+#include "environment_interface.h"
+
+/*!
+ * \brief Table of the Wi-Fi access points detected by successive scans, keyed by MAC address
+ *
+ * Each scan result is merged in the entry of its MAC address, which counts the detections and keeps the RSSI
+ * statistics and the instant of the last detection. When the table is full, the entry seen the longest time ago is
+ * replaced.
+ *
+ * The entries take about 1.8 KB of RAM (DEMO_WIFI_AP_TABLE_MAX_ENTRIES entries of 28 bytes). They have static storage
+ * so that they do not weigh on the stack of main, where the demo holder lives: only one table can be used at a time.
+ */
+class DemoWifiApTable
+{
+   public:
+    explicit DemoWifiApTable( EnvironmentInterface* environment );
+    virtual ~DemoWifiApTable( );
+
+    void Clear( );
+
+    /*!
+     * \brief Merge the results of a scan in the table
+     *
+     * \param [in] results Results of the scan. Nothing is merged if the scan failed
+     */
+    void Merge( const demo_wifi_scan_all_results_t& results );
+
+    uint8_t  GetCount( ) const;
+    uint16_t GetNbScans( ) const;
+
+    /*!
+     * \brief Get an entry of the table
+     *
+     * \param [in] index Index of the entry, lower than GetCount( )
+     *
+     * \retval Pointer to the entry, NULL if index is out of range
+     */
+    const demo_wifi_ap_entry_t* GetEntry( const uint8_t index ) const;
+
+    static int8_t GetRssiMean( const demo_wifi_ap_entry_t& entry );
+
+   protected:
+    demo_wifi_ap_entry_t* FindOrAllocateEntry( const demo_wifi_mac_address_t mac_address );
+
+   private:
+    EnvironmentInterface*       environment;
+    static demo_wifi_ap_entry_t entries[DEMO_WIFI_AP_TABLE_MAX_ENTRIES];
+    uint8_t                     count;
+    uint16_t                    nb_scans;
+};
+
+#endif  // __DEMO_WIFI_AP_TABLE_H__
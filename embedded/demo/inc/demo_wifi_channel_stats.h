@@ -0,0 +1,79 @@
+/**
+ * @file      demo_wifi_channel_stats.h
+ *
+ * @brief     Occupancy statistics of the Wi-Fi channels across scans
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_WIFI_CHANNEL_STATS_H__
+#define __DEMO_WIFI_CHANNEL_STATS_H__
+
+#include <stdint.h>
+#include "demo_wifi_types.h"
+
+/*!
+ * \brief Statistics of the 2.4 GHz Wi-Fi channels, updated with the results of each scan
+ *
+ * For each channel, the number of access points detected per scan, the RSSI distribution and the time spent scanning
+ * it are accumulated over the scans that included the channel.
+ */
+class DemoWifiChannelStats
+{
+   public:
+    DemoWifiChannelStats( );
+    virtual ~DemoWifiChannelStats( );
+
+    void Clear( );
+
+    /*!
+     * \brief Merge the results of a scan in the statistics
+     *
+     * \param [in] results Results of the scan. Nothing is merged if the scan failed
+     *
+     * \param [in] channels Mask of the channels scanned, bit 0 being channel 1
+     */
+    void Merge( const demo_wifi_scan_all_results_t& results, const lr1110_wifi_channel_mask_t channels );
+
+    uint16_t GetNbScans( ) const;
+
+    /*!
+     * \brief Get the statistics of a channel
+     *
+     * \param [in] channel Channel number, from 1 to DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS
+     *
+     * \retval Pointer to the statistics, NULL if channel is out of range
+     */
+    const demo_wifi_channel_stats_t* GetChannel( const demo_wifi_channel_t channel ) const;
+
+    static uint8_t GetRssiBin( const int8_t rssi );
+
+   private:
+    demo_wifi_channel_stats_t channels[DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS];
+    uint16_t                  nb_scans;
+};
+
+#endif  // __DEMO_WIFI_CHANNEL_STATS_H__
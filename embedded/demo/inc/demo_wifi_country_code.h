@@ -51,6 +51,8 @@ class DemoWifiCountryCode : public DemoWifiInterface
                                    const lr1110_wifi_channel_mask_t channels, const lr1110_wifi_country_code_t* scan_result,
                                    const uint8_t nbr_results );
 
+    virtual lr1110_wifi_channel_mask_t GetChannelMask( ) const;
+
    private:
     demo_wifi_country_code_settings_t settings;
 };
@@ -37,6 +37,8 @@
 #include "demo_base.h"
 #include "lr1110_wifi_types.h"
 #include "demo_wifi_types.h"
+#include "demo_wifi_ap_table.h"
+#include "demo_wifi_channel_stats.h"
 
 typedef enum
 {
@@ -60,6 +62,21 @@ class DemoWifiInterface : public DemoTransceiverBase
     virtual void SpecificInterruptHandler( );
 
     const demo_wifi_scan_all_results_t* GetResult( ) const;
+
+    /*!
+     * \brief Set the table the results of each scan are merged in
+     *
+     * \param [in] ap_table Access point table, NULL to disable the aggregation
+     */
+    void SetApTable( DemoWifiApTable* ap_table );
+
+    /*!
+     * \brief Set the per-channel statistics the results of each scan are merged in
+     *
+     * \param [in] channel_stats Channel statistics, NULL to disable them
+     */
+    void SetChannelStats( DemoWifiChannelStats* channel_stats );
+
     static const char*                  state2str( const demo_wifi_state_t state );
 
    protected:
@@ -68,18 +85,27 @@ class DemoWifiInterface : public DemoTransceiverBase
     virtual void ExecuteScan( radio_t* radio )         = 0;
     virtual void FetchAndSaveResults( radio_t* radio ) = 0;
 
+    virtual lr1110_wifi_channel_mask_t GetChannelMask( ) const = 0;
+
     /*!
-     * \brief Compute consumption based on cumulative timings
+     * \brief Indicate whether the scan is made of several steps and some remain to be executed
      *
-     * \return Consumption in micro ampere second (uas)
+     * \retval true if the next step must be executed before terminating the demo
      */
-    static uint32_t              ComputeConsumption( const lr1110_system_reg_mode_t          regMode,
-                                                     const lr1110_wifi_cumulative_timings_t& timing );
+    virtual bool HasPendingScan( ) const;
+
+    /*!
+     * \brief Add the energy of the scan to the results, from the cumulative timings
+     */
+    void AddEnergyToResults( const lr1110_system_reg_mode_t reg_mode, const lr1110_wifi_cumulative_timings_t& timings );
+
     demo_wifi_scan_all_results_t results;
 
    private:
-    demo_wifi_state_t state;
-    uint32_t          wifi_irq;
+    demo_wifi_state_t     state;
+    uint32_t              wifi_irq;
+    DemoWifiApTable*      ap_table;
+    DemoWifiChannelStats* channel_stats;
 };
 
 #endif  // __DEMO_WIFI_INTERFACE_H__
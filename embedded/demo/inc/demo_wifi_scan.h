@@ -34,6 +34,7 @@
 
 #include "demo_configuration.h"
 #include "demo_wifi_interface.h"
+#include "demo_wifi_adaptive_scan.h"
 
 class DemoWifiScan : public DemoWifiInterface
 {
@@ -42,8 +43,17 @@ class DemoWifiScan : public DemoWifiInterface
                   CommunicationInterface* communication_interface );
     virtual ~DemoWifiScan( );
 
+    virtual void Reset( );
+
     void Configure( demo_wifi_settings_t& config );
 
+    /*!
+     * \brief Set the controller tuning the channels of the scan when the adaptive mode is configured
+     *
+     * \param [in] adaptive_scan Controller keeping the history of the previous scans, NULL to disable the adaptive mode
+     */
+    void SetAdaptiveScan( DemoWifiAdaptiveScan* adaptive_scan );
+
    protected:
     virtual void ExecuteScan( radio_t* radio );
     virtual void FetchAndSaveResults( radio_t* radio );
@@ -55,8 +65,18 @@ class DemoWifiScan : public DemoWifiInterface
                                    const lr1110_wifi_basic_mac_type_channel_result_t* scan_result,
                                    const uint8_t                                      nbr_results );
 
+    virtual lr1110_wifi_channel_mask_t GetChannelMask( ) const;
+    virtual bool                       HasPendingScan( ) const;
+
+    bool IsAdaptive( ) const;
+    void UpdateAdaptiveScan( radio_t* radio, const uint8_t nb_results_before );
+
    private:
-    demo_wifi_settings_t settings;
+    demo_wifi_settings_t           settings;
+    DemoWifiAdaptiveScan*          adaptive_scan;
+    demo_wifi_adaptive_scan_plan_t adaptive_plan;
+    uint8_t                        adaptive_plan_index;
+    uint32_t                       adaptive_scan_time_us;  //!< Cumulative scan time at the end of the previous step
 };
 
 #endif  //__DEMO_WIFI_SCAN_H__
\ No newline at end of file
@@ -2,8 +2,12 @@
 #define __DEMO_WIFI_TYPES_H__
 
 #include "lr1110_wifi_types.h"
+#include "telemetry_sampler_types.h"
 
 #define DEMO_WIFI_MAX_RESULT_TOTAL 32
+#define DEMO_WIFI_AP_TABLE_MAX_ENTRIES ( 64 )
+#define DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS ( 14 )
+#define DEMO_WIFI_CHANNEL_STATS_RSSI_BINS ( 5 )
 #define DEMO_TYPE_WIFI_MAC_ADDRESS_LENGTH ( 6 )
 
 typedef struct DemoWifiTimings
@@ -43,13 +47,73 @@ typedef struct
     uint8_t                 country_code[LR1110_WIFI_STR_COUNTRY_CODE_SIZE];
 } demo_wifi_scan_single_result_t;
 
+/*!
+ * \brief Energy spent in each phase of a scan, in micro ampere second
+ */
+typedef struct
+{
+    uint32_t detection_uas;
+    uint32_t correlation_uas;
+    uint32_t capture_uas;
+    uint32_t demodulation_uas;
+} demo_wifi_energy_t;
+
 typedef struct
 {
     uint8_t                        nbrResults;
     demo_wifi_scan_single_result_t results[DEMO_WIFI_MAX_RESULT_TOTAL];
     demo_wifi_timings_t            timings;
     uint32_t                       global_consumption_uas;
+    demo_wifi_energy_t             energy;  //!< Breakdown of global_consumption_uas
     bool                           error;
+    telemetry_sample_t             telemetry;  //!< Latest VBAT and temperature when the scan ended
 } demo_wifi_scan_all_results_t;
 
+/*!
+ * \brief Access point aggregated across scans
+ *
+ * The channel, type and country code are the ones of the last detection.
+ */
+typedef struct
+{
+    demo_wifi_mac_address_t mac_address;
+    demo_wifi_channel_t     channel;
+    demo_wifi_signal_type_t type;
+    uint8_t                 country_code[LR1110_WIFI_STR_COUNTRY_CODE_SIZE];
+    uint16_t                nb_detections;
+    int8_t                  rssi_min;
+    int8_t                  rssi_max;
+    int32_t                 rssi_sum;
+    uint32_t                local_instant_last_seen_s;
+} demo_wifi_ap_entry_t;
+
+/*!
+ * \brief Occupancy of a 2.4 GHz channel over the scans that included it
+ *
+ * The RSSI histogram bins are 10 dB wide: below -90 dBm, [-90;-80[, [-80;-70[, [-70;-60[ and from -60 dBm.
+ */
+typedef struct
+{
+    uint16_t nb_scans;
+    uint16_t nb_detections;
+    uint8_t  nb_ap_last_scan;
+    uint8_t  nb_ap_max_per_scan;
+    int8_t   rssi_max;
+    uint16_t rssi_histogram[DEMO_WIFI_CHANNEL_STATS_RSSI_BINS];
+    uint32_t dwell_time_us;  //!< Share of the scan timings, the LR1110 reporting them for all channels together
+} demo_wifi_channel_stats_t;
+
+typedef struct
+{
+    demo_wifi_channel_t channel;
+    uint16_t            timeout_ms;  //!< Timeout of each of the retrials on the channel
+} demo_wifi_adaptive_scan_step_t;
+
+typedef struct
+{
+    demo_wifi_adaptive_scan_step_t steps[DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS];
+    uint8_t                        nb_steps;
+    lr1110_wifi_channel_mask_t     channels;  //!< Mask of the channels of the plan, bit 0 being channel 1
+} demo_wifi_adaptive_scan_plan_t;
+
 #endif  // __DEMO_WIFI_TYPES_H__
\ No newline at end of file
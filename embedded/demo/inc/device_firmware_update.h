@@ -0,0 +1,109 @@
+/**
+ * @file      device_firmware_update.h
+ *
+ * @brief     Definition of the update of the LR1110 firmware through its bootloader.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEVICE_FIRMWARE_UPDATE_H__
+#define __DEVICE_FIRMWARE_UPDATE_H__
+
+#include "device_base.h"
+#include "lr1110_bootloader_types.h"
+
+#define DEVICE_FIRMWARE_UPDATE_CHUNK_SIZE_MAX ( 256 )
+#define DEVICE_FIRMWARE_UPDATE_TYPE_BOOTLOADER ( 0xDF )
+#define DEVICE_FIRMWARE_UPDATE_TYPE_TRANSCEIVER ( 0x01 )
+
+typedef enum
+{
+    DEVICE_FIRMWARE_UPDATE_STATUS_OK                 = 0,
+    DEVICE_FIRMWARE_UPDATE_STATUS_BUSY               = 1,  //!< A demo is using the radio
+    DEVICE_FIRMWARE_UPDATE_STATUS_NOT_STARTED        = 2,
+    DEVICE_FIRMWARE_UPDATE_STATUS_NOT_IN_BOOTLOADER  = 3,
+    DEVICE_FIRMWARE_UPDATE_STATUS_WRONG_IMAGE_SIZE   = 4,
+    DEVICE_FIRMWARE_UPDATE_STATUS_WRONG_OFFSET       = 5,
+    DEVICE_FIRMWARE_UPDATE_STATUS_WRONG_CHUNK_SIZE   = 6,
+    DEVICE_FIRMWARE_UPDATE_STATUS_WRITE_FAILED       = 7,
+    DEVICE_FIRMWARE_UPDATE_STATUS_INCOMPLETE         = 8,
+    DEVICE_FIRMWARE_UPDATE_STATUS_HASH_MISMATCH      = 9,
+    DEVICE_FIRMWARE_UPDATE_STATUS_NOT_IN_TRANSCEIVER = 10,
+} device_firmware_update_status_t;
+
+/*!
+ * \brief Outcome of an update, once the LR1110 rebooted on its new firmware
+ */
+typedef struct
+{
+    lr1110_bootloader_hash_t    hash;     //!< Hash of the flash content given by the bootloader
+    lr1110_bootloader_version_t version;  //!< Version read after the reboot
+} device_firmware_update_result_t;
+
+/*!
+ * \brief Write an encrypted firmware image to the flash of the LR1110 through its bootloader
+ *
+ * Start resets the LR1110 into its bootloader and erases its flash. The image then comes in chunks of 256 bytes
+ * (only the last one may be shorter) written in order, and Finish checks the hash of the flash content before
+ * rebooting the LR1110 on its new firmware.
+ *
+ * A chunk is checked and written in two steps so that the caller can acknowledge it in between, letting the next
+ * chunk arrive while the current one is written. A failed write is reported by the next check, and by Finish.
+ */
+class DeviceFirmwareUpdate
+{
+   public:
+    explicit DeviceFirmwareUpdate( DeviceBase* device );
+    virtual ~DeviceFirmwareUpdate( );
+
+    device_firmware_update_status_t Start( const uint32_t image_size, const uint8_t* expected_hash,
+                                           lr1110_bootloader_version_t* bootloader_version );
+    device_firmware_update_status_t CheckChunk( const uint32_t offset, const uint16_t chunk_size ) const;
+    void                            WriteChunk( const uint32_t offset, const uint8_t* chunk,
+                                                const uint16_t chunk_size );
+    device_firmware_update_status_t Finish( device_firmware_update_result_t* result );
+
+    bool     IsInProgress( ) const;
+    bool     IsInBootloader( ) const;
+    uint32_t GetNbBytesWritten( ) const;
+    uint32_t GetImageSize( ) const;
+
+   protected:
+    void EnterBootloader( );
+
+   private:
+    DeviceBase*                     device;
+    bool                            is_in_progress;
+    bool                            is_in_bootloader;
+    device_firmware_update_status_t status;
+    uint32_t                        image_size;
+    uint32_t                        nb_bytes_written;
+    bool                            has_expected_hash;
+    lr1110_bootloader_hash_t        expected_hash;
+    uint32_t                        words[DEVICE_FIRMWARE_UPDATE_CHUNK_SIZE_MAX / 4];
+};
+
+#endif  // __DEVICE_FIRMWARE_UPDATE_H__
@@ -0,0 +1,90 @@
+/**
+ * @file      entropy_pool.h
+ *
+ * @brief     Definition of the entropy pool and of the random generator it seeds.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ENTROPY_POOL_H__
+#define __ENTROPY_POOL_H__
+
+#include "device_base.h"
+
+#define ENTROPY_POOL_KEY_NB_WORDS ( 8 )
+#define ENTROPY_POOL_BLOCK_NB_WORDS ( 16 )
+
+/*!
+ * \brief Random numbers for the demos and the HCI, without an SPI transaction per number
+ *
+ * Harvest reads one random word from the LR1110 at a time into a pool. Each time the pool holds 256 bits, they are
+ * mixed into the key of a ChaCha20 based generator running on the MCU, which then serves all the random numbers.
+ * The generator erases its key with its own output after each block, so that past numbers cannot be recovered from
+ * its state.
+ *
+ * Harvest must only be called while the radio is idle. It reads the LR1110 at a low rate once the generator is
+ * seeded, so it can be called from the main loop.
+ *
+ * No random number is served before the first reseed: until then the generator key is all zeros and its output would
+ * be predictable. The getters return false in that case, and callers must fall back to a behavior that does not need
+ * randomness.
+ */
+class EntropyPool
+{
+   public:
+    explicit EntropyPool( DeviceBase* device );
+    virtual ~EntropyPool( );
+
+    void Harvest( );
+
+    bool     IsSeeded( ) const;
+    uint32_t GetNbReseeds( ) const;
+    bool     GetRandomBytes( uint8_t* buffer, const uint16_t length );
+    bool     GetRandomWord( uint32_t* random_word );
+    bool     GetRandomInRange( const uint32_t min, const uint32_t max, uint32_t* random_value );
+
+    /*!
+     * \brief Erase a buffer holding random numbers, in a way the compiler cannot remove as a dead store
+     */
+    static void Wipe( void* buffer, const uint16_t length );
+
+   protected:
+    void Reseed( );
+    void GenerateBlock( );
+
+   private:
+    DeviceBase* device;
+    uint32_t    last_harvest_ms;
+    uint32_t    pool[ENTROPY_POOL_KEY_NB_WORDS];
+    uint8_t     nb_pool_words;
+    uint32_t    nb_reseeds;
+    uint32_t    key[ENTROPY_POOL_KEY_NB_WORDS];
+    uint32_t    counter;
+    uint8_t     output[( ENTROPY_POOL_BLOCK_NB_WORDS - ENTROPY_POOL_KEY_NB_WORDS ) * sizeof( uint32_t )];
+    uint8_t     nb_output_bytes;
+};
+
+#endif  // __ENTROPY_POOL_H__
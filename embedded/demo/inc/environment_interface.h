@@ -34,19 +34,15 @@
 
 #include <time.h>
 #include <stdint.h>
-
-typedef struct
-{
-    float latitude;
-    float longitude;
-    float altitude;
-} environment_location_t;
+#include "demo_gnss_assistance_position.h"
 
 typedef time_t environment_date_time_t;
 
 /*
  * Is responsible to handle the approximate location and time of the device
  * Mainly used for Gnss Assisted Scan
+ * The location is the best assistance position known. Once set, a location stays available: a stale one is still
+ * used, with an uncertainty grown with its age, until a fresher one is set
  */
 class EnvironmentInterface
 {
@@ -56,21 +52,29 @@ class EnvironmentInterface
 
     bool HasDate( ) const;
     bool HasLocation( ) const;
+    bool HasFreshLocation( ) const;
 
     environment_date_time_t GetDateTime( ) const;
     environment_location_t  GetLocation( ) const;
 
+    /*!
+     * \brief Get the assistance position currently used, with its source and up-to-date uncertainty
+     *
+     * \returns True if a position has ever been set, false otherwise
+     */
+    bool GetAssistancePosition( demo_gnss_assistance_position_t& position ) const;
+
     void           SetTimeFromGpsEpoch( const environment_date_time_t& time_from_gps_epoch );
-    void           SetLocation( const environment_location_t& location );
+    void           SetLocation( const environment_location_t& location,
+                                const demo_gnss_assistance_position_source_t source, const uint32_t uncertainty_m );
     int32_t        GetDelta( ) const { return this->delta_time_s; }
     virtual time_t GetLocalTimeSeconds( ) const      = 0;
     virtual time_t GetLocalTimeMilliseconds( ) const = 0;
 
    private:
-    bool                   has_date;
-    bool                   has_location;
-    int32_t                delta_time_s;
-    environment_location_t last_location;
+    bool                       has_date;
+    int32_t                    delta_time_s;
+    DemoGnssAssistancePosition assistance_position;
 };
 
 #endif  // __ENVIRONMENT_INTERFACE_H__
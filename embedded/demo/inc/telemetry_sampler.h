@@ -0,0 +1,105 @@
+/**
+ * @file      telemetry_sampler.h
+ *
+ * @brief     Definition of the sampler of the LR1110 supply voltage and temperature.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __TELEMETRY_SAMPLER_H__
+#define __TELEMETRY_SAMPLER_H__
+
+#include "device_base.h"
+#include "telemetry_sampler_types.h"
+
+#define TELEMETRY_SAMPLER_PERIOD_DEFAULT_MS ( 60000 )
+#define TELEMETRY_SAMPLER_PERIOD_MIN_MS ( 1000 )
+#define TELEMETRY_SAMPLER_PERIOD_MAX_MS ( 3600000 )
+
+/*!
+ * \brief Periodic reading of VBAT and of the temperature of the LR1110
+ *
+ * The values are converted with the typical Vana of 1.35 V given in the LR1110 driver, so they are estimates. The
+ * last TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES samples are kept, the extremes cover all the samples since the start.
+ *
+ * Runtime must only be called while the radio is idle. The first sample is taken on the first call.
+ */
+class TelemetrySampler
+{
+   public:
+    explicit TelemetrySampler( DeviceBase* device );
+    virtual ~TelemetrySampler( );
+
+    /*!
+     * \brief Take a sample if the period elapsed since the previous one
+     *
+     * \retval true if a new sample was taken
+     */
+    bool Runtime( );
+
+    /*!
+     * \brief Change the sampling period
+     *
+     * \param [in] period_ms Period, between TELEMETRY_SAMPLER_PERIOD_MIN_MS and TELEMETRY_SAMPLER_PERIOD_MAX_MS
+     *
+     * \retval false if the period is out of range, in which case it is not changed
+     */
+    bool     SetPeriod( const uint32_t period_ms );
+    uint32_t GetPeriod( ) const;
+
+    uint32_t                    GetNbSamples( ) const;
+    const telemetry_sample_t&   GetLatest( ) const;
+    const telemetry_extremes_t& GetExtremes( ) const;
+
+    uint8_t GetHistoryCount( ) const;
+
+    /*!
+     * \brief Get a sample of the history
+     *
+     * \param [in] index Index of the sample, 0 being the oldest one
+     *
+     * \retval The sample, or NULL if index is not lower than GetHistoryCount
+     */
+    const telemetry_sample_t* GetHistoryEntry( const uint8_t index ) const;
+
+   protected:
+    void            AddSample( const telemetry_sample_t& sample );
+    static uint16_t ConvertVbatToMv( const uint8_t vbat );
+    static int16_t  ConvertTemperatureToDc( const uint16_t temperature );
+
+   private:
+    DeviceBase*          device;
+    uint32_t             period_ms;
+    bool                 has_attempted;
+    uint32_t             last_attempt_ms;
+    uint32_t             nb_samples;
+    telemetry_sample_t   history[TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES];
+    uint8_t              history_next_index;
+    telemetry_sample_t   latest;
+    telemetry_extremes_t extremes;
+};
+
+#endif  // __TELEMETRY_SAMPLER_H__
@@ -0,0 +1,31 @@
+#ifndef __TELEMETRY_SAMPLER_TYPES_H__
+#define __TELEMETRY_SAMPLER_TYPES_H__
+
+#include <stdint.h>
+
+#define TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES ( 32 )
+
+/*!
+ * \brief Supply voltage and temperature measured by the LR1110
+ *
+ * All the fields are 0 until the first sample is taken.
+ */
+typedef struct
+{
+    uint32_t local_instant_ms;
+    uint16_t vbat_mv;
+    int16_t  temperature_dc;  //!< Temperature in tenths of degree Celsius
+} telemetry_sample_t;
+
+/*!
+ * \brief Extreme values of all the samples taken since the start
+ */
+typedef struct
+{
+    uint16_t vbat_min_mv;
+    uint16_t vbat_max_mv;
+    int16_t  temperature_min_dc;
+    int16_t  temperature_max_dc;
+} telemetry_extremes_t;
+
+#endif  // __TELEMETRY_SAMPLER_TYPES_H__
@@ -40,15 +40,19 @@ Demo::Demo( DeviceTransceiver* device, EnvironmentInterface* environment, Antenn
       timer( timer ),
       running_demo( NULL ),
       demo_type_current( DEMO_TYPE_NONE ),
-      communication_interface( communication_interface )
+      communication_interface( communication_interface ),
+      entropy_pool( NULL ),
+      wifi_ap_table( environment )
 {
-    this->demo_wifi_settings_default.channels     = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
-    this->demo_wifi_settings_default.types        = DEMO_WIFI_TYPE_SCAN_DEFAULT;
-    this->demo_wifi_settings_default.scan_mode    = DEMO_WIFI_MODE_DEFAULT;
-    this->demo_wifi_settings_default.nbr_retrials = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
-    this->demo_wifi_settings_default.max_results  = DEMO_WIFI_MAX_RESULTS_DEFAULT;
-    this->demo_wifi_settings_default.timeout      = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
-    this->demo_wifi_settings_default.result_type  = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_wifi_settings_default.channels       = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
+    this->demo_wifi_settings_default.types          = DEMO_WIFI_TYPE_SCAN_DEFAULT;
+    this->demo_wifi_settings_default.scan_mode      = DEMO_WIFI_MODE_DEFAULT;
+    this->demo_wifi_settings_default.nbr_retrials   = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
+    this->demo_wifi_settings_default.max_results    = DEMO_WIFI_MAX_RESULTS_DEFAULT;
+    this->demo_wifi_settings_default.timeout        = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
+    this->demo_wifi_settings_default.result_type    = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_wifi_settings_default.is_adaptive    = DEMO_WIFI_IS_ADAPTIVE_DEFAULT;
+    this->demo_wifi_settings_default.time_budget_ms = DEMO_WIFI_TIME_BUDGET_IN_MS_DEFAULT;
 
     this->demo_wifi_country_code_settings_default.channels              = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
     this->demo_wifi_country_code_settings_default.nbr_retrials          = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
@@ -56,17 +60,26 @@ Demo::Demo( DeviceTransceiver* device, EnvironmentInterface* environment, Antenn
     this->demo_wifi_country_code_settings_default.timeout               = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
     this->demo_wifi_country_code_settings_default.does_abort_on_timeout = DEMO_WIFI_DOES_ABORT_ON_TIMEOUT_DEFAULT;
 
-    this->demo_gnss_autonomous_settings_default.option             = DEMO_GNSS_AUTONOMOUS_OPTION_DEFAULT;
-    this->demo_gnss_autonomous_settings_default.capture_mode       = DEMO_GNSS_AUTONOMOUS_CAPTURE_MODE_DEFAULT;
-    this->demo_gnss_autonomous_settings_default.nb_satellites      = DEMO_GNSS_AUTONOMOUS_N_SATELLLITE_DEFAULT;
-    this->demo_gnss_autonomous_settings_default.antenna_selection  = DEMO_GNSS_AUTONOMOUS_ANTENNA_SELECTION_DEFAULT;
-    this->demo_gnss_autonomous_settings_default.constellation_mask = DEMO_GNSS_AUTONOMOUS_CONSTELLATION_MASK_DEFAULT;
-
-    this->demo_gnss_assisted_settings_default.option             = DEMO_GNSS_ASSISTED_OPTION_DEFAULT;
-    this->demo_gnss_assisted_settings_default.capture_mode       = DEMO_GNSS_ASSISTED_CAPTURE_MODE_DEFAULT;
-    this->demo_gnss_assisted_settings_default.nb_satellites      = DEMO_GNSS_ASSISTED_N_SATELLLITE_DEFAULT;
-    this->demo_gnss_assisted_settings_default.antenna_selection  = DEMO_GNSS_ASSISTED_ANTENNA_SELECTION_DEFAULT;
-    this->demo_gnss_assisted_settings_default.constellation_mask = DEMO_GNSS_ASSISTED_CONSTELLATION_MASK_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.option               = DEMO_GNSS_AUTONOMOUS_OPTION_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.capture_mode         = DEMO_GNSS_AUTONOMOUS_CAPTURE_MODE_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.nb_satellites        = DEMO_GNSS_AUTONOMOUS_N_SATELLLITE_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.antenna_selection    = DEMO_GNSS_AUTONOMOUS_ANTENNA_SELECTION_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.constellation_mask   = DEMO_GNSS_AUTONOMOUS_CONSTELLATION_MASK_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.dual_scan_skip_nb_sv = DEMO_GNSS_DUAL_SCAN_SKIP_NB_SV_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.dual_scan_cnr_min    = DEMO_GNSS_DUAL_SCAN_CNR_MIN_DEFAULT;
+    this->demo_gnss_autonomous_settings_default.dual_scan_min_sv     = DEMO_GNSS_DUAL_SCAN_MIN_SV_DEFAULT;
+
+    this->demo_gnss_assisted_settings_default.option               = DEMO_GNSS_ASSISTED_OPTION_DEFAULT;
+    this->demo_gnss_assisted_settings_default.capture_mode         = DEMO_GNSS_ASSISTED_CAPTURE_MODE_DEFAULT;
+    this->demo_gnss_assisted_settings_default.nb_satellites        = DEMO_GNSS_ASSISTED_N_SATELLLITE_DEFAULT;
+    this->demo_gnss_assisted_settings_default.antenna_selection    = DEMO_GNSS_ASSISTED_ANTENNA_SELECTION_DEFAULT;
+    this->demo_gnss_assisted_settings_default.constellation_mask   = DEMO_GNSS_ASSISTED_CONSTELLATION_MASK_DEFAULT;
+    this->demo_gnss_assisted_settings_default.dual_scan_skip_nb_sv = DEMO_GNSS_DUAL_SCAN_SKIP_NB_SV_DEFAULT;
+    this->demo_gnss_assisted_settings_default.dual_scan_cnr_min    = DEMO_GNSS_DUAL_SCAN_CNR_MIN_DEFAULT;
+    this->demo_gnss_assisted_settings_default.dual_scan_min_sv     = DEMO_GNSS_DUAL_SCAN_MIN_SV_DEFAULT;
+
+    this->demo_gnss_scheduler_settings_default.scan_type  = DEMO_GNSS_SCHEDULER_SCAN_TYPE_DEFAULT;
+    this->demo_gnss_scheduler_settings_default.interval_s = DEMO_GNSS_SCHEDULER_INTERVAL_S_DEFAULT;
 
     this->demo_radio_settings_default.rf_frequency                      = DEMO_RADIO_RF_FREQUENCY_DEFAULT;
     this->demo_radio_settings_default.tx_power                          = DEMO_RADIO_TX_POWER_DEFAULT;
@@ -97,6 +110,30 @@ Demo::Demo( DeviceTransceiver* device, EnvironmentInterface* environment, Antenn
     this->demo_radio_settings_default.packet_gfsk.preamble_detector     = DEMO_RADIO_GFSK_PBL_DETECT_DEFAULT;
     this->demo_radio_settings_default.packet_gfsk.preamble_len_in_bits  = DEMO_RADIO_GFSK_PBL_LENGTH_DEFAULT;
     this->demo_radio_settings_default.packet_gfsk.sync_word_len_in_bits = DEMO_RADIO_GFSK_SW_LENGTH_DEFAULT;
+
+    this->demo_radio_spectrum_settings_default.start_frequency_hz = DEMO_RADIO_SPECTRUM_START_FREQUENCY_DEFAULT;
+    this->demo_radio_spectrum_settings_default.stop_frequency_hz  = DEMO_RADIO_SPECTRUM_STOP_FREQUENCY_DEFAULT;
+    this->demo_radio_spectrum_settings_default.step_hz            = DEMO_RADIO_SPECTRUM_STEP_DEFAULT;
+    this->demo_radio_spectrum_settings_default.nb_samples         = DEMO_RADIO_SPECTRUM_NB_SAMPLES_DEFAULT;
+    this->demo_radio_spectrum_settings_default.nb_sweeps          = DEMO_RADIO_SPECTRUM_NB_SWEEPS_DEFAULT;
+
+    this->demo_radio_cad_settings_default.sf_mask            = DEMO_RADIO_CAD_SF_MASK_DEFAULT;
+    this->demo_radio_cad_settings_default.bw                 = DEMO_RADIO_CAD_BW_DEFAULT;
+    this->demo_radio_cad_settings_default.start_frequency_hz = DEMO_RADIO_CAD_START_FREQUENCY_DEFAULT;
+    this->demo_radio_cad_settings_default.channel_spacing_hz = DEMO_RADIO_CAD_CHANNEL_SPACING_DEFAULT;
+    this->demo_radio_cad_settings_default.nb_channels        = DEMO_RADIO_CAD_NB_CHANNELS_DEFAULT;
+    this->demo_radio_cad_settings_default.period_ms          = DEMO_RADIO_CAD_PERIOD_MS_DEFAULT;
+    this->demo_radio_cad_settings_default.cad_symb_nb        = DEMO_RADIO_CAD_SYMB_NB_DEFAULT;
+    this->demo_radio_cad_settings_default.cad_detect_peak    = DEMO_RADIO_CAD_DETECT_PEAK_DEFAULT;
+    this->demo_radio_cad_settings_default.cad_detect_min     = DEMO_RADIO_CAD_DETECT_MIN_DEFAULT;
+    this->demo_radio_cad_settings_default.nb_cads            = DEMO_RADIO_CAD_NB_CADS_DEFAULT;
+
+    this->demo_radio_per_rx_settings_default.rx_period_ms    = DEMO_RADIO_PER_RX_PERIOD_MS_DEFAULT;
+    this->demo_radio_per_rx_settings_default.sleep_period_ms = DEMO_RADIO_PER_SLEEP_PERIOD_MS_DEFAULT;
+
+    this->demo_ping_pong_settings_default.timing              = DEMO_PING_PONG_TIMING_DEFAULT;
+    this->demo_ping_pong_settings_default.turnaround_delay_ms = DEMO_PING_PONG_TURNAROUND_DELAY_MS_DEFAULT;
+    this->demo_ping_pong_settings_default.guard_delay_ms      = DEMO_PING_PONG_GUARD_DELAY_MS_DEFAULT;
 }
 
 Demo::~Demo( ) {}
@@ -107,12 +144,17 @@ void Demo::Init( )
     this->SetConfigToDefault( DEMO_TYPE_WIFI_COUNTRY_CODE );
     this->SetConfigToDefault( DEMO_TYPE_GNSS_AUTONOMOUS );
     this->SetConfigToDefault( DEMO_TYPE_GNSS_ASSISTED );
+    this->SetConfigToDefault( DEMO_TYPE_GNSS_SCHEDULER );
     this->SetConfigToDefault( DEMO_TYPE_RADIO_PING_PONG );
     this->SetConfigToDefault( DEMO_TYPE_RADIO_PER_TX );
     this->SetConfigToDefault( DEMO_TYPE_RADIO_PER_RX );
     this->SetConfigToDefault( DEMO_TYPE_TX_CW );
+    this->SetConfigToDefault( DEMO_TYPE_RADIO_SPECTRUM );
+    this->SetConfigToDefault( DEMO_TYPE_RADIO_CAD );
 }
 
+void Demo::SetEntropyPool( EntropyPool* entropy_pool ) { this->entropy_pool = entropy_pool; }
+
 void Demo::SetConfigToDefault( demo_type_t demo_type )
 {
     switch( demo_type )
@@ -141,14 +183,39 @@ void Demo::SetConfigToDefault( demo_type_t demo_type )
         this->demo_gnss_assisted_settings = this->demo_gnss_assisted_settings_default;
         break;
     }
-    case DEMO_TYPE_RADIO_PING_PONG:
+    case DEMO_TYPE_GNSS_SCHEDULER:
+    {
+        this->demo_gnss_scheduler_settings = this->demo_gnss_scheduler_settings_default;
+        break;
+    }
     case DEMO_TYPE_RADIO_PER_TX:
-    case DEMO_TYPE_RADIO_PER_RX:
     case DEMO_TYPE_TX_CW:
     {
         this->demo_radio_settings = this->demo_radio_settings_default;
         break;
     }
+    case DEMO_TYPE_RADIO_PING_PONG:
+    {
+        this->demo_radio_settings     = this->demo_radio_settings_default;
+        this->demo_ping_pong_settings = this->demo_ping_pong_settings_default;
+        break;
+    }
+    case DEMO_TYPE_RADIO_PER_RX:
+    {
+        this->demo_radio_settings        = this->demo_radio_settings_default;
+        this->demo_radio_per_rx_settings = this->demo_radio_per_rx_settings_default;
+        break;
+    }
+    case DEMO_TYPE_RADIO_SPECTRUM:
+    {
+        this->demo_radio_spectrum_settings = this->demo_radio_spectrum_settings_default;
+        break;
+    }
+    case DEMO_TYPE_RADIO_CAD:
+    {
+        this->demo_radio_cad_settings = this->demo_radio_cad_settings_default;
+        break;
+    }
     default:
         break;
     }
@@ -160,7 +227,12 @@ void Demo::GetConfigDefault( demo_all_settings_t* settings )
     settings->wifi_country_code_settings = this->demo_wifi_country_code_settings_default;
     settings->gnss_autonomous_settings   = this->demo_gnss_autonomous_settings_default;
     settings->gnss_assisted_settings     = this->demo_gnss_assisted_settings_default;
+    settings->gnss_scheduler_settings    = this->demo_gnss_scheduler_settings_default;
     settings->radio_settings             = this->demo_radio_settings_default;
+    settings->radio_spectrum_settings    = this->demo_radio_spectrum_settings_default;
+    settings->radio_cad_settings         = this->demo_radio_cad_settings_default;
+    settings->radio_per_rx_settings      = this->demo_radio_per_rx_settings_default;
+    settings->ping_pong_settings         = this->demo_ping_pong_settings_default;
 }
 
 void Demo::GetConfig( demo_all_settings_t* settings )
@@ -169,7 +241,12 @@ void Demo::GetConfig( demo_all_settings_t* settings )
     settings->wifi_country_code_settings = this->demo_wifi_country_code_settings;
     settings->gnss_autonomous_settings   = this->demo_gnss_autonomous_settings;
     settings->gnss_assisted_settings     = this->demo_gnss_assisted_settings;
+    settings->gnss_scheduler_settings    = this->demo_gnss_scheduler_settings;
     settings->radio_settings             = this->demo_radio_settings;
+    settings->radio_spectrum_settings    = this->demo_radio_spectrum_settings;
+    settings->radio_cad_settings         = this->demo_radio_cad_settings;
+    settings->radio_per_rx_settings      = this->demo_radio_per_rx_settings;
+    settings->ping_pong_settings         = this->demo_ping_pong_settings;
 }
 
 void Demo::GetConfigRadio( demo_radio_settings_t* settings ) { *settings = this->demo_radio_settings; }
@@ -183,8 +260,47 @@ void Demo::GetConfigAutonomousGnss( demo_gnss_settings_t* settings )
 
 void Demo::GetConfigAssistedGnss( demo_gnss_settings_t* settings ) { *settings = this->demo_gnss_assisted_settings; }
 
+void Demo::GetConfigGnssScheduler( demo_gnss_scheduler_settings_t* settings )
+{
+    *settings = this->demo_gnss_scheduler_settings;
+}
+
+void Demo::GetConfigRadioSpectrum( demo_radio_spectrum_settings_t* settings )
+{
+    *settings = this->demo_radio_spectrum_settings;
+}
+
+void Demo::GetConfigRadioCad( demo_radio_cad_settings_t* settings ) { *settings = this->demo_radio_cad_settings; }
+
+void Demo::GetConfigRadioPerRx( demo_radio_per_rx_settings_t* settings )
+{
+    *settings = this->demo_radio_per_rx_settings;
+}
+
+void Demo::GetConfigPingPong( demo_ping_pong_settings_t* settings ) { *settings = this->demo_ping_pong_settings; }
+
 void Demo::UpdateConfigRadio( demo_radio_settings_t* radio_config ) { this->demo_radio_settings = *radio_config; }
 
+void Demo::UpdateConfigRadioSpectrum( const demo_radio_spectrum_settings_t* radio_spectrum_config )
+{
+    this->demo_radio_spectrum_settings = *radio_spectrum_config;
+}
+
+void Demo::UpdateConfigRadioCad( const demo_radio_cad_settings_t* radio_cad_config )
+{
+    this->demo_radio_cad_settings = *radio_cad_config;
+}
+
+void Demo::UpdateConfigRadioPerRx( const demo_radio_per_rx_settings_t* radio_per_rx_config )
+{
+    this->demo_radio_per_rx_settings = *radio_per_rx_config;
+}
+
+void Demo::UpdateConfigPingPong( const demo_ping_pong_settings_t* ping_pong_config )
+{
+    this->demo_ping_pong_settings = *ping_pong_config;
+}
+
 void Demo::UpdateConfigWifiScan( const demo_wifi_settings_t* wifi_config ) { this->demo_wifi_settings = *wifi_config; }
 
 void Demo::UpdateConfigWifiCountryCode( const demo_wifi_country_code_settings_t* wifi_config )
@@ -192,6 +308,16 @@ void Demo::UpdateConfigWifiCountryCode( const demo_wifi_country_code_settings_t*
     this->demo_wifi_country_code_settings = *wifi_config;
 }
 
+void Demo::GetConfigConsumptionModel( demo_consumption_model_settings_t* coefficients ) const
+{
+    this->consumption_model.GetCoefficients( coefficients );
+}
+
+void Demo::UpdateConfigConsumptionModel( const demo_consumption_model_settings_t* coefficients )
+{
+    this->consumption_model.SetCoefficients( coefficients );
+}
+
 void Demo::UpdateConfigAutonomousGnss( const demo_gnss_settings_t* gnss_autonomous_config )
 {
     this->demo_gnss_autonomous_settings = *gnss_autonomous_config;
@@ -202,6 +328,11 @@ void Demo::UpdateConfigAssistedGnss( const demo_gnss_settings_t* gnss_assisted_c
     this->demo_gnss_assisted_settings = *gnss_assisted_config;
 }
 
+void Demo::UpdateConfigGnssScheduler( const demo_gnss_scheduler_settings_t* gnss_scheduler_config )
+{
+    this->demo_gnss_scheduler_settings = *gnss_scheduler_config;
+}
+
 void Demo::Start( demo_type_t demo_type )
 {
     if( demo_type != this->demo_type_current )
@@ -225,6 +356,10 @@ void Demo::Start( demo_type_t demo_type )
             this->running_demo = new DemoGnssAssisted( device, signaling, environment, antenna_selector, timer,
                                                        this->communication_interface );
             break;
+        case DEMO_TYPE_GNSS_SCHEDULER:
+            this->running_demo = new DemoGnssScheduler( device, signaling, environment, antenna_selector, timer,
+                                                        this->communication_interface );
+            break;
         case DEMO_TYPE_RADIO_PING_PONG:
             this->running_demo = new DemoPingPong( device, signaling, environment, this->communication_interface );
             break;
@@ -239,10 +374,21 @@ void Demo::Start( demo_type_t demo_type )
             this->running_demo = new DemoRadioPer( device, signaling, environment, this->communication_interface,
                                                    DEMO_RADIO_PER_MODE_RX );
             break;
+        case DEMO_TYPE_RADIO_SPECTRUM:
+            this->running_demo = new DemoRadioSpectrum( device, signaling, environment, this->communication_interface );
+            break;
+        case DEMO_TYPE_RADIO_CAD:
+            this->running_demo = new DemoRadioCad( device, signaling, environment, this->communication_interface );
+            break;
         default:
             break;
         }
 
+        // The access points aggregated by a previous Wi-Fi demo are not relevant anymore
+        this->wifi_ap_table.Clear( );
+        this->wifi_channel_stats.Clear( );
+        this->wifi_adaptive_scan.Clear( );
+
         this->demo_type_current = demo_type;
     }
 
@@ -253,22 +399,55 @@ void Demo::Start( demo_type_t demo_type )
     {
     case DEMO_TYPE_WIFI:
         ( ( DemoWifiScan* ) this->running_demo )->Configure( this->demo_wifi_settings );
+        ( ( DemoWifiScan* ) this->running_demo )->SetApTable( &this->wifi_ap_table );
+        ( ( DemoWifiScan* ) this->running_demo )->SetChannelStats( &this->wifi_channel_stats );
+        ( ( DemoWifiScan* ) this->running_demo )->SetAdaptiveScan( &this->wifi_adaptive_scan );
+        ( ( DemoWifiScan* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
         break;
     case DEMO_TYPE_WIFI_COUNTRY_CODE:
         ( ( DemoWifiCountryCode* ) this->running_demo )->Configure( this->demo_wifi_country_code_settings );
+        ( ( DemoWifiCountryCode* ) this->running_demo )->SetApTable( &this->wifi_ap_table );
+        ( ( DemoWifiCountryCode* ) this->running_demo )->SetChannelStats( &this->wifi_channel_stats );
+        ( ( DemoWifiCountryCode* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
         break;
     case DEMO_TYPE_GNSS_AUTONOMOUS:
         ( ( DemoGnssAutonomous* ) this->running_demo )->Configure( this->demo_gnss_autonomous_settings );
+        ( ( DemoGnssAutonomous* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
         break;
     case DEMO_TYPE_GNSS_ASSISTED:
         ( ( DemoGnssAssisted* ) this->running_demo )->Configure( this->demo_gnss_assisted_settings );
+        ( ( DemoGnssAssisted* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
+        break;
+    case DEMO_TYPE_GNSS_SCHEDULER:
+        ( ( DemoGnssScheduler* ) this->running_demo )
+            ->Configure( this->demo_gnss_scheduler_settings,
+                         ( this->demo_gnss_scheduler_settings.scan_type == DEMO_GNSS_SCHEDULER_SCAN_ASSISTED )
+                             ? this->demo_gnss_assisted_settings
+                             : this->demo_gnss_autonomous_settings );
+        ( ( DemoGnssScheduler* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
+        ( ( DemoGnssScheduler* ) this->running_demo )->SetEntropyPool( this->entropy_pool );
         break;
-    case DEMO_TYPE_RADIO_PING_PONG:
     case DEMO_TYPE_RADIO_PER_TX:
-    case DEMO_TYPE_RADIO_PER_RX:
     case DEMO_TYPE_TX_CW:
         ( ( DemoRadioInterface* ) this->running_demo )->Configure( this->demo_radio_settings );
         break;
+    case DEMO_TYPE_RADIO_PING_PONG:
+        ( ( DemoPingPong* ) this->running_demo )->Configure( this->demo_radio_settings );
+        ( ( DemoPingPong* ) this->running_demo )->ConfigureTiming( this->demo_ping_pong_settings );
+        break;
+    case DEMO_TYPE_RADIO_PER_RX:
+        ( ( DemoRadioPer* ) this->running_demo )->Configure( this->demo_radio_settings );
+        ( ( DemoRadioPer* ) this->running_demo )->ConfigureRx( this->demo_radio_per_rx_settings );
+        ( ( DemoRadioPer* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
+        break;
+    case DEMO_TYPE_RADIO_SPECTRUM:
+        ( ( DemoRadioSpectrum* ) this->running_demo )->Configure( this->demo_radio_spectrum_settings );
+        break;
+    case DEMO_TYPE_RADIO_CAD:
+        ( ( DemoRadioCad* ) this->running_demo )->Configure( this->demo_radio_settings );
+        ( ( DemoRadioCad* ) this->running_demo )->ConfigureCad( this->demo_radio_cad_settings );
+        ( ( DemoRadioCad* ) this->running_demo )->SetConsumptionModel( &this->consumption_model );
+        break;
     default:
         break;
     }
@@ -290,6 +469,9 @@ void Demo::Reset( )
     {
         this->running_demo->Reset( );
     }
+    this->wifi_ap_table.Clear( );
+    this->wifi_channel_stats.Clear( );
+    this->wifi_adaptive_scan.Clear( );
 }
 
 bool Demo::HasIntermediateResults( ) const
@@ -304,6 +486,10 @@ bool Demo::HasIntermediateResults( ) const
     }
 }
 
+bool Demo::IsRunning( ) const { return ( this->running_demo != NULL ) && this->running_demo->IsStarted( ); }
+
+bool Demo::IsRadioIdle( ) const { return ( this->IsRunning( ) == false ) || this->running_demo->IsRadioIdle( ); }
+
 demo_status_t Demo::Runtime( ) { return this->running_demo->Runtime( ); }
 
 demo_type_t Demo::GetType( ) { return this->demo_type_current; }
@@ -320,12 +506,48 @@ void* Demo::GetResults( )
         return ( void* ) ( ( DemoGnssAutonomous* ) this->running_demo )->GetResult( );
     case DEMO_TYPE_GNSS_ASSISTED:
         return ( void* ) ( ( DemoGnssAssisted* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_GNSS_SCHEDULER:
+        return ( void* ) ( ( DemoGnssScheduler* ) this->running_demo )->GetResult( );
     case DEMO_TYPE_RADIO_PING_PONG:
         return ( void* ) ( ( DemoPingPong* ) this->running_demo )->GetResult( );
     case DEMO_TYPE_RADIO_PER_TX:
     case DEMO_TYPE_RADIO_PER_RX:
         return ( void* ) ( ( DemoRadioPer* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_RADIO_SPECTRUM:
+        return ( void* ) ( ( DemoRadioSpectrum* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_RADIO_CAD:
+        return ( void* ) ( ( DemoRadioCad* ) this->running_demo )->GetResult( );
     default:
         return NULL;
     }
 }
+
+const DemoWifiApTable* Demo::GetWifiApTable( ) const { return &this->wifi_ap_table; }
+
+const DemoWifiChannelStats* Demo::GetWifiChannelStats( ) const { return &this->wifi_channel_stats; }
+
+void Demo::ClearWifiChannelStats( ) { this->wifi_channel_stats.Clear( ); }
+
+uint8_t Demo::GetGnssHistoryCount( ) const
+{
+    if( this->demo_type_current == DEMO_TYPE_GNSS_SCHEDULER )
+    {
+        return ( ( DemoGnssScheduler* ) this->running_demo )->GetHistoryCount( );
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+const demo_gnss_nav_history_entry_t* Demo::GetGnssHistoryEntry( const uint8_t index ) const
+{
+    if( this->demo_type_current == DEMO_TYPE_GNSS_SCHEDULER )
+    {
+        return ( ( DemoGnssScheduler* ) this->running_demo )->GetHistoryEntry( index );
+    }
+    else
+    {
+        return NULL;
+    }
+}
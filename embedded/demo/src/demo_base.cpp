@@ -56,6 +56,8 @@ void DemoBase::ResetAndInitLr1110( ) { this->device->ResetAndInit( ); }
 
 bool DemoBase::HasIntermediateResults( ) const { return false; }
 
+bool DemoBase::IsRadioIdle( ) const { return false; }
+
 DemoBase::~DemoBase( ) {}
 
 void DemoBase::Initialize( )
@@ -0,0 +1,142 @@
+/**
+ * @file      demo_consumption_model.cpp
+ *
+ * @brief     Consumption model of the LR1110 scans
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_consumption_model.h"
+
+DemoConsumptionModel::DemoConsumptionModel( ) { this->SetToDefault( ); }
+
+DemoConsumptionModel::~DemoConsumptionModel( ) {}
+
+void DemoConsumptionModel::SetToDefault( )
+{
+    this->coefficients.wifi_dcdc_detection_ua    = DEMO_CONSUMPTION_WIFI_DCDC_DETECTION_UA_DEFAULT;
+    this->coefficients.wifi_dcdc_correlation_ua  = DEMO_CONSUMPTION_WIFI_DCDC_CORRELATION_UA_DEFAULT;
+    this->coefficients.wifi_dcdc_capture_ua      = DEMO_CONSUMPTION_WIFI_DCDC_CAPTURE_UA_DEFAULT;
+    this->coefficients.wifi_dcdc_demodulation_ua = DEMO_CONSUMPTION_WIFI_DCDC_DEMODULATION_UA_DEFAULT;
+    this->coefficients.wifi_ldo_detection_ua     = DEMO_CONSUMPTION_WIFI_LDO_DETECTION_UA_DEFAULT;
+    this->coefficients.wifi_ldo_correlation_ua   = DEMO_CONSUMPTION_WIFI_LDO_CORRELATION_UA_DEFAULT;
+    this->coefficients.wifi_ldo_capture_ua       = DEMO_CONSUMPTION_WIFI_LDO_CAPTURE_UA_DEFAULT;
+    this->coefficients.wifi_ldo_demodulation_ua  = DEMO_CONSUMPTION_WIFI_LDO_DEMODULATION_UA_DEFAULT;
+    this->coefficients.gnss_dcdc_acquisition_ua  = DEMO_CONSUMPTION_GNSS_DCDC_ACQUISITION_UA_DEFAULT;
+    this->coefficients.gnss_dcdc_computation_ua  = DEMO_CONSUMPTION_GNSS_DCDC_COMPUTATION_UA_DEFAULT;
+    this->coefficients.radio_dcdc_cad_ua         = DEMO_CONSUMPTION_RADIO_DCDC_CAD_UA_DEFAULT;
+    this->coefficients.radio_dcdc_rx_ua          = DEMO_CONSUMPTION_RADIO_DCDC_RX_UA_DEFAULT;
+    this->coefficients.radio_sleep_ua            = DEMO_CONSUMPTION_RADIO_SLEEP_UA_DEFAULT;
+}
+
+void DemoConsumptionModel::GetCoefficients( demo_consumption_model_settings_t* coefficients ) const
+{
+    *coefficients = this->coefficients;
+}
+
+void DemoConsumptionModel::SetCoefficients( const demo_consumption_model_settings_t* coefficients )
+{
+    this->coefficients = *coefficients;
+}
+
+uint32_t DemoConsumptionModel::ComputeWifiEnergy( const lr1110_system_reg_mode_t          reg_mode,
+                                                  const lr1110_wifi_cumulative_timings_t& timings,
+                                                  demo_wifi_energy_t&                     energy ) const
+{
+    const bool is_ldo = ( reg_mode == LR1110_SYSTEM_REG_MODE_LDO );
+
+    energy.detection_uas = DemoConsumptionModel::ComputeCharge(
+        timings.rx_detection_us,
+        is_ldo ? this->coefficients.wifi_ldo_detection_ua : this->coefficients.wifi_dcdc_detection_ua );
+    energy.correlation_uas = DemoConsumptionModel::ComputeCharge(
+        timings.rx_correlation_us,
+        is_ldo ? this->coefficients.wifi_ldo_correlation_ua : this->coefficients.wifi_dcdc_correlation_ua );
+    energy.capture_uas = DemoConsumptionModel::ComputeCharge(
+        timings.rx_capture_us,
+        is_ldo ? this->coefficients.wifi_ldo_capture_ua : this->coefficients.wifi_dcdc_capture_ua );
+    energy.demodulation_uas = DemoConsumptionModel::ComputeCharge(
+        timings.demodulation_us,
+        is_ldo ? this->coefficients.wifi_ldo_demodulation_ua : this->coefficients.wifi_dcdc_demodulation_ua );
+
+    return energy.detection_uas + energy.correlation_uas + energy.capture_uas + energy.demodulation_uas;
+}
+
+uint32_t DemoConsumptionModel::ComputeGnssEnergy( const lr1110_gnss_timings_t& timings,
+                                                  demo_gnss_energy_t&          energy ) const
+{
+    energy.acquisition_uas =
+        DemoConsumptionModel::ComputeCharge( timings.radio_ms * 1000, this->coefficients.gnss_dcdc_acquisition_ua );
+    energy.computation_uas = DemoConsumptionModel::ComputeCharge( timings.computation_ms * 1000,
+                                                                  this->coefficients.gnss_dcdc_computation_ua );
+
+    return energy.acquisition_uas + energy.computation_uas;
+}
+
+uint32_t DemoConsumptionModel::ComputeRadioCadEnergy( const uint32_t cad_duration_us, const uint32_t rx_duration_us,
+                                                      demo_radio_cad_energy_t& energy ) const
+{
+    energy.cad_nas = DemoConsumptionModel::ComputeChargeNas( cad_duration_us, this->coefficients.radio_dcdc_cad_ua );
+    energy.rx_nas  = DemoConsumptionModel::ComputeChargeNas( rx_duration_us, this->coefficients.radio_dcdc_rx_ua );
+
+    return energy.cad_nas + energy.rx_nas;
+}
+
+uint32_t DemoConsumptionModel::ComputeRadioRxAverageCurrent( const uint32_t rx_period_ms,
+                                                             const uint32_t sleep_period_ms,
+                                                             const uint32_t listening_duration_ms,
+                                                             const uint32_t reception_duration_ms ) const
+{
+    const uint32_t rx_ua = this->coefficients.radio_dcdc_rx_ua;
+
+    if( ( sleep_period_ms == 0 ) || ( listening_duration_ms == 0 ) )
+    {
+        return rx_ua;
+    }
+
+    const uint32_t listening_ua =
+        ( uint32_t )( ( ( ( uint64_t ) rx_ua * rx_period_ms ) +
+                        ( ( uint64_t ) this->coefficients.radio_sleep_ua * sleep_period_ms ) ) /
+                      ( rx_period_ms + sleep_period_ms ) );
+
+    // The duty cycle is suspended while a packet is received
+    const uint32_t receiving_ms =
+        ( reception_duration_ms < listening_duration_ms ) ? reception_duration_ms : listening_duration_ms;
+    const uint64_t charge_ua_ms = ( ( uint64_t ) listening_ua * ( listening_duration_ms - receiving_ms ) ) +
+                                  ( ( uint64_t ) rx_ua * receiving_ms );
+
+    return ( uint32_t )( charge_ua_ms / listening_duration_ms );
+}
+
+uint32_t DemoConsumptionModel::ComputeCharge( const uint32_t duration_us, const uint32_t current_ua )
+{
+    // 64-bit intermediate: a few seconds at tens of milliampere overflow 32 bits when counted in us x uA
+    return ( uint32_t )( ( ( uint64_t ) duration_us * current_ua ) / 1000000 );
+}
+
+uint32_t DemoConsumptionModel::ComputeChargeNas( const uint32_t duration_us, const uint32_t current_ua )
+{
+    return ( uint32_t )( ( ( uint64_t ) duration_us * current_ua ) / 1000 );
+}
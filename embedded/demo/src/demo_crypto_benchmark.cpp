@@ -0,0 +1,214 @@
+/**
+ * @file      demo_crypto_benchmark.cpp
+ *
+ * @brief     Latency of the LR1110 crypto engine primitives, SPI transfers included
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "demo_crypto_benchmark.h"
+#include "lr1110_crypto_engine.h"
+#include "lr1110_regmem.h"
+#include "system_time.h"
+
+#define DEMO_CRYPTO_BENCHMARK_KEY_ID ( LR1110_CRYPTO_KEYS_IDX_GP0 )
+#define DEMO_CRYPTO_BENCHMARK_DERIVED_KEY_ID ( LR1110_CRYPTO_KEYS_IDX_GP1 )
+
+// Example key of the AES-CMAC specification (RFC 4493)
+static const lr1110_crypto_key_t demo_crypto_benchmark_key = {
+    0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C,
+};
+
+demo_crypto_benchmark_results_t DemoCryptoBenchmark::results;
+uint8_t                         DemoCryptoBenchmark::payload[DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX];
+uint8_t                         DemoCryptoBenchmark::output[DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX];
+lr1110_crypto_mic_t             DemoCryptoBenchmark::mic;
+
+DemoCryptoBenchmark::DemoCryptoBenchmark( DeviceBase* device ) : device( device )
+{
+    memset( &this->results, 0, sizeof( this->results ) );
+    memset( this->output, 0, sizeof( this->output ) );
+    memset( this->mic, 0, sizeof( this->mic ) );
+
+    for( uint16_t index = 0; index < DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX; index++ )
+    {
+        this->payload[index] = ( uint8_t ) index;
+    }
+}
+
+DemoCryptoBenchmark::~DemoCryptoBenchmark( ) {}
+
+bool DemoCryptoBenchmark::IsSettingsValid( const demo_crypto_benchmark_settings_t& settings )
+{
+    if( ( settings.nb_iterations == 0 ) || ( settings.nb_iterations > DEMO_CRYPTO_BENCHMARK_MAX_ITERATIONS ) ||
+        ( settings.nb_payload_sizes == 0 ) || ( settings.nb_payload_sizes > DEMO_CRYPTO_BENCHMARK_MAX_PAYLOAD_SIZES ) )
+    {
+        return false;
+    }
+
+    // AES encryption and decryption only process whole blocks
+    for( uint8_t index = 0; index < settings.nb_payload_sizes; index++ )
+    {
+        const uint16_t payload_size = settings.payload_sizes[index];
+
+        if( ( payload_size == 0 ) || ( payload_size > DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_MAX ) ||
+            ( ( payload_size % DEMO_CRYPTO_BENCHMARK_PAYLOAD_SIZE_STEP ) != 0 ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DemoCryptoBenchmark::Run( const demo_crypto_benchmark_settings_t& settings,
+                               const lr1110_crypto_element_t           element_to_restore )
+{
+    lr1110_crypto_status_t status;
+
+    this->results.nb_results = 0;
+
+    lr1110_crypto_select( this->device->GetRadio( ), LR1110_CRYPTO_ELEMENT_CRYPTO_ENGINE );
+    lr1110_crypto_set_key( this->device->GetRadio( ), &status, DEMO_CRYPTO_BENCHMARK_KEY_ID,
+                           demo_crypto_benchmark_key );
+
+    for( uint8_t index = 0; index < settings.nb_payload_sizes; index++ )
+    {
+        for( uint8_t primitive = DEMO_CRYPTO_BENCHMARK_SPI_REFERENCE; primitive < DEMO_CRYPTO_BENCHMARK_DERIVE_KEY;
+             primitive++ )
+        {
+            this->TimePrimitive( ( demo_crypto_benchmark_primitive_t ) primitive, settings.payload_sizes[index],
+                                 settings.nb_iterations );
+        }
+    }
+
+    this->TimePrimitive( DEMO_CRYPTO_BENCHMARK_DERIVE_KEY, LR1110_CRYPTO_NONCE_LENGTH, settings.nb_iterations );
+
+    if( element_to_restore != LR1110_CRYPTO_ELEMENT_CRYPTO_ENGINE )
+    {
+        lr1110_crypto_select( this->device->GetRadio( ), element_to_restore );
+    }
+}
+
+const demo_crypto_benchmark_results_t* DemoCryptoBenchmark::GetResults( ) const { return &this->results; }
+
+void DemoCryptoBenchmark::TimePrimitive( const demo_crypto_benchmark_primitive_t primitive,
+                                         const uint16_t payload_size, const uint16_t nb_iterations )
+{
+    demo_crypto_benchmark_result_t& result = this->results.results[this->results.nb_results];
+
+    result.primitive     = primitive;
+    result.payload_size  = payload_size;
+    result.nb_iterations = nb_iterations;
+    result.nb_errors     = 0;
+    result.min_us        = UINT32_MAX;
+    result.max_us        = 0;
+    result.total_us      = 0;
+
+    if( primitive == DEMO_CRYPTO_BENCHMARK_AES_CMAC_VERIFY )
+    {
+        // The MIC to verify is the one of the payload, so that the verification succeeds
+        this->CallPrimitive( DEMO_CRYPTO_BENCHMARK_AES_CMAC_COMPUTE, payload_size );
+    }
+
+    for( uint16_t iteration = 0; iteration < nb_iterations; iteration++ )
+    {
+        const uint32_t               start_cycles = system_time_GetCycleCounter( );
+        const lr1110_crypto_status_t status       = this->CallPrimitive( primitive, payload_size );
+        const uint32_t duration_us = system_time_CyclesToUs( system_time_GetCycleCounter( ) - start_cycles );
+
+        if( status != LR1110_CRYPTO_STATUS_SUCCESS )
+        {
+            result.nb_errors++;
+        }
+        if( duration_us < result.min_us )
+        {
+            result.min_us = duration_us;
+        }
+        if( duration_us > result.max_us )
+        {
+            result.max_us = duration_us;
+        }
+        result.total_us += duration_us;
+    }
+
+    this->results.nb_results++;
+}
+
+lr1110_crypto_status_t DemoCryptoBenchmark::CallPrimitive( const demo_crypto_benchmark_primitive_t primitive,
+                                                           const uint16_t                          payload_size )
+{
+    lr1110_crypto_status_t status = LR1110_CRYPTO_STATUS_SUCCESS;
+
+    switch( primitive )
+    {
+    case DEMO_CRYPTO_BENCHMARK_SPI_REFERENCE:
+    {
+        lr1110_regmem_write_buffer8( this->device->GetRadio( ), this->payload, ( uint8_t ) payload_size );
+        lr1110_regmem_read_buffer8( this->device->GetRadio( ), this->output, 0, ( uint8_t ) payload_size );
+        break;
+    }
+    case DEMO_CRYPTO_BENCHMARK_AES_ENCRYPT:
+    {
+        lr1110_crypto_aes_encrypt( this->device->GetRadio( ), &status, DEMO_CRYPTO_BENCHMARK_KEY_ID, this->payload,
+                                   payload_size, this->output );
+        break;
+    }
+    case DEMO_CRYPTO_BENCHMARK_AES_DECRYPT:
+    {
+        lr1110_crypto_aes_decrypt( this->device->GetRadio( ), &status, DEMO_CRYPTO_BENCHMARK_KEY_ID, this->payload,
+                                   payload_size, this->output );
+        break;
+    }
+    case DEMO_CRYPTO_BENCHMARK_AES_CMAC_COMPUTE:
+    {
+        lr1110_crypto_compute_aes_cmac( this->device->GetRadio( ), &status, DEMO_CRYPTO_BENCHMARK_KEY_ID,
+                                        this->payload, payload_size, this->mic );
+        break;
+    }
+    case DEMO_CRYPTO_BENCHMARK_AES_CMAC_VERIFY:
+    {
+        lr1110_crypto_verify_aes_cmac( this->device->GetRadio( ), &status, DEMO_CRYPTO_BENCHMARK_KEY_ID,
+                                       this->payload, payload_size, this->mic );
+        break;
+    }
+    case DEMO_CRYPTO_BENCHMARK_DERIVE_KEY:
+    {
+        // The first bytes of the payload are used as nonce
+        lr1110_crypto_derive_key( this->device->GetRadio( ), &status, DEMO_CRYPTO_BENCHMARK_KEY_ID,
+                                  DEMO_CRYPTO_BENCHMARK_DERIVED_KEY_ID, this->payload );
+        break;
+    }
+    default:
+    {
+        status = LR1110_CRYPTO_STATUS_ERROR;
+        break;
+    }
+    }
+
+    return status;
+}
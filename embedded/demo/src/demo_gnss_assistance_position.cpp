@@ -0,0 +1,161 @@
+/**
+ * @file      demo_gnss_assistance_position.cpp
+ *
+ * @brief     Implementation of the manager of the GNSS assistance position.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "demo_gnss_assistance_position.h"
+
+#define DEMO_GNSS_ASSISTANCE_POSITION_DRIFT_M_PER_S ( 1 )
+#define DEMO_GNSS_ASSISTANCE_POSITION_MAX_UNCERTAINTY_M ( 100000 )
+#define DEMO_GNSS_ASSISTANCE_POSITION_MAX_AGE_S ( 12 * 3600 )
+#define DEMO_GNSS_ASSISTANCE_POSITION_HOST_UNCERTAINTY_M ( 10000 )
+#define DEMO_GNSS_ASSISTANCE_POSITION_MANUAL_UNCERTAINTY_M ( 1000 )
+#define DEMO_GNSS_ASSISTANCE_POSITION_SOLVE_UNCERTAINTY_M ( 100 )
+
+DemoGnssAssistancePosition::DemoGnssAssistancePosition( ) { this->Clear( ); }
+
+DemoGnssAssistancePosition::~DemoGnssAssistancePosition( ) {}
+
+void DemoGnssAssistancePosition::Clear( )
+{
+    memset( this->positions, 0, sizeof( this->positions ) );
+    memset( this->is_valid, 0, sizeof( this->is_valid ) );
+}
+
+void DemoGnssAssistancePosition::Update( const environment_location_t& location,
+                                         const demo_gnss_assistance_position_source_t source,
+                                         const uint32_t uncertainty_m, const time_t now_s )
+{
+    if( source >= DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES )
+    {
+        return;
+    }
+
+    demo_gnss_assistance_position_t& position = this->positions[source];
+
+    position.location      = location;
+    position.source        = source;
+    position.timestamp_s   = now_s;
+    position.uncertainty_m = ( uncertainty_m != 0 ) ? uncertainty_m : GetDefaultUncertainty( source );
+
+    this->is_valid[source] = true;
+}
+
+bool DemoGnssAssistancePosition::GetBest( const time_t now_s, demo_gnss_assistance_position_t& position ) const
+{
+    bool     found            = false;
+    bool     found_fresh      = false;
+    uint32_t best_uncertainty = 0;
+
+    for( uint8_t index = 0; index < DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES; index++ )
+    {
+        if( this->is_valid[index] == false )
+        {
+            continue;
+        }
+
+        const bool     is_fresh    = IsFresh( this->positions[index], now_s );
+        const uint32_t uncertainty = GetCurrentUncertainty( this->positions[index], now_s );
+
+        // A fresh position always wins over a stale one. On equal uncertainty, the most recent position wins
+        const bool is_better =
+            ( uncertainty < best_uncertainty ) ||
+            ( ( uncertainty == best_uncertainty ) && ( this->positions[index].timestamp_s > position.timestamp_s ) );
+        if( ( found == false ) || ( is_fresh && !found_fresh ) || ( ( is_fresh == found_fresh ) && is_better ) )
+        {
+            position               = this->positions[index];
+            position.uncertainty_m = uncertainty;
+            best_uncertainty       = uncertainty;
+            found                  = true;
+            found_fresh            = is_fresh;
+        }
+    }
+
+    return found;
+}
+
+bool DemoGnssAssistancePosition::HasPosition( ) const
+{
+    for( uint8_t index = 0; index < DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES; index++ )
+    {
+        if( this->is_valid[index] == true )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool DemoGnssAssistancePosition::HasFreshPosition( const time_t now_s ) const
+{
+    for( uint8_t index = 0; index < DEMO_GNSS_ASSISTANCE_POSITION_NB_SOURCES; index++ )
+    {
+        if( ( this->is_valid[index] == true ) && IsFresh( this->positions[index], now_s ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t DemoGnssAssistancePosition::GetDefaultUncertainty( const demo_gnss_assistance_position_source_t source )
+{
+    switch( source )
+    {
+    case DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_HOST:
+        return DEMO_GNSS_ASSISTANCE_POSITION_HOST_UNCERTAINTY_M;
+    case DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_MANUAL:
+        return DEMO_GNSS_ASSISTANCE_POSITION_MANUAL_UNCERTAINTY_M;
+    case DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_SOLVE:
+        return DEMO_GNSS_ASSISTANCE_POSITION_SOLVE_UNCERTAINTY_M;
+    default:
+        return DEMO_GNSS_ASSISTANCE_POSITION_MAX_UNCERTAINTY_M;
+    }
+}
+
+uint32_t DemoGnssAssistancePosition::GetCurrentUncertainty( const demo_gnss_assistance_position_t& position,
+                                                            const time_t                           now_s )
+{
+    const uint32_t age_s = ( now_s > position.timestamp_s ) ? ( uint32_t )( now_s - position.timestamp_s ) : 0;
+    const uint64_t uncertainty_m =
+        ( uint64_t ) position.uncertainty_m + ( uint64_t ) age_s * DEMO_GNSS_ASSISTANCE_POSITION_DRIFT_M_PER_S;
+
+    return ( uncertainty_m < UINT32_MAX ) ? ( uint32_t ) uncertainty_m : UINT32_MAX;
+}
+
+bool DemoGnssAssistancePosition::IsFresh( const demo_gnss_assistance_position_t& position, const time_t now_s )
+{
+    const uint32_t age_s = ( now_s > position.timestamp_s ) ? ( uint32_t )( now_s - position.timestamp_s ) : 0;
+
+    return ( age_s <= DEMO_GNSS_ASSISTANCE_POSITION_MAX_AGE_S ) &&
+           ( GetCurrentUncertainty( position, now_s ) <= DEMO_GNSS_ASSISTANCE_POSITION_MAX_UNCERTAINTY_M );
+}
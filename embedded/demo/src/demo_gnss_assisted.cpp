@@ -42,12 +42,20 @@ DemoGnssAssisted::DemoGnssAssisted( DeviceTransceiver* device, SignalingInterfac
 
 DemoGnssAssisted::~DemoGnssAssisted( ) {}
 
-void DemoGnssAssisted::CallScan( )
+bool DemoGnssAssisted::CallScan( )
 {
     const lr1110_gnss_date_t gnss_time =
         DemoGnssBase::GnssTimeFromEnvironment( this->GetEnvironment( )->GetDateTime( ) );
-    lr1110_gnss_solver_assistance_position_t gnss_position = { 0 };
-    DemoGnssAssisted::GnssPositionFromEnvironment( this->GetEnvironment( )->GetLocation( ), gnss_position );
+    lr1110_gnss_solver_assistance_position_t gnss_position       = { 0 };
+    demo_gnss_assistance_position_t          assistance_position = { 0 };
+    if( !this->GetEnvironment( )->GetAssistancePosition( assistance_position ) )
+    {
+        return false;
+    }
+    DemoGnssAssisted::GnssPositionFromEnvironment( assistance_position.location, gnss_position );
+    this->communication_interface->Log( "Assistance position from source %u (+/- %lu m)%s\n",
+                                        assistance_position.source, assistance_position.uncertainty_m,
+                                        this->GetEnvironment( )->HasFreshLocation( ) ? "" : ", stale" );
 
     if( !this->CheckAndStoreAlmanacAge( DEMO_GNSS_LIMIT_ALMANAC_AGE_DAYS ) )
     {
@@ -65,6 +73,8 @@ void DemoGnssAssisted::CallScan( )
         this->device->GetRadio( ), gnss_time, this->GetSettings( ).option,
         LR1110_GNSS_BIT_CHANGE_MASK | LR1110_GNSS_DOPPLER_MASK | LR1110_GNSS_IRQ_PSEUDO_RANGE_MASK,
         this->GetSettings( ).nb_satellites );
+
+    return true;
 }
 
 void DemoGnssAssisted::GnssPositionFromEnvironment( const environment_location_t&             location,
@@ -41,7 +41,7 @@ DemoGnssAutonomous::DemoGnssAutonomous( DeviceTransceiver* device, SignalingInte
 
 DemoGnssAutonomous::~DemoGnssAutonomous( ) {}
 
-void DemoGnssAutonomous::CallScan( )
+bool DemoGnssAutonomous::CallScan( )
 {
     const lr1110_gnss_date_t gnss_time =
         DemoGnssBase::GnssTimeFromEnvironment( this->GetEnvironment( )->GetDateTime( ) );
@@ -55,4 +55,6 @@ void DemoGnssAutonomous::CallScan( )
         this->device->GetRadio( ), gnss_time,
         LR1110_GNSS_BIT_CHANGE_MASK | LR1110_GNSS_DOPPLER_MASK | LR1110_GNSS_IRQ_PSEUDO_RANGE_MASK,
         this->GetSettings( ).nb_satellites );
+
+    return true;
 }
@@ -34,9 +34,6 @@
 #include "lr1110_gnss.h"
 #include "system_lptim.h"
 
-#define DEMO_GNSS_CONSUMPTION_DCDC_ACQUISITION_MA ( 11 )
-#define DEMO_GNSS_CONSUMPTION_DCDC_COMPUTATION_MA ( 6 )
-
 DemoGnssBase::DemoGnssBase( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
                             AntennaSelectorInterface* antenna_selector, TimerInterface* timer,
                             CommunicationInterface* communication_interface )
@@ -61,6 +58,7 @@ void DemoGnssBase::Reset( )
     this->result.nb_result                                = 0;
     this->result.nav_message.size                         = 0;
     this->result.consumption_uas                          = 0;
+    this->result.energy                                   = { 0 };
     this->result.error                                    = DEMO_GNSS_BASE_NO_ERROR;
     this->result.timings                                  = { 0 };
     this->result.local_instant_measurement                = 0;
@@ -121,10 +119,15 @@ void DemoGnssBase::SpecificRuntime( )
 
     case DEMO_GNSS_BASE_SCAN:
     {
-        this->SetWaitingForInterrupt( );
         measurement_instant_s = this->environment->GetLocalTimeSeconds( );
 
-        this->CallScan( );
+        if( !this->CallScan( ) )
+        {
+            this->JumpToErrorState( DEMO_GNSS_BASE_ERROR_NO_LOCATION );
+            this->communication_interface->Log( "No location available\n" );
+            break;
+        }
+        this->SetWaitingForInterrupt( );
 
         this->instant_start_capture_ms = this->environment->GetLocalTimeMilliseconds( );
 
@@ -196,10 +199,16 @@ void DemoGnssBase::SpecificRuntime( )
                 {
                     this->state = DEMO_GNSS_BASE_GET_RESULTS;
                 }
-                else
+                else if( this->IsSecondScanNeeded( ) )
                 {
                     this->state = DEMO_GNSS_BASE_WAIT_AND_EXECUTE_SECOND_SCAN;
                 }
+                else
+                {
+                    // The timer armed for the second scan is not waited for
+                    this->timer->clear_timer( );
+                    this->state = DEMO_GNSS_BASE_GET_RESULTS;
+                }
 
                 this->signaling->StopCapture( );
             }
@@ -244,9 +253,11 @@ void DemoGnssBase::SpecificRuntime( )
             lr1110_gnss_get_detected_satellites( this->device->GetRadio( ), nb_sv_detected, list_of_sv );
             lr1110_gnss_get_timings( this->device->GetRadio( ), &this->result.timings );
 
-            this->result.consumption_uas =
-                ( this->result.timings.radio_ms * DEMO_GNSS_CONSUMPTION_DCDC_ACQUISITION_MA +
-                  this->result.timings.computation_ms * DEMO_GNSS_CONSUMPTION_DCDC_COMPUTATION_MA );
+            if( this->GetConsumptionModel( ) != NULL )
+            {
+                this->result.consumption_uas =
+                    this->GetConsumptionModel( )->ComputeGnssEnergy( this->result.timings, this->result.energy );
+            }
 
             this->result.local_instant_measurement                = measurement_instant_s;
             this->result.local_instant_measurement_second_capture = this->instant_second_capture_ms;
@@ -369,8 +380,32 @@ void DemoGnssBase::AskAndStoreDate( )
     if( success == true )
     {
         this->GetEnvironment( )->SetTimeFromGpsEpoch( actual_time );
-        this->GetEnvironment( )->SetLocation( initial_position );
+        this->GetEnvironment( )->SetLocation( initial_position, DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_HOST, 0 );
+    }
+}
+
+bool DemoGnssBase::IsSecondScanNeeded( )
+{
+    uint8_t                          nb_sv_detected = 0;
+    lr1110_gnss_detected_satellite_t list_of_sv[30] = { 0 };
+
+    lr1110_gnss_get_nb_detected_satellites( this->device->GetRadio( ), &nb_sv_detected );
+    if( nb_sv_detected > 30 )
+    {
+        nb_sv_detected = 30;
     }
+    lr1110_gnss_get_detected_satellites( this->device->GetRadio( ), nb_sv_detected, list_of_sv );
+
+    const demo_gnss_scan_policy_decision_t decision =
+        this->scan_policy.Decide( this->settings, list_of_sv, nb_sv_detected );
+
+    this->communication_interface->Log(
+        "Second scan %s: %u satellites detected, %u above %i dB (%u executed, %u skipped)\n",
+        DemoGnssScanPolicy::decision2str( decision ), nb_sv_detected, this->scan_policy.GetNbStrongSatellites( ),
+        this->settings.dual_scan_cnr_min, this->scan_policy.GetNbSecondScansExecuted( ),
+        this->scan_policy.GetNbSecondScansSkipped( ) );
+
+    return decision == DEMO_GNSS_SCAN_POLICY_EXECUTE_SECOND_SCAN;
 }
 
 bool DemoGnssBase::IsResultToSolver( const demo_gnss_nav_result_t& nav_result )
@@ -0,0 +1,101 @@
+/**
+ * @file      demo_gnss_scan_policy.cpp
+ *
+ * @brief     Implementation of the policy deciding whether the second scan of a dual scan is executed.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_gnss_scan_policy.h"
+
+DemoGnssScanPolicy::DemoGnssScanPolicy( ) { this->Clear( ); }
+
+DemoGnssScanPolicy::~DemoGnssScanPolicy( ) {}
+
+void DemoGnssScanPolicy::Clear( )
+{
+    this->nb_strong_satellites = 0;
+    this->nb_executed          = 0;
+    this->nb_skipped           = 0;
+}
+
+demo_gnss_scan_policy_decision_t DemoGnssScanPolicy::Decide( const demo_gnss_settings_t&             settings,
+                                                             const lr1110_gnss_detected_satellite_t* satellites,
+                                                             const uint8_t                           nb_satellites )
+{
+    demo_gnss_scan_policy_decision_t decision = DEMO_GNSS_SCAN_POLICY_EXECUTE_SECOND_SCAN;
+
+    this->nb_strong_satellites = 0;
+    for( uint8_t index = 0; index < nb_satellites; index++ )
+    {
+        if( satellites[index].cnr >= settings.dual_scan_cnr_min )
+        {
+            this->nb_strong_satellites++;
+        }
+    }
+
+    if( ( settings.dual_scan_skip_nb_sv != 0 ) &&
+        ( this->nb_strong_satellites >= settings.dual_scan_skip_nb_sv ) )
+    {
+        decision = DEMO_GNSS_SCAN_POLICY_SKIP_ENOUGH_SATELLITES;
+    }
+    else if( nb_satellites < settings.dual_scan_min_sv )
+    {
+        decision = DEMO_GNSS_SCAN_POLICY_SKIP_TOO_FEW_SATELLITES;
+    }
+
+    if( decision == DEMO_GNSS_SCAN_POLICY_EXECUTE_SECOND_SCAN )
+    {
+        this->nb_executed++;
+    }
+    else
+    {
+        this->nb_skipped++;
+    }
+
+    return decision;
+}
+
+uint8_t DemoGnssScanPolicy::GetNbStrongSatellites( ) const { return this->nb_strong_satellites; }
+
+uint16_t DemoGnssScanPolicy::GetNbSecondScansExecuted( ) const { return this->nb_executed; }
+
+uint16_t DemoGnssScanPolicy::GetNbSecondScansSkipped( ) const { return this->nb_skipped; }
+
+const char* DemoGnssScanPolicy::decision2str( const demo_gnss_scan_policy_decision_t decision )
+{
+    switch( decision )
+    {
+    case DEMO_GNSS_SCAN_POLICY_EXECUTE_SECOND_SCAN:
+        return "execute";
+    case DEMO_GNSS_SCAN_POLICY_SKIP_ENOUGH_SATELLITES:
+        return "skip (enough satellites)";
+    case DEMO_GNSS_SCAN_POLICY_SKIP_TOO_FEW_SATELLITES:
+        return "skip (too few satellites)";
+    default:
+        return "unknown";
+    }
+}
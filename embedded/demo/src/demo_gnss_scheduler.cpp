@@ -0,0 +1,225 @@
+/**
+ * @file      demo_gnss_scheduler.cpp
+ *
+ * @brief     Implementation of the periodic GNSS scan scheduler.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "demo_gnss_scheduler.h"
+#include "lr1110_system.h"
+
+#define DEMO_GNSS_SCHEDULER_JITTER_RATIO ( 10 )
+
+DemoGnssScheduler::DemoGnssScheduler( DeviceTransceiver* device, SignalingInterface* signaling,
+                                      EnvironmentInterface* environment, AntennaSelectorInterface* antenna_selector,
+                                      TimerInterface* timer, CommunicationInterface* communication_interface )
+    : DemoBase( device, signaling, communication_interface ),
+      gnss_autonomous( device, signaling, environment, antenna_selector, timer, communication_interface ),
+      gnss_assisted( device, signaling, environment, antenna_selector, timer, communication_interface ),
+      gnss_demo( &gnss_autonomous ),
+      environment( environment ),
+      timer( timer ),
+      entropy_pool( NULL ),
+      state( DEMO_GNSS_SCHEDULER_START_SCAN ),
+      instant_scan_start_ms( 0 ),
+      has_intermediate_results( false ),
+      history_next_index( 0 ),
+      history_count( 0 )
+{
+    this->settings.scan_type  = DEMO_GNSS_SCHEDULER_SCAN_TYPE_DEFAULT;
+    this->settings.interval_s = DEMO_GNSS_SCHEDULER_INTERVAL_S_DEFAULT;
+}
+
+DemoGnssScheduler::~DemoGnssScheduler( ) {}
+
+void DemoGnssScheduler::Reset( )
+{
+    this->DemoBase::Reset( );
+    this->state                    = DEMO_GNSS_SCHEDULER_START_SCAN;
+    this->instant_scan_start_ms    = 0;
+    this->has_intermediate_results = false;
+    this->history_next_index       = 0;
+    this->history_count            = 0;
+}
+
+void DemoGnssScheduler::Configure( const demo_gnss_scheduler_settings_t& scheduler_settings,
+                                   demo_gnss_settings_t&                 gnss_settings )
+{
+    this->settings = scheduler_settings;
+
+    if( this->settings.scan_type == DEMO_GNSS_SCHEDULER_SCAN_ASSISTED )
+    {
+        this->gnss_demo = &this->gnss_assisted;
+    }
+    else
+    {
+        this->gnss_demo = &this->gnss_autonomous;
+    }
+    this->gnss_demo->Configure( gnss_settings );
+}
+
+void DemoGnssScheduler::SetConsumptionModel( const DemoConsumptionModel* consumption_model )
+{
+    this->gnss_autonomous.SetConsumptionModel( consumption_model );
+    this->gnss_assisted.SetConsumptionModel( consumption_model );
+}
+
+void DemoGnssScheduler::SetEntropyPool( EntropyPool* entropy_pool ) { this->entropy_pool = entropy_pool; }
+
+void DemoGnssScheduler::SpecificRuntime( )
+{
+    this->has_intermediate_results = false;
+
+    switch( this->state )
+    {
+    case DEMO_GNSS_SCHEDULER_START_SCAN:
+    {
+        this->instant_scan_start_ms = ( uint32_t ) this->environment->GetLocalTimeMilliseconds( );
+        this->gnss_demo->Start( );
+        this->state = DEMO_GNSS_SCHEDULER_WAIT_FOR_SCAN;
+        break;
+    }
+
+    case DEMO_GNSS_SCHEDULER_WAIT_FOR_SCAN:
+    {
+        if( this->gnss_demo->Runtime( ) == DEMO_STATUS_TERMINATED )
+        {
+            this->gnss_demo->Stop( );
+
+            const demo_gnss_all_results_t* result = this->gnss_demo->GetResult( );
+            if( result->error == DEMO_GNSS_BASE_NO_ERROR )
+            {
+                this->StoreResultInHistory( result );
+            }
+            else
+            {
+                this->communication_interface->Log( "Scheduled GNSS scan failed (error %u)\n", result->error );
+            }
+            this->has_intermediate_results = true;
+
+            const uint32_t interval_ms = ( uint32_t ) this->settings.interval_s * 1000;
+            const uint32_t elapsed_ms =
+                ( uint32_t ) this->environment->GetLocalTimeMilliseconds( ) - this->instant_scan_start_ms;
+
+            if( elapsed_ms < interval_ms )
+            {
+                this->timer->set_and_start( interval_ms - elapsed_ms + this->GetJitterMs( interval_ms ) );
+                this->state = DEMO_GNSS_SCHEDULER_WAIT_FOR_NEXT_SCAN;
+            }
+            else
+            {
+                this->communication_interface->Log( "Scheduled GNSS scan lasted longer than the interval (%u ms)\n",
+                                                    elapsed_ms );
+                this->state = DEMO_GNSS_SCHEDULER_START_SCAN;
+            }
+        }
+        else if( this->gnss_demo->IsWaitingForInterrupt( ) )
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+
+    case DEMO_GNSS_SCHEDULER_WAIT_FOR_NEXT_SCAN:
+    {
+        if( this->timer->is_timer_elapsed( ) == true )
+        {
+            this->timer->clear_timer( );
+            this->state = DEMO_GNSS_SCHEDULER_START_SCAN;
+        }
+        break;
+    }
+    }
+}
+
+void DemoGnssScheduler::SpecificStop( )
+{
+    if( this->gnss_demo->IsStarted( ) )
+    {
+        this->gnss_demo->Stop( );
+    }
+    this->timer->clear_timer( );
+}
+
+void DemoGnssScheduler::SpecificInterruptHandler( ) {}
+
+bool DemoGnssScheduler::HasIntermediateResults( ) const { return this->has_intermediate_results; }
+
+bool DemoGnssScheduler::IsRadioIdle( ) const { return this->state == DEMO_GNSS_SCHEDULER_WAIT_FOR_NEXT_SCAN; }
+
+const demo_gnss_all_results_t* DemoGnssScheduler::GetResult( ) const { return this->gnss_demo->GetResult( ); }
+
+uint8_t DemoGnssScheduler::GetHistoryCount( ) const { return this->history_count; }
+
+const demo_gnss_nav_history_entry_t* DemoGnssScheduler::GetHistoryEntry( const uint8_t index ) const
+{
+    if( index >= this->history_count )
+    {
+        return NULL;
+    }
+
+    const uint8_t oldest_index =
+        ( this->history_next_index + GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES - this->history_count ) %
+        GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES;
+
+    return &this->history[( oldest_index + index ) % GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES];
+}
+
+void DemoGnssScheduler::ClearRegisteredIrqs( ) const
+{
+    lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_GNSS_SCAN_DONE );
+}
+
+void DemoGnssScheduler::StoreResultInHistory( const demo_gnss_all_results_t* result )
+{
+    demo_gnss_nav_history_entry_t* entry = &this->history[this->history_next_index];
+
+    entry->local_instant_measurement = result->local_instant_measurement;
+    entry->nb_satellites             = result->nb_result;
+    entry->nav_message.size          = result->nav_message.size;
+    memcpy( entry->nav_message.message, result->nav_message.message, result->nav_message.size );
+
+    this->history_next_index = ( this->history_next_index + 1 ) % GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES;
+    if( this->history_count < GNSS_DEMO_NAV_HISTORY_MAX_ENTRIES )
+    {
+        this->history_count++;
+    }
+}
+
+uint32_t DemoGnssScheduler::GetJitterMs( const uint32_t interval_ms )
+{
+    uint32_t jitter_ms = 0;
+
+    if( this->entropy_pool != NULL )
+    {
+        // Left to 0 if the pool is not seeded yet
+        this->entropy_pool->GetRandomInRange( 0, interval_ms / DEMO_GNSS_SCHEDULER_JITTER_RATIO, &jitter_ms );
+    }
+
+    return jitter_ms;
+}
@@ -44,6 +44,19 @@
 // Slave opens Ping Rx window 5 ms before Master actually sends the Ping
 #define DEMO_PING_PONG_SLAVE_WAIT_START_PING_RX ( DEMO_PING_PONG_WAIT_MASTER_PING_TO_PING_TIMEOUT_MS - 5 )
 
+// Slave goes back to Master if no Ping is received during this time
+#define DEMO_PING_PONG_SLAVE_MAX_RX_TIMEOUT ( 2 * DEMO_PING_PONG_SLAVE_WAIT_START_PING_RX )
+
+// With the hardware timing, until a first Pong is received, the radio of the Master closes its Rx window slightly
+// before the firmware would do it, so that the timeout is reported by the radio
+#define DEMO_PING_PONG_MASTER_DISCOVERY_RX_TIMEOUT ( DEMO_PING_PONG_MASTER_MAX_RX_TIMEOUT - 10 )
+
+// With the hardware timing, the Master keeps its Rx window open this long after the expected end of the Pong
+#define DEMO_PING_PONG_MASTER_PONG_RX_MARGIN_MS ( 5 )
+
+#define DEMO_PING_PONG_AUTO_TX_RX_DISABLED ( 0xFFFFFFFF )
+#define DEMO_PING_PONG_RTC_FREQUENCY_HZ ( 32768 )
+
 DemoPingPong::DemoPingPong( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
                             CommunicationInterface* communication_interface )
     : DemoRadioInterface( device, signaling, communication_interface ),
@@ -53,12 +66,20 @@ DemoPingPong::DemoPingPong( DeviceTransceiver* device, SignalingInterface* signa
       last_irq_received_instant_ms( 0 ),
       last_tx_done_instant_ms( 0 ),
       last_rx_done_instant_ms( 0 ),
+      last_ping_start_instant_ms( 0 ),
+      time_on_air_ms( 0 ),
+      is_link_established( false ),
+      has_pending_radio_event( false ),
       radio_interrupt_mask( LR1110_SYSTEM_IRQ_TX_DONE | LR1110_SYSTEM_IRQ_RX_DONE | LR1110_SYSTEM_IRQ_TIMEOUT ),
       has_intermediate_results( false )
 {
     this->results  = {};
     this->settings = {};
 
+    this->timing_settings.timing              = DEMO_PING_PONG_TIMING_DEFAULT;
+    this->timing_settings.turnaround_delay_ms = DEMO_PING_PONG_TURNAROUND_DELAY_MS_DEFAULT;
+    this->timing_settings.guard_delay_ms      = DEMO_PING_PONG_GUARD_DELAY_MS_DEFAULT;
+
     for( uint16_t i = 0; i < DEMO_PING_PONG_MAX_PAYLOAD_SIZE; i++ )
     {
         this->payload_ping[i] = 0x00;
@@ -68,6 +89,11 @@ DemoPingPong::DemoPingPong( DeviceTransceiver* device, SignalingInterface* signa
 
 DemoPingPong::~DemoPingPong( ) {}
 
+void DemoPingPong::ConfigureTiming( const demo_ping_pong_settings_t& timing_settings )
+{
+    this->timing_settings = timing_settings;
+}
+
 const demo_ping_pong_results_t* DemoPingPong::GetResult( ) const { return &this->results; }
 
 void DemoPingPong::SpecificRuntime( )
@@ -83,7 +109,15 @@ void DemoPingPong::SpecificRuntime( )
         if( this->ConfigureRadio( ) == DEMO_PING_PONG_STATUS_OK )
         {
             this->last_tx_done_instant_ms = now_ms;  // Fake the instant of last received event
-            this->state                   = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
+            this->is_link_established     = false;
+            this->has_pending_radio_event = false;
+            this->time_on_air_ms =
+                ( this->settings.pkt_type == LR1110_RADIO_PKT_TYPE_LORA )
+                    ? lr1110_radio_get_lora_time_on_air_in_ms( &this->settings.packet_lora,
+                                                               &this->settings.modulation_lora )
+                    : lr1110_radio_get_gfsk_time_on_air_in_ms( &this->settings.packet_gfsk,
+                                                               &this->settings.modulation_gfsk );
+            this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
             this->communication_interface->Log( "Start as Master\n" );
         }
         else
@@ -95,9 +129,10 @@ void DemoPingPong::SpecificRuntime( )
     }
     case DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING:
     {
-        if( ( now_ms - this->last_tx_done_instant_ms ) > DEMO_PING_PONG_WAIT_MASTER_PING_TO_PING_TIMEOUT_MS )
+        if( this->IsTimeToSendPing( now_ms ) )
         {
             this->SetWaitingForInterrupt( );
+            this->last_ping_start_instant_ms = now_ms;
             this->StartSendMessage( );
             this->signaling->Tx( );
             this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING_DONE;
@@ -118,10 +153,21 @@ void DemoPingPong::SpecificRuntime( )
                 this->results.count_tx++;
                 this->FetchStatisticToResults( );
                 this->last_tx_done_instant_ms = this->last_irq_received_instant_ms;
-                this->StartReceptionMessage( );
+                if( !this->IsHardwareTimed( ) )
+                {
+                    // With the hardware timing, the radio is already listening for the Pong
+                    this->StartReceptionMessage( );
+                }
                 this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_RECEIVE_PONG;
             }
-            this->ClearRegisteredIrqs( );
+            if( this->IsHardwareTimed( ) )
+            {
+                this->ClearHandledIrqs( LR1110_SYSTEM_IRQ_TX_DONE );
+            }
+            else
+            {
+                this->ClearRegisteredIrqs( );
+            }
         }
         break;
     }
@@ -136,7 +182,7 @@ void DemoPingPong::SpecificRuntime( )
     }
     case DEMO_PING_PONG_STATE_MASTER_WAIT_RECEIVE_PONG:
     {
-        if( this->InterruptHasRaised( ) )
+        if( this->HasRadioEvent( ) )
         {
             lr1110_system_stat1_t stat1;
             lr1110_system_stat2_t stat2;
@@ -148,6 +194,12 @@ void DemoPingPong::SpecificRuntime( )
             {
                 lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_CRC_ERROR );
                 this->results.count_rx_wrong_packet++;
+                if( this->IsHardwareTimed( ) )
+                {
+                    // The Rx window opened by the radio is closed
+                    this->last_rx_done_instant_ms = this->last_irq_received_instant_ms;
+                    this->state                   = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
+                }
             }
             else if( irq_status & LR1110_SYSTEM_IRQ_RX_DONE )
             {
@@ -158,6 +210,9 @@ void DemoPingPong::SpecificRuntime( )
                 {
                     this->signaling->Rx( );
                     this->results.count_rx_correct_packet++;
+                    this->last_rx_done_instant_ms = this->last_irq_received_instant_ms;
+                    this->is_link_established     = true;
+                    this->UpdateRoundTrip( this->last_rx_done_instant_ms - this->last_ping_start_instant_ms );
                     this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
                 }
                 else if( this->IsPingPayload( received_payload.received_payload ) )
@@ -166,20 +221,23 @@ void DemoPingPong::SpecificRuntime( )
                     // Switch this one to slave and keep going.
                     this->communication_interface->Log( "Switch to Slave\n" );
                     this->last_rx_done_instant_ms = this->last_tx_done_instant_ms;
+                    this->is_link_established     = false;
                     this->mode                    = DEMO_PING_PONG_MODE_SLAVE;
                     this->state                   = DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG;
                 }
                 else
                 {
                     this->communication_interface->Log( "Wrong packet\n" );
-                    this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
+                    this->is_link_established = false;
+                    this->state               = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
                     this->results.count_rx_wrong_packet++;
                 }
             }
             if( irq_status & LR1110_SYSTEM_IRQ_TIMEOUT )
             {
                 this->communication_interface->Log( "Master Timeout\n" );
-                this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
+                this->is_link_established = false;
+                this->state               = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
                 this->results.count_rx_timeout++;
             }
             this->ClearRegisteredIrqs( );
@@ -187,7 +245,8 @@ void DemoPingPong::SpecificRuntime( )
         else if( ( now_ms - this->last_tx_done_instant_ms ) > DEMO_PING_PONG_MASTER_MAX_RX_TIMEOUT )
         {
             this->EndReceptionMessage( );
-            this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
+            this->is_link_established = false;
+            this->state               = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
             this->results.count_rx_timeout++;
         }
         break;
@@ -207,7 +266,7 @@ void DemoPingPong::SpecificRuntime( )
     }
     case DEMO_PING_PONG_STATE_SLAVE_WAIT_RECEIVE_PING:
     {
-        if( this->InterruptHasRaised( ) )
+        if( this->HasRadioEvent( ) )
         {
             lr1110_system_stat1_t stat1;
             lr1110_system_stat2_t stat2;
@@ -218,6 +277,12 @@ void DemoPingPong::SpecificRuntime( )
             {
                 lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_CRC_ERROR );
                 this->results.count_rx_wrong_packet++;
+                if( this->IsHardwareTimed( ) )
+                {
+                    // Prevent the radio from answering to a corrupted packet and listen again
+                    this->EndReceptionMessage( );
+                    this->StartReceptionMessage( );
+                }
             }
             else if( irq_status & LR1110_SYSTEM_IRQ_RX_DONE )
             {
@@ -229,13 +294,27 @@ void DemoPingPong::SpecificRuntime( )
                     this->last_rx_done_instant_ms = this->last_irq_received_instant_ms;
                     this->results.count_rx_correct_packet++;
                     this->signaling->Rx( );
-                    this->state = DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG;
+                    if( this->IsHardwareTimed( ) )
+                    {
+                        // The radio sends the Pong by itself after the turnaround delay
+                        this->SetWaitingForInterrupt( );
+                        this->signaling->Tx( );
+                        this->state = DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG_DONE;
+                    }
+                    else
+                    {
+                        this->state = DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG;
+                    }
                 }
                 else if( this->IsPongPayload( received_payload.received_payload ) )
                 {
                     // That means there is another Slave on the line.
                     // Switch this one to master and keep going.
                     this->communication_interface->Log( "Wrong payload: switch to Master\n" );
+                    if( this->IsHardwareTimed( ) )
+                    {
+                        this->EndReceptionMessage( );
+                    }
                     this->last_tx_done_instant_ms = this->last_irq_received_instant_ms;
                     this->mode                    = DEMO_PING_PONG_MODE_MASTER;
                     this->state                   = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
@@ -243,6 +322,11 @@ void DemoPingPong::SpecificRuntime( )
                 else
                 {
                     this->results.count_rx_wrong_packet++;
+                    if( this->IsHardwareTimed( ) )
+                    {
+                        this->EndReceptionMessage( );
+                        this->StartReceptionMessage( );
+                    }
                 }
             }
             if( irq_status & LR1110_SYSTEM_IRQ_TIMEOUT )
@@ -254,9 +338,17 @@ void DemoPingPong::SpecificRuntime( )
                 this->state = DEMO_PING_PONG_STATE_MASTER_WAIT_SEND_PING;
                 this->results.count_rx_timeout++;
             }
-            this->ClearRegisteredIrqs( );
+            if( this->state == DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG_DONE )
+            {
+                // The end of the Pong may already be there: keep it
+                this->ClearHandledIrqs( LR1110_SYSTEM_IRQ_RX_DONE | LR1110_SYSTEM_IRQ_TIMEOUT );
+            }
+            else
+            {
+                this->ClearRegisteredIrqs( );
+            }
         }
-        if( ( now_ms - this->last_rx_done_instant_ms ) > ( 2 * DEMO_PING_PONG_SLAVE_WAIT_START_PING_RX ) )
+        if( ( now_ms - this->last_rx_done_instant_ms ) > DEMO_PING_PONG_SLAVE_MAX_RX_TIMEOUT )
         {
             // In case of timeout: go back to master
             this->last_tx_done_instant_ms = this->last_irq_received_instant_ms;
@@ -269,7 +361,11 @@ void DemoPingPong::SpecificRuntime( )
     }
     case DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG:
     {
-        if( ( now_ms - this->last_rx_done_instant_ms ) > DEMO_PING_PONG_WAIT_MASTER_PING_TO_PONG_TIMEOUT_MS )
+        const uint32_t pong_delay_ms = ( this->IsHardwareTimed( ) )
+                                           ? this->timing_settings.turnaround_delay_ms
+                                           : DEMO_PING_PONG_WAIT_MASTER_PING_TO_PONG_TIMEOUT_MS;
+
+        if( ( now_ms - this->last_rx_done_instant_ms ) > pong_delay_ms )
         {
             this->SetWaitingForInterrupt( );
             this->StartSendMessage( );
@@ -280,7 +376,7 @@ void DemoPingPong::SpecificRuntime( )
     }
     case DEMO_PING_PONG_STATE_SLAVE_WAIT_SEND_PONG_DONE:
     {
-        if( this->InterruptHasRaised( ) )
+        if( this->HasRadioEvent( ) )
         {
             lr1110_system_stat1_t stat1;
             lr1110_system_stat2_t stat2;
@@ -322,6 +418,61 @@ void DemoPingPong::SpecificRuntime( )
 
 bool DemoPingPong::HasIntermediateResults( ) const { return has_intermediate_results; }
 
+bool DemoPingPong::IsHardwareTimed( ) const
+{
+    return this->timing_settings.timing == DEMO_PING_PONG_TIMING_HARDWARE;
+}
+
+bool DemoPingPong::IsTimeToSendPing( const uint32_t now_ms ) const
+{
+    if( this->IsHardwareTimed( ) && this->is_link_established )
+    {
+        return ( now_ms - this->last_rx_done_instant_ms ) > this->timing_settings.guard_delay_ms;
+    }
+
+    return ( now_ms - this->last_tx_done_instant_ms ) > DEMO_PING_PONG_WAIT_MASTER_PING_TO_PING_TIMEOUT_MS;
+}
+
+bool DemoPingPong::HasRadioEvent( )
+{
+    const bool has_interrupt      = this->InterruptHasRaised( );
+    const bool has_pending_event  = this->has_pending_radio_event;
+    this->has_pending_radio_event = false;
+
+    return has_interrupt || has_pending_event;
+}
+
+void DemoPingPong::ClearHandledIrqs( const uint32_t handled_irqs )
+{
+    lr1110_system_stat1_t stat1;
+    lr1110_system_stat2_t stat2;
+    uint32_t              irq_status;
+
+    // With the hardware timing, the radio chains the Tx and the Rx by itself: the next event may already be raised
+    // while the previous one is handled, in which case the interrupt line stays high and no new interrupt occurs
+    lr1110_system_clear_irq_status( this->device->GetRadio( ), handled_irqs );
+    lr1110_system_get_status( this->device->GetRadio( ), &stat1, &stat2, &irq_status );
+    if( ( irq_status & this->radio_interrupt_mask ) != 0 )
+    {
+        this->has_pending_radio_event      = true;
+        this->last_irq_received_instant_ms = this->environment->GetLocalTimeMilliseconds( );
+    }
+}
+
+void DemoPingPong::UpdateRoundTrip( const uint32_t round_trip_ms )
+{
+    if( ( this->results.count_round_trip == 0 ) || ( round_trip_ms < this->results.round_trip_min_ms ) )
+    {
+        this->results.round_trip_min_ms = round_trip_ms;
+    }
+    if( round_trip_ms > this->results.round_trip_max_ms )
+    {
+        this->results.round_trip_max_ms = round_trip_ms;
+    }
+    this->results.round_trip_total_ms += round_trip_ms;
+    this->results.count_round_trip++;
+}
+
 void DemoPingPong::SpecificStop( )
 {
     lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
@@ -330,6 +481,10 @@ void DemoPingPong::SpecificStop( )
     this->results.count_rx_correct_packet = 0;
     this->results.count_rx_wrong_packet   = 0;
     this->results.count_rx_timeout        = 0;
+    this->results.count_round_trip        = 0;
+    this->results.round_trip_min_ms       = 0;
+    this->results.round_trip_max_ms       = 0;
+    this->results.round_trip_total_ms     = 0;
 
     this->state = DEMO_PING_PONG_STATE_INIT;
 }
@@ -343,6 +498,13 @@ void DemoPingPong::LogInfo( ) const
         "Last RSSI: %i dBm\n",
         DemoPingPong::ModeToString( this->results.mode ), this->results.count_rx_correct_packet, this->results.count_tx,
         this->results.count_rx_timeout, this->results.count_rx_wrong_packet, this->results.last_rssi );
+
+    if( this->results.count_round_trip > 0 )
+    {
+        this->communication_interface->Log( "Round trip: %u ms (min %u ms, max %u ms)\n",
+                                            this->results.round_trip_total_ms / this->results.count_round_trip,
+                                            this->results.round_trip_min_ms, this->results.round_trip_max_ms );
+    }
 }
 
 const char* DemoPingPong::ModeToString( const demo_ping_pong_mode_t mode )
@@ -403,7 +565,13 @@ demo_ping_pong_status_t DemoPingPong::ConfigureRadio( ) const
     // 5. Set tx output power
     lr1110_radio_set_tx_params( this->device->GetRadio( ), this->settings.tx_power, this->settings.pa_ramp_time );
 
-    // 6. Enable IRQs
+    // 6. Let the radio stay in frequency synthesis between the Ping and the Pong
+    if( this->IsHardwareTimed( ) )
+    {
+        lr1110_radio_set_rx_tx_fallback_mode( this->device->GetRadio( ), LR1110_RADIO_FALLBACK_FS );
+    }
+
+    // 7. Enable IRQs
     lr1110_system_set_dio_irq_params( this->device->GetRadio( ), this->radio_interrupt_mask, 0 );
 
     return DEMO_PING_PONG_STATUS_OK;
@@ -415,12 +583,30 @@ void DemoPingPong::StartSendMessage( ) const
     {
     case DEMO_PING_PONG_MODE_MASTER:
     {
+        if( this->IsHardwareTimed( ) )
+        {
+            // The radio opens the Pong Rx window as soon as the Ping is sent. Until a first Pong is received, the
+            // window is as long as with the firmware timing so that another Master can be heard
+            const uint32_t rx_window_ms =
+                ( this->is_link_established )
+                    ? ( this->timing_settings.turnaround_delay_ms + this->time_on_air_ms +
+                        DEMO_PING_PONG_MASTER_PONG_RX_MARGIN_MS )
+                    : DEMO_PING_PONG_MASTER_DISCOVERY_RX_TIMEOUT;
+
+            lr1110_radio_auto_tx_rx( this->device->GetRadio( ), 0, LR1110_RADIO_MODE_FS,
+                                     DemoPingPong::ConvertMsToRtcSteps( rx_window_ms ) );
+        }
         DemoPingPong::TransmitPayload( this->device->GetRadio( ), this->payload_ping, this->settings.payload_length,
                                        DEMO_PING_PONG_TX_TIMEOUT_DEFAULT );
         break;
     }
     case DEMO_PING_PONG_MODE_SLAVE:
     {
+        if( this->IsHardwareTimed( ) )
+        {
+            lr1110_radio_auto_tx_rx( this->device->GetRadio( ), DEMO_PING_PONG_AUTO_TX_RX_DISABLED,
+                                     LR1110_RADIO_MODE_FS, 0 );
+        }
         DemoPingPong::TransmitPayload( this->device->GetRadio( ), this->payload_pong, this->settings.payload_length,
                                        DEMO_PING_PONG_TX_TIMEOUT_DEFAULT );
         break;
@@ -430,7 +616,26 @@ void DemoPingPong::StartSendMessage( ) const
 
 void DemoPingPong::StartReceptionMessage( ) const
 {
-    lr1110_radio_set_rx( this->device->GetRadio( ), DEMO_PING_PONG_RX_TIMEOUT_DEFAULT );
+    if( this->IsHardwareTimed( ) && ( this->mode == DEMO_PING_PONG_MODE_SLAVE ) )
+    {
+        // Load the Pong and let the radio send it by itself, after the turnaround delay, once a packet is received.
+        // The radio does not transmit if the reception ends with a timeout
+        lr1110_regmem_write_buffer8( this->device->GetRadio( ), this->payload_pong, this->settings.payload_length );
+        lr1110_radio_auto_tx_rx( this->device->GetRadio( ),
+                                 DemoPingPong::ConvertMsToRtcSteps( this->timing_settings.turnaround_delay_ms ),
+                                 LR1110_RADIO_MODE_FS, 0 );
+        lr1110_radio_set_rx( this->device->GetRadio( ),
+                             DemoPingPong::ConvertMsToRtcSteps( DEMO_PING_PONG_SLAVE_MAX_RX_TIMEOUT ) );
+    }
+    else
+    {
+        if( this->IsHardwareTimed( ) )
+        {
+            lr1110_radio_auto_tx_rx( this->device->GetRadio( ), DEMO_PING_PONG_AUTO_TX_RX_DISABLED,
+                                     LR1110_RADIO_MODE_FS, 0 );
+        }
+        lr1110_radio_set_rx( this->device->GetRadio( ), DEMO_PING_PONG_RX_TIMEOUT_DEFAULT );
+    }
 }
 
 void DemoPingPong::EndReceptionMessage( ) const
@@ -522,6 +727,11 @@ bool DemoPingPong::ArePayloadEquals( const demo_ping_pong_rf_payload_t& expected
     }
 }
 
+uint32_t DemoPingPong::ConvertMsToRtcSteps( const uint32_t duration_ms )
+{
+    return ( uint32_t )( ( ( uint64_t ) duration_ms * DEMO_PING_PONG_RTC_FREQUENCY_HZ ) / 1000 );
+}
+
 void DemoPingPong::ClearRegisteredIrqs( ) const
 {
     lr1110_system_clear_irq_status( this->device->GetRadio( ), this->radio_interrupt_mask );
@@ -0,0 +1,312 @@
+/**
+ * @file      demo_radio_cad.cpp
+ *
+ * @brief     Implementation of the channel activity detection demo
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_radio_cad.h"
+#include "lr1110_radio.h"
+
+// Symbols of the explicit header and of the first payload block, received before the RX timeout is stopped
+#define DEMO_RADIO_CAD_HEADER_SYMB_NB ( 8 )
+
+// The low data rate optimization is required above this symbol duration
+#define DEMO_RADIO_CAD_LDRO_SYMBOL_DURATION_US ( 16380 )
+
+// The RX timeout is counted in steps of 31.25 us on 24 bits
+#define DEMO_RADIO_CAD_RX_TIMEOUT_MAX ( 0xFFFFFF )
+
+#define DEMO_RADIO_CAD_IRQ_MASK                                                                 \
+    ( LR1110_SYSTEM_IRQ_CAD_DONE | LR1110_SYSTEM_IRQ_CAD_DETECTED | LR1110_SYSTEM_IRQ_RX_DONE | \
+      LR1110_SYSTEM_IRQ_TIMEOUT | LR1110_SYSTEM_IRQ_HEADER_ERROR | LR1110_SYSTEM_IRQ_CRC_ERROR )
+
+#define DEMO_RADIO_CAD_RX_END_IRQ_MASK \
+    ( LR1110_SYSTEM_IRQ_RX_DONE | LR1110_SYSTEM_IRQ_TIMEOUT | LR1110_SYSTEM_IRQ_HEADER_ERROR )
+
+DemoRadioCad::DemoRadioCad( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
+                            CommunicationInterface* communication_interface )
+    : DemoRadioInterface( device, signaling, communication_interface ),
+      environment( environment ),
+      state( DEMO_RADIO_CAD_STATE_INIT ),
+      combination_index( 0 ),
+      cad_start_ms( 0 ),
+      rx_start_ms( 0 )
+{
+    this->settings     = {};
+    this->cad_settings = {};
+    this->results      = {};
+}
+
+DemoRadioCad::~DemoRadioCad( ) {}
+
+void DemoRadioCad::ConfigureCad( const demo_radio_cad_settings_t& cad_settings ) { this->cad_settings = cad_settings; }
+
+const demo_radio_cad_results_t* DemoRadioCad::GetResult( ) const { return &this->results; }
+
+uint8_t DemoRadioCad::GetNbCombinations( const demo_radio_cad_settings_t& cad_settings )
+{
+    uint8_t nb_sf = 0;
+
+    for( uint8_t sf_index = 0; sf_index < 8; sf_index++ )
+    {
+        if( ( cad_settings.sf_mask & ( 1 << sf_index ) ) != 0 )
+        {
+            nb_sf++;
+        }
+    }
+
+    if( cad_settings.nb_channels > DEMO_RADIO_CAD_MAX_CHANNELS )
+    {
+        return 0;
+    }
+
+    return nb_sf * cad_settings.nb_channels;
+}
+
+void DemoRadioCad::SpecificRuntime( )
+{
+    const uint32_t now_ms = this->environment->GetLocalTimeMilliseconds( );
+
+    switch( this->state )
+    {
+    case DEMO_RADIO_CAD_STATE_INIT:
+    {
+        if( DemoRadioCad::GetNbCombinations( this->cad_settings ) == 0 )
+        {
+            this->communication_interface->Log( "Invalid CAD configuration\n" );
+            this->Terminate( );
+            break;
+        }
+
+        this->ConfigureRadio( );
+        this->BuildCombinations( );
+
+        this->combination_index = 0;
+        this->cad_start_ms      = now_ms - this->cad_settings.period_ms;
+        this->state             = DEMO_RADIO_CAD_STATE_START_CAD;
+        break;
+    }
+    case DEMO_RADIO_CAD_STATE_START_CAD:
+    {
+        if( ( now_ms - this->cad_start_ms ) >= this->cad_settings.period_ms )
+        {
+            this->cad_start_ms = now_ms;
+            this->SetWaitingForInterrupt( );
+            this->StartCad( this->results.combinations[this->combination_index] );
+            this->state = DEMO_RADIO_CAD_STATE_WAIT_FOR_CAD_DONE;
+        }
+        break;
+    }
+    case DEMO_RADIO_CAD_STATE_WAIT_FOR_CAD_DONE:
+    {
+        if( this->InterruptHasRaised( ) )
+        {
+            lr1110_system_stat1_t stat1;
+            lr1110_system_stat2_t stat2;
+            uint32_t              irq_status;
+
+            lr1110_system_get_status( this->device->GetRadio( ), &stat1, &stat2, &irq_status );
+            if( irq_status & LR1110_SYSTEM_IRQ_CAD_DONE )
+            {
+                lr1110_system_clear_irq_status( this->device->GetRadio( ),
+                                                LR1110_SYSTEM_IRQ_CAD_DONE | LR1110_SYSTEM_IRQ_CAD_DETECTED );
+                this->results.combinations[this->combination_index].nb_cads++;
+                this->results.nb_cads++;
+
+                if( irq_status & LR1110_SYSTEM_IRQ_CAD_DETECTED )
+                {
+                    // The LR1110 went to reception on its own, the CAD exit mode being RX
+                    this->rx_start_ms = now_ms;
+                    this->state       = DEMO_RADIO_CAD_STATE_WAIT_FOR_RX_DONE;
+                }
+                else
+                {
+                    this->EndCad( );
+                }
+            }
+        }
+        else
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+    case DEMO_RADIO_CAD_STATE_WAIT_FOR_RX_DONE:
+    {
+        if( this->InterruptHasRaised( ) )
+        {
+            demo_radio_cad_combination_results_t& combination = this->results.combinations[this->combination_index];
+            lr1110_system_stat1_t                 stat1;
+            lr1110_system_stat2_t                 stat2;
+            uint32_t                              irq_status;
+
+            lr1110_system_get_status( this->device->GetRadio( ), &stat1, &stat2, &irq_status );
+            if( irq_status & DEMO_RADIO_CAD_RX_END_IRQ_MASK )
+            {
+                lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+
+                // A packet received with a wrong CRC still proves the activity
+                if( irq_status & LR1110_SYSTEM_IRQ_RX_DONE )
+                {
+                    combination.nb_detections++;
+                    this->signaling->Rx( );
+                }
+                else
+                {
+                    combination.nb_false_alarms++;
+                }
+                combination.rx_duration_ms += now_ms - this->rx_start_ms;
+                this->EndCad( );
+            }
+        }
+        else
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+    }
+}
+
+void DemoRadioCad::SpecificStop( )
+{
+    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+
+    this->state = DEMO_RADIO_CAD_STATE_INIT;
+}
+
+void DemoRadioCad::ConfigureRadio( ) const
+{
+    this->device->ResetAndInit( );
+    lr1110_radio_set_pkt_type( this->device->GetRadio( ), LR1110_RADIO_PKT_TYPE_LORA );
+    lr1110_radio_set_lora_pkt_params( this->device->GetRadio( ), &this->settings.packet_lora );
+
+    lr1110_system_set_dio_irq_params( this->device->GetRadio( ), DEMO_RADIO_CAD_IRQ_MASK, 0 );
+    lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+}
+
+void DemoRadioCad::BuildCombinations( )
+{
+    this->results = {};
+
+    for( uint8_t sf_index = 0; sf_index < 8; sf_index++ )
+    {
+        if( ( this->cad_settings.sf_mask & ( 1 << sf_index ) ) == 0 )
+        {
+            continue;
+        }
+
+        uint32_t frequency_hz = this->cad_settings.start_frequency_hz;
+
+        for( uint8_t channel = 0; channel < this->cad_settings.nb_channels; channel++ )
+        {
+            demo_radio_cad_combination_results_t& combination =
+                this->results.combinations[this->results.nb_combinations];
+
+            combination.sf              = ( lr1110_radio_lora_sf_t )( LR1110_RADIO_LORA_SF5 + sf_index );
+            combination.frequency_hz    = frequency_hz;
+            combination.cad_duration_us = this->cad_settings.cad_symb_nb * this->GetSymbolDurationUs( combination.sf );
+            this->results.nb_combinations++;
+
+            frequency_hz += this->cad_settings.channel_spacing_hz;
+        }
+    }
+}
+
+void DemoRadioCad::StartCad( const demo_radio_cad_combination_results_t& combination ) const
+{
+    lr1110_radio_mod_params_lora_t modulation;
+    lr1110_radio_cad_params_t      cad_params;
+
+    modulation.sf   = combination.sf;
+    modulation.bw   = this->cad_settings.bw;
+    modulation.cr   = this->settings.modulation_lora.cr;
+    modulation.ldro =
+        ( this->GetSymbolDurationUs( combination.sf ) >= DEMO_RADIO_CAD_LDRO_SYMBOL_DURATION_US ) ? 1 : 0;
+
+    cad_params.cad_symb_nb     = this->cad_settings.cad_symb_nb;
+    cad_params.cad_detect_peak = this->cad_settings.cad_detect_peak;
+    cad_params.cad_detect_min  = this->cad_settings.cad_detect_min;
+    cad_params.cad_exit_mode   = LR1110_RADIO_CAD_EXIT_MODE_RX;
+    cad_params.cad_timeout     = this->GetRxTimeout( combination.sf );
+
+    lr1110_radio_set_rf_freq( this->device->GetRadio( ), combination.frequency_hz );
+    lr1110_radio_set_lora_mod_params( this->device->GetRadio( ), &modulation );
+    lr1110_radio_set_cad_params( this->device->GetRadio( ), &cad_params );
+    lr1110_radio_set_cad( this->device->GetRadio( ) );
+}
+
+void DemoRadioCad::EndCad( )
+{
+    demo_radio_cad_combination_results_t& combination = this->results.combinations[this->combination_index];
+
+    const DemoConsumptionModel* consumption_model = this->GetConsumptionModel( );
+    if( consumption_model != NULL )
+    {
+        const uint32_t rx_duration_per_cad_us =
+            ( uint32_t )( ( ( uint64_t ) combination.rx_duration_ms * 1000 ) / combination.nb_cads );
+
+        consumption_model->ComputeRadioCadEnergy( combination.cad_duration_us, rx_duration_per_cad_us,
+                                                  combination.energy_per_cad );
+    }
+
+    this->combination_index = ( this->combination_index + 1 ) % this->results.nb_combinations;
+    this->state             = DEMO_RADIO_CAD_STATE_START_CAD;
+
+    if( ( this->cad_settings.nb_cads != 0 ) && ( this->results.nb_cads >= this->cad_settings.nb_cads ) )
+    {
+        this->Terminate( );
+    }
+}
+
+uint32_t DemoRadioCad::GetSymbolDurationUs( const lr1110_radio_lora_sf_t sf ) const
+{
+    const uint32_t bw_in_hz = lr1110_radio_get_lora_bw_in_hz( this->cad_settings.bw );
+
+    if( bw_in_hz == 0 )
+    {
+        return 0;
+    }
+
+    return ( uint32_t )( ( ( uint64_t ) 1000000 << sf ) / bw_in_hz );
+}
+
+uint32_t DemoRadioCad::GetRxTimeout( const lr1110_radio_lora_sf_t sf ) const
+{
+    const uint32_t nb_symb    = this->settings.packet_lora.preamble_len_in_symb + DEMO_RADIO_CAD_HEADER_SYMB_NB;
+    const uint64_t rx_timeout = ( ( uint64_t ) nb_symb * this->GetSymbolDurationUs( sf ) * 32 ) / 1000;
+
+    return ( rx_timeout > DEMO_RADIO_CAD_RX_TIMEOUT_MAX ) ? DEMO_RADIO_CAD_RX_TIMEOUT_MAX : ( uint32_t ) rx_timeout;
+}
+
+void DemoRadioCad::SpecificInterruptHandler( ) {}
+
+void DemoRadioCad::ClearRegisteredIrqs( ) const
+{
+    lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+}
@@ -32,6 +32,11 @@
 #include "demo_radio_per.h"
 #include "lr1110_radio.h"
 
+#define DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH ( 4 )
+// The LR1110 counts the duty cycle periods on 24 bits, in steps of 1 / 32768 s
+#define DEMO_RADIO_PER_RTC_FREQUENCY_HZ ( 32768 )
+#define DEMO_RADIO_PER_RX_DUTY_CYCLE_PERIOD_MAX_MS ( 511999 )
+
 DemoRadioPer::DemoRadioPer( DeviceTransceiver* device, SignalingInterface* signaling, EnvironmentInterface* environment,
                             CommunicationInterface* communication_interface, demo_radio_per_mode_t mode )
     : DemoRadioInterface( device, signaling, communication_interface ),
@@ -40,8 +45,9 @@ DemoRadioPer::DemoRadioPer( DeviceTransceiver* device, SignalingInterface* signa
       has_intermediate_results( false ),
       mode( mode )
 {
-    this->results  = {};
-    this->settings = {};
+    this->results     = {};
+    this->settings    = {};
+    this->rx_settings = {};
 }
 
 DemoRadioPer::~DemoRadioPer( ) {}
@@ -84,7 +90,9 @@ void DemoRadioPer::SpecificRuntime( )
 
         lr1110_system_set_dio_irq_params(
             this->device->GetRadio( ),
-            LR1110_SYSTEM_IRQ_TX_DONE | LR1110_SYSTEM_IRQ_RX_DONE | LR1110_SYSTEM_IRQ_TIMEOUT, 0 );
+            LR1110_SYSTEM_IRQ_TX_DONE | LR1110_SYSTEM_IRQ_RX_DONE | LR1110_SYSTEM_IRQ_TIMEOUT |
+                LR1110_SYSTEM_IRQ_HEADER_ERROR,
+            0 );
         lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
 
         switch( mode )
@@ -108,6 +116,16 @@ void DemoRadioPer::SpecificRuntime( )
 
         this->last_event = now_ms;
 
+        this->listening_start_ms    = now_ms;
+        this->reception_duration_ms = 0;
+        this->has_sequence_number   = false;
+        this->time_on_air_ms =
+            ( this->settings.pkt_type == LR1110_RADIO_PKT_TYPE_LORA )
+                ? lr1110_radio_get_lora_time_on_air_in_ms( &this->settings.packet_lora,
+                                                           &this->settings.modulation_lora )
+                : lr1110_radio_get_gfsk_time_on_air_in_ms( &this->settings.packet_gfsk,
+                                                           &this->settings.modulation_gfsk );
+
         break;
     }
     case DEMO_RADIO_PER_STATE_SEND:
@@ -115,6 +133,15 @@ void DemoRadioPer::SpecificRuntime( )
         if( ( now_ms - this->last_event ) > 1000 )
         {
             this->SetWaitingForInterrupt( );
+            if( this->settings.payload_length >= DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH )
+            {
+                // The receiver derives the number of packets sent from this sequence number
+                const uint32_t sequence_number = this->settings.nb_of_packets - this->nb_of_packets_remaining;
+                for( uint8_t index = 0; index < DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH; index++ )
+                {
+                    this->buffer[index] = ( uint8_t )( sequence_number >> ( 8 * index ) );
+                }
+            }
             lr1110_regmem_write_buffer8( this->device->GetRadio( ), this->buffer, this->settings.payload_length );
             this->last_event = now_ms;
             lr1110_radio_set_tx( this->device->GetRadio( ), 0x00000000 );
@@ -148,7 +175,7 @@ void DemoRadioPer::SpecificRuntime( )
 
     case DEMO_RADIO_PER_STATE_SET_RX:
     {
-        lr1110_radio_set_rx( this->device->GetRadio( ), 0x00000000 );
+        this->StartRx( );
         this->state = DEMO_RADIO_PER_STATE_WAIT_FOR_RX_DONE;
         break;
     }
@@ -166,6 +193,7 @@ void DemoRadioPer::SpecificRuntime( )
             {
                 lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
                 this->results.count_rx_wrong_packet++;
+                this->reception_duration_ms += this->time_on_air_ms;
                 this->has_intermediate_results = true;
                 this->state                    = DEMO_RADIO_PER_STATE_SET_RX;
             }
@@ -173,12 +201,23 @@ void DemoRadioPer::SpecificRuntime( )
             {
                 this->signaling->Rx( );
                 lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+                this->UpdateSequenceNumber( );
                 this->results.count_rx_correct_packet++;
+                this->reception_duration_ms += this->time_on_air_ms;
+                this->has_intermediate_results = true;
+                this->state                    = DEMO_RADIO_PER_STATE_SET_RX;
+            }
+            else if( irq_status & LR1110_SYSTEM_IRQ_TIMEOUT )
+            {
+                // The duty cycle detected a preamble that no packet followed
+                lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+                this->results.count_rx_timeout++;
                 this->has_intermediate_results = true;
                 this->state                    = DEMO_RADIO_PER_STATE_SET_RX;
             }
             this->ClearRegisteredIrqs( );
         }
+        this->UpdateAverageCurrent( now_ms );
         break;
     }
 
@@ -200,10 +239,13 @@ void DemoRadioPer::SpecificStop( )
 {
     lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
 
-    this->results.count_tx                = 0;
-    this->results.count_rx_correct_packet = 0;
-    this->results.count_rx_wrong_packet   = 0;
-    this->results.count_rx_timeout        = 0;
+    this->results.count_tx                 = 0;
+    this->results.count_rx_correct_packet  = 0;
+    this->results.count_rx_wrong_packet    = 0;
+    this->results.count_rx_timeout         = 0;
+    this->results.count_rx_expected_packet = 0;
+    this->results.listening_duration_ms    = 0;
+    this->results.average_current_ua       = 0;
 
     this->state = DEMO_RADIO_PER_STATE_INIT;
 }
@@ -214,6 +256,84 @@ void DemoRadioPer::SpecificInterruptHandler( ) {}
 
 void DemoRadioPer::ClearRegisteredIrqs( ) const {}
 
+void DemoRadioPer::ConfigureRx( const demo_radio_per_rx_settings_t& rx_settings ) { this->rx_settings = rx_settings; }
+
+bool DemoRadioPer::IsRxDutyCycleValid( const demo_radio_per_rx_settings_t& rx_settings )
+{
+    if( rx_settings.sleep_period_ms == 0 )
+    {
+        return true;
+    }
+
+    return ( rx_settings.rx_period_ms != 0 ) &&
+           ( rx_settings.rx_period_ms <= DEMO_RADIO_PER_RX_DUTY_CYCLE_PERIOD_MAX_MS ) &&
+           ( rx_settings.sleep_period_ms <= DEMO_RADIO_PER_RX_DUTY_CYCLE_PERIOD_MAX_MS );
+}
+
+void DemoRadioPer::StartRx( ) const
+{
+    if( this->rx_settings.sleep_period_ms == 0 )
+    {
+        lr1110_radio_set_rx( this->device->GetRadio( ), 0x00000000 );
+    }
+    else
+    {
+        lr1110_radio_set_rx_duty_cycle( this->device->GetRadio( ),
+                                        DemoRadioPer::ConvertMsToRtcSteps( this->rx_settings.rx_period_ms ),
+                                        DemoRadioPer::ConvertMsToRtcSteps( this->rx_settings.sleep_period_ms ),
+                                        LR1110_RADIO_RX_DUTY_CYCLE_MODE_RX );
+    }
+}
+
+void DemoRadioPer::UpdateSequenceNumber( )
+{
+    lr1110_radio_rx_buffer_status_t buffer_status;
+    uint8_t                         sequence_buffer[DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH];
+    uint32_t                        sequence_number = 0;
+
+    lr1110_radio_get_rx_buffer_status( this->device->GetRadio( ), &buffer_status );
+    if( buffer_status.pld_len_in_bytes < DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH )
+    {
+        return;
+    }
+
+    lr1110_regmem_read_buffer8( this->device->GetRadio( ), sequence_buffer, buffer_status.buffer_start_pointer,
+                                DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH );
+    for( uint8_t index = 0; index < DEMO_RADIO_PER_SEQUENCE_NUMBER_LENGTH; index++ )
+    {
+        sequence_number |= ( uint32_t ) sequence_buffer[index] << ( 8 * index );
+    }
+
+    if( ( this->has_sequence_number == false ) || ( sequence_number <= this->last_sequence_number ) )
+    {
+        // First packet or restarted transmitter: move the origin so that this packet is the next one expected. The
+        // modular arithmetic keeps the count of the previous sequences
+        this->first_sequence_number = sequence_number - this->results.count_rx_expected_packet;
+        this->has_sequence_number   = true;
+    }
+
+    this->last_sequence_number             = sequence_number;
+    this->results.count_rx_expected_packet = sequence_number - this->first_sequence_number + 1;
+}
+
+void DemoRadioPer::UpdateAverageCurrent( const uint32_t now_ms )
+{
+    const DemoConsumptionModel* consumption_model = this->GetConsumptionModel( );
+
+    this->results.listening_duration_ms = now_ms - this->listening_start_ms;
+    this->results.average_current_ua =
+        ( consumption_model != NULL )
+            ? consumption_model->ComputeRadioRxAverageCurrent(
+                  this->rx_settings.rx_period_ms, this->rx_settings.sleep_period_ms,
+                  this->results.listening_duration_ms, this->reception_duration_ms )
+            : 0;
+}
+
+uint32_t DemoRadioPer::ConvertMsToRtcSteps( const uint32_t duration_ms )
+{
+    return ( uint32_t )( ( ( uint64_t ) duration_ms * DEMO_RADIO_PER_RTC_FREQUENCY_HZ ) / 1000 );
+}
+
 bool DemoRadioPer::HasIntermediateResults( ) const { return this->has_intermediate_results; }
 
 const demo_radio_per_results_t* DemoRadioPer::GetResult( ) const { return &this->results; }
@@ -0,0 +1,206 @@
+/**
+ * @file      demo_radio_spectrum.cpp
+ *
+ * @brief     Implementation of RSSI spectrum sweep demo.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_radio_spectrum.h"
+#include "lr1110_radio.h"
+#include <string.h>
+
+// Bins measured per call of the runtime, so that a sweep does not hold the GUI and the host communication
+#define DEMO_RADIO_SPECTRUM_BINS_PER_RUNTIME ( 16 )
+
+// The modulation does not matter to measure the RSSI, only the receiver bandwidth does
+#define DEMO_RADIO_SPECTRUM_GFSK_BITRATE ( 4800 )
+#define DEMO_RADIO_SPECTRUM_GFSK_FDEV ( 2400 )
+
+#define DEMO_RADIO_SPECTRUM_RX_CONTINUOUS ( 0xFFFFFF )
+
+DemoRadioSpectrum::DemoRadioSpectrum( DeviceTransceiver* device, SignalingInterface* signaling,
+                                      EnvironmentInterface* environment,
+                                      CommunicationInterface* communication_interface )
+    : DemoTransceiverBase( device, signaling, communication_interface ),
+      environment( environment ),
+      state( DEMO_RADIO_SPECTRUM_STATE_INIT ),
+      nb_bins( 0 ),
+      next_bin( 0 ),
+      nb_sweeps( 0 ),
+      sweep_start_ms( 0 ),
+      has_intermediate_results( false )
+{
+    this->settings = {};
+    this->results  = {};
+}
+
+DemoRadioSpectrum::~DemoRadioSpectrum( ) {}
+
+void DemoRadioSpectrum::Configure( const demo_radio_spectrum_settings_t& settings )
+{
+    this->settings = settings;
+    this->nb_bins  = DemoRadioSpectrum::GetNbBins( settings );
+
+    if( this->settings.nb_samples == 0 )
+    {
+        this->settings.nb_samples = 1;
+    }
+}
+
+uint8_t DemoRadioSpectrum::GetNbBins( const demo_radio_spectrum_settings_t& settings )
+{
+    if( ( settings.step_hz == 0 ) || ( settings.stop_frequency_hz <= settings.start_frequency_hz ) )
+    {
+        return 0;
+    }
+
+    const uint32_t nb_bins = ( settings.stop_frequency_hz - settings.start_frequency_hz ) / settings.step_hz;
+
+    return ( nb_bins > DEMO_RADIO_SPECTRUM_MAX_BINS ) ? DEMO_RADIO_SPECTRUM_MAX_BINS : ( uint8_t ) nb_bins;
+}
+
+void DemoRadioSpectrum::SpecificRuntime( )
+{
+    this->has_intermediate_results = false;
+
+    switch( this->state )
+    {
+    case DEMO_RADIO_SPECTRUM_STATE_INIT:
+    {
+        if( this->nb_bins == 0 )
+        {
+            this->communication_interface->Log( "Invalid spectrum range\n" );
+            this->Terminate( );
+            break;
+        }
+
+        this->ConfigureRadio( );
+
+        this->results                    = {};
+        this->results.start_frequency_hz = this->settings.start_frequency_hz;
+        this->results.step_hz            = this->settings.step_hz;
+        this->results.nb_bins            = this->nb_bins;
+
+        this->next_bin       = 0;
+        this->nb_sweeps      = 0;
+        this->sweep_start_ms = this->environment->GetLocalTimeMilliseconds( );
+        this->state          = DEMO_RADIO_SPECTRUM_STATE_SWEEP;
+        break;
+    }
+    case DEMO_RADIO_SPECTRUM_STATE_SWEEP:
+    {
+        for( uint8_t count = 0; ( count < DEMO_RADIO_SPECTRUM_BINS_PER_RUNTIME ) && ( this->next_bin < this->nb_bins );
+             count++ )
+        {
+            this->MeasureBin( this->next_bin );
+            this->next_bin++;
+        }
+
+        if( this->next_bin == this->nb_bins )
+        {
+            const uint32_t now_ms = this->environment->GetLocalTimeMilliseconds( );
+
+            this->nb_sweeps++;
+            this->results.sweep_index       = this->nb_sweeps;
+            this->results.sweep_duration_ms = now_ms - this->sweep_start_ms;
+            memcpy( this->results.bins, this->sweep_bins, this->nb_bins * sizeof( demo_radio_spectrum_bin_t ) );
+            this->has_intermediate_results = true;
+            this->signaling->Rx( );
+
+            this->next_bin       = 0;
+            this->sweep_start_ms = now_ms;
+
+            if( ( this->settings.nb_sweeps != 0 ) && ( this->nb_sweeps >= this->settings.nb_sweeps ) )
+            {
+                this->Terminate( );
+            }
+        }
+        break;
+    }
+    }
+}
+
+void DemoRadioSpectrum::SpecificStop( )
+{
+    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+
+    this->has_intermediate_results = false;
+    this->state                    = DEMO_RADIO_SPECTRUM_STATE_INIT;
+}
+
+void DemoRadioSpectrum::ConfigureRadio( ) const
+{
+    lr1110_radio_mod_params_gfsk_t modulation;
+
+    modulation.br_in_bps   = DEMO_RADIO_SPECTRUM_GFSK_BITRATE;
+    modulation.fdev_in_hz  = DEMO_RADIO_SPECTRUM_GFSK_FDEV;
+    modulation.pulse_shape = LR1110_RADIO_GFSK_PULSE_SHAPE_BT_05;
+    lr1110_radio_get_gfsk_rx_bandwidth( this->settings.step_hz, &modulation.bw_dsb_param );
+
+    this->device->ResetAndInit( );
+    lr1110_radio_set_pkt_type( this->device->GetRadio( ), LR1110_RADIO_PKT_TYPE_GFSK );
+    lr1110_radio_set_gfsk_mod_params( this->device->GetRadio( ), &modulation );
+}
+
+void DemoRadioSpectrum::MeasureBin( const uint8_t bin_index )
+{
+    const uint32_t frequency_hz =
+        this->settings.start_frequency_hz + ( bin_index * this->settings.step_hz ) + ( this->settings.step_hz / 2 );
+    int8_t  rssi     = 0;
+    int8_t  peak     = INT8_MIN;
+    int16_t rssi_sum = 0;
+
+    // The frequency can only be changed out of reception, the synthesizer is kept running in between
+    lr1110_system_set_fs( this->device->GetRadio( ) );
+    lr1110_radio_set_rf_freq( this->device->GetRadio( ), frequency_hz );
+    lr1110_radio_set_rx( this->device->GetRadio( ), DEMO_RADIO_SPECTRUM_RX_CONTINUOUS );
+
+    // The first sample is discarded as it may have been taken before the receiver settled
+    lr1110_radio_get_rssi_inst( this->device->GetRadio( ), &rssi );
+
+    for( uint8_t sample = 0; sample < this->settings.nb_samples; sample++ )
+    {
+        lr1110_radio_get_rssi_inst( this->device->GetRadio( ), &rssi );
+
+        rssi_sum += rssi;
+        if( rssi > peak )
+        {
+            peak = rssi;
+        }
+    }
+
+    this->sweep_bins[bin_index].peak_rssi    = peak;
+    this->sweep_bins[bin_index].average_rssi = ( int8_t )( rssi_sum / this->settings.nb_samples );
+}
+
+void DemoRadioSpectrum::SpecificInterruptHandler( ) {}
+
+void DemoRadioSpectrum::ClearRegisteredIrqs( ) const {}
+
+bool DemoRadioSpectrum::HasIntermediateResults( ) const { return this->has_intermediate_results; }
+
+const demo_radio_spectrum_results_t* DemoRadioSpectrum::GetResult( ) const { return &this->results; }
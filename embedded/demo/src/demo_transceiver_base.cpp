@@ -33,6 +33,13 @@
 
 DemoTransceiverBase::DemoTransceiverBase( DeviceTransceiver* device, SignalingInterface* signaling,
                                           CommunicationInterface* communication_interface )
-    : DemoBase( device, signaling, communication_interface )
+    : DemoBase( device, signaling, communication_interface ), consumption_model( NULL )
 {
-}
\ No newline at end of file
+}
+
+void DemoTransceiverBase::SetConsumptionModel( const DemoConsumptionModel* consumption_model )
+{
+    this->consumption_model = consumption_model;
+}
+
+const DemoConsumptionModel* DemoTransceiverBase::GetConsumptionModel( ) const { return this->consumption_model; }
\ No newline at end of file
@@ -0,0 +1,236 @@
+/**
+ * @file      demo_wifi_adaptive_scan.cpp
+ *
+ * @brief     Adaptive tuning of the Wi-Fi scan timeouts
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "demo_wifi_adaptive_scan.h"
+
+#define DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS ( 30 )
+#define DEMO_WIFI_ADAPTIVE_SCAN_MAX_TIMEOUT_FACTOR ( 2 )
+#define DEMO_WIFI_ADAPTIVE_SCAN_EMPTY_STREAK_MIN ( 3 )
+#define DEMO_WIFI_ADAPTIVE_SCAN_FULL_PLAN_PERIOD ( 8 )
+#define DEMO_WIFI_ADAPTIVE_SCAN_AVERAGE_SHIFT ( 2 )
+#define DEMO_WIFI_ADAPTIVE_SCAN_FIXED_POINT ( 16 )
+
+DemoWifiAdaptiveScan::DemoWifiAdaptiveScan( ) { this->Clear( ); }
+
+DemoWifiAdaptiveScan::~DemoWifiAdaptiveScan( ) {}
+
+void DemoWifiAdaptiveScan::Clear( )
+{
+    memset( this->history, 0, sizeof( this->history ) );
+    this->nb_plans                 = 0;
+    this->nb_plans_since_full_plan = 0;
+}
+
+void DemoWifiAdaptiveScan::Plan( const lr1110_wifi_channel_mask_t channels, const uint16_t timeout_ms,
+                                 const uint8_t nbr_retrials, const uint16_t time_budget_ms,
+                                 demo_wifi_adaptive_scan_plan_t& plan )
+{
+    demo_wifi_adaptive_scan_step_t candidates[DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS];
+    uint32_t                       priorities[DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS];
+    uint8_t                        nb_candidates = 0;
+
+    const uint8_t  retrials     = ( nbr_retrials != 0 ) ? nbr_retrials : 1;
+    const bool     is_full_plan = ( this->nb_plans_since_full_plan == 0 );
+    const uint32_t max_timeout_ms = ( timeout_ms > DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS )
+                                        ? timeout_ms * DEMO_WIFI_ADAPTIVE_SCAN_MAX_TIMEOUT_FACTOR
+                                        : DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS;
+
+    memset( &plan, 0, sizeof( plan ) );
+
+    // First pass: the channels with a fixed timeout reserve their time, the others share the rest of the budget
+    uint32_t reserved_ms  = 0;
+    uint32_t total_weight = 0;
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS; index++ )
+    {
+        if( ( channels & ( 1 << index ) ) == 0 )
+        {
+            continue;
+        }
+
+        const channel_history_t& history = this->history[index];
+
+        if( ( is_full_plan == true ) || ( history.nb_updates == 0 ) )
+        {
+            reserved_ms += timeout_ms * retrials;
+        }
+        else if( this->IsProbeOnly( history ) == true )
+        {
+            reserved_ms += DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS * retrials;
+        }
+        else
+        {
+            total_weight += DEMO_WIFI_ADAPTIVE_SCAN_FIXED_POINT + history.expected_results_x16;
+        }
+        nb_candidates++;
+    }
+
+    if( nb_candidates == 0 )
+    {
+        return;
+    }
+
+    const uint32_t budget_ms =
+        ( time_budget_ms != 0 ) ? time_budget_ms : ( uint32_t ) timeout_ms * retrials * nb_candidates;
+    const uint32_t shared_budget_ms = ( budget_ms > reserved_ms ) ? budget_ms - reserved_ms : 0;
+
+    // Second pass: compute the timeouts, and sort the channels by decreasing priority
+    nb_candidates = 0;
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS; index++ )
+    {
+        if( ( channels & ( 1 << index ) ) == 0 )
+        {
+            continue;
+        }
+
+        const channel_history_t& history    = this->history[index];
+        uint32_t                 timeout    = timeout_ms;
+        const uint32_t           priority   = this->GetYield( history );
+        uint8_t                  insert_idx = nb_candidates;
+
+        if( ( is_full_plan == false ) && ( history.nb_updates != 0 ) )
+        {
+            if( this->IsProbeOnly( history ) == true )
+            {
+                timeout = DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS;
+            }
+            else
+            {
+                const uint32_t weight = DEMO_WIFI_ADAPTIVE_SCAN_FIXED_POINT + history.expected_results_x16;
+
+                timeout = ( shared_budget_ms * weight ) / ( total_weight * retrials );
+                if( timeout < DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS )
+                {
+                    timeout = DEMO_WIFI_ADAPTIVE_SCAN_PROBE_TIMEOUT_MS;
+                }
+                else if( timeout > max_timeout_ms )
+                {
+                    timeout = max_timeout_ms;
+                }
+            }
+        }
+
+        while( ( insert_idx > 0 ) && ( priorities[insert_idx - 1] < priority ) )
+        {
+            candidates[insert_idx] = candidates[insert_idx - 1];
+            priorities[insert_idx] = priorities[insert_idx - 1];
+            insert_idx--;
+        }
+        candidates[insert_idx].channel    = index + 1;
+        candidates[insert_idx].timeout_ms = ( uint16_t ) timeout;
+        priorities[insert_idx]            = priority;
+        nb_candidates++;
+    }
+
+    // Last pass: keep the channels fitting in the budget, the first one being always scanned
+    uint32_t planned_ms = 0;
+    for( uint8_t index = 0; index < nb_candidates; index++ )
+    {
+        const uint32_t cost_ms = ( uint32_t ) candidates[index].timeout_ms * retrials;
+
+        if( ( plan.nb_steps != 0 ) && ( ( planned_ms + cost_ms ) > budget_ms ) )
+        {
+            continue;
+        }
+
+        plan.steps[plan.nb_steps] = candidates[index];
+        plan.channels |= ( 1 << ( candidates[index].channel - 1 ) );
+        plan.nb_steps++;
+        planned_ms += cost_ms;
+    }
+
+    if( this->nb_plans < UINT16_MAX )
+    {
+        this->nb_plans++;
+    }
+    this->nb_plans_since_full_plan = ( this->nb_plans_since_full_plan + 1 ) % DEMO_WIFI_ADAPTIVE_SCAN_FULL_PLAN_PERIOD;
+}
+
+void DemoWifiAdaptiveScan::Update( const demo_wifi_channel_t channel, const uint8_t nb_results,
+                                   const uint32_t duration_us )
+{
+    if( ( channel == 0 ) || ( channel > DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS ) )
+    {
+        return;
+    }
+
+    channel_history_t& history = this->history[channel - 1];
+
+    const int32_t sample_x16  = nb_results * DEMO_WIFI_ADAPTIVE_SCAN_FIXED_POINT;
+    const int32_t duration_ms = ( duration_us + 500 ) / 1000;
+
+    if( history.nb_updates == 0 )
+    {
+        history.expected_results_x16 = sample_x16;
+        history.duration_ms          = duration_ms;
+    }
+    else
+    {
+        history.expected_results_x16 +=
+            ( sample_x16 - ( int32_t ) history.expected_results_x16 ) / ( 1 << DEMO_WIFI_ADAPTIVE_SCAN_AVERAGE_SHIFT );
+        history.duration_ms +=
+            ( duration_ms - ( int32_t ) history.duration_ms ) / ( 1 << DEMO_WIFI_ADAPTIVE_SCAN_AVERAGE_SHIFT );
+    }
+
+    if( history.nb_updates < UINT8_MAX )
+    {
+        history.nb_updates++;
+    }
+
+    if( nb_results != 0 )
+    {
+        history.empty_streak = 0;
+    }
+    else if( history.empty_streak < UINT8_MAX )
+    {
+        history.empty_streak++;
+    }
+}
+
+uint16_t DemoWifiAdaptiveScan::GetNbPlans( ) const { return this->nb_plans; }
+
+bool DemoWifiAdaptiveScan::IsProbeOnly( const channel_history_t& history ) const
+{
+    return ( history.nb_updates != 0 ) && ( history.empty_streak >= DEMO_WIFI_ADAPTIVE_SCAN_EMPTY_STREAK_MIN );
+}
+
+uint32_t DemoWifiAdaptiveScan::GetYield( const channel_history_t& history ) const
+{
+    // Channels never scanned come first, so that their history gets built
+    if( history.nb_updates == 0 )
+    {
+        return UINT32_MAX;
+    }
+
+    const uint32_t duration_ms = ( history.duration_ms != 0 ) ? history.duration_ms : 1;
+
+    return ( ( uint32_t ) history.expected_results_x16 * 1000 ) / duration_ms;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file      demo_wifi_ap_table.cpp
+ *
+ * @brief     Aggregation of the Wi-Fi access points detected across scans
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "demo_wifi_ap_table.h"
+
+demo_wifi_ap_entry_t DemoWifiApTable::entries[DEMO_WIFI_AP_TABLE_MAX_ENTRIES];
+
+DemoWifiApTable::DemoWifiApTable( EnvironmentInterface* environment ) : environment( environment )
+{
+    this->Clear( );
+}
+
+DemoWifiApTable::~DemoWifiApTable( ) {}
+
+void DemoWifiApTable::Clear( )
+{
+    this->count    = 0;
+    this->nb_scans = 0;
+}
+
+void DemoWifiApTable::Merge( const demo_wifi_scan_all_results_t& results )
+{
+    if( results.error == true )
+    {
+        return;
+    }
+
+    const uint32_t local_instant_s = this->environment->GetLocalTimeSeconds( );
+
+    for( uint8_t index = 0; index < results.nbrResults; index++ )
+    {
+        const demo_wifi_scan_single_result_t& result = results.results[index];
+        demo_wifi_ap_entry_t*                 entry  = this->FindOrAllocateEntry( result.mac_address );
+
+        if( entry->nb_detections == 0 )
+        {
+            entry->rssi_min = result.rssi;
+            entry->rssi_max = result.rssi;
+            entry->rssi_sum = 0;
+        }
+        else
+        {
+            if( result.rssi < entry->rssi_min )
+            {
+                entry->rssi_min = result.rssi;
+            }
+            if( result.rssi > entry->rssi_max )
+            {
+                entry->rssi_max = result.rssi;
+            }
+        }
+
+        // Saturate the counter rather than wrapping, the sum staying consistent with it
+        if( entry->nb_detections < UINT16_MAX )
+        {
+            entry->nb_detections++;
+            entry->rssi_sum += result.rssi;
+        }
+        entry->channel                   = result.channel;
+        entry->type                      = result.type;
+        memcpy( entry->country_code, result.country_code, LR1110_WIFI_STR_COUNTRY_CODE_SIZE );
+        entry->local_instant_last_seen_s = local_instant_s;
+    }
+
+    if( this->nb_scans < UINT16_MAX )
+    {
+        this->nb_scans++;
+    }
+}
+
+uint8_t DemoWifiApTable::GetCount( ) const { return this->count; }
+
+uint16_t DemoWifiApTable::GetNbScans( ) const { return this->nb_scans; }
+
+const demo_wifi_ap_entry_t* DemoWifiApTable::GetEntry( const uint8_t index ) const
+{
+    if( index < this->count )
+    {
+        return &this->entries[index];
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+int8_t DemoWifiApTable::GetRssiMean( const demo_wifi_ap_entry_t& entry )
+{
+    if( entry.nb_detections == 0 )
+    {
+        return 0;
+    }
+
+    // Round to the nearest integer, the sum being negative most of the time
+    const int32_t half_count = entry.nb_detections / 2;
+    const int32_t rounded_sum = ( entry.rssi_sum < 0 ) ? entry.rssi_sum - half_count : entry.rssi_sum + half_count;
+
+    return ( int8_t )( rounded_sum / ( int32_t ) entry.nb_detections );
+}
+
+demo_wifi_ap_entry_t* DemoWifiApTable::FindOrAllocateEntry( const demo_wifi_mac_address_t mac_address )
+{
+    uint8_t oldest_index = 0;
+
+    for( uint8_t index = 0; index < this->count; index++ )
+    {
+        if( memcmp( this->entries[index].mac_address, mac_address, DEMO_TYPE_WIFI_MAC_ADDRESS_LENGTH ) == 0 )
+        {
+            return &this->entries[index];
+        }
+
+        if( this->entries[index].local_instant_last_seen_s <
+            this->entries[oldest_index].local_instant_last_seen_s )
+        {
+            oldest_index = index;
+        }
+    }
+
+    demo_wifi_ap_entry_t* entry =
+        ( this->count < DEMO_WIFI_AP_TABLE_MAX_ENTRIES ) ? &this->entries[this->count++] : &this->entries[oldest_index];
+
+    memcpy( entry->mac_address, mac_address, DEMO_TYPE_WIFI_MAC_ADDRESS_LENGTH );
+    entry->nb_detections = 0;
+
+    return entry;
+}
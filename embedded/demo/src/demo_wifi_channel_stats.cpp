@@ -0,0 +1,160 @@
+/**
+ * @file      demo_wifi_channel_stats.cpp
+ *
+ * @brief     Occupancy statistics of the Wi-Fi channels across scans
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "demo_wifi_channel_stats.h"
+
+#define DEMO_WIFI_CHANNEL_STATS_RSSI_LOWEST_EDGE ( -90 )
+#define DEMO_WIFI_CHANNEL_STATS_RSSI_BIN_WIDTH ( 10 )
+
+DemoWifiChannelStats::DemoWifiChannelStats( ) { this->Clear( ); }
+
+DemoWifiChannelStats::~DemoWifiChannelStats( ) {}
+
+void DemoWifiChannelStats::Clear( )
+{
+    memset( this->channels, 0, sizeof( this->channels ) );
+    this->nb_scans = 0;
+}
+
+void DemoWifiChannelStats::Merge( const demo_wifi_scan_all_results_t& results,
+                                  const lr1110_wifi_channel_mask_t    channels )
+{
+    uint8_t nb_ap_per_channel[DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS] = { 0 };
+    uint8_t nb_channels_scanned                                     = 0;
+
+    if( results.error == true )
+    {
+        return;
+    }
+
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS; index++ )
+    {
+        if( ( channels & ( 1 << index ) ) != 0 )
+        {
+            nb_channels_scanned++;
+        }
+    }
+
+    if( nb_channels_scanned == 0 )
+    {
+        return;
+    }
+
+    for( uint8_t index = 0; index < results.nbrResults; index++ )
+    {
+        const demo_wifi_scan_single_result_t& result = results.results[index];
+
+        if( ( result.channel == 0 ) || ( result.channel > DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS ) )
+        {
+            continue;
+        }
+
+        demo_wifi_channel_stats_t& stats = this->channels[result.channel - 1];
+
+        if( ( stats.nb_detections == 0 ) || ( result.rssi > stats.rssi_max ) )
+        {
+            stats.rssi_max = result.rssi;
+        }
+        if( stats.nb_detections < UINT16_MAX )
+        {
+            stats.nb_detections++;
+        }
+
+        uint16_t& bin = stats.rssi_histogram[DemoWifiChannelStats::GetRssiBin( result.rssi )];
+        if( bin < UINT16_MAX )
+        {
+            bin++;
+        }
+
+        nb_ap_per_channel[result.channel - 1]++;
+    }
+
+    // The cumulative timings cover all the channels of the scan, so they are shared evenly between them
+    const uint32_t scan_time_us = results.timings.rx_detection_us + results.timings.rx_correlation_us +
+                                  results.timings.rx_capture_us + results.timings.demodulation_us;
+    const uint32_t dwell_time_us = scan_time_us / nb_channels_scanned;
+
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS; index++ )
+    {
+        if( ( channels & ( 1 << index ) ) == 0 )
+        {
+            continue;
+        }
+
+        demo_wifi_channel_stats_t& stats = this->channels[index];
+
+        if( stats.nb_scans < UINT16_MAX )
+        {
+            stats.nb_scans++;
+        }
+        stats.nb_ap_last_scan = nb_ap_per_channel[index];
+        if( nb_ap_per_channel[index] > stats.nb_ap_max_per_scan )
+        {
+            stats.nb_ap_max_per_scan = nb_ap_per_channel[index];
+        }
+        stats.dwell_time_us += dwell_time_us;
+    }
+
+    if( this->nb_scans < UINT16_MAX )
+    {
+        this->nb_scans++;
+    }
+}
+
+uint16_t DemoWifiChannelStats::GetNbScans( ) const { return this->nb_scans; }
+
+const demo_wifi_channel_stats_t* DemoWifiChannelStats::GetChannel( const demo_wifi_channel_t channel ) const
+{
+    if( ( channel > 0 ) && ( channel <= DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS ) )
+    {
+        return &this->channels[channel - 1];
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+uint8_t DemoWifiChannelStats::GetRssiBin( const int8_t rssi )
+{
+    if( rssi < DEMO_WIFI_CHANNEL_STATS_RSSI_LOWEST_EDGE )
+    {
+        return 0;
+    }
+    else
+    {
+        const uint8_t bin =
+            1 + ( rssi - DEMO_WIFI_CHANNEL_STATS_RSSI_LOWEST_EDGE ) / DEMO_WIFI_CHANNEL_STATS_RSSI_BIN_WIDTH;
+
+        return ( bin < DEMO_WIFI_CHANNEL_STATS_RSSI_BINS ) ? bin : ( DEMO_WIFI_CHANNEL_STATS_RSSI_BINS - 1 );
+    }
+}
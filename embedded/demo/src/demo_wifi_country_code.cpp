@@ -44,6 +44,8 @@ DemoWifiCountryCode::~DemoWifiCountryCode( ) {}
 
 void DemoWifiCountryCode::Configure( demo_wifi_country_code_settings_t& config ) { this->settings = config; }
 
+lr1110_wifi_channel_mask_t DemoWifiCountryCode::GetChannelMask( ) const { return this->settings.channels; }
+
 void DemoWifiCountryCode::ExecuteScan( radio_t* radio )
 {
     lr1110_wifi_search_country_code( radio, this->settings.channels, this->settings.max_results,
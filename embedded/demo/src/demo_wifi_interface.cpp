@@ -32,14 +32,12 @@
 #include "demo_wifi_interface.h"
 #include "lr1110_wifi.h"
 
-#define WIFI_DEMO_CONSUMPTION_DCDC_CORRELATION_MA ( 12 )
-#define WIFI_DEMO_CONSUMPTION_DCDC_DEMODULATION_MA ( 4 )
-#define WIFI_DEMO_CONSUMPTION_LDO_CORRELATION_MA ( 24 )
-#define WIFI_DEMO_CONSUMPTION_LDO_DEMODULATION_MA ( 8 )
-
 DemoWifiInterface::DemoWifiInterface( DeviceTransceiver* device, SignalingInterface* signaling,
                                       CommunicationInterface* communication_interface )
-    : DemoTransceiverBase( device, signaling, communication_interface ), state( DEMO_WIFI_INIT )
+    : DemoTransceiverBase( device, signaling, communication_interface ),
+      state( DEMO_WIFI_INIT ),
+      ap_table( NULL ),
+      channel_stats( NULL )
 {
     wifi_irq = LR1110_SYSTEM_IRQ_WIFI_SCAN_DONE;
 }
@@ -52,6 +50,7 @@ void DemoWifiInterface::Reset( )
     this->state                          = DEMO_WIFI_INIT;
     this->results.nbrResults             = 0;
     this->results.global_consumption_uas = 0;
+    this->results.energy                 = {};
 
     uint32_t irq_to_en_dio1 = LR1110_SYSTEM_IRQ_WIFI_SCAN_DONE;
     uint32_t irq_to_en_dio2 = 0x00;
@@ -125,17 +124,30 @@ void DemoWifiInterface::SpecificRuntime( )
     case DEMO_WIFI_GET_RESULTS:
     {
         this->FetchAndSaveResults( this->device->GetRadio( ) );
+        if( this->HasPendingScan( ) == true )
+        {
+            this->state = DEMO_WIFI_SCAN;
+            break;
+        }
+
         lr1110_wifi_cumulative_timings_t wifi_results_timings = { 0 };
 
         lr1110_wifi_read_cumulative_timing( this->device->GetRadio( ), &wifi_results_timings );
 
-        uint32_t consumption_uas =
-            DemoWifiInterface::ComputeConsumption( LR1110_SYSTEM_REG_MODE_DCDC, wifi_results_timings );
+        this->AddEnergyToResults( LR1110_SYSTEM_REG_MODE_DCDC, wifi_results_timings );
         results.timings = wifi_results_timings;
-        results.global_consumption_uas += consumption_uas;
-        results.error = false;
+        results.error   = false;
         this->state   = DEMO_WIFI_TERMINATED;
 
+        if( this->ap_table != NULL )
+        {
+            this->ap_table->Merge( this->results );
+        }
+        if( this->channel_stats != NULL )
+        {
+            this->channel_stats->Merge( this->results, this->GetChannelMask( ) );
+        }
+
         break;
     }
 
@@ -171,28 +183,31 @@ const char* DemoWifiInterface::state2str( const demo_wifi_state_t state )
 
 const demo_wifi_scan_all_results_t* DemoWifiInterface::GetResult( ) const { return &this->results; }
 
-uint32_t DemoWifiInterface::ComputeConsumption( const lr1110_system_reg_mode_t          regMode,
-                                                const lr1110_wifi_cumulative_timings_t& timing )
+bool DemoWifiInterface::HasPendingScan( ) const { return false; }
+
+void DemoWifiInterface::SetApTable( DemoWifiApTable* ap_table ) { this->ap_table = ap_table; }
+
+void DemoWifiInterface::SetChannelStats( DemoWifiChannelStats* channel_stats )
+{
+    this->channel_stats = channel_stats;
+}
+
+void DemoWifiInterface::AddEnergyToResults( const lr1110_system_reg_mode_t          reg_mode,
+                                            const lr1110_wifi_cumulative_timings_t& timings )
 {
-    uint32_t consumption_uas = 0;
+    const DemoConsumptionModel* consumption_model = this->GetConsumptionModel( );
+    demo_wifi_energy_t          energy            = {};
 
-    switch( regMode )
+    if( consumption_model == NULL )
     {
-    case LR1110_SYSTEM_REG_MODE_LDO:
-        consumption_uas =
-            ( ( timing.rx_correlation_us + timing.rx_capture_us ) * WIFI_DEMO_CONSUMPTION_LDO_CORRELATION_MA +
-              timing.demodulation_us * WIFI_DEMO_CONSUMPTION_LDO_DEMODULATION_MA ) /
-            1000;
-        break;
-    case LR1110_SYSTEM_REG_MODE_DCDC:
-        consumption_uas =
-            ( ( timing.rx_correlation_us + timing.rx_capture_us ) * WIFI_DEMO_CONSUMPTION_DCDC_CORRELATION_MA +
-              timing.demodulation_us * WIFI_DEMO_CONSUMPTION_DCDC_DEMODULATION_MA ) /
-            1000;
-        break;
+        return;
     }
 
-    return consumption_uas;
+    this->results.global_consumption_uas += consumption_model->ComputeWifiEnergy( reg_mode, timings, energy );
+    this->results.energy.detection_uas += energy.detection_uas;
+    this->results.energy.correlation_uas += energy.correlation_uas;
+    this->results.energy.capture_uas += energy.capture_uas;
+    this->results.energy.demodulation_uas += energy.demodulation_uas;
 }
 
 void DemoWifiInterface::ClearRegisteredIrqs( ) const
@@ -38,21 +38,53 @@
 
 DemoWifiScan::DemoWifiScan( DeviceTransceiver* device, SignalingInterface* signaling,
                             CommunicationInterface* communication_interface )
-    : DemoWifiInterface( device, signaling, communication_interface )
+    : DemoWifiInterface( device, signaling, communication_interface ),
+      adaptive_scan( NULL ),
+      adaptive_plan_index( 0 ),
+      adaptive_scan_time_us( 0 )
 {
+    memset( &this->adaptive_plan, 0, sizeof( this->adaptive_plan ) );
 }
 
 DemoWifiScan::~DemoWifiScan( ) {}
 
+void DemoWifiScan::Reset( )
+{
+    this->DemoWifiInterface::Reset( );
+    this->adaptive_plan.nb_steps = 0;
+    this->adaptive_plan.channels = 0;
+    this->adaptive_plan_index    = 0;
+    this->adaptive_scan_time_us  = 0;
+}
+
 void DemoWifiScan::ExecuteScan( radio_t* radio )
 {
-    lr1110_wifi_scan( radio, this->settings.types, this->settings.channels, this->settings.scan_mode,
-                      this->settings.max_results, this->settings.nbr_retrials, this->settings.timeout,
-                      WIFI_SCAN_ABORT_ON_TIMEOUT );
+    if( this->IsAdaptive( ) == false )
+    {
+        lr1110_wifi_scan( radio, this->settings.types, this->settings.channels, this->settings.scan_mode,
+                          this->settings.max_results, this->settings.nbr_retrials, this->settings.timeout,
+                          WIFI_SCAN_ABORT_ON_TIMEOUT );
+        return;
+    }
+
+    // In adaptive mode, each channel is scanned alone so that it gets its own timeout and its own timings
+    if( this->adaptive_plan_index == 0 )
+    {
+        this->adaptive_scan->Plan( this->settings.channels, this->settings.timeout, this->settings.nbr_retrials,
+                                   this->settings.time_budget_ms, this->adaptive_plan );
+    }
+
+    const demo_wifi_adaptive_scan_step_t& step = this->adaptive_plan.steps[this->adaptive_plan_index];
+
+    lr1110_wifi_scan( radio, this->settings.types, ( lr1110_wifi_channel_mask_t )( 1 << ( step.channel - 1 ) ),
+                      this->settings.scan_mode, this->settings.max_results, this->settings.nbr_retrials,
+                      step.timeout_ms, WIFI_SCAN_ABORT_ON_TIMEOUT );
 }
 
 void DemoWifiScan::FetchAndSaveResults( radio_t* radio )
 {
+    const uint8_t nb_results_before = this->results.nbrResults;
+
     switch( this->settings.result_type )
     {
     case DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE:
@@ -66,6 +98,28 @@ void DemoWifiScan::FetchAndSaveResults( radio_t* radio )
         break;
     }
     }
+
+    if( this->IsAdaptive( ) == true )
+    {
+        this->UpdateAdaptiveScan( radio, nb_results_before );
+    }
+}
+
+void DemoWifiScan::UpdateAdaptiveScan( radio_t* radio, const uint8_t nb_results_before )
+{
+    lr1110_wifi_cumulative_timings_t timings = { 0 };
+
+    // The timings are cumulative since the beginning of the scan, the time of this channel is the difference
+    lr1110_wifi_read_cumulative_timing( radio, &timings );
+    const uint32_t scan_time_us =
+        timings.rx_detection_us + timings.rx_correlation_us + timings.rx_capture_us + timings.demodulation_us;
+    const uint32_t step_time_us =
+        ( scan_time_us > this->adaptive_scan_time_us ) ? scan_time_us - this->adaptive_scan_time_us : 0;
+    this->adaptive_scan_time_us = scan_time_us;
+
+    this->adaptive_scan->Update( this->adaptive_plan.steps[this->adaptive_plan_index].channel,
+                                 this->results.nbrResults - nb_results_before, step_time_us );
+    this->adaptive_plan_index++;
 }
 
 void DemoWifiScan::FetchAndSaveBasicCompleteResults( radio_t* radio )
@@ -100,6 +154,24 @@ void DemoWifiScan::FetchAndSaveBasicMacChannelTypeResults( radio_t* radio )
 
 void DemoWifiScan::Configure( demo_wifi_settings_t& config ) { this->settings = config; }
 
+void DemoWifiScan::SetAdaptiveScan( DemoWifiAdaptiveScan* adaptive_scan ) { this->adaptive_scan = adaptive_scan; }
+
+lr1110_wifi_channel_mask_t DemoWifiScan::GetChannelMask( ) const
+{
+    return ( this->IsAdaptive( ) == true ) ? this->adaptive_plan.channels : this->settings.channels;
+}
+
+bool DemoWifiScan::HasPendingScan( ) const
+{
+    return ( this->IsAdaptive( ) == true ) && ( this->adaptive_plan_index < this->adaptive_plan.nb_steps );
+}
+
+bool DemoWifiScan::IsAdaptive( ) const
+{
+    return ( this->settings.is_adaptive == true ) && ( this->adaptive_scan != NULL ) &&
+           ( this->settings.channels != 0 );
+}
+
 void DemoWifiScan::AddScanToResults( const lr1110_system_reg_mode_t regMode, demo_wifi_scan_all_results_t& results,
                                      const lr1110_wifi_basic_complete_result_t* scan_result, const uint8_t nbr_results )
 {
@@ -0,0 +1,205 @@
+/**
+ * @file      device_firmware_update.cpp
+ *
+ * @brief     Implementation of the update of the LR1110 firmware through its bootloader.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "device_firmware_update.h"
+#include "lr1110_bootloader.h"
+#include "lr1110_hal.h"
+#include "system_gpio.h"
+#include "system_time.h"
+#include <string.h>
+
+#define DEVICE_FIRMWARE_UPDATE_BOOTLOADER_ENTRY_DELAY_MS ( 500 )
+
+DeviceFirmwareUpdate::DeviceFirmwareUpdate( DeviceBase* device )
+    : device( device ),
+      is_in_progress( false ),
+      is_in_bootloader( false ),
+      status( DEVICE_FIRMWARE_UPDATE_STATUS_NOT_STARTED ),
+      image_size( 0 ),
+      nb_bytes_written( 0 ),
+      has_expected_hash( false )
+{
+    memset( this->expected_hash, 0, sizeof( this->expected_hash ) );
+}
+
+DeviceFirmwareUpdate::~DeviceFirmwareUpdate( ) {}
+
+device_firmware_update_status_t DeviceFirmwareUpdate::Start( const uint32_t image_size, const uint8_t* expected_hash,
+                                                             lr1110_bootloader_version_t* bootloader_version )
+{
+    this->is_in_progress   = false;
+    this->image_size       = image_size;
+    this->nb_bytes_written = 0;
+
+    this->has_expected_hash = ( expected_hash != NULL );
+    if( this->has_expected_hash == true )
+    {
+        memcpy( this->expected_hash, expected_hash, LR1110_BL_HASH_LENGTH );
+    }
+
+    if( ( image_size == 0 ) || ( ( image_size % sizeof( uint32_t ) ) != 0 ) )
+    {
+        this->status = DEVICE_FIRMWARE_UPDATE_STATUS_WRONG_IMAGE_SIZE;
+        return this->status;
+    }
+
+    this->EnterBootloader( );
+
+    lr1110_bootloader_get_version( this->device->GetRadio( ), bootloader_version );
+    this->is_in_bootloader = ( bootloader_version->type == DEVICE_FIRMWARE_UPDATE_TYPE_BOOTLOADER );
+    if( this->is_in_bootloader == false )
+    {
+        this->status = DEVICE_FIRMWARE_UPDATE_STATUS_NOT_IN_BOOTLOADER;
+        return this->status;
+    }
+
+    lr1110_bootloader_erase_flash( this->device->GetRadio( ) );
+    // The erase lasts a few seconds: wait for it here rather than in the write of the first chunk
+    system_gpio_wait_for_state( this->device->GetRadio( )->busy, SYSTEM_GPIO_PIN_STATE_LOW );
+
+    this->is_in_progress = true;
+    this->status         = DEVICE_FIRMWARE_UPDATE_STATUS_OK;
+    return this->status;
+}
+
+device_firmware_update_status_t DeviceFirmwareUpdate::CheckChunk( const uint32_t offset,
+                                                                  const uint16_t chunk_size ) const
+{
+    if( this->is_in_progress == false )
+    {
+        return DEVICE_FIRMWARE_UPDATE_STATUS_NOT_STARTED;
+    }
+    if( this->status != DEVICE_FIRMWARE_UPDATE_STATUS_OK )
+    {
+        return this->status;
+    }
+    if( offset != this->nb_bytes_written )
+    {
+        return DEVICE_FIRMWARE_UPDATE_STATUS_WRONG_OFFSET;
+    }
+
+    const uint32_t remaining_size = this->image_size - this->nb_bytes_written;
+    const uint32_t expected_size  = ( remaining_size < DEVICE_FIRMWARE_UPDATE_CHUNK_SIZE_MAX )
+                                       ? remaining_size
+                                       : DEVICE_FIRMWARE_UPDATE_CHUNK_SIZE_MAX;
+    if( chunk_size != expected_size )
+    {
+        return DEVICE_FIRMWARE_UPDATE_STATUS_WRONG_CHUNK_SIZE;
+    }
+
+    return DEVICE_FIRMWARE_UPDATE_STATUS_OK;
+}
+
+void DeviceFirmwareUpdate::WriteChunk( const uint32_t offset, const uint8_t* chunk, const uint16_t chunk_size )
+{
+    if( this->CheckChunk( offset, chunk_size ) != DEVICE_FIRMWARE_UPDATE_STATUS_OK )
+    {
+        return;
+    }
+
+    // The image is a sequence of big endian words, as expected by the bootloader
+    const uint8_t nb_words = chunk_size / sizeof( uint32_t );
+    for( uint8_t index = 0; index < nb_words; index++ )
+    {
+        const uint8_t* raw  = chunk + sizeof( uint32_t ) * index;
+        this->words[index] = ( ( uint32_t ) raw[0] << 24 ) + ( raw[1] << 16 ) + ( raw[2] << 8 ) + raw[3];
+    }
+
+    if( lr1110_bootloader_write_flash_encrypted( this->device->GetRadio( ), offset, this->words, nb_words ) !=
+        LR1110_STATUS_OK )
+    {
+        this->status = DEVICE_FIRMWARE_UPDATE_STATUS_WRITE_FAILED;
+        return;
+    }
+
+    this->nb_bytes_written += chunk_size;
+}
+
+device_firmware_update_status_t DeviceFirmwareUpdate::Finish( device_firmware_update_result_t* result )
+{
+    memset( result, 0, sizeof( device_firmware_update_result_t ) );
+
+    if( this->is_in_progress == false )
+    {
+        return DEVICE_FIRMWARE_UPDATE_STATUS_NOT_STARTED;
+    }
+    if( ( this->status == DEVICE_FIRMWARE_UPDATE_STATUS_OK ) && ( this->nb_bytes_written != this->image_size ) )
+    {
+        this->status = DEVICE_FIRMWARE_UPDATE_STATUS_INCOMPLETE;
+    }
+
+    lr1110_bootloader_get_hash( this->device->GetRadio( ), result->hash );
+    if( ( this->status == DEVICE_FIRMWARE_UPDATE_STATUS_OK ) && ( this->has_expected_hash == true ) &&
+        ( memcmp( result->hash, this->expected_hash, LR1110_BL_HASH_LENGTH ) != 0 ) )
+    {
+        this->status = DEVICE_FIRMWARE_UPDATE_STATUS_HASH_MISMATCH;
+    }
+
+    this->is_in_progress = false;
+
+    // On failure, the LR1110 stays in its bootloader so that the update can be started again
+    if( this->status != DEVICE_FIRMWARE_UPDATE_STATUS_OK )
+    {
+        return this->status;
+    }
+
+    lr1110_bootloader_reboot( this->device->GetRadio( ), false );
+    lr1110_bootloader_get_version( this->device->GetRadio( ), &result->version );
+    if( result->version.type != DEVICE_FIRMWARE_UPDATE_TYPE_TRANSCEIVER )
+    {
+        this->status = DEVICE_FIRMWARE_UPDATE_STATUS_NOT_IN_TRANSCEIVER;
+        return this->status;
+    }
+    this->is_in_bootloader = false;
+
+    this->device->ResetAndInit( );
+
+    return this->status;
+}
+
+bool DeviceFirmwareUpdate::IsInProgress( ) const { return this->is_in_progress; }
+
+bool DeviceFirmwareUpdate::IsInBootloader( ) const { return this->is_in_bootloader; }
+
+uint32_t DeviceFirmwareUpdate::GetNbBytesWritten( ) const { return this->nb_bytes_written; }
+
+uint32_t DeviceFirmwareUpdate::GetImageSize( ) const { return this->image_size; }
+
+void DeviceFirmwareUpdate::EnterBootloader( )
+{
+    radio_t* radio = this->device->GetRadio( );
+
+    // The LR1110 starts its bootloader if BUSY is held low when it leaves reset
+    system_gpio_init_direction_state( radio->busy, SYSTEM_GPIO_PIN_DIRECTION_OUTPUT, SYSTEM_GPIO_PIN_STATE_LOW );
+    lr1110_hal_reset( radio );
+    system_time_wait_ms( DEVICE_FIRMWARE_UPDATE_BOOTLOADER_ENTRY_DELAY_MS );
+    system_gpio_init_direction_state( radio->busy, SYSTEM_GPIO_PIN_DIRECTION_INPUT, SYSTEM_GPIO_PIN_STATE_LOW );
+}
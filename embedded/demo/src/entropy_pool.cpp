@@ -0,0 +1,234 @@
+/**
+ * @file      entropy_pool.cpp
+ *
+ * @brief     Implementation of the entropy pool and of the random generator it seeds.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "entropy_pool.h"
+#include "lr1110_system.h"
+#include "system_time.h"
+#include <string.h>
+
+#define ENTROPY_POOL_HARVEST_PERIOD_UNSEEDED_MS ( 10 )
+#define ENTROPY_POOL_HARVEST_PERIOD_SEEDED_MS ( 1000 )
+#define ENTROPY_POOL_CHACHA20_NB_DOUBLE_ROUNDS ( 10 )
+
+#define ENTROPY_POOL_ROTL( value, shift ) ( ( ( value ) << ( shift ) ) | ( ( value ) >> ( 32 - ( shift ) ) ) )
+
+#define ENTROPY_POOL_QUARTER_ROUND( a, b, c, d ) \
+    a += b;                                      \
+    d ^= a;                                      \
+    d = ENTROPY_POOL_ROTL( d, 16 );              \
+    c += d;                                      \
+    b ^= c;                                      \
+    b = ENTROPY_POOL_ROTL( b, 12 );              \
+    a += b;                                      \
+    d ^= a;                                      \
+    d = ENTROPY_POOL_ROTL( d, 8 );               \
+    c += d;                                      \
+    b ^= c;                                      \
+    b = ENTROPY_POOL_ROTL( b, 7 )
+
+/*!
+ * \brief Compute one ChaCha20 block (RFC 7539) with a zero nonce
+ */
+static void entropy_pool_chacha20_block( const uint32_t key[ENTROPY_POOL_KEY_NB_WORDS], const uint32_t counter,
+                                         uint32_t block[ENTROPY_POOL_BLOCK_NB_WORDS] )
+{
+    uint32_t state[ENTROPY_POOL_BLOCK_NB_WORDS] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+
+    memcpy( state + 4, key, ENTROPY_POOL_KEY_NB_WORDS * sizeof( uint32_t ) );
+    state[12] = counter;
+
+    memcpy( block, state, sizeof( state ) );
+    for( uint8_t round = 0; round < ENTROPY_POOL_CHACHA20_NB_DOUBLE_ROUNDS; round++ )
+    {
+        ENTROPY_POOL_QUARTER_ROUND( block[0], block[4], block[8], block[12] );
+        ENTROPY_POOL_QUARTER_ROUND( block[1], block[5], block[9], block[13] );
+        ENTROPY_POOL_QUARTER_ROUND( block[2], block[6], block[10], block[14] );
+        ENTROPY_POOL_QUARTER_ROUND( block[3], block[7], block[11], block[15] );
+        ENTROPY_POOL_QUARTER_ROUND( block[0], block[5], block[10], block[15] );
+        ENTROPY_POOL_QUARTER_ROUND( block[1], block[6], block[11], block[12] );
+        ENTROPY_POOL_QUARTER_ROUND( block[2], block[7], block[8], block[13] );
+        ENTROPY_POOL_QUARTER_ROUND( block[3], block[4], block[9], block[14] );
+    }
+    for( uint8_t index = 0; index < ENTROPY_POOL_BLOCK_NB_WORDS; index++ )
+    {
+        block[index] += state[index];
+    }
+}
+
+EntropyPool::EntropyPool( DeviceBase* device )
+    : device( device ), last_harvest_ms( 0 ), nb_pool_words( 0 ), nb_reseeds( 0 ), counter( 0 ), nb_output_bytes( 0 )
+{
+    memset( this->pool, 0, sizeof( this->pool ) );
+    memset( this->key, 0, sizeof( this->key ) );
+    memset( this->output, 0, sizeof( this->output ) );
+}
+
+EntropyPool::~EntropyPool( ) {}
+
+void EntropyPool::Harvest( )
+{
+    const uint32_t now_ms    = system_time_GetTicker( );
+    const uint32_t period_ms = ( this->IsSeeded( ) == true ) ? ENTROPY_POOL_HARVEST_PERIOD_SEEDED_MS
+                                                             : ENTROPY_POOL_HARVEST_PERIOD_UNSEEDED_MS;
+
+    if( ( now_ms - this->last_harvest_ms ) < period_ms )
+    {
+        return;
+    }
+    this->last_harvest_ms = now_ms;
+
+    uint32_t random_number = 0;
+    if( lr1110_system_get_random_number( this->device->GetRadio( ), &random_number ) != LR1110_STATUS_OK )
+    {
+        return;
+    }
+
+    this->pool[this->nb_pool_words] ^= random_number;
+    this->nb_pool_words++;
+
+    if( this->nb_pool_words == ENTROPY_POOL_KEY_NB_WORDS )
+    {
+        this->Reseed( );
+    }
+}
+
+bool EntropyPool::IsSeeded( ) const { return this->nb_reseeds > 0; }
+
+uint32_t EntropyPool::GetNbReseeds( ) const { return this->nb_reseeds; }
+
+bool EntropyPool::GetRandomBytes( uint8_t* buffer, const uint16_t length )
+{
+    uint16_t index = 0;
+
+    if( this->IsSeeded( ) == false )
+    {
+        return false;
+    }
+
+    while( index < length )
+    {
+        if( this->nb_output_bytes == 0 )
+        {
+            this->GenerateBlock( );
+        }
+
+        // Bytes are served from the end of the output, and erased once served
+        const uint8_t nb_bytes =
+            ( ( length - index ) < this->nb_output_bytes ) ? ( uint8_t )( length - index ) : this->nb_output_bytes;
+        this->nb_output_bytes -= nb_bytes;
+        memcpy( buffer + index, this->output + this->nb_output_bytes, nb_bytes );
+        EntropyPool::Wipe( this->output + this->nb_output_bytes, nb_bytes );
+        index += nb_bytes;
+    }
+
+    return true;
+}
+
+bool EntropyPool::GetRandomWord( uint32_t* random_word )
+{
+    *random_word = 0;
+
+    return this->GetRandomBytes( ( uint8_t* ) random_word, sizeof( uint32_t ) );
+}
+
+bool EntropyPool::GetRandomInRange( const uint32_t min, const uint32_t max, uint32_t* random_value )
+{
+    uint32_t random_word = 0;
+
+    *random_value = min;
+    if( this->GetRandomWord( &random_word ) == false )
+    {
+        return false;
+    }
+
+    if( max <= min )
+    {
+        return true;
+    }
+
+    const uint32_t range = max - min + 1;
+    if( range == 0 )
+    {
+        *random_value = random_word;
+        return true;
+    }
+
+    // Reject the top of the word range that would make the lowest values more likely
+    const uint32_t limit = UINT32_MAX - ( UINT32_MAX % range );
+    while( random_word >= limit )
+    {
+        this->GetRandomWord( &random_word );
+    }
+
+    *random_value = min + ( random_word % range );
+    return true;
+}
+
+void EntropyPool::Wipe( void* buffer, const uint16_t length )
+{
+    volatile uint8_t* bytes = ( volatile uint8_t* ) buffer;
+
+    for( uint16_t index = 0; index < length; index++ )
+    {
+        bytes[index] = 0;
+    }
+}
+
+void EntropyPool::Reseed( )
+{
+    for( uint8_t index = 0; index < ENTROPY_POOL_KEY_NB_WORDS; index++ )
+    {
+        this->key[index] ^= this->pool[index];
+    }
+    EntropyPool::Wipe( this->pool, sizeof( this->pool ) );
+    this->nb_pool_words = 0;
+    this->nb_reseeds++;
+
+    // Drop the output computed with the previous key
+    EntropyPool::Wipe( this->output, sizeof( this->output ) );
+    this->nb_output_bytes = 0;
+    this->GenerateBlock( );
+}
+
+void EntropyPool::GenerateBlock( )
+{
+    uint32_t block[ENTROPY_POOL_BLOCK_NB_WORDS];
+
+    entropy_pool_chacha20_block( this->key, this->counter, block );
+    this->counter++;
+
+    // Fast key erasure: the first half of the block replaces the key, the second half is the output
+    memcpy( this->key, block, sizeof( this->key ) );
+    memcpy( this->output, block + ENTROPY_POOL_KEY_NB_WORDS, sizeof( this->output ) );
+    this->nb_output_bytes = sizeof( this->output );
+
+    EntropyPool::Wipe( block, sizeof( block ) );
+}
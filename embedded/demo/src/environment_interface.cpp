@@ -31,7 +31,7 @@
 
 #include "environment_interface.h"
 
-EnvironmentInterface::EnvironmentInterface( ) : has_date( false ), has_location( false ), delta_time_s( 0 ) {}
+EnvironmentInterface::EnvironmentInterface( ) : has_date( false ), delta_time_s( 0 ) {}
 
 EnvironmentInterface::~EnvironmentInterface( ) {}
 
@@ -49,12 +49,28 @@ void EnvironmentInterface::SetTimeFromGpsEpoch( const environment_date_time_t& t
     this->has_date     = true;
 }
 
-bool EnvironmentInterface::HasLocation( ) const { return this->has_location; }
+bool EnvironmentInterface::HasLocation( ) const { return this->assistance_position.HasPosition( ); }
 
-environment_location_t EnvironmentInterface::GetLocation( ) const { return this->last_location; }
+bool EnvironmentInterface::HasFreshLocation( ) const
+{
+    return this->assistance_position.HasFreshPosition( this->GetLocalTimeSeconds( ) );
+}
+
+environment_location_t EnvironmentInterface::GetLocation( ) const
+{
+    demo_gnss_assistance_position_t position = { 0 };
+    this->assistance_position.GetBest( this->GetLocalTimeSeconds( ), position );
+    return position.location;
+}
+
+bool EnvironmentInterface::GetAssistancePosition( demo_gnss_assistance_position_t& position ) const
+{
+    return this->assistance_position.GetBest( this->GetLocalTimeSeconds( ), position );
+}
 
-void EnvironmentInterface::SetLocation( const environment_location_t& location )
+void EnvironmentInterface::SetLocation( const environment_location_t&                location,
+                                        const demo_gnss_assistance_position_source_t source,
+                                        const uint32_t                               uncertainty_m )
 {
-    this->last_location = location;
-    this->has_location  = true;
+    this->assistance_position.Update( location, source, uncertainty_m, this->GetLocalTimeSeconds( ) );
 }
\ No newline at end of file
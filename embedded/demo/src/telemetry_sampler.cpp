@@ -0,0 +1,184 @@
+/**
+ * @file      telemetry_sampler.cpp
+ *
+ * @brief     Implementation of the sampler of the LR1110 supply voltage and temperature.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "telemetry_sampler.h"
+#include "lr1110_system.h"
+#include "system_time.h"
+#include <string.h>
+
+// Typical values given with lr1110_system_get_vbat and lr1110_system_get_temp
+#define TELEMETRY_SAMPLER_VANA_MV ( 1350 )
+#define TELEMETRY_SAMPLER_VBE25_UV ( 729500 )
+#define TELEMETRY_SAMPLER_VBE_SLOPE_UV_PER_C ( -1700 )
+#define TELEMETRY_SAMPLER_TEMPERATURE_MASK ( 0x07FF )
+#define TELEMETRY_SAMPLER_TEMPERATURE_FULL_SCALE ( 2047 )
+
+TelemetrySampler::TelemetrySampler( DeviceBase* device )
+    : device( device ),
+      period_ms( TELEMETRY_SAMPLER_PERIOD_DEFAULT_MS ),
+      has_attempted( false ),
+      last_attempt_ms( 0 ),
+      nb_samples( 0 ),
+      history_next_index( 0 )
+{
+    memset( this->history, 0, sizeof( this->history ) );
+    memset( &this->latest, 0, sizeof( this->latest ) );
+    memset( &this->extremes, 0, sizeof( this->extremes ) );
+}
+
+TelemetrySampler::~TelemetrySampler( ) {}
+
+bool TelemetrySampler::Runtime( )
+{
+    const uint32_t now_ms = system_time_GetTicker( );
+
+    if( ( this->has_attempted == true ) && ( ( now_ms - this->last_attempt_ms ) < this->period_ms ) )
+    {
+        return false;
+    }
+    this->has_attempted   = true;
+    this->last_attempt_ms = now_ms;
+
+    uint8_t  vbat        = 0;
+    uint16_t temperature = 0;
+    if( ( lr1110_system_get_vbat( this->device->GetRadio( ), &vbat ) != LR1110_STATUS_OK ) ||
+        ( lr1110_system_get_temp( this->device->GetRadio( ), &temperature ) != LR1110_STATUS_OK ) )
+    {
+        return false;
+    }
+
+    telemetry_sample_t sample;
+    sample.local_instant_ms = now_ms;
+    sample.vbat_mv          = TelemetrySampler::ConvertVbatToMv( vbat );
+    sample.temperature_dc   = TelemetrySampler::ConvertTemperatureToDc( temperature );
+    this->AddSample( sample );
+
+    return true;
+}
+
+bool TelemetrySampler::SetPeriod( const uint32_t period_ms )
+{
+    if( ( period_ms < TELEMETRY_SAMPLER_PERIOD_MIN_MS ) || ( period_ms > TELEMETRY_SAMPLER_PERIOD_MAX_MS ) )
+    {
+        return false;
+    }
+
+    this->period_ms = period_ms;
+    return true;
+}
+
+uint32_t TelemetrySampler::GetPeriod( ) const { return this->period_ms; }
+
+uint32_t TelemetrySampler::GetNbSamples( ) const { return this->nb_samples; }
+
+const telemetry_sample_t& TelemetrySampler::GetLatest( ) const { return this->latest; }
+
+const telemetry_extremes_t& TelemetrySampler::GetExtremes( ) const { return this->extremes; }
+
+uint8_t TelemetrySampler::GetHistoryCount( ) const
+{
+    return ( this->nb_samples < TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES ) ? ( uint8_t ) this->nb_samples
+                                                                        : TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES;
+}
+
+const telemetry_sample_t* TelemetrySampler::GetHistoryEntry( const uint8_t index ) const
+{
+    const uint8_t history_count = this->GetHistoryCount( );
+
+    if( index >= history_count )
+    {
+        return NULL;
+    }
+
+    // Once the history is full, the oldest sample is the next one to be overwritten
+    const uint8_t oldest_index =
+        ( history_count < TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES ) ? 0 : this->history_next_index;
+    return &this->history[( oldest_index + index ) % TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES];
+}
+
+void TelemetrySampler::AddSample( const telemetry_sample_t& sample )
+{
+    if( this->nb_samples == 0 )
+    {
+        this->extremes.vbat_min_mv        = sample.vbat_mv;
+        this->extremes.vbat_max_mv        = sample.vbat_mv;
+        this->extremes.temperature_min_dc = sample.temperature_dc;
+        this->extremes.temperature_max_dc = sample.temperature_dc;
+    }
+    else
+    {
+        if( sample.vbat_mv < this->extremes.vbat_min_mv )
+        {
+            this->extremes.vbat_min_mv = sample.vbat_mv;
+        }
+        if( sample.vbat_mv > this->extremes.vbat_max_mv )
+        {
+            this->extremes.vbat_max_mv = sample.vbat_mv;
+        }
+        if( sample.temperature_dc < this->extremes.temperature_min_dc )
+        {
+            this->extremes.temperature_min_dc = sample.temperature_dc;
+        }
+        if( sample.temperature_dc > this->extremes.temperature_max_dc )
+        {
+            this->extremes.temperature_max_dc = sample.temperature_dc;
+        }
+    }
+
+    this->history[this->history_next_index] = sample;
+    this->history_next_index++;
+    if( this->history_next_index == TELEMETRY_SAMPLER_HISTORY_MAX_ENTRIES )
+    {
+        this->history_next_index = 0;
+    }
+    this->latest = sample;
+    this->nb_samples++;
+}
+
+uint16_t TelemetrySampler::ConvertVbatToMv( const uint8_t vbat )
+{
+    // Vbat = ( 5 * vbat / 255 - 1 ) * Vana
+    const int32_t vbat_mv = ( ( 5 * ( int32_t ) vbat * TELEMETRY_SAMPLER_VANA_MV ) / 255 ) - TELEMETRY_SAMPLER_VANA_MV;
+
+    return ( vbat_mv > 0 ) ? ( uint16_t ) vbat_mv : 0;
+}
+
+int16_t TelemetrySampler::ConvertTemperatureToDc( const uint16_t temperature )
+{
+    // Temperature = ( temperature / 2047 * Vana - Vbe25 ) / VbeSlope + 25
+    const uint32_t vbe_uv = ( ( uint32_t )( temperature & TELEMETRY_SAMPLER_TEMPERATURE_MASK ) *
+                              TELEMETRY_SAMPLER_VANA_MV * 1000 ) /
+                            TELEMETRY_SAMPLER_TEMPERATURE_FULL_SCALE;
+
+    return ( int16_t )( ( ( ( ( int32_t ) vbe_uv - TELEMETRY_SAMPLER_VBE25_UV ) * 10 ) /
+                          TELEMETRY_SAMPLER_VBE_SLOPE_UV_PER_C ) +
+                        250 );
+}
@@ -39,6 +39,13 @@
 extern "C" {
 #endif
 
+typedef struct
+{
+    bool     is_touched;
+    uint16_t x;
+    uint16_t y;
+} touch_point_t;
+
 void touch_init( void );
 
 uint8_t touch_read_register( uint8_t reg );
@@ -49,6 +56,34 @@ bool touch_is_touched( void );
 
 void readTouchData( uint16_t* posX, uint16_t* posY, bool* touching );
 
+/*!
+ * \brief Read the touch status and the first touch point in one I2C burst read
+ *
+ * \param [out] point Touch status and raw coordinates of the first touch point
+ */
+void touch_read_point( touch_point_t* point );
+
+/*!
+ * \brief Notify the touch driver that the touch interrupt line changed
+ *
+ * To be called from the touch interrupt handler. It queues a sampling of the touch controller on the I2C bus without
+ * waiting for it.
+ *
+ * \param [in] is_down True if the touch interrupt line is asserted
+ */
+void touch_irq_handler( bool is_down );
+
+/*!
+ * \brief Get the last touch point, sampled on interrupt
+ *
+ * A sampling of the touch controller is queued only if an interrupt has been notified since the last call, or while
+ * the panel is touched to follow the moves. This function never waits for the I2C bus: it returns the point of the
+ * last completed sampling.
+ *
+ * \param [out] point Touch status and raw coordinates of the first touch point
+ */
+void touch_get_point( touch_point_t* point );
+
 long map( long x, long in_min, long in_max, long out_min, long out_max );
 
 #ifdef __cplusplus
@@ -37,6 +37,10 @@
 #define FT6x06_DEV_MODE 0x00
 #define FT6x06_GEST_ID 0x01
 #define FT6x06_TD_STATUS 0x02
+#define FT6x06_P1_XH 0x03
+#define FT6x06_P1_XL 0x04
+#define FT6x06_P1_YH 0x05
+#define FT6x06_P1_YL 0x06
 #define FT6x06_TH_GROUP 0x80
 #define FT6x06_PERIODACTIVE 0x88
 #define FT6x06_CHIPER 0xA3
@@ -45,15 +49,38 @@
 #define FT6x06_FOCALTECH_ID 0xA8
 #define FT6x06_RELEASE_CODE_ID 0xAF
 
+/*!
+ * \brief Size of the register block from TD_STATUS to P1_YL
+ */
+#define FT6x06_TOUCH_BLOCK_SIZE ( FT6x06_P1_YL - FT6x06_TD_STATUS + 1 )
+
+static void touch_decode_block( const uint8_t* block, touch_point_t* point );
+static void touch_start_sampling( void );
+static void touch_on_sampling_done( void* object );
+
+static volatile bool touch_irq_pending = true;
+static volatile bool touch_irq_is_down = false;
+static touch_point_t touch_last_point  = { .is_touched = false, .x = 0, .y = 0 };
+
+static const uint8_t        touch_block_reg                      = FT6x06_TD_STATUS;
+static uint8_t              touch_block[FT6x06_TOUCH_BLOCK_SIZE] = { 0 };
+static system_i2c_request_t touch_request                        = {
+    .address       = FT6x06_ADDR,
+    .buffer_in     = &touch_block_reg,
+    .length_in     = 1,
+    .buffer_out    = touch_block,
+    .length_out    = FT6x06_TOUCH_BLOCK_SIZE,
+    .done_callback = { .object = &touch_last_point, .callback = touch_on_sampling_done },
+    .status        = SYSTEM_I2C_REQUEST_IDLE,
+};
+
 void touch_init( void ) { touch_write_register( FT6x06_G_MODE, 0x00 ); }
 
 uint8_t touch_read_register( uint8_t reg )
 {
-    uint8_t buf[1] = { reg };
-    uint8_t data   = 0;
+    uint8_t data = 0;
 
-    system_i2c_write( FT6x06_ADDR, buf, 1, true );
-    system_i2c_read( FT6x06_ADDR, &data, 1, false );
+    system_i2c_write_read( FT6x06_ADDR, &reg, 1, &data, 1 );
 
     return data;
 }
@@ -62,7 +89,7 @@ void touch_write_register( uint8_t reg, uint8_t val )
 {
     uint8_t buf[2] = { reg, val };
 
-    system_i2c_write( FT6x06_ADDR, buf, 2, false );
+    system_i2c_write( FT6x06_ADDR, buf, 2 );
 }
 
 bool touch_is_touched( )
@@ -81,17 +108,88 @@ bool touch_is_touched( )
 
 void readTouchData( uint16_t* posX, uint16_t* posY, bool* touching )
 {
-    posX[0] = touch_read_register( 0x03 ) & 0x0F;
-    posX[0] <<= 8;
-    posX[0] |= touch_read_register( 0x04 );
-    posY[0] = touch_read_register( 0x05 ) & 0x0F;
-    posY[0] <<= 8;
-    posY[0] |= touch_read_register( 0x06 );
+    touch_point_t point;
+
+    touch_read_point( &point );
+
+    posX[0] = map( point.x, 0, 240, 240, 0 );
+    posY[0] = map( point.y, 0, 320, 320, 0 );
+
+    touching[0] = point.is_touched;
+}
+
+void touch_read_point( touch_point_t* point )
+{
+    const uint8_t reg                            = FT6x06_TD_STATUS;
+    uint8_t       block[FT6x06_TOUCH_BLOCK_SIZE] = { 0 };
+
+    system_i2c_write_read( FT6x06_ADDR, &reg, 1, block, FT6x06_TOUCH_BLOCK_SIZE );
+
+    touch_decode_block( block, point );
+}
+
+void touch_irq_handler( bool is_down )
+{
+    touch_irq_is_down = is_down;
+    touch_irq_pending = true;
+    touch_start_sampling( );
+}
 
-    posX[0] = map( posX[0], 0, 240, 240, 0 );
-    posY[0] = map( posY[0], 0, 320, 320, 0 );
+void touch_get_point( touch_point_t* point )
+{
+    uint32_t primask = 0;
+
+    /* While the panel is touched, keep sampling to follow the moves */
+    if( touch_irq_pending || touch_irq_is_down )
+    {
+        touch_irq_pending = true;
+        touch_start_sampling( );
+    }
 
-    touching[0] = touch_is_touched( );
+    /* The cached point is updated from the I2C interrupt */
+    primask = __get_PRIMASK( );
+    __disable_irq( );
+    *point = touch_last_point;
+    __set_PRIMASK( primask );
+}
+
+static void touch_decode_block( const uint8_t* block, touch_point_t* point )
+{
+    const uint8_t n_touches = block[FT6x06_TD_STATUS - FT6x06_TD_STATUS] & 0x0F;
+
+    point->is_touched = ( n_touches == 1 ) || ( n_touches == 2 );
+    point->x          = ( ( uint16_t )( block[FT6x06_P1_XH - FT6x06_TD_STATUS] & 0x0F ) << 8 ) |
+                        block[FT6x06_P1_XL - FT6x06_TD_STATUS];
+    point->y          = ( ( uint16_t )( block[FT6x06_P1_YH - FT6x06_TD_STATUS] & 0x0F ) << 8 ) |
+                        block[FT6x06_P1_YL - FT6x06_TD_STATUS];
+}
+
+static void touch_start_sampling( void )
+{
+    /* If a sampling is ongoing, the pending flag makes the completion start a new one. The flag is cleared before the
+     * submission so that an interrupt raised meanwhile is not lost, and set back if the I2C queue cannot take the
+     * request, so that the next call to touch_get_point tries again */
+    if( !system_i2c_is_request_busy( &touch_request ) )
+    {
+        touch_irq_pending = false;
+        if( !system_i2c_submit( &touch_request ) )
+        {
+            touch_irq_pending = true;
+        }
+    }
+}
+
+static void touch_on_sampling_done( void* object )
+{
+    if( touch_request.status == SYSTEM_I2C_REQUEST_DONE )
+    {
+        touch_decode_block( touch_block, ( touch_point_t* ) object );
+    }
+
+    if( touch_irq_pending )
+    {
+        touch_start_sampling( );
+    }
 }
 
 long map( long x, long in_min, long in_max, long out_min, long out_max )
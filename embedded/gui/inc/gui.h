@@ -40,8 +40,10 @@
 #include "guiRadioTxCw.h"
 #include "guiRadioPer.h"
 #include "guiRadioPingPong.h"
+#include "guiRadioSpectrum.h"
 #include "guiMenuDemo.h"
 #include "guiResultsWifi.h"
+#include "guiResultsWifiChannels.h"
 #include "guiResultsGnss.h"
 #include "guiSplashScreen.h"
 #include "guiAbout.h"
@@ -49,6 +51,7 @@
 #include "guiTestGnss.h"
 #include "guiConfigWifi.h"
 #include "guiConfigGnss.h"
+#include "guiMemoryMonitor.h"
 #include <stdint.h>
 #include <string.h>
 #include "stdio.h"
@@ -65,8 +68,10 @@ typedef struct
     GuiRadioTxCw*            guiRadioTxCw;
     GuiRadioPer*             guiRadioPer;
     GuiRadioPingPong*        guiRadioPingPong;
+    GuiRadioSpectrum*        guiRadioSpectrum;
     GuiTestWifi*             guiTestWifi;
     GuiResultsWifi*          guiResultWifi;
+    GuiResultsWifiChannels*  guiResultWifiChannels;
     GuiConfigWifi*           guiConfigWifi;
     GuiTestGnss*             guiTestGnssAutonomous;
     GuiResultsGnss*          guiResultGnssAutonomous;
@@ -85,6 +90,7 @@ typedef enum
     GUI_LAST_EVENT_START_DEMO_PER_TX,
     GUI_LAST_EVENT_START_DEMO_PER_RX,
     GUI_LAST_EVENT_START_DEMO_PING_PONG,
+    GUI_LAST_EVENT_START_DEMO_RADIO_SPECTRUM,
     GUI_LAST_EVENT_START_DEMO_WIFI,
     GUI_LAST_EVENT_START_DEMO_GNSS_AUTONOMOUS,
     GUI_LAST_EVENT_START_DEMO_GNSS_ASSISTED,
@@ -114,14 +120,18 @@ class Gui
 
     void HostConnectivityChange( bool is_connected );
 
-    virtual GuiLastEvent_t GetLastEvent( );
-    void                   UpdateRadioPingPongResult( GuiRadioPingPongResult_t& gui_demo_result );
-    void                   UpdateRadioPerResult( GuiRadioPerResult_t& demo_result );
-    void                   UpdateWifiDemoResult( GuiWifiResult_t& gui_demo_result );
-    void                   UpdateGnssDemoResult( GuiGnssResult_t& gui_demo_result );
-    void                   UpdateReverseGeoCoding( const GuiResultGeoLoc_t& new_reverse_geo_coding );
-    void                   SetDemoStatus( GuiDemoStatus_t& demo_status );
-    bool                   HasRefreshPending( ) const;
+    virtual GuiLastEvent_t  GetLastEvent( );
+    void                    UpdateRadioPingPongResult( GuiRadioPingPongResult_t& gui_demo_result );
+    void                    UpdateRadioPerResult( GuiRadioPerResult_t& demo_result );
+    void                    UpdateRadioSpectrumResult( GuiRadioSpectrumResult_t& demo_result );
+    void                    UpdateWifiDemoResult( GuiWifiResult_t& gui_demo_result );
+    void                    UpdateGnssDemoResult( GuiGnssResult_t& gui_demo_result );
+    void                    UpdateReverseGeoCoding( const GuiResultGeoLoc_t& new_reverse_geo_coding );
+    void                    UpdateTelemetry( const GuiTelemetry_t& new_telemetry );
+    void                    SetDemoStatus( GuiDemoStatus_t& demo_status );
+    bool                    HasRefreshPending( ) const;
+    const GuiMemoryMonitor& GetMemoryMonitor( ) const;
+    void                    ResetMemoryMonitor( );
 
     static const char* event2str( GuiLastEvent_t event )
     {
@@ -154,6 +164,8 @@ class Gui
     GuiDemoResult_t      demo_results;
     GuiPages_t           guiPages;
     version_handler_t*   version_handler;
+    GuiTelemetry_t       telemetry;
+    GuiMemoryMonitor     memory_monitor;
 };
 
 #endif  // __GUI_H__
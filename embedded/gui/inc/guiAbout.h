@@ -39,16 +39,19 @@
 class GuiAbout : public GuiCommon
 {
    public:
-    GuiAbout( version_handler_t* version_handler );
+    GuiAbout( version_handler_t* version_handler, const GuiTelemetry_t* telemetry );
     virtual ~GuiAbout( );
 
     virtual void draw( );
+    virtual void refresh( );
 
     static void callback( lv_obj_t* obj, lv_event_t event );
 
    private:
-    lv_obj_t*          btn_back;
-    version_handler_t* version_handler;
+    lv_obj_t*             btn_back;
+    lv_obj_t*             lbl_telemetry;
+    version_handler_t*    version_handler;
+    const GuiTelemetry_t* telemetry;
 };
 
 #endif
@@ -64,6 +64,9 @@ typedef enum
     GUI_PAGE_GNSS_ASSISTED_TEST,
     GUI_PAGE_GNSS_ASSISTED_RESULTS,
     GUI_PAGE_GNSS_ASSISTED_CONFIG,
+    GUI_PAGE_WIFI_CHANNELS,
+    GUI_PAGE_RADIO_SPECTRUM,
+    GUI_PAGE_COUNT,
 } guiPageType_t;
 
 typedef enum
@@ -74,6 +77,7 @@ typedef enum
     GUI_EVENT_LEFT,
     GUI_EVENT_RIGHT,
     GUI_EVENT_RESULTS,
+    GUI_EVENT_STATISTICS,
     GUI_EVENT_CONFIG,
     GUI_EVENT_ABOUT,
     GUI_EVENT_SAVE,
@@ -85,6 +89,7 @@ typedef enum
     GUI_EVENT_START_PER_TX,
     GUI_EVENT_START_PER_RX,
     GUI_EVENT_START_PING_PONG,
+    GUI_EVENT_START_SPECTRUM,
     GUI_EVENT_START_WIFI,
     GUI_EVENT_START_GNSS_AUTONOMOUS,
     GUI_EVENT_START_GNSS_ASSISTED,
@@ -98,6 +103,17 @@ typedef enum
     GUI_BUTTON_POS_RIGHT,
 } guiButtonPos_t;
 
+/*!
+ * \brief Persistent row of a result page, made of a name cell and a value cell
+ */
+typedef struct
+{
+    lv_obj_t* cell_name;
+    lv_obj_t* cell_value;
+    lv_obj_t* lbl_name;
+    lv_obj_t* lbl_value;
+} guiResultRow_t;
+
 class GuiCommon
 {
    public:
@@ -124,6 +140,12 @@ class GuiCommon
     void createChoiceSwitch( lv_obj_t** sw, lv_obj_t* screen, const char* lbl_sw_name_left,
                              const char* lbl_sw_name_right, lv_event_cb_t event_cb, int16_t y_pos, bool is_visible );
     void updateHostConnectivityState( const bool is_connected );
+    void createResultRows( guiResultRow_t* rows, uint8_t n_rows, int16_t y_pos );
+
+    static bool updateLabelText( lv_obj_t* label, const char* text );
+    static void updateButtonState( lv_obj_t* btn, lv_btn_state_t state );
+    static void setResultRow( guiResultRow_t* row, const char* name, const char* value );
+    static void hideResultRow( guiResultRow_t* row );
 
     static float    convertConsoToUah( const uint32_t conso_uas );
     static uint32_t check_value_limits( const uint32_t value, const uint32_t limit_low, const uint32_t limit_high );
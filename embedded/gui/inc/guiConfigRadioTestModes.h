@@ -90,9 +90,6 @@ class GuiConfigRadioTestModes : public GuiCommon
 
     char ta_text[10];
 
-    const char lp_pa_options[9]  = "10\n14\n15";
-    const char hp_pa_options[12] = "14\n17\n20\n22";
-
     GuiRadioSetting_t        settings_temp;
     GuiRadioSetting_t*       settings_current;
     const GuiRadioSetting_t* settings_default;
@@ -33,6 +33,7 @@
 #define __GUI_CONFIG_WIFI_H__
 
 #include "guiCommon.h"
+#include "demo_configuration_tables.h"
 
 class GuiConfigWifi : public GuiCommon
 {
@@ -65,6 +66,10 @@ class GuiConfigWifi : public GuiCommon
     const char* btnm_channels_map[18] = { "1", "2",  "3",  "4",  "5",  "\n", "6",  "7",  "8",
                                           "9", "10", "\n", "11", "12", "13", "14", "15", "" };
     const char* btnm_types_map[5]     = { "B", "G", "N", "ALL", "" };
+
+    static_assert( DEMO_CONFIGURATION_TABLE_SIZE( btnm_types_map ) ==
+                       DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_wifi_type_table ) + 1,
+                   "Wi-Fi type buttons and table are not consistent" );
 };
 
 #endif
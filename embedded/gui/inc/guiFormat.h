@@ -49,6 +49,8 @@
 
 #define GUI_WIFI_CHANNELS 14
 
+#define GUI_RADIO_SPECTRUM_MAX_BINS 128
+
 #define GUI_RESULT_GEO_LOC_STREET_LENGTH 32
 #define GUI_RESULT_GEO_LOC_CITY_LENGTH 32
 #define GUI_RESULT_GEO_LOC_COUNTRY_LENGTH 32
@@ -89,6 +91,7 @@ typedef struct
     GuiWifiMacAddress_t  macAddr;
     GuiWifiCountryCode_t countryCode;
     int8_t               rssi;
+    uint16_t             nbDetections;
 } GuiWifiResultData_t;
 
 typedef struct
@@ -104,14 +107,31 @@ typedef struct
 
 typedef struct
 {
-    GuiDemoStatus_t     status;
-    GuiWifiResultType_t typeB;
-    GuiWifiResultType_t typeG;
-    uint8_t             nbMacAddrTotal;
-    uint32_t            powerConsTotal;
-    uint32_t            timingTotal;
-    GuiResultGeoLoc_t   reverse_geo_loc;
-    bool                error;
+    uint16_t nbScans;
+    uint16_t nbDetections;
+    uint8_t  nbApMaxPerScan;
+    int8_t   rssiMax;
+} GuiWifiChannelStats_t;
+
+typedef struct
+{
+    GuiWifiChannelStats_t channel[GUI_WIFI_CHANNELS];
+    uint16_t              nbScans;
+} GuiWifiChannelsStats_t;
+
+typedef struct
+{
+    GuiDemoStatus_t        status;
+    GuiWifiResultType_t    typeB;
+    GuiWifiResultType_t    typeG;
+    uint8_t                nbMacAddrTotal;
+    uint8_t                nbApAggregated;
+    uint16_t               nbScansAggregated;
+    GuiWifiChannelsStats_t channelsStats;
+    uint32_t               powerConsTotal;
+    uint32_t               timingTotal;
+    GuiResultGeoLoc_t      reverse_geo_loc;
+    bool                   error;
 } GuiWifiResult_t;
 
 typedef enum
@@ -151,12 +171,33 @@ typedef struct
     uint32_t count_rx_wrong_packet;
     uint32_t count_tx;
     uint32_t count_rx_timeout;
+    uint32_t count_rx_expected_packet;
+    uint32_t average_current_ua;
 } GuiRadioPerResult_t;
 
+typedef struct
+{
+    uint32_t sweep_index;
+    uint32_t sweep_duration_ms;
+    uint32_t start_freq_in_hz;
+    uint32_t step_in_hz;
+    uint8_t  nb_bins;
+    int8_t   peak_rssi[GUI_RADIO_SPECTRUM_MAX_BINS];
+    int8_t   average_rssi[GUI_RADIO_SPECTRUM_MAX_BINS];
+} GuiRadioSpectrumResult_t;
+
+typedef struct
+{
+    bool     is_sampled;
+    uint16_t vbat_mv;
+    int16_t  temperature_dc;  //!< Temperature in tenths of degree Celsius
+} GuiTelemetry_t;
+
 typedef struct
 {
     GuiRadioPerResult_t      radio_per_result;
     GuiRadioPingPongResult_t radio_pingpong_result;
+    GuiRadioSpectrumResult_t radio_spectrum_result;
     GuiWifiResult_t          wifi_result;
     GuiGnssResult_t          gnss_result;
 } GuiDemoResult_t;
@@ -0,0 +1,77 @@
+/**
+ * @file      guiMemoryMonitor.h
+ *
+ * @brief     Monitor of the LVGL memory pool usage per GUI page
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __GUI_MEMORY_MONITOR_H__
+#define __GUI_MEMORY_MONITOR_H__
+
+#include <stdint.h>
+#include "guiCommon.h"
+
+/*!
+ * \brief Minimum delay between two periodic samplings of the LVGL memory pool
+ */
+#define GUI_MEMORY_MONITOR_PERIOD_MS ( 500 )
+
+typedef struct
+{
+    uint32_t n_samples;
+    uint32_t peak_used_size;
+    uint32_t min_free_biggest_size;
+    uint8_t  peak_frag_pct;
+} GuiMemoryPageStats_t;
+
+/*!
+ * \brief Keep track of the LVGL memory pool usage and fragmentation for each page
+ *
+ * Walking the LVGL pool is linear in the number of allocated blocks, so the samplings are requested by Gui on page
+ * changes and refreshes, and are otherwise limited to one every GUI_MEMORY_MONITOR_PERIOD_MS.
+ */
+class GuiMemoryMonitor
+{
+   public:
+    GuiMemoryMonitor( );
+    virtual ~GuiMemoryMonitor( );
+
+    void Reset( );
+    void Sample( guiPageType_t page, bool force );
+
+    uint32_t                    GetPoolSize( ) const;
+    uint8_t                     GetImageCacheSize( ) const;
+    uint32_t                    GetPeakUsedSize( ) const;
+    const GuiMemoryPageStats_t* GetPageStats( guiPageType_t page ) const;
+
+   private:
+    uint32_t             last_sample_tick;
+    uint32_t             peak_used_size;
+    GuiMemoryPageStats_t page_stats[GUI_PAGE_COUNT];
+};
+
+#endif  // __GUI_MEMORY_MONITOR_H__
@@ -54,6 +54,9 @@ class GuiMenuRadioTestModes : public GuiMenuCommon
     lv_obj_t* lbl_radio_ping_pong;
     lv_obj_t* btn_radio_ping_pong;
     lv_obj_t* lbl_btn_radio_ping_pong;
+    lv_obj_t* lbl_radio_spectrum;
+    lv_obj_t* btn_radio_spectrum;
+    lv_obj_t* lbl_btn_radio_spectrum;
     lv_obj_t* btn_back;
     lv_obj_t* btn_config;
 };
@@ -43,17 +43,19 @@ class GuiResultsGnss : public GuiCommon
     virtual ~GuiResultsGnss( );
 
     virtual void draw( );
+    virtual void refresh( );
     virtual void updateResults( guiEvent_t event );
 
     static void callback( lv_obj_t* obj, lv_event_t event );
 
-    lv_obj_t* table;
-    lv_obj_t* lbl_info_page;
-    lv_obj_t* btn_left;
-    lv_obj_t* btn_right;
-    lv_obj_t* btn_back;
+    guiResultRow_t rows[GUI_GNSS_MAX_RESULTS];
+    lv_obj_t*      lbl_info_page;
+    lv_obj_t*      btn_left;
+    lv_obj_t*      btn_right;
+    lv_obj_t*      btn_back;
 
    private:
+    void                   updateNavigation( );
     void                   setResults( );
     uint8_t                _pageTotal;
     uint8_t                _pageCurrent;
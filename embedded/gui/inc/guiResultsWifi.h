@@ -41,22 +41,26 @@ class GuiResultsWifi : public GuiCommon
     virtual ~GuiResultsWifi( );
 
     virtual void draw( );
+    virtual void refresh( );
     virtual void updateResults( guiEvent_t event );
 
     static void callback( lv_obj_t* obj, lv_event_t event );
 
-    lv_obj_t* table;
-    lv_obj_t* lbl_info_page;
-    lv_obj_t* btn_left;
-    lv_obj_t* btn_right;
-    lv_obj_t* btn_back;
+    guiResultRow_t rows[GUI_MAX_WIFI_MAC_ADDRESSES];
+    lv_obj_t*      lbl_info_page;
+    lv_obj_t*      btn_left;
+    lv_obj_t*      btn_right;
+    lv_obj_t*      btn_back;
 
    private:
-    void                   findNextChannel( bool up );
-    void                   setChannelResults( );
-    bool                   _isSeveralPages;
-    uint8_t                _index;
-    const GuiWifiResult_t* _results;
+    bool                          findFirstChannel( );
+    void                          findNextChannel( bool up );
+    void                          updateNavigation( );
+    void                          setChannelResults( );
+    const GuiWifiResultChannel_t* getChannel( uint8_t index ) const;
+    bool                          _isSeveralPages;
+    uint8_t                       _index;
+    const GuiWifiResult_t*        _results;
 };
 
 #endif
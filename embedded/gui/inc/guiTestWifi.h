@@ -57,6 +57,7 @@ class GuiTestWifi : public GuiCommon
     lv_obj_t* btn_send;
     lv_obj_t* btn_back;
     lv_obj_t* btn_config;
+    lv_obj_t* btn_stats;
 
    private:
     const GuiWifiResult_t* _results;
@@ -68,11 +68,22 @@ typedef int16_t lv_coord_t;
 /* LittelvGL's internal memory manager's settings.
  * The graphical objects and other related data are stored here. */
 
+/* Optional build-time profile sizing the memory pool and the image cache from the peaks measured by GuiMemoryMonitor.
+ * gui_memory_profile.h is generated by the GuiMemoryProfile host tool, and used when building with
+ * `make GUI_MEMORY_PROFILE=1`. It defines GUI_MEMORY_PROFILE_MEM_SIZE and GUI_MEMORY_PROFILE_IMG_CACHE_SIZE. */
+#ifdef GUI_MEMORY_PROFILE
+#  include "gui_memory_profile.h"
+#endif
+
 /* 1: use custom malloc/free, 0: use the built-in `lv_mem_alloc` and `lv_mem_free` */
 #define LV_MEM_CUSTOM      0
 #if LV_MEM_CUSTOM == 0
 /* Size of the memory used by `lv_mem_alloc` in bytes (>= 2kB)*/
-#  define LV_MEM_SIZE    (32U * 1024U)
+#  ifdef GUI_MEMORY_PROFILE_MEM_SIZE
+#    define LV_MEM_SIZE    GUI_MEMORY_PROFILE_MEM_SIZE
+#  else
+#    define LV_MEM_SIZE    (32U * 1024U)
+#  endif
 
 /* Complier prefix for a big array declaration */
 #  define LV_MEM_ATTR
@@ -173,7 +184,11 @@ typedef void * lv_fs_drv_user_data_t;
  * With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  * However the opened images might consume additional RAM.
  * LV_IMG_CACHE_DEF_SIZE must be >= 1 */
+#ifdef GUI_MEMORY_PROFILE_IMG_CACHE_SIZE
+#define LV_IMG_CACHE_DEF_SIZE       GUI_MEMORY_PROFILE_IMG_CACHE_SIZE
+#else
 #define LV_IMG_CACHE_DEF_SIZE       1
+#endif
 
 /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
 typedef void * lv_img_decoder_user_data_t;
@@ -0,0 +1,67 @@
+/**
+ * @file      lv_img_rle.h
+ *
+ * @brief     Run-length encoded image decoder for LVGL
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LV_IMG_RLE_H__
+#define __LV_IMG_RLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lvgl.h"
+
+/*!
+ * \brief Color format of the run-length encoded images
+ *
+ * The data of an image with this color format is made of:
+ *   - a table of one 16-bit little endian offset per row, pointing to the first run of the row from the start of the
+ *     data;
+ *   - the runs of each row. A run starts with a control byte: if its MSB is set, the next RGB565 little endian pixel
+ *     is repeated ( control & 0x7F ) + 1 times, otherwise the ( control + 1 ) next RGB565 little endian pixels are
+ *     copied as is. A run never crosses a row boundary.
+ *
+ * These images are produced by embedded/tools/lv_img_rle_converter.py.
+ */
+#define LV_IMG_CF_RLE ( LV_IMG_CF_USER_ENCODED_0 )
+
+/*!
+ * \brief Register the run-length encoded image decoder to LVGL
+ *
+ * Must be called after lv_init. The images are decoded one line at a time, directly in the LVGL draw buffer, so no
+ * RAM is needed to hold the decoded image.
+ */
+void lv_img_rle_init( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -31,14 +31,19 @@
 
 #include "gui.h"
 #include "lvgl.h"
+#include "touch.h"
 
 volatile bool Gui::interruptPending = false;
 bool          Gui::isTouched        = false;
 
 Gui::Gui( ) : refresh_pending( false ), event( GUI_LAST_EVENT_NONE )
 {
-    this->demo_results.wifi_result.nbMacAddrTotal = 0;
-    this->demo_results.wifi_result.powerConsTotal = 0;
+    this->demo_results.wifi_result.nbMacAddrTotal    = 0;
+    this->demo_results.wifi_result.nbApAggregated    = 0;
+    this->demo_results.wifi_result.nbScansAggregated = 0;
+    this->demo_results.wifi_result.powerConsTotal    = 0;
+    memset( &this->demo_results.wifi_result.channelsStats, 0, sizeof( GuiWifiChannelsStats_t ) );
+    memset( &this->telemetry, 0, sizeof( GuiTelemetry_t ) );
 }
 
 Gui::~Gui( ) {}
@@ -51,7 +56,7 @@ void Gui::Init( GuiDemoSettings_t* settings, GuiDemoSettings_t* settings_default
 
     guiPages.guiSplashscreen = new GuiSplashScreen( );
 
-    guiPages.guiAbout = new GuiAbout( this->version_handler );
+    guiPages.guiAbout = new GuiAbout( this->version_handler, &this->telemetry );
 
     guiPages.guiMenu = new GuiMenu( );
 
@@ -64,13 +69,18 @@ void Gui::Init( GuiDemoSettings_t* settings, GuiDemoSettings_t* settings_default
     guiPages.guiCurrent = guiPages.guiSplashscreen;
     guiPages.guiNext    = guiPages.guiCurrent;
     guiPages.guiCurrent->draw( );
+    this->memory_monitor.Sample( guiPages.guiCurrent->getType( ), true );
 
-    this->demo_results.wifi_result.nbMacAddrTotal = 0;
+    this->demo_results.wifi_result.nbMacAddrTotal    = 0;
+    this->demo_results.wifi_result.nbApAggregated    = 0;
+    this->demo_results.wifi_result.nbScansAggregated = 0;
+    memset( &this->demo_results.wifi_result.channelsStats, 0, sizeof( GuiWifiChannelsStats_t ) );
 }
 
 void Gui::Runtime( )
 {
     guiEvent_t event_from_display;
+    bool       force_memory_sample = false;
 
     event_from_display = guiPages.guiCurrent->getAndClearEvent( );
 
@@ -149,6 +159,11 @@ void Gui::Runtime( )
                 this->guiPages.guiNext          = this->guiPages.guiRadioPingPong;
                 this->guiPages.guiNext->init( );
                 break;
+            case GUI_EVENT_START_SPECTRUM:
+                this->guiPages.guiRadioSpectrum = new GuiRadioSpectrum( &( this->demo_results.radio_spectrum_result ) );
+                this->guiPages.guiNext          = this->guiPages.guiRadioSpectrum;
+                this->guiPages.guiNext->init( );
+                break;
             case GUI_EVENT_CONFIG:
                 this->guiPages.guiNext = this->guiPages.guiConfigRadioTestModes;
                 break;
@@ -196,6 +211,8 @@ void Gui::Runtime( )
                 this->guiPages.guiNext      = this->guiPages.guiMenuRadioTestModes;
                 this->event                 = GUI_LAST_EVENT_STOP_DEMO;
                 break;
+            default:
+                break;
             }
             break;
         }
@@ -222,6 +239,8 @@ void Gui::Runtime( )
                 this->guiPages.guiNext     = this->guiPages.guiMenuRadioTestModes;
                 this->event                = GUI_LAST_EVENT_STOP_DEMO;
                 break;
+            default:
+                break;
             }
             break;
         }
@@ -244,6 +263,32 @@ void Gui::Runtime( )
                 this->guiPages.guiNext          = this->guiPages.guiMenuRadioTestModes;
                 this->event                     = GUI_LAST_EVENT_STOP_DEMO;
                 break;
+            default:
+                break;
+            }
+            break;
+        }
+
+        case GUI_PAGE_RADIO_SPECTRUM:
+        {
+            switch( event_from_display )
+            {
+            case GUI_EVENT_START_SPECTRUM:
+                this->guiPages.guiCurrent->start( );
+                this->event = GUI_LAST_EVENT_START_DEMO_RADIO_SPECTRUM;
+                break;
+            case GUI_EVENT_STOP:
+                this->guiPages.guiCurrent->stop( );
+                this->event = GUI_LAST_EVENT_STOP_DEMO;
+                break;
+            case GUI_EVENT_BACK:
+                delete this->guiPages.guiRadioSpectrum;
+                this->guiPages.guiRadioSpectrum = NULL;
+                this->guiPages.guiNext          = this->guiPages.guiMenuRadioTestModes;
+                this->event                     = GUI_LAST_EVENT_STOP_DEMO;
+                break;
+            default:
+                break;
             }
             break;
         }
@@ -253,11 +298,12 @@ void Gui::Runtime( )
             switch( event_from_display )
             {
             case GUI_EVENT_START_WIFI:
-                guiPages.guiTestWifi   = new GuiTestWifi( &demo_results.wifi_result );
-                guiPages.guiResultWifi = new GuiResultsWifi( &demo_results.wifi_result );
-                guiPages.guiConfigWifi = new GuiConfigWifi( &( this->demo_settings.wifi_settings ),
-                                                            &( this->demo_settings_default.wifi_settings ) );
-                this->guiPages.guiNext = this->guiPages.guiTestWifi;
+                guiPages.guiTestWifi           = new GuiTestWifi( &demo_results.wifi_result );
+                guiPages.guiResultWifi         = new GuiResultsWifi( &demo_results.wifi_result );
+                guiPages.guiResultWifiChannels = new GuiResultsWifiChannels( &demo_results.wifi_result );
+                guiPages.guiConfigWifi         = new GuiConfigWifi( &( this->demo_settings.wifi_settings ),
+                                                                    &( this->demo_settings_default.wifi_settings ) );
+                this->guiPages.guiNext         = this->guiPages.guiTestWifi;
                 this->guiPages.guiNext->init( );
                 break;
             case GUI_EVENT_START_GNSS_AUTONOMOUS:
@@ -302,12 +348,14 @@ void Gui::Runtime( )
             case GUI_EVENT_BACK:
                 delete guiPages.guiTestWifi;
                 delete guiPages.guiResultWifi;
+                delete guiPages.guiResultWifiChannels;
                 delete guiPages.guiConfigWifi;
-                guiPages.guiTestWifi   = NULL;
-                guiPages.guiResultWifi = NULL;
-                guiPages.guiConfigWifi = NULL;
-                guiPages.guiNext       = guiPages.guiMenuDemo;
-                this->event            = GUI_LAST_EVENT_STOP_DEMO;
+                guiPages.guiTestWifi           = NULL;
+                guiPages.guiResultWifi         = NULL;
+                guiPages.guiResultWifiChannels = NULL;
+                guiPages.guiConfigWifi         = NULL;
+                guiPages.guiNext               = guiPages.guiMenuDemo;
+                this->event                    = GUI_LAST_EVENT_STOP_DEMO;
                 break;
             case GUI_EVENT_START_WIFI:
                 guiPages.guiCurrent->start( );
@@ -316,6 +364,9 @@ void Gui::Runtime( )
             case GUI_EVENT_RESULTS:
                 guiPages.guiNext = guiPages.guiResultWifi;
                 break;
+            case GUI_EVENT_STATISTICS:
+                guiPages.guiNext = guiPages.guiResultWifiChannels;
+                break;
             case GUI_EVENT_SEND:
                 this->event = GUI_LAST_EVENT_SEND;
                 break;
@@ -345,6 +396,19 @@ void Gui::Runtime( )
             break;
         }
 
+        case GUI_PAGE_WIFI_CHANNELS:
+        {
+            switch( event_from_display )
+            {
+            case GUI_EVENT_BACK:
+                guiPages.guiNext = guiPages.guiTestWifi;
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+
         case GUI_PAGE_WIFI_CONFIG:
         {
             switch( event_from_display )
@@ -507,6 +571,7 @@ void Gui::Runtime( )
         {
             guiPages.guiNext->draw( );
             guiPages.guiCurrent = guiPages.guiNext;
+            force_memory_sample = true;
         }
     }
 
@@ -514,9 +579,12 @@ void Gui::Runtime( )
     {
         this->refresh_pending = false;
         guiPages.guiCurrent->refresh( );
+        force_memory_sample = true;
     }
 
     lv_task_handler( );
+
+    this->memory_monitor.Sample( guiPages.guiCurrent->getType( ), force_memory_sample );
 }
 
 void Gui::GetRadioSettings( GuiRadioSetting_t* settings ) { *settings = this->demo_settings.radio_settings; }
@@ -537,6 +605,7 @@ void Gui::InterruptHandler( bool is_down )
 {
     interruptPending = true;
     Gui::isTouched   = is_down;
+    touch_irq_handler( is_down );
 }
 
 void Gui::HostConnectivityChange( bool is_connected )
@@ -575,6 +644,12 @@ void Gui::UpdateRadioPerResult( GuiRadioPerResult_t& demo_result )
     this->refresh_pending               = true;
 }
 
+void Gui::UpdateRadioSpectrumResult( GuiRadioSpectrumResult_t& demo_result )
+{
+    this->demo_results.radio_spectrum_result = demo_result;
+    this->refresh_pending                    = true;
+}
+
 void Gui::UpdateReverseGeoCoding( const GuiResultGeoLoc_t& new_reverse_geo_coding )
 {
     this->demo_results.gnss_result.reverse_geo_loc = new_reverse_geo_coding;
@@ -582,6 +657,21 @@ void Gui::UpdateReverseGeoCoding( const GuiResultGeoLoc_t& new_reverse_geo_codin
     this->refresh_pending                          = true;
 }
 
+void Gui::UpdateTelemetry( const GuiTelemetry_t& new_telemetry )
+{
+    this->telemetry = new_telemetry;
+
+    // Only the about page shows the telemetry, the other pages must not be refreshed for it
+    if( ( guiPages.guiCurrent != NULL ) && ( guiPages.guiCurrent->getType( ) == GUI_PAGE_ABOUT ) )
+    {
+        this->refresh_pending = true;
+    }
+}
+
 void Gui::SetDemoStatus( GuiDemoStatus_t& demo_status ) {}
 
 bool Gui::HasRefreshPending( ) const { return this->refresh_pending; }
+
+const GuiMemoryMonitor& Gui::GetMemoryMonitor( ) const { return this->memory_monitor; }
+
+void Gui::ResetMemoryMonitor( ) { this->memory_monitor.Reset( ); }
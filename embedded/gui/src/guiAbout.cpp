@@ -35,8 +35,8 @@
 
 #define GUI_ABOUT_BUFFER_LENGTH ( 30 )
 
-GuiAbout::GuiAbout( version_handler_t* version_handler )
-    : GuiCommon( GUI_PAGE_ABOUT ), version_handler( version_handler )
+GuiAbout::GuiAbout( version_handler_t* version_handler, const GuiTelemetry_t* telemetry )
+    : GuiCommon( GUI_PAGE_ABOUT ), version_handler( version_handler ), telemetry( telemetry )
 {
     char buffer[GUI_ABOUT_BUFFER_LENGTH];
 
@@ -78,6 +78,13 @@ GuiAbout::GuiAbout( version_handler_t* version_handler )
     lv_obj_set_width( lbl_version_fw, 240 );
     lv_obj_align( lbl_version_fw, NULL, LV_ALIGN_CENTER, 0, -40 );
 
+    this->lbl_telemetry = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_telemetry, &( GuiCommon::screen_style ) );
+    lv_label_set_long_mode( this->lbl_telemetry, LV_LABEL_LONG_BREAK );
+    lv_label_set_align( this->lbl_telemetry, LV_LABEL_ALIGN_CENTER );
+    lv_obj_set_width( this->lbl_telemetry, 240 );
+    this->refresh( );
+
     lv_obj_t* lbl_copyrights_lvgl = lv_label_create( this->screen, NULL );
     lv_obj_set_style( lbl_copyrights_lvgl, &( GuiCommon::screen_style ) );
     lv_label_set_long_mode( lbl_copyrights_lvgl, LV_LABEL_LONG_BREAK );
@@ -99,7 +106,28 @@ GuiAbout::GuiAbout( version_handler_t* version_handler )
 
 GuiAbout::~GuiAbout( ) {}
 
-void GuiAbout::draw( ) { lv_scr_load( this->screen ); }
+void GuiAbout::draw( )
+{
+    this->refresh( );
+    lv_scr_load( this->screen );
+}
+
+void GuiAbout::refresh( )
+{
+    char buffer[GUI_ABOUT_BUFFER_LENGTH];
+
+    if( this->telemetry->is_sampled == true )
+    {
+        snprintf( buffer, GUI_ABOUT_BUFFER_LENGTH, "VBAT %u mV - %.1f C", this->telemetry->vbat_mv,
+                  this->telemetry->temperature_dc / 10.0f );
+    }
+    else
+    {
+        snprintf( buffer, GUI_ABOUT_BUFFER_LENGTH, "VBAT - TEMPERATURE: N/A" );
+    }
+    lv_label_set_text( this->lbl_telemetry, buffer );
+    lv_obj_align( this->lbl_telemetry, NULL, LV_ALIGN_CENTER, 0, -20 );
+}
 
 void GuiAbout::callback( lv_obj_t* obj, lv_event_t event )
 {
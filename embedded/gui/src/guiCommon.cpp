@@ -44,6 +44,11 @@
 #define GUI_COMMON_INFOFRAME_HEIGHT 150
 #define GUI_COMMON_INFOFRAME_WIDTH 230
 
+#define GUI_COMMON_RESULT_ROW_HEIGHT 30
+#define GUI_COMMON_RESULT_NAME_WIDTH 150
+#define GUI_COMMON_RESULT_VALUE_WIDTH 80
+#define GUI_COMMON_RESULT_TEXT_MARGIN 5
+
 bool       GuiCommon::_is_host_connected       = false;
 bool       GuiCommon::_is_gui_environment_init = false;
 guiEvent_t GuiCommon::_event                   = GUI_EVENT_NONE;
@@ -274,6 +279,84 @@ void GuiCommon::updateHostConnectivityState( const bool is_connected )
     this->updateHostConnectivityState( );
 }
 
+void GuiCommon::createResultRows( guiResultRow_t* rows, uint8_t n_rows, int16_t y_pos )
+{
+    const int16_t x_pos = ( LV_HOR_RES_MAX - GUI_COMMON_RESULT_NAME_WIDTH - GUI_COMMON_RESULT_VALUE_WIDTH ) / 2;
+
+    for( uint8_t index = 0; index < n_rows; index++ )
+    {
+        guiResultRow_t* row   = &rows[index];
+        const int16_t   row_y = y_pos + index * ( GUI_COMMON_RESULT_ROW_HEIGHT - 1 );
+
+        // Adjacent cells share their border, as in a table
+        row->cell_name = lv_cont_create( this->screen, NULL );
+        lv_cont_set_fit( row->cell_name, LV_FIT_NONE );
+        lv_cont_set_style( row->cell_name, LV_CONT_STYLE_MAIN, &( GuiCommon::table_cell1 ) );
+        lv_obj_set_size( row->cell_name, GUI_COMMON_RESULT_NAME_WIDTH, GUI_COMMON_RESULT_ROW_HEIGHT );
+        lv_obj_set_pos( row->cell_name, x_pos, row_y );
+
+        row->cell_value = lv_cont_create( this->screen, NULL );
+        lv_cont_set_fit( row->cell_value, LV_FIT_NONE );
+        lv_cont_set_style( row->cell_value, LV_CONT_STYLE_MAIN, &( GuiCommon::table_cell1 ) );
+        lv_obj_set_size( row->cell_value, GUI_COMMON_RESULT_VALUE_WIDTH, GUI_COMMON_RESULT_ROW_HEIGHT );
+        lv_obj_set_pos( row->cell_value, x_pos + GUI_COMMON_RESULT_NAME_WIDTH - 1, row_y );
+
+        // The labels are realigned by LVGL when their text changes their size
+        row->lbl_name = lv_label_create( row->cell_name, NULL );
+        lv_label_set_text( row->lbl_name, "" );
+        lv_obj_set_auto_realign( row->lbl_name, true );
+        lv_obj_align( row->lbl_name, NULL, LV_ALIGN_IN_LEFT_MID, GUI_COMMON_RESULT_TEXT_MARGIN, 0 );
+
+        row->lbl_value = lv_label_create( row->cell_value, NULL );
+        lv_label_set_text( row->lbl_value, "" );
+        lv_obj_set_auto_realign( row->lbl_value, true );
+        lv_obj_align( row->lbl_value, NULL, LV_ALIGN_IN_RIGHT_MID, -GUI_COMMON_RESULT_TEXT_MARGIN, 0 );
+
+        GuiCommon::hideResultRow( row );
+    }
+}
+
+bool GuiCommon::updateLabelText( lv_obj_t* label, const char* text )
+{
+    // Setting a label text always invalidates it, even if the text is unchanged
+    if( strcmp( lv_label_get_text( label ), text ) == 0 )
+    {
+        return false;
+    }
+
+    lv_label_set_text( label, text );
+    return true;
+}
+
+void GuiCommon::updateButtonState( lv_obj_t* btn, lv_btn_state_t state )
+{
+    if( lv_btn_get_state( btn ) != state )
+    {
+        lv_btn_set_state( btn, state );
+    }
+}
+
+void GuiCommon::setResultRow( guiResultRow_t* row, const char* name, const char* value )
+{
+    GuiCommon::updateLabelText( row->lbl_name, name );
+    GuiCommon::updateLabelText( row->lbl_value, value );
+
+    if( lv_obj_get_hidden( row->cell_name ) == true )
+    {
+        lv_obj_set_hidden( row->cell_name, false );
+        lv_obj_set_hidden( row->cell_value, false );
+    }
+}
+
+void GuiCommon::hideResultRow( guiResultRow_t* row )
+{
+    if( lv_obj_get_hidden( row->cell_name ) == false )
+    {
+        lv_obj_set_hidden( row->cell_name, true );
+        lv_obj_set_hidden( row->cell_value, true );
+    }
+}
+
 guiEvent_t GuiCommon::touchEvent( uint16_t x, uint16_t y )
 {
     guiEvent_t event = GUI_EVENT_NONE;
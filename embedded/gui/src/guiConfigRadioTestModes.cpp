@@ -31,6 +31,7 @@
 
 #include "guiConfigRadioTestModes.h"
 #include "stdlib.h"
+#include "demo_configuration_tables.h"
 
 #define DDLIST_WIDTH 95
 #define TMP_BUFFER_CONFIG_PARAM_GENERIC_LENGTH ( 10 )
@@ -65,8 +66,8 @@ GuiConfigRadioTestModes::GuiConfigRadioTestModes( GuiRadioSetting_t*       setti
     this->create_ta( &( this->ta_pkt ), this->tab_generic, 80, "Nb of packets", 5, "100",
                      GuiConfigRadioTestModes::callback_ta );
 
-    this->create_ddlist( &( this->ddlist_pwr ), this->tab_generic, 115, "Power (dBm)", lp_pa_options,
-                         GuiConfigRadioTestModes::callback_ddlist );
+    this->create_ddlist( &( this->ddlist_pwr ), this->tab_generic, 115, "Power (dBm)",
+                         demo_configuration_lp_pa_options, GuiConfigRadioTestModes::callback_ddlist );
 
     this->createChoiceSwitch( &( this->sw_pkt_type ), this->tab_generic, "LoRa", "GFSK",
                               GuiConfigRadioTestModes::callback_sw, 30, true );
@@ -75,27 +76,15 @@ GuiConfigRadioTestModes::GuiConfigRadioTestModes( GuiRadioSetting_t*       setti
                               GuiConfigRadioTestModes::callback_sw, 65, true );
 
     this->create_ddlist( &( this->lora_ddlist_sf ), this->tab_lora, 20, "Spreading Factor",
-                         "SF5\n"
-                         "SF6\n"
-                         "SF7\n"
-                         "SF8\n"
-                         "SF9\n"
-                         "SF10\n"
-                         "SF11\n"
-                         "SF12",
+                         demo_configuration_lora_sf_options,
                          GuiConfigRadioTestModes::callback_ddlist );
 
     this->create_ddlist( &( this->lora_ddlist_bw ), this->tab_lora, 50, "Bandwidth",
-                         "125kHz\n"
-                         "250kHz\n"
-                         "500kHz",
+                         demo_configuration_lora_bw_options,
                          GuiConfigRadioTestModes::callback_ddlist );
 
     this->create_ddlist( &( this->lora_ddlist_cr ), this->tab_lora, 80, "Coding rate",
-                         "4/5\n"
-                         "4/6\n"
-                         "4/7\n"
-                         "4/8",
+                         demo_configuration_lora_cr_options,
                          GuiConfigRadioTestModes::callback_ddlist );
 
     this->create_ddlist( &( this->lora_ddlist_iq ), this->tab_lora, 110, "IQ",
@@ -120,11 +109,7 @@ GuiConfigRadioTestModes::GuiConfigRadioTestModes( GuiRadioSetting_t*       setti
                      GuiConfigRadioTestModes::callback_ta );
 
     this->create_ddlist( &( this->gfsk_ddlist_crc ), this->tab_gfsk, 80, "CRC",
-                         "OFF\n"
-                         "1B\n"
-                         "2B\n"
-                         "1B inv.\n"
-                         "2B inv.",
+                         demo_configuration_gfsk_crc_options,
                          GuiConfigRadioTestModes::callback_ddlist );
 
     this->create_ddlist( &( this->gfsk_ddlist_hdr ), this->tab_gfsk, 110, "Header type",
@@ -199,43 +184,16 @@ void GuiConfigRadioTestModes::ConfigParamGeneric( )
     if( this->settings_temp.is_hp_pa_enabled == true )
     {
         lv_sw_on( this->sw_pa, LV_ANIM_OFF );
-        lv_ddlist_set_options( this->ddlist_pwr, hp_pa_options );
-        switch( this->settings_temp.pwr_in_dbm )
-        {
-        case 14:
-            lv_ddlist_set_selected( this->ddlist_pwr, 0 );
-            break;
-        case 17:
-            lv_ddlist_set_selected( this->ddlist_pwr, 1 );
-            break;
-        case 20:
-            lv_ddlist_set_selected( this->ddlist_pwr, 2 );
-            break;
-        case 22:
-            lv_ddlist_set_selected( this->ddlist_pwr, 3 );
-            break;
-        default:
-            break;
-        }
+        lv_ddlist_set_options( this->ddlist_pwr, demo_configuration_hp_pa_options );
+        lv_ddlist_set_selected( this->ddlist_pwr, demo_configuration_get_pa_index( LR1110_RADIO_PA_SEL_HP,
+                                                                                   this->settings_temp.pwr_in_dbm ) );
     }
     else
     {
         lv_sw_off( this->sw_pa, LV_ANIM_OFF );
-        lv_ddlist_set_options( this->ddlist_pwr, lp_pa_options );
-        switch( this->settings_temp.pwr_in_dbm )
-        {
-        case 10:
-            lv_ddlist_set_selected( this->ddlist_pwr, 0 );
-            break;
-        case 14:
-            lv_ddlist_set_selected( this->ddlist_pwr, 1 );
-            break;
-        case 15:
-            lv_ddlist_set_selected( this->ddlist_pwr, 2 );
-            break;
-        default:
-            break;
-        }
+        lv_ddlist_set_options( this->ddlist_pwr, demo_configuration_lp_pa_options );
+        lv_ddlist_set_selected( this->ddlist_pwr, demo_configuration_get_pa_index( LR1110_RADIO_PA_SEL_LP,
+                                                                                   this->settings_temp.pwr_in_dbm ) );
     }
 }
 
@@ -398,13 +356,13 @@ void GuiConfigRadioTestModes::callback_sw( lv_obj_t* obj, lv_event_t event )
             self->settings_temp.is_hp_pa_enabled = !self->settings_temp.is_hp_pa_enabled;
             if( self->settings_temp.is_hp_pa_enabled == true )
             {
-                lv_ddlist_set_options( self->ddlist_pwr, self->hp_pa_options );
-                self->settings_temp.pwr_in_dbm = 14;
+                lv_ddlist_set_options( self->ddlist_pwr, demo_configuration_hp_pa_options );
+                self->settings_temp.pwr_in_dbm = demo_configuration_hp_pa_table[0].pwr_in_dbm;
             }
             else
             {
-                lv_ddlist_set_options( self->ddlist_pwr, self->lp_pa_options );
-                self->settings_temp.pwr_in_dbm = 10;
+                lv_ddlist_set_options( self->ddlist_pwr, demo_configuration_lp_pa_options );
+                self->settings_temp.pwr_in_dbm = demo_configuration_lp_pa_table[0].pwr_in_dbm;
             }
             lv_ddlist_set_selected( self->ddlist_pwr, 0 );
             self->ConfigActionButton( );
@@ -528,36 +486,13 @@ void GuiConfigRadioTestModes::callback_ddlist( lv_obj_t* obj, lv_event_t event )
         {
             if( self->settings_temp.is_hp_pa_enabled == true )
             {
-                switch( id )
-                {
-                case 0:
-                    self->settings_temp.pwr_in_dbm = 14;
-                    break;
-                case 1:
-                    self->settings_temp.pwr_in_dbm = 17;
-                    break;
-                case 2:
-                    self->settings_temp.pwr_in_dbm = 20;
-                    break;
-                case 3:
-                    self->settings_temp.pwr_in_dbm = 22;
-                    break;
-                }
+                self->settings_temp.pwr_in_dbm =
+                    demo_configuration_get_value( demo_configuration_hp_pa_table, id ).pwr_in_dbm;
             }
             else
             {
-                switch( id )
-                {
-                case 0:
-                    self->settings_temp.pwr_in_dbm = 10;
-                    break;
-                case 1:
-                    self->settings_temp.pwr_in_dbm = 14;
-                    break;
-                case 2:
-                    self->settings_temp.pwr_in_dbm = 15;
-                    break;
-                }
+                self->settings_temp.pwr_in_dbm =
+                    demo_configuration_get_value( demo_configuration_lp_pa_table, id ).pwr_in_dbm;
             }
         }
 
@@ -0,0 +1,104 @@
+/**
+ * @file      guiMemoryMonitor.cpp
+ *
+ * @brief     Monitor of the LVGL memory pool usage per GUI page
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "guiMemoryMonitor.h"
+#include "lvgl.h"
+
+GuiMemoryMonitor::GuiMemoryMonitor( ) { this->Reset( ); }
+
+GuiMemoryMonitor::~GuiMemoryMonitor( ) {}
+
+void GuiMemoryMonitor::Reset( )
+{
+    this->last_sample_tick = 0;
+    this->peak_used_size   = 0;
+
+    for( uint8_t page = 0; page < GUI_PAGE_COUNT; page++ )
+    {
+        this->page_stats[page].n_samples             = 0;
+        this->page_stats[page].peak_used_size        = 0;
+        this->page_stats[page].min_free_biggest_size = UINT32_MAX;
+        this->page_stats[page].peak_frag_pct         = 0;
+    }
+}
+
+void GuiMemoryMonitor::Sample( guiPageType_t page, bool force )
+{
+    if( page >= GUI_PAGE_COUNT )
+    {
+        return;
+    }
+
+    if( ( force == false ) && ( lv_tick_elaps( this->last_sample_tick ) < GUI_MEMORY_MONITOR_PERIOD_MS ) )
+    {
+        return;
+    }
+    this->last_sample_tick = lv_tick_get( );
+
+    lv_mem_monitor_t monitor;
+    lv_mem_monitor( &monitor );
+
+    const uint32_t        used_size = monitor.total_size - monitor.free_size;
+    GuiMemoryPageStats_t& stats     = this->page_stats[page];
+
+    stats.n_samples++;
+    if( used_size > stats.peak_used_size )
+    {
+        stats.peak_used_size = used_size;
+    }
+    if( monitor.free_biggest_size < stats.min_free_biggest_size )
+    {
+        stats.min_free_biggest_size = monitor.free_biggest_size;
+    }
+    if( monitor.frag_pct > stats.peak_frag_pct )
+    {
+        stats.peak_frag_pct = monitor.frag_pct;
+    }
+    if( used_size > this->peak_used_size )
+    {
+        this->peak_used_size = used_size;
+    }
+}
+
+uint32_t GuiMemoryMonitor::GetPoolSize( ) const { return LV_MEM_SIZE; }
+
+uint8_t GuiMemoryMonitor::GetImageCacheSize( ) const { return LV_IMG_CACHE_DEF_SIZE; }
+
+uint32_t GuiMemoryMonitor::GetPeakUsedSize( ) const { return this->peak_used_size; }
+
+const GuiMemoryPageStats_t* GuiMemoryMonitor::GetPageStats( guiPageType_t page ) const
+{
+    if( page >= GUI_PAGE_COUNT )
+    {
+        return NULL;
+    }
+    return &this->page_stats[page];
+}
@@ -35,15 +35,18 @@ GuiMenuRadioTestModes::GuiMenuRadioTestModes( ) : GuiMenuCommon( GUI_PAGE_MENU_R
 {
     this->createHeader( "RADIO TEST MODES" );
 
-    this->createTestEntry( -70, &( this->lbl_radio_tx_cw ), &( this->btn_radio_tx_cw ), &( this->lbl_btn_radio_tx_cw ),
+    this->createTestEntry( -90, &( this->lbl_radio_tx_cw ), &( this->btn_radio_tx_cw ), &( this->lbl_btn_radio_tx_cw ),
                            "TX Cont. Wave", true, GuiMenuRadioTestModes::callback );
 
-    this->createTestEntry( 0, &( this->lbl_radio_per ), &( this->btn_radio_per ), &( this->lbl_btn_radio_per ),
+    this->createTestEntry( -30, &( this->lbl_radio_per ), &( this->btn_radio_per ), &( this->lbl_btn_radio_per ),
                            "Packet Error Rate", true, GuiMenuRadioTestModes::callback );
 
-    this->createTestEntry( 70, &( this->lbl_radio_ping_pong ), &( this->btn_radio_ping_pong ),
+    this->createTestEntry( 30, &( this->lbl_radio_ping_pong ), &( this->btn_radio_ping_pong ),
                            &( this->lbl_btn_radio_ping_pong ), "Ping Pong", true, GuiMenuRadioTestModes::callback );
 
+    this->createTestEntry( 90, &( this->lbl_radio_spectrum ), &( this->btn_radio_spectrum ),
+                           &( this->lbl_btn_radio_spectrum ), "RSSI Spectrum", true, GuiMenuRadioTestModes::callback );
+
     this->createActionButton( &( this->btn_back ), "BACK", GuiMenuRadioTestModes::callback, GUI_BUTTON_POS_CENTER, -5,
                               true );
 
@@ -73,6 +76,10 @@ void GuiMenuRadioTestModes::callback( lv_obj_t* obj, lv_event_t event )
         {
             GuiCommon::_event = GUI_EVENT_START_PING_PONG;
         }
+        else if( obj == self->btn_radio_spectrum )
+        {
+            GuiCommon::_event = GUI_EVENT_START_SPECTRUM;
+        }
         else if( obj == self->btn_back )
         {
             GuiCommon::_event = GUI_EVENT_BACK;
@@ -116,6 +116,18 @@ void GuiRadioPer::refresh( )
 
         snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Packet errors = %i", this->results->count_rx_wrong_packet );
         lv_label_set_text( this->lbl_info_frame_2, buffer );
+
+        if( this->results->count_rx_expected_packet != 0 )
+        {
+            snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Capture %i%% at %iuA",
+                      ( this->results->count_rx_correct_packet * 100 ) / this->results->count_rx_expected_packet,
+                      this->results->average_current_ua );
+        }
+        else
+        {
+            snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Current = %iuA", this->results->average_current_ua );
+        }
+        lv_label_set_text( this->lbl_info_frame_3, buffer );
     }
 }
 
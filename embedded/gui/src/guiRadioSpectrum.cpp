@@ -0,0 +1,180 @@
+/**
+ * @file      guiRadioSpectrum.cpp
+ *
+ * @brief     Implementation of the gui RSSI spectrum sweep page.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "guiRadioSpectrum.h"
+
+#define TMP_BUFFER_REFRESH_LENGTH ( 48 )
+#define GUI_RADIO_SPECTRUM_CHART_WIDTH ( 220 )
+#define GUI_RADIO_SPECTRUM_CHART_HEIGHT ( 100 )
+#define GUI_RADIO_SPECTRUM_RSSI_MIN ( -130 )
+#define GUI_RADIO_SPECTRUM_RSSI_MAX ( -30 )
+
+GuiRadioSpectrum::GuiRadioSpectrum( const GuiRadioSpectrumResult_t* results )
+    : GuiCommon( GUI_PAGE_RADIO_SPECTRUM ), results( results ), nb_points( 0 )
+{
+    this->createHeader( "RSSI SPECTRUM" );
+
+    this->createActionButton( &( this->btn_start ), "START", GuiRadioSpectrum::callback, GUI_BUTTON_POS_CENTER, -60,
+                              true );
+
+    this->createActionButton( &( this->btn_stop ), "STOP", GuiRadioSpectrum::callback, GUI_BUTTON_POS_CENTER, -60,
+                              true );
+
+    this->createActionButton( &( this->btn_back ), "BACK", GuiRadioSpectrum::callback, GUI_BUTTON_POS_CENTER, -5,
+                              true );
+
+    lv_obj_set_hidden( this->btn_start, false );
+    lv_obj_set_hidden( this->btn_stop, true );
+
+    this->lbl_info_page = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_info_page, &( GuiCommon::screen_style ) );
+    lv_label_set_long_mode( this->lbl_info_page, LV_LABEL_LONG_BREAK );
+    lv_label_set_align( this->lbl_info_page, LV_LABEL_ALIGN_CENTER );
+    lv_label_set_text( this->lbl_info_page, "Peak (red) and average (blue)" );
+    lv_obj_set_width( this->lbl_info_page, 240 );
+    lv_obj_align( this->lbl_info_page, NULL, LV_ALIGN_IN_TOP_MID, 0, 45 );
+
+    // One column per frequency bin and series, from the noise floor up to strong signals
+    this->chart = lv_chart_create( this->screen, NULL );
+    lv_obj_set_size( this->chart, GUI_RADIO_SPECTRUM_CHART_WIDTH, GUI_RADIO_SPECTRUM_CHART_HEIGHT );
+    lv_obj_align( this->chart, NULL, LV_ALIGN_IN_TOP_MID, 0, 65 );
+    lv_chart_set_type( this->chart, LV_CHART_TYPE_COLUMN );
+    lv_chart_set_div_line_count( this->chart, 4, 0 );
+    lv_chart_set_range( this->chart, GUI_RADIO_SPECTRUM_RSSI_MIN, GUI_RADIO_SPECTRUM_RSSI_MAX );
+    this->series_peak    = lv_chart_add_series( this->chart, LV_COLOR_RED );
+    this->series_average = lv_chart_add_series( this->chart, LV_COLOR_BLUE );
+    lv_chart_init_points( this->chart, this->series_peak, GUI_RADIO_SPECTRUM_RSSI_MIN );
+    lv_chart_init_points( this->chart, this->series_average, GUI_RADIO_SPECTRUM_RSSI_MIN );
+
+    this->lbl_first_frequency = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_first_frequency, &( GuiCommon::note_style ) );
+    lv_label_set_text( this->lbl_first_frequency, "" );
+    lv_obj_align( this->lbl_first_frequency, this->chart, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 2 );
+
+    this->lbl_last_frequency = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_last_frequency, &( GuiCommon::note_style ) );
+    lv_label_set_text( this->lbl_last_frequency, "" );
+    lv_obj_align( this->lbl_last_frequency, this->chart, LV_ALIGN_OUT_BOTTOM_RIGHT, 0, 2 );
+
+    this->lbl_summary = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_summary, &( GuiCommon::screen_style ) );
+    lv_label_set_long_mode( this->lbl_summary, LV_LABEL_LONG_BREAK );
+    lv_label_set_align( this->lbl_summary, LV_LABEL_ALIGN_CENTER );
+    lv_label_set_text( this->lbl_summary, "" );
+    lv_obj_set_width( this->lbl_summary, 240 );
+    lv_obj_align( this->lbl_summary, this->chart, LV_ALIGN_OUT_BOTTOM_MID, 0, 18 );
+}
+
+GuiRadioSpectrum::~GuiRadioSpectrum( ) {}
+
+void GuiRadioSpectrum::init( ) { lv_label_set_text( this->lbl_summary, "PRESS START TO BEGIN" ); }
+
+void GuiRadioSpectrum::start( ) { lv_label_set_text( this->lbl_summary, "SWEEPING..." ); }
+
+void GuiRadioSpectrum::stop( ) {}
+
+void GuiRadioSpectrum::draw( ) { lv_scr_load( this->screen ); }
+
+void GuiRadioSpectrum::refresh( )
+{
+    char    buffer[TMP_BUFFER_REFRESH_LENGTH];
+    uint8_t strongest_index = 0;
+
+    if( this->results->nb_bins == 0 )
+    {
+        return;
+    }
+
+    if( this->results->nb_bins != this->nb_points )
+    {
+        this->nb_points = this->results->nb_bins;
+        lv_chart_set_point_count( this->chart, this->nb_points );
+
+        this->setFrequencyLabel( this->lbl_first_frequency, this->results->start_freq_in_hz );
+        this->setFrequencyLabel( this->lbl_last_frequency,
+                                 this->results->start_freq_in_hz + ( this->nb_points * this->results->step_in_hz ) );
+    }
+
+    for( uint8_t index = 0; index < this->nb_points; index++ )
+    {
+        this->series_peak->points[index]    = this->results->peak_rssi[index];
+        this->series_average->points[index] = this->results->average_rssi[index];
+
+        if( this->results->peak_rssi[index] > this->results->peak_rssi[strongest_index] )
+        {
+            strongest_index = index;
+        }
+    }
+    lv_chart_refresh( this->chart );
+
+    const uint32_t strongest_frequency_khz = ( this->results->start_freq_in_hz +
+                                               ( strongest_index * this->results->step_in_hz ) +
+                                               ( this->results->step_in_hz / 2 ) ) /
+                                             1000;
+    snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Sweep %lu - %lu ms\nMax %i dBm at %lu.%03lu MHz",
+              this->results->sweep_index, this->results->sweep_duration_ms, this->results->peak_rssi[strongest_index],
+              strongest_frequency_khz / 1000, strongest_frequency_khz % 1000 );
+    GuiCommon::updateLabelText( this->lbl_summary, buffer );
+}
+
+void GuiRadioSpectrum::setFrequencyLabel( lv_obj_t* label, const uint32_t frequency_hz )
+{
+    char buffer[TMP_BUFFER_REFRESH_LENGTH];
+
+    snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "%lu.%lu MHz", frequency_hz / 1000000,
+              ( frequency_hz / 100000 ) % 10 );
+    lv_label_set_text( label, buffer );
+}
+
+void GuiRadioSpectrum::callback( lv_obj_t* obj, lv_event_t event )
+{
+    GuiRadioSpectrum* self = ( GuiRadioSpectrum* ) lv_obj_get_user_data( obj );
+
+    if( ( event == LV_EVENT_RELEASED ) && ( lv_btn_get_state( obj ) != LV_BTN_STATE_INA ) )
+    {
+        if( obj == self->btn_start )
+        {
+            lv_obj_set_hidden( self->btn_start, true );
+            lv_obj_set_hidden( self->btn_stop, false );
+            GuiCommon::_event = GUI_EVENT_START_SPECTRUM;
+        }
+        else if( obj == self->btn_stop )
+        {
+            lv_obj_set_hidden( self->btn_start, false );
+            lv_obj_set_hidden( self->btn_stop, true );
+            GuiCommon::_event = GUI_EVENT_STOP;
+        }
+        else if( obj == self->btn_back )
+        {
+            GuiCommon::_event = GUI_EVENT_BACK;
+        }
+    }
+}
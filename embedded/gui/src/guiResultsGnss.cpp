@@ -34,7 +34,7 @@
 #define TMP_BUFFER_SET_RESULTS_LENGTH ( 25 )
 
 GuiResultsGnss::GuiResultsGnss( const GuiGnssResult_t* results, guiPageType_t pageType )
-    : GuiCommon( pageType ), _results( results )
+    : GuiCommon( pageType ), _pageTotal( 0 ), _pageCurrent( 0 ), _index( 0 ), _results( results )
 {
     switch( pageType )
     {
@@ -62,14 +62,7 @@ GuiResultsGnss::GuiResultsGnss( const GuiGnssResult_t* results, guiPageType_t pa
     lv_obj_set_width( this->lbl_info_page, 240 );
     lv_obj_align( this->lbl_info_page, NULL, LV_ALIGN_IN_TOP_MID, 0, 50 );
 
-    this->table = lv_table_create( this->screen, NULL );
-    lv_table_set_style( this->table, LV_TABLE_STYLE_CELL1, &( GuiCommon::table_cell1 ) );
-    lv_table_set_style( this->table, LV_TABLE_STYLE_BG, &lv_style_transp_tight );
-    lv_table_set_col_cnt( this->table, 2 );
-    lv_table_set_row_cnt( this->table, 6 );
-    lv_table_set_col_width( this->table, 0, 150 );
-    lv_table_set_col_width( this->table, 1, 80 );
-    lv_obj_align( this->table, NULL, LV_ALIGN_IN_TOP_MID, 0, 80 );
+    this->createResultRows( this->rows, GUI_GNSS_MAX_RESULTS, 80 );
 }
 
 GuiResultsGnss::~GuiResultsGnss( ) {}
@@ -78,27 +71,19 @@ void GuiResultsGnss::draw( )
 {
     this->_pageCurrent = 0;
 
-    this->_pageTotal = ( _results->nb_satellites % GUI_GNSS_MAX_RESULTS == 0 )
-                           ? _results->nb_satellites / GUI_GNSS_MAX_RESULTS
-                           : _results->nb_satellites / GUI_GNSS_MAX_RESULTS + 1;
-
-    // Update navigation button states
-    if( _pageTotal > 1 )
-    {
-        lv_btn_set_state( this->btn_left, LV_BTN_STATE_REL );
-        lv_btn_set_state( this->btn_right, LV_BTN_STATE_REL );
-    }
-    else
-    {
-        lv_btn_set_state( this->btn_left, LV_BTN_STATE_INA );
-        lv_btn_set_state( this->btn_right, LV_BTN_STATE_INA );
-    }
-
+    this->updateNavigation( );
     this->setResults( );
 
     lv_scr_load( this->screen );
 }
 
+void GuiResultsGnss::refresh( )
+{
+    // Stay on the displayed page as long as it still exists
+    this->updateNavigation( );
+    this->setResults( );
+}
+
 void GuiResultsGnss::updateResults( guiEvent_t event )
 {
     switch( event )
@@ -123,43 +108,57 @@ void GuiResultsGnss::updateResults( guiEvent_t event )
     this->setResults( );
 }
 
-void GuiResultsGnss::setResults( )
+void GuiResultsGnss::updateNavigation( )
 {
-    char    buffer[TMP_BUFFER_SET_RESULTS_LENGTH];
-    uint8_t max;
+    this->_pageTotal = ( _results->nb_satellites % GUI_GNSS_MAX_RESULTS == 0 )
+                           ? _results->nb_satellites / GUI_GNSS_MAX_RESULTS
+                           : _results->nb_satellites / GUI_GNSS_MAX_RESULTS + 1;
 
-    snprintf( buffer, TMP_BUFFER_SET_RESULTS_LENGTH, "Page %i/%i", _pageCurrent + 1, _pageTotal );
-    lv_label_set_text( this->lbl_info_page, buffer );
+    if( ( this->_pageTotal == 0 ) || ( this->_pageCurrent >= this->_pageTotal ) )
+    {
+        this->_pageCurrent = 0;
+    }
+
+    GuiCommon::updateButtonState( this->btn_left, ( _pageTotal > 1 ) ? LV_BTN_STATE_REL : LV_BTN_STATE_INA );
+    GuiCommon::updateButtonState( this->btn_right, ( _pageTotal > 1 ) ? LV_BTN_STATE_REL : LV_BTN_STATE_INA );
+}
 
-    max = ( ( ( _pageCurrent + 1 ) * GUI_GNSS_MAX_RESULTS ) > _results->nb_satellites )
-              ? _results->nb_satellites
-              : ( ( _pageCurrent + 1 ) * GUI_GNSS_MAX_RESULTS );
+void GuiResultsGnss::setResults( )
+{
+    char buffer_name[TMP_BUFFER_SET_RESULTS_LENGTH];
+    char buffer_value[TMP_BUFFER_SET_RESULTS_LENGTH];
 
-    lv_table_set_row_cnt( this->table, max - _pageCurrent * GUI_GNSS_MAX_RESULTS );
+    snprintf( buffer_name, TMP_BUFFER_SET_RESULTS_LENGTH, "Page %i/%i", _pageCurrent + 1, _pageTotal );
+    GuiCommon::updateLabelText( this->lbl_info_page, buffer_name );
 
-    for( uint8_t index = _pageCurrent * GUI_GNSS_MAX_RESULTS; index < max; index++ )
+    // Only the labels whose text changed are invalidated, so LVGL redraws only these areas
+    for( uint8_t row_index = 0; row_index < GUI_GNSS_MAX_RESULTS; row_index++ )
     {
-        uint8_t table_index = index - _pageCurrent * GUI_GNSS_MAX_RESULTS;
+        const uint8_t index = _pageCurrent * GUI_GNSS_MAX_RESULTS + row_index;
+
+        if( index >= _results->nb_satellites )
+        {
+            GuiCommon::hideResultRow( &this->rows[row_index] );
+            continue;
+        }
 
         switch( _results->satellite_ids[index].constellation )
         {
         case GUI_GNSS_CONSTELLATION_GPS:
-            snprintf( buffer, TMP_BUFFER_SET_RESULTS_LENGTH, "GPS #%i", _results->satellite_ids[index].satellite_id );
+            snprintf( buffer_name, TMP_BUFFER_SET_RESULTS_LENGTH, "GPS #%i",
+                      _results->satellite_ids[index].satellite_id );
             break;
         case GUI_GNSS_CONSTELLATION_BEIDOU:
-            snprintf( buffer, TMP_BUFFER_SET_RESULTS_LENGTH, "BeiDou #%i",
+            snprintf( buffer_name, TMP_BUFFER_SET_RESULTS_LENGTH, "BeiDou #%i",
                       _results->satellite_ids[index].satellite_id );
             break;
         default:
+            buffer_name[0] = '\0';
             break;
         }
 
-        lv_table_set_cell_value( this->table, table_index, 0, buffer );
-        lv_table_set_cell_align( this->table, table_index, 0, LV_LABEL_ALIGN_LEFT );
-
-        snprintf( buffer, TMP_BUFFER_SET_RESULTS_LENGTH, "%ddB", _results->satellite_ids[index].snr );
-        lv_table_set_cell_value( this->table, table_index, 1, buffer );
-        lv_table_set_cell_align( this->table, table_index, 1, LV_LABEL_ALIGN_RIGHT );
+        snprintf( buffer_value, TMP_BUFFER_SET_RESULTS_LENGTH, "%ddB", _results->satellite_ids[index].snr );
+        GuiCommon::setResultRow( &this->rows[row_index], buffer_name, buffer_value );
     }
 }
 
@@ -31,10 +31,10 @@
 
 #include "guiResultsWifi.h"
 
-#define TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH ( 25 )
+#define TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH ( 32 )
 
 GuiResultsWifi::GuiResultsWifi( const GuiWifiResult_t* results )
-    : GuiCommon( GUI_PAGE_WIFI_RESULTS ), _results( results )
+    : GuiCommon( GUI_PAGE_WIFI_RESULTS ), _isSeveralPages( false ), _index( 0 ), _results( results )
 {
     this->createHeader( "Wi-Fi SCANNING - RESULTS" );
 
@@ -52,60 +52,29 @@ GuiResultsWifi::GuiResultsWifi( const GuiWifiResult_t* results )
     lv_obj_set_width( this->lbl_info_page, 240 );
     lv_obj_align( this->lbl_info_page, NULL, LV_ALIGN_IN_TOP_MID, 0, 50 );
 
-    this->table = lv_table_create( this->screen, NULL );
-    lv_table_set_style( this->table, LV_TABLE_STYLE_CELL1, &( GuiCommon::table_cell1 ) );
-    lv_table_set_style( this->table, LV_TABLE_STYLE_BG, &lv_style_transp_tight );
-    lv_table_set_col_cnt( this->table, 2 );
-    lv_table_set_row_cnt( this->table, 6 );
-    lv_table_set_col_width( this->table, 0, 150 );
-    lv_table_set_col_width( this->table, 1, 80 );
-    lv_obj_align( this->table, NULL, LV_ALIGN_IN_TOP_MID, 0, 80 );
+    this->createResultRows( this->rows, GUI_MAX_WIFI_MAC_ADDRESSES, 80 );
 }
 
 GuiResultsWifi::~GuiResultsWifi( ) {}
 
 void GuiResultsWifi::draw( )
 {
-    const GuiWifiResultChannel_t* chan = NULL;
+    this->findFirstChannel( );
+    this->updateNavigation( );
+    this->setChannelResults( );
 
-    // Find the first non - empty channel
-    for( uint8_t index = 0; index < GUI_WIFI_CHANNELS * 2; index++ )
-    {
-        if( index < GUI_WIFI_CHANNELS )
-        {
-            if( _results->typeB.channel[index].nbMacAddr > 0 )
-            {
-                chan   = &_results->typeB.channel[index];
-                _index = index;
-                break;
-            }
-        }
-        else
-        {
-            if( _results->typeG.channel[index % GUI_WIFI_CHANNELS].nbMacAddr > 0 )
-            {
-                chan   = &_results->typeG.channel[index % GUI_WIFI_CHANNELS];
-                _index = index;
-                break;
-            }
-        }
-    }
+    lv_scr_load( this->screen );
+}
 
-    // Update navigation button states
-    if( ( chan != NULL ) && ( chan->nbMacAddr != _results->nbMacAddrTotal ) )
-    {
-        lv_btn_set_state( this->btn_left, LV_BTN_STATE_REL );
-        lv_btn_set_state( this->btn_right, LV_BTN_STATE_REL );
-    }
-    else
+void GuiResultsWifi::refresh( )
+{
+    // Stay on the displayed channel as long as it has results
+    if( this->getChannel( this->_index )->nbMacAddr == 0 )
     {
-        lv_btn_set_state( this->btn_left, LV_BTN_STATE_INA );
-        lv_btn_set_state( this->btn_right, LV_BTN_STATE_INA );
+        this->findFirstChannel( );
     }
-
+    this->updateNavigation( );
     this->setChannelResults( );
-
-    lv_scr_load( this->screen );
 }
 
 void GuiResultsWifi::updateResults( guiEvent_t event )
@@ -114,35 +83,73 @@ void GuiResultsWifi::updateResults( guiEvent_t event )
     this->setChannelResults( );
 }
 
+bool GuiResultsWifi::findFirstChannel( )
+{
+    for( uint8_t index = 0; index < GUI_WIFI_CHANNELS * 2; index++ )
+    {
+        if( this->getChannel( index )->nbMacAddr > 0 )
+        {
+            this->_index = index;
+            return true;
+        }
+    }
+
+    this->_index = 0;
+    return false;
+}
+
+void GuiResultsWifi::updateNavigation( )
+{
+    uint8_t nb_channels_with_results = 0;
+
+    // The channels list the aggregated access points, so their count is not related to the number of results of the
+    // last scan
+    for( uint8_t index = 0; index < GUI_WIFI_CHANNELS * 2; index++ )
+    {
+        if( this->getChannel( index )->nbMacAddr > 0 )
+        {
+            nb_channels_with_results++;
+        }
+    }
+
+    this->_isSeveralPages = ( nb_channels_with_results > 1 );
+
+    GuiCommon::updateButtonState( this->btn_left, this->_isSeveralPages ? LV_BTN_STATE_REL : LV_BTN_STATE_INA );
+    GuiCommon::updateButtonState( this->btn_right, this->_isSeveralPages ? LV_BTN_STATE_REL : LV_BTN_STATE_INA );
+}
+
 void GuiResultsWifi::setChannelResults( )
 {
     char                          buffer[TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH];
-    const GuiWifiResultChannel_t* chan;
+    const GuiWifiResultChannel_t* chan = this->getChannel( this->_index );
 
     // Create page information
     if( this->_index < GUI_WIFI_CHANNELS )
     {
-        chan = &_results->typeB.channel[this->_index];
-        snprintf( buffer, TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH, "Wi-Fi B Ch%i", ( this->_index + 1 ) );
+        snprintf( buffer, TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH, "Wi-Fi B Ch%i - %u scan(s)", ( this->_index + 1 ),
+                  _results->nbScansAggregated );
     }
     else
     {
-        chan = &_results->typeG.channel[this->_index % GUI_WIFI_CHANNELS];
-        snprintf( buffer, TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH, "Wi-Fi G Ch%i", ( _index + 1 ) % GUI_WIFI_CHANNELS );
+        snprintf( buffer, TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH, "Wi-Fi G Ch%i - %u scan(s)",
+                  ( _index + 1 ) % GUI_WIFI_CHANNELS, _results->nbScansAggregated );
     }
 
-    lv_label_set_text( this->lbl_info_page, buffer );
-
-    lv_table_set_row_cnt( this->table, chan->nbMacAddr );
+    GuiCommon::updateLabelText( this->lbl_info_page, buffer );
 
-    for( uint8_t index = 0; index < chan->nbMacAddr; index++ )
+    // Only the labels whose text changed are invalidated, so LVGL redraws only these areas
+    for( uint8_t index = 0; index < GUI_MAX_WIFI_MAC_ADDRESSES; index++ )
     {
-        lv_table_set_cell_value( table, index, 0, chan->data[index].macAddr );
-        lv_table_set_cell_align( table, index, 0, LV_LABEL_ALIGN_LEFT );
-
-        snprintf( buffer, TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH, "%idBm", chan->data[index].rssi );
-        lv_table_set_cell_value( table, index, 1, buffer );
-        lv_table_set_cell_align( table, index, 1, LV_LABEL_ALIGN_RIGHT );
+        if( index < chan->nbMacAddr )
+        {
+            snprintf( buffer, TMP_BUFFER_SET_CHANNEL_RESULTS_LENGTH, "%idBm x%u", chan->data[index].rssi,
+                      chan->data[index].nbDetections );
+            GuiCommon::setResultRow( &this->rows[index], chan->data[index].macAddr, buffer );
+        }
+        else
+        {
+            GuiCommon::hideResultRow( &this->rows[index] );
+        }
     }
 }
 
@@ -159,23 +166,25 @@ void GuiResultsWifi::findNextChannel( bool up )
             _index = ( _index == 0 ) ? ( GUI_WIFI_CHANNELS * 2 - 1 ) : ( _index - 1 );
         }
 
-        if( _index < GUI_WIFI_CHANNELS )
+        if( this->getChannel( _index )->nbMacAddr > 0 )
         {
-            if( _results->typeB.channel[_index].nbMacAddr > 0 )
-            {
-                break;
-            }
-        }
-        else
-        {
-            if( _results->typeG.channel[_index % GUI_WIFI_CHANNELS].nbMacAddr > 0 )
-            {
-                break;
-            }
+            break;
         }
     }
 }
 
+const GuiWifiResultChannel_t* GuiResultsWifi::getChannel( uint8_t index ) const
+{
+    if( index < GUI_WIFI_CHANNELS )
+    {
+        return &_results->typeB.channel[index];
+    }
+    else
+    {
+        return &_results->typeG.channel[index % GUI_WIFI_CHANNELS];
+    }
+}
+
 void GuiResultsWifi::callback( lv_obj_t* obj, lv_event_t event )
 {
     GuiResultsWifi* self = ( GuiResultsWifi* ) lv_obj_get_user_data( obj );
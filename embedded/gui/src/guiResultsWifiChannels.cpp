@@ -0,0 +1,163 @@
+/**
+ * @file      guiResultsWifiChannels.cpp
+ *
+ * @brief     Implementation of the gui Wi-Fi channel occupancy page.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "guiResultsWifiChannels.h"
+
+#define TMP_BUFFER_REFRESH_LENGTH ( 48 )
+#define GUI_WIFI_CHANNELS_CHART_WIDTH ( 220 )
+#define GUI_WIFI_CHANNELS_CHART_HEIGHT ( 130 )
+#define GUI_WIFI_CHANNELS_CHART_MIN_RANGE ( 10 )
+
+GuiResultsWifiChannels::GuiResultsWifiChannels( const GuiWifiResult_t* results )
+    : GuiCommon( GUI_PAGE_WIFI_CHANNELS ), _results( results )
+{
+    this->createHeader( "Wi-Fi SCANNING - CHANNELS" );
+
+    this->createActionButton( &( this->btn_back ), "BACK", GuiResultsWifiChannels::callback, GUI_BUTTON_POS_CENTER, -5,
+                              true );
+
+    this->lbl_info_page = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_info_page, &( GuiCommon::screen_style ) );
+    lv_label_set_long_mode( this->lbl_info_page, LV_LABEL_LONG_BREAK );
+    lv_label_set_align( this->lbl_info_page, LV_LABEL_ALIGN_CENTER );
+    lv_label_set_text( this->lbl_info_page, "" );
+    lv_obj_set_width( this->lbl_info_page, 240 );
+    lv_obj_align( this->lbl_info_page, NULL, LV_ALIGN_IN_TOP_MID, 0, 50 );
+
+    // One column per channel, its height being the mean number of access points per scan in tenths
+    this->chart = lv_chart_create( this->screen, NULL );
+    lv_obj_set_size( this->chart, GUI_WIFI_CHANNELS_CHART_WIDTH, GUI_WIFI_CHANNELS_CHART_HEIGHT );
+    lv_obj_align( this->chart, NULL, LV_ALIGN_IN_TOP_MID, 0, 75 );
+    lv_chart_set_type( this->chart, LV_CHART_TYPE_COLUMN );
+    lv_chart_set_point_count( this->chart, GUI_WIFI_CHANNELS );
+    lv_chart_set_div_line_count( this->chart, 3, 0 );
+    lv_chart_set_range( this->chart, 0, GUI_WIFI_CHANNELS_CHART_MIN_RANGE );
+    this->series = lv_chart_add_series( this->chart, LV_COLOR_BLUE );
+    lv_chart_init_points( this->chart, this->series, 0 );
+
+    this->lbl_first_channel = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_first_channel, &( GuiCommon::note_style ) );
+    lv_label_set_text( this->lbl_first_channel, "Ch1" );
+    lv_obj_align( this->lbl_first_channel, this->chart, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 2 );
+
+    this->lbl_last_channel = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_last_channel, &( GuiCommon::note_style ) );
+    lv_label_set_text( this->lbl_last_channel, "Ch14" );
+    lv_obj_align( this->lbl_last_channel, this->chart, LV_ALIGN_OUT_BOTTOM_RIGHT, 0, 2 );
+
+    this->lbl_summary = lv_label_create( this->screen, NULL );
+    lv_obj_set_style( this->lbl_summary, &( GuiCommon::screen_style ) );
+    lv_label_set_long_mode( this->lbl_summary, LV_LABEL_LONG_BREAK );
+    lv_label_set_align( this->lbl_summary, LV_LABEL_ALIGN_CENTER );
+    lv_label_set_text( this->lbl_summary, "" );
+    lv_obj_set_width( this->lbl_summary, 240 );
+    lv_obj_align( this->lbl_summary, this->chart, LV_ALIGN_OUT_BOTTOM_MID, 0, 22 );
+}
+
+GuiResultsWifiChannels::~GuiResultsWifiChannels( ) {}
+
+void GuiResultsWifiChannels::draw( )
+{
+    this->refresh( );
+
+    lv_scr_load( this->screen );
+}
+
+void GuiResultsWifiChannels::refresh( )
+{
+    char                          buffer[TMP_BUFFER_REFRESH_LENGTH];
+    const GuiWifiChannelsStats_t* stats          = &this->_results->channelsStats;
+    lv_coord_t                    range          = GUI_WIFI_CHANNELS_CHART_MIN_RANGE;
+    uint8_t                       busiest_index  = GUI_WIFI_CHANNELS;
+    uint8_t                       quietest_index = GUI_WIFI_CHANNELS;
+    lv_coord_t                    busiest_value  = 0;
+    lv_coord_t                    quietest_value = 0;
+
+    for( uint8_t index = 0; index < GUI_WIFI_CHANNELS; index++ )
+    {
+        const GuiWifiChannelStats_t* channel = &stats->channel[index];
+        lv_coord_t                   value   = 0;
+
+        if( channel->nbScans > 0 )
+        {
+            value = ( lv_coord_t )( ( 10 * ( uint32_t ) channel->nbDetections + channel->nbScans / 2 ) /
+                                    channel->nbScans );
+
+            if( ( busiest_index == GUI_WIFI_CHANNELS ) || ( value > busiest_value ) )
+            {
+                busiest_index = index;
+                busiest_value = value;
+            }
+            if( ( quietest_index == GUI_WIFI_CHANNELS ) || ( value < quietest_value ) )
+            {
+                quietest_index = index;
+                quietest_value = value;
+            }
+        }
+
+        if( value > range )
+        {
+            range = value;
+        }
+        this->series->points[index] = value;
+    }
+
+    lv_chart_set_range( this->chart, 0, range );
+    lv_chart_refresh( this->chart );
+
+    snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Mean APs per scan - %u scan(s)", stats->nbScans );
+    GuiCommon::updateLabelText( this->lbl_info_page, buffer );
+
+    if( busiest_index < GUI_WIFI_CHANNELS )
+    {
+        snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Busiest: Ch%u (%u.%u)\nQuietest: Ch%u (%u.%u)",
+                  busiest_index + 1, busiest_value / 10, busiest_value % 10, quietest_index + 1, quietest_value / 10,
+                  quietest_value % 10 );
+    }
+    else
+    {
+        snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "No channel scanned" );
+    }
+    GuiCommon::updateLabelText( this->lbl_summary, buffer );
+}
+
+void GuiResultsWifiChannels::callback( lv_obj_t* obj, lv_event_t event )
+{
+    GuiResultsWifiChannels* self = ( GuiResultsWifiChannels* ) lv_obj_get_user_data( obj );
+
+    if( ( event == LV_EVENT_RELEASED ) && ( lv_btn_get_state( obj ) != LV_BTN_STATE_INA ) )
+    {
+        if( obj == self->btn_back )
+        {
+            GuiCommon::_event = GUI_EVENT_BACK;
+        }
+    }
+}
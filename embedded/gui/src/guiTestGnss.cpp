@@ -168,9 +168,9 @@ void GuiTestGnss::refresh( )
         }
     }
 
-    lv_label_set_text( this->lbl_info_frame_1, buffer_1 );
-    lv_label_set_text( this->lbl_info_frame_2, buffer_2 );
-    lv_label_set_text( this->lbl_info_frame_3, buffer_3 );
+    GuiCommon::updateLabelText( this->lbl_info_frame_1, buffer_1 );
+    GuiCommon::updateLabelText( this->lbl_info_frame_2, buffer_2 );
+    GuiCommon::updateLabelText( this->lbl_info_frame_3, buffer_3 );
 }
 
 void GuiTestGnss::draw( ) { lv_scr_load( this->screen ); }
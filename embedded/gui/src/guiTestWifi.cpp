@@ -50,6 +50,8 @@ GuiTestWifi::GuiTestWifi( const GuiWifiResult_t* results ) : GuiCommon( GUI_PAGE
 
     this->createActionButton( &( this->btn_config ), "CONFIG", GuiTestWifi::callback, GUI_BUTTON_POS_RIGHT, -5, true );
 
+    this->createActionButton( &( this->btn_stats ), "STATS", GuiTestWifi::callback, GUI_BUTTON_POS_LEFT, -5, false );
+
     this->createInfoFrame( &( this->info_frame ), &( this->lbl_info_frame_1 ), "SCAN IN PROGRESS...",
                            &( this->lbl_info_frame_2 ), "", &( this->lbl_info_frame_3 ), "" );
 }
@@ -66,6 +68,7 @@ void GuiTestWifi::init( )
 
     lv_btn_set_state( this->btn_send, LV_BTN_STATE_INA );
     lv_btn_set_state( this->btn_results, LV_BTN_STATE_INA );
+    lv_btn_set_state( this->btn_stats, LV_BTN_STATE_INA );
 }
 
 void GuiTestWifi::start( )
@@ -108,13 +111,20 @@ void GuiTestWifi::refresh( )
         snprintf( buffer_2, TMP_BUFFERS_REFRESH_LENGTH, "%u ms / %.3f uAh", _results->timingTotal,
                   GuiCommon::convertConsoToUah( _results->powerConsTotal ) );
 
-        if( _results->nbMacAddrTotal != 0 )
+        // The results page lists the access points aggregated across the scans
+        if( _results->nbApAggregated != 0 )
         {
             lv_btn_set_state( this->btn_results, LV_BTN_STATE_REL );
-            if( GuiCommon::_is_host_connected == true )
-            {
-                lv_btn_set_state( this->btn_send, LV_BTN_STATE_REL );
-            }
+        }
+
+        if( _results->channelsStats.nbScans != 0 )
+        {
+            lv_btn_set_state( this->btn_stats, LV_BTN_STATE_REL );
+        }
+
+        if( ( _results->nbMacAddrTotal != 0 ) && ( GuiCommon::_is_host_connected == true ) )
+        {
+            lv_btn_set_state( this->btn_send, LV_BTN_STATE_REL );
         }
     }
 
@@ -134,9 +144,9 @@ void GuiTestWifi::refresh( )
         }
     }
 
-    lv_label_set_text( this->lbl_info_frame_1, buffer_1 );
-    lv_label_set_text( this->lbl_info_frame_2, buffer_2 );
-    lv_label_set_text( this->lbl_info_frame_3, buffer_3 );
+    GuiCommon::updateLabelText( this->lbl_info_frame_1, buffer_1 );
+    GuiCommon::updateLabelText( this->lbl_info_frame_2, buffer_2 );
+    GuiCommon::updateLabelText( this->lbl_info_frame_3, buffer_3 );
 }
 
 void GuiTestWifi::draw( ) { lv_scr_load( this->screen ); }
@@ -179,5 +189,9 @@ void GuiTestWifi::callback( lv_obj_t* obj, lv_event_t event )
         {
             GuiCommon::_event = GUI_EVENT_CONFIG;
         }
+        else if( obj == self->btn_stats )
+        {
+            GuiCommon::_event = GUI_EVENT_STATISTICS;
+        }
     }
 }
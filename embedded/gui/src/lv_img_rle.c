@@ -0,0 +1,168 @@
+/**
+ * @file      lv_img_rle.c
+ *
+ * @brief     Run-length encoded image decoder for LVGL
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lv_img_rle.h"
+
+#define LV_IMG_RLE_REPEAT_FLAG ( 0x80 )
+#define LV_IMG_RLE_COUNT_MASK ( 0x7F )
+#define LV_IMG_RLE_PIXEL_SIZE ( 2 )
+
+static lv_res_t lv_img_rle_info( lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header );
+static lv_res_t lv_img_rle_open( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc );
+static lv_res_t lv_img_rle_read_line( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc, lv_coord_t x,
+                                      lv_coord_t y, lv_coord_t len, uint8_t* buf );
+static lv_color_t lv_img_rle_get_color( const uint8_t* pixel );
+
+void lv_img_rle_init( void )
+{
+    lv_img_decoder_t* decoder = lv_img_decoder_create( );
+
+    if( decoder == NULL )
+    {
+        return;
+    }
+
+    lv_img_decoder_set_info_cb( decoder, lv_img_rle_info );
+    lv_img_decoder_set_open_cb( decoder, lv_img_rle_open );
+    lv_img_decoder_set_read_line_cb( decoder, lv_img_rle_read_line );
+}
+
+static lv_res_t lv_img_rle_info( lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header )
+{
+    ( void ) decoder;
+
+    if( lv_img_src_get_type( src ) != LV_IMG_SRC_VARIABLE )
+    {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t* img_dsc = ( const lv_img_dsc_t* ) src;
+    if( img_dsc->header.cf != LV_IMG_CF_RLE )
+    {
+        return LV_RES_INV;
+    }
+
+    header->w  = img_dsc->header.w;
+    header->h  = img_dsc->header.h;
+    header->cf = img_dsc->header.cf;
+
+    return LV_RES_OK;
+}
+
+static lv_res_t lv_img_rle_open( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc )
+{
+    ( void ) decoder;
+
+    /* Leaving img_data to NULL makes LVGL read the image line by line in its draw buffer */
+    dsc->img_data = NULL;
+
+    return LV_RES_OK;
+}
+
+static lv_res_t lv_img_rle_read_line( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc, lv_coord_t x,
+                                      lv_coord_t y, lv_coord_t len, uint8_t* buf )
+{
+    ( void ) decoder;
+
+    const lv_img_dsc_t* img_dsc = ( const lv_img_dsc_t* ) dsc->src;
+    const uint8_t*      data    = img_dsc->data;
+    lv_color_t*         output  = ( lv_color_t* ) buf;
+
+    if( ( x < 0 ) || ( y < 0 ) || ( y >= img_dsc->header.h ) || ( ( x + len ) > img_dsc->header.w ) )
+    {
+        return LV_RES_INV;
+    }
+
+    const uint16_t row_offset = data[2 * y] | ( data[2 * y + 1] << 8 );
+    const uint8_t* run        = &data[row_offset];
+
+    /* Skip the runs, or part of run, before the first requested pixel */
+    lv_coord_t to_skip = x;
+    while( len > 0 )
+    {
+        const uint8_t    control     = run[0];
+        const bool       is_repeated = ( control & LV_IMG_RLE_REPEAT_FLAG ) != 0;
+        const lv_coord_t run_length  = ( control & LV_IMG_RLE_COUNT_MASK ) + 1;
+        const uint8_t*   pixels      = &run[1];
+
+        run += 1 + ( is_repeated ? 1 : run_length ) * LV_IMG_RLE_PIXEL_SIZE;
+
+        if( to_skip >= run_length )
+        {
+            to_skip -= run_length;
+            continue;
+        }
+
+        lv_coord_t count = run_length - to_skip;
+        if( count > len )
+        {
+            count = len;
+        }
+        len -= count;
+
+        if( is_repeated )
+        {
+            const lv_color_t color = lv_img_rle_get_color( pixels );
+            while( count-- > 0 )
+            {
+                *output++ = color;
+            }
+        }
+        else
+        {
+            pixels += to_skip * LV_IMG_RLE_PIXEL_SIZE;
+            while( count-- > 0 )
+            {
+                *output++ = lv_img_rle_get_color( pixels );
+                pixels += LV_IMG_RLE_PIXEL_SIZE;
+            }
+        }
+        to_skip = 0;
+    }
+
+    return LV_RES_OK;
+}
+
+static lv_color_t lv_img_rle_get_color( const uint8_t* pixel )
+{
+    const uint16_t rgb565 = pixel[0] | ( pixel[1] << 8 );
+    lv_color_t     color;
+
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    color.full = rgb565;
+#elif LV_COLOR_DEPTH == 16
+    color.full = ( uint16_t )( ( rgb565 >> 8 ) | ( rgb565 << 8 ) );
+#else
+    color = lv_color_make( ( rgb565 >> 8 ) & 0xF8, ( rgb565 >> 3 ) & 0xFC, ( rgb565 << 3 ) & 0xF8 );
+#endif
+
+    return color;
+}
@@ -27,8 +27,6 @@
 
 static void touchpad_init( void );
 static bool touchpad_read( lv_indev_drv_t* indev_drv, lv_indev_data_t* data );
-static bool touchpad_is_pressed( void );
-static void touchpad_get_xy( lv_coord_t* x, lv_coord_t* y );
 
 /**********************
  *  STATIC VARIABLES
@@ -89,11 +87,16 @@ static bool touchpad_read( lv_indev_drv_t* indev_drv, lv_indev_data_t* data )
 {
     static lv_coord_t last_x = 0;
     static lv_coord_t last_y = 0;
+    touch_point_t     point;
+
+    /*Get the point sampled on touch interrupt: the touch controller is not read while the panel is released*/
+    touch_get_point( &point );
 
     /*Save the pressed coordinates and the state*/
-    if( touchpad_is_pressed( ) )
+    if( point.is_touched )
     {
-        touchpad_get_xy( &last_x, &last_y );
+        last_x      = point.x;
+        last_y      = point.y;
         data->state = LV_INDEV_STATE_PR;
     }
     else
@@ -109,22 +112,6 @@ static bool touchpad_read( lv_indev_drv_t* indev_drv, lv_indev_data_t* data )
     return false;
 }
 
-/*Return true is the touchpad is pressed*/
-static bool touchpad_is_pressed( void ) { return touch_is_touched( ); }
-
-/*Get the x and y coordinates if the touchpad is pressed*/
-static void touchpad_get_xy( lv_coord_t* x, lv_coord_t* y )
-{
-    bool     touch;
-    uint16_t posX;
-    uint16_t posY;
-
-    readTouchData( &posX, &posY, &touch );
-
-    ( *x ) = 240 - posX;
-    ( *y ) = 320 - posY;
-}
-
 #else /* Enable this file at the top */
 
 /* This dummy typedef exists purely to silence -Wpedantic. */
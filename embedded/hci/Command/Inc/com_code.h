@@ -42,12 +42,34 @@
 #define COM_CODE_GET_ALMANAC_DATES ( 7 )
 #define COM_CODE_UPDATE_ALMANAC ( 8 )
 #define COM_CODE_CHECK_ALMANAC_UPDATE ( 9 )
+#define COM_CODE_FETCH_GNSS_HISTORY ( 10 )
+#define COM_CODE_FETCH_GUI_MEMORY ( 11 )
+#define COM_CODE_FETCH_WIFI_CHANNEL_STATS ( 12 )
+#define COM_CODE_CONSUMPTION_MODEL ( 13 )
+#define COM_CODE_CRYPTO_BENCHMARK ( 14 )
+#define COM_CODE_CRYPTO_SELECT ( 15 )
+#define COM_CODE_CRYPTO_SET_KEY ( 16 )
+#define COM_CODE_CRYPTO_PROCESS ( 17 )
+#define COM_CODE_FIRMWARE_UPDATE_START ( 18 )
+#define COM_CODE_FIRMWARE_UPDATE_CHUNK ( 19 )
+#define COM_CODE_FIRMWARE_UPDATE_FINISH ( 20 )
+#define COM_CODE_GET_RANDOM ( 21 )
+#define COM_CODE_FETCH_TELEMETRY ( 22 )
 
 #define RESP_CODE_EVENT ( 0x80 )
 #define RESP_CODE_WIFI_RESULT ( 0x81 )
 #define RESP_CODE_GNSS_AUTONOMOUS_RESULT ( 0x82 )
 #define RESP_CODE_GNSS_ASSISTED_RESULT ( 0x83 )
 #define LOG_RESPONSE_CODE ( 0x84 )
+#define RESP_CODE_GNSS_HISTORY_RESULT ( 0x85 )
+#define RESP_CODE_WIFI_AP_SUMMARY ( 0x86 )
+#define RESP_CODE_ENERGY ( 0x87 )
+#define RESP_CODE_RADIO_SPECTRUM ( 0x88 )
+#define RESP_CODE_RADIO_CAD ( 0x89 )
+#define RESP_CODE_RADIO_PER_RX ( 0x8A )
+#define RESP_CODE_RADIO_PING_PONG ( 0x8B )
+#define RESP_CODE_CRYPTO_BENCHMARK ( 0x8C )
+#define RESP_CODE_TELEMETRY ( 0x8D )
 #define ERROR_CODE_EVENT ( 0x90 )
 
 #endif  // __COM_CODE_H__
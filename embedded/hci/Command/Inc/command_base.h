@@ -43,6 +43,11 @@ typedef enum
     COMMAND_BASE_DEMO_WIFI_COUNTRY_CODE = 2,
     COMMAND_BASE_DEMO_GNSS_AUTONOMOUS   = 3,
     COMMAND_BASE_DEMO_GNSS_ASSISTED     = 4,
+    COMMAND_BASE_DEMO_GNSS_SCHEDULER    = 5,
+    COMMAND_BASE_DEMO_RADIO_SPECTRUM    = 6,
+    COMMAND_BASE_DEMO_RADIO_CAD         = 7,
+    COMMAND_BASE_DEMO_RADIO_PER_RX      = 8,
+    COMMAND_BASE_DEMO_RADIO_PING_PONG   = 9,
 } CommandBaseDemoId_t;
 
 class CommandBase : public CommandInterface
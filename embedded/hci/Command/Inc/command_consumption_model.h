@@ -0,0 +1,67 @@
+/**
+ * @file      command_consumption_model.h
+ *
+ * @brief     Definition of the command getting and setting the consumption model.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_CONSUMPTION_MODEL_H__
+#define __COMMAND_CONSUMPTION_MODEL_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "demo.h"
+
+/*!
+ * \brief Get or set the currents of the consumption model
+ *
+ * With an empty payload, the command only reads the model. Otherwise the
+ * payload holds the 10 currents below, each on 4 bytes (little endian, uA),
+ * which replace the ones of the model. The response holds the currents of the
+ * model after the command, in the same format:
+ *   - Wi-Fi with DC-DC: detection, correlation, capture, demodulation
+ *   - Wi-Fi with LDO: detection, correlation, capture, demodulation
+ *   - GNSS with DC-DC: acquisition, computation
+ */
+class CommandConsumptionModel : public CommandInterface
+{
+   public:
+    CommandConsumptionModel( Hci& hci, Demo& demo_holder );
+    virtual ~CommandConsumptionModel( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   private:
+    Hci&                              hci;
+    Demo&                             demo_holder;
+    bool                              has_coefficients;
+    demo_consumption_model_settings_t coefficients;
+};
+
+#endif  // __COMMAND_CONSUMPTION_MODEL_H__
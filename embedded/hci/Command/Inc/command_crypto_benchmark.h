@@ -0,0 +1,79 @@
+/**
+ * @file      command_crypto_benchmark.h
+ *
+ * @brief     Definition of the command running the crypto engine benchmark.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_CRYPTO_BENCHMARK_H__
+#define __COMMAND_CRYPTO_BENCHMARK_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "demo.h"
+#include "demo_crypto_benchmark.h"
+#include "command_crypto_select.h"
+
+#define COMMAND_CRYPTO_BENCHMARK_STATUS_OK ( 0 )
+#define COMMAND_CRYPTO_BENCHMARK_STATUS_BUSY ( 1 )
+
+/*!
+ * \brief Run the crypto engine benchmark and send its results
+ *
+ * The payload holds the number of iterations, then one to four payload sizes,
+ * each on 2 bytes (little endian). The response holds a status and the number
+ * of results. Each result then follows in its own frame:
+ *   - primitive (1 byte)
+ *   - payload size, iterations, errors (2 bytes each, little endian)
+ *   - min, max and total durations (4 bytes each, little endian, us)
+ *
+ * The benchmark is refused while a demo is running, as it shares the radio.
+ * It overwrites the GP0 and GP1 key slots, see DemoCryptoBenchmark, and then
+ * selects back the element last selected with CommandCryptoSelect.
+ */
+class CommandCryptoBenchmark : public CommandInterface
+{
+   public:
+    CommandCryptoBenchmark( DeviceBase* device, Hci& hci, Demo& demo_holder, const CommandCryptoSelect& crypto_select );
+    virtual ~CommandCryptoBenchmark( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   protected:
+    void SendResult( const demo_crypto_benchmark_result_t& result );
+
+   private:
+    Hci&                             hci;
+    Demo&                            demo_holder;
+    const CommandCryptoSelect&       crypto_select;
+    DemoCryptoBenchmark              benchmark;
+    demo_crypto_benchmark_settings_t settings;
+};
+
+#endif  // __COMMAND_CRYPTO_BENCHMARK_H__
@@ -0,0 +1,87 @@
+/**
+ * @file      command_crypto_process.h
+ *
+ * @brief     Definition of the command processing a batch of blocks with the crypto element.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_CRYPTO_PROCESS_H__
+#define __COMMAND_CRYPTO_PROCESS_H__
+
+#include "command_interface.h"
+#include "command_crypto_types.h"
+#include "device_base.h"
+#include "hci.h"
+#include "demo.h"
+#include "lr1110_crypto_engine_types.h"
+
+/*!
+ * \brief Apply the same operation with the same key to a batch of blocks
+ *
+ * The payload holds the operation and the key index on 1 byte each, followed
+ * by the blocks, each prefixed with its length on 1 byte. The response holds
+ * the status of the command and the number of blocks on 1 byte each, followed
+ * by the result of each block in the order of the payload:
+ *   - status returned by the crypto element (1 byte)
+ *   - output length (1 byte), 0 if the block failed
+ *   - output: the ciphertext for AES encryption, the MIC for AES-CMAC
+ *
+ * Batching the blocks saves one HCI round trip per block. The payload is
+ * refused if the response of the whole batch would not fit in one frame.
+ *
+ * The blocks are copied out of the reception buffer of the HCI, which is given
+ * back to the UART before the command is executed. The blocks and response
+ * buffers have static storage to keep them off the stack of main.
+ */
+class CommandCryptoProcess : public CommandInterface
+{
+   public:
+    CommandCryptoProcess( DeviceBase* device, Hci& hci, Demo& demo_holder );
+    virtual ~CommandCryptoProcess( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   protected:
+    uint8_t                GetOutputMaxLength( const uint8_t block_length ) const;
+    lr1110_crypto_status_t ProcessBlock( const uint8_t* block, const uint8_t block_length, uint8_t* output,
+                                         uint8_t* output_length );
+
+   private:
+    DeviceBase*                device;
+    Hci&                       hci;
+    Demo&                      demo_holder;
+    command_crypto_operation_t operation;
+    uint8_t                    key_id;
+    uint8_t                    nb_blocks;
+    uint16_t                   blocks_length;
+    static uint8_t             blocks[MAX_RECEPTION_BUFFER];
+    static uint8_t             response[MAX_TRANSMITION_BUFFER];
+};
+
+#endif  // __COMMAND_CRYPTO_PROCESS_H__
@@ -0,0 +1,71 @@
+/**
+ * @file      command_crypto_select.h
+ *
+ * @brief     Definition of the command selecting the crypto element.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_CRYPTO_SELECT_H__
+#define __COMMAND_CRYPTO_SELECT_H__
+
+#include "command_interface.h"
+#include "command_crypto_types.h"
+#include "device_base.h"
+#include "hci.h"
+#include "demo.h"
+#include "lr1110_crypto_engine_types.h"
+
+/*!
+ * \brief Select the element running the following crypto commands
+ *
+ * The payload holds the element on 1 byte, as lr1110_crypto_element_t. The
+ * response holds the status of the command on 1 byte.
+ *
+ * The element last selected is kept so that the commands that need the crypto
+ * engine, like the benchmark, can select it back once done.
+ */
+class CommandCryptoSelect : public CommandInterface
+{
+   public:
+    CommandCryptoSelect( DeviceBase* device, Hci& hci, Demo& demo_holder );
+    virtual ~CommandCryptoSelect( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+    lr1110_crypto_element_t GetSelectedElement( ) const;
+
+   private:
+    DeviceBase*             device;
+    Hci&                    hci;
+    Demo&                   demo_holder;
+    lr1110_crypto_element_t element;
+    lr1110_crypto_element_t selected_element;
+};
+
+#endif  // __COMMAND_CRYPTO_SELECT_H__
@@ -0,0 +1,27 @@
+#ifndef __COMMAND_CRYPTO_TYPES_H__
+#define __COMMAND_CRYPTO_TYPES_H__
+
+#include <stdint.h>
+
+/*!
+ * \brief Status leading the response of every crypto command
+ *
+ * The crypto engine is reached over the same SPI bus as the radio, so the
+ * commands are refused while a demo is running.
+ */
+typedef enum
+{
+    COMMAND_CRYPTO_STATUS_OK   = 0,
+    COMMAND_CRYPTO_STATUS_BUSY = 1,
+} command_crypto_status_t;
+
+/*!
+ * \brief Operation applied to every block of a batch
+ */
+typedef enum
+{
+    COMMAND_CRYPTO_OPERATION_AES_ENCRYPT = 0,  //!< Blocks are non-zero multiples of 16 bytes
+    COMMAND_CRYPTO_OPERATION_AES_CMAC    = 1,  //!< Each block gets its 4-byte MIC
+} command_crypto_operation_t;
+
+#endif  // __COMMAND_CRYPTO_TYPES_H__
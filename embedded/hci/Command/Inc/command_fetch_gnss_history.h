@@ -0,0 +1,68 @@
+/**
+ * @file      command_fetch_gnss_history.h
+ *
+ * @brief     Definition of the command fetching the NAV message history of the GNSS scheduler.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_FETCH_GNSS_HISTORY_H__
+#define __COMMAND_FETCH_GNSS_HISTORY_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "demo.h"
+
+/*!
+ * \brief Send all the NAV messages stored by the GNSS scheduler in one burst
+ *
+ * The response holds the number of entries. It is followed by one
+ * RESP_CODE_GNSS_HISTORY_RESULT frame per entry, from the oldest to the most
+ * recent one, each of them being:
+ *   - 4 bytes: delay since the measurement in seconds (little endian)
+ *   - 1 byte: number of detected satellites
+ *   - the NAV message (variable size)
+ */
+class CommandFetchGnssHistory : public CommandInterface
+{
+   public:
+    CommandFetchGnssHistory( Hci& hci, EnvironmentInterface& environment, Demo& demo_holder );
+    virtual ~CommandFetchGnssHistory( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   protected:
+    void SendHistoryEntry( const demo_gnss_nav_history_entry_t& entry );
+
+   private:
+    Hci&                  hci;
+    EnvironmentInterface& environment;
+    Demo&                 demo_holder;
+};
+
+#endif  // __COMMAND_FETCH_GNSS_HISTORY_H__
@@ -0,0 +1,72 @@
+/**
+ * @file      command_fetch_gui_memory.h
+ *
+ * @brief     Definition of the command fetching the LVGL memory pool usage measured by the GUI.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_FETCH_GUI_MEMORY_H__
+#define __COMMAND_FETCH_GUI_MEMORY_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "gui.h"
+
+/*!
+ * \brief Send the LVGL memory pool usage measured by the GUI
+ *
+ * The optional 1-byte payload of the command is a flag: if non zero, the
+ * measurements are reset once sent.
+ *
+ * The response is:
+ *   - 4 bytes: size of the LVGL memory pool (little endian)
+ *   - 4 bytes: peak used size over all pages (little endian)
+ *   - 1 byte: number of entries of the LVGL image cache
+ *   - 1 byte: number of sampled pages
+ *   - for each sampled page:
+ *     - 1 byte: page identifier (guiPageType_t)
+ *     - 4 bytes: peak used size (little endian)
+ *     - 4 bytes: smallest biggest free block size (little endian)
+ *     - 1 byte: peak fragmentation in percent
+ */
+class CommandFetchGuiMemory : public CommandInterface
+{
+   public:
+    CommandFetchGuiMemory( Hci& hci, Gui& gui );
+    virtual ~CommandFetchGuiMemory( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   private:
+    Hci& hci;
+    Gui& gui;
+    bool reset_after_fetch;
+};
+
+#endif  // __COMMAND_FETCH_GUI_MEMORY_H__
@@ -36,6 +36,13 @@
 #include "hci.h"
 #include "demo.h"
 
+typedef enum
+{
+    COMMAND_FETCH_RESULT_LAST_SCAN  = 0x00,  //!< Results of the last scan
+    COMMAND_FETCH_RESULT_AP_SUMMARY = 0x01,  //!< Wi-Fi access points aggregated across the scans
+    COMMAND_FETCH_RESULT_ENERGY     = 0x02,  //!< Energy of each phase of the last scan
+} command_fetch_result_content_t;
+
 class CommandFetchResult : public CommandInterface
 {
    public:
@@ -47,7 +54,61 @@ class CommandFetchResult : public CommandInterface
     virtual CommandEvent_t Execute( );
 
    protected:
+    /*!
+     * \brief Send the number of results of a Wi-Fi or GNSS scan, with the telemetry attached to the scan
+     *
+     * The response is the number of results, then on 2 bytes VBAT in mV and the temperature in tenths of degree
+     * Celsius (signed), both being 0 if no telemetry sample was taken before the scan, and the age of the sample in
+     * seconds when the results are fetched, saturated to 0xFFFF.
+     */
+    void SendResultCountWithTelemetry( const uint8_t nb_results, const telemetry_sample_t& telemetry );
     void FetchWifiResults( const demo_wifi_scan_all_results_t& wifi_results );
+    void FetchWifiApSummary( const DemoWifiApTable& ap_table );
+
+    /*!
+     * \brief Get the number of frames needed to send the Wi-Fi access point summary
+     *
+     * \param [in] ap_table Table of the aggregated access points
+     *
+     * \retval The number of RESP_CODE_WIFI_AP_SUMMARY frames
+     */
+    static uint8_t GetWifiApSummaryFrameCount( const DemoWifiApTable& ap_table );
+
+    /*!
+     * \brief Send the energy of each phase of the last scan in a RESP_CODE_ENERGY frame
+     *
+     * The frame is the demo type, the number of phases, then the energy of each phase in uas on 4 bytes. The phases
+     * are detection, correlation, capture and demodulation for Wi-Fi, acquisition and computation for GNSS. Other
+     * demos report no phase.
+     */
+    void FetchEnergy( );
+
+    /*!
+     * \brief Send the statistics of each spreading factor and channel combination of the CAD demo
+     *
+     * Each combination is sent in its own RESP_CODE_RADIO_CAD frame: the combination index, the frequency in Hz, the
+     * spreading factor, then on 4 bytes the number of CADs, of detections and of false alarms, the duration of one CAD
+     * in us, the time spent receiving after the detections in ms, and the average energy per CAD of the CAD and of
+     * the reception in nas.
+     */
+    void FetchRadioCadResults( const demo_radio_cad_results_t& cad_results );
+
+    /*!
+     * \brief Send the statistics of the PER receiver in a RESP_CODE_RADIO_PER_RX frame
+     *
+     * The frame is, on 4 bytes, the number of packets received correctly, with errors and of timeouts, the number of
+     * packets sent since the first one received, the listening duration in ms and the estimated average current in ua.
+     */
+    void FetchRadioPerRxResults( const demo_radio_per_results_t& per_results );
+
+    /*!
+     * \brief Send the statistics of the ping-pong in a RESP_CODE_RADIO_PING_PONG frame
+     *
+     * The frame is the mode (0 for slave, 1 for master), then on 4 bytes the number of packets sent, received
+     * correctly, received with errors and of timeouts, the number of round trips measured by the master and their
+     * minimum, maximum and total duration in ms.
+     */
+    void FetchRadioPingPongResults( const demo_ping_pong_results_t& ping_pong_results );
     void FetchAutonomousGnssResults( const demo_gnss_all_results_t& gnss_autonomous_results );
     void FetchAssistedGnssResults( const demo_gnss_all_results_t& gnss_assisted_results );
 
@@ -68,9 +129,10 @@ class CommandFetchResult : public CommandInterface
     static uint8_t AppendValueAtIndex( uint8_t* array, const uint16_t index, const uint32_t value );
 
    private:
-    Hci&                  hci;
-    EnvironmentInterface& environment;
-    Demo&                 demo_holder;
+    Hci&                           hci;
+    EnvironmentInterface&          environment;
+    Demo&                          demo_holder;
+    command_fetch_result_content_t content;
 };
 
 #endif  // __COMMAND_FETCH_RESULT_H__
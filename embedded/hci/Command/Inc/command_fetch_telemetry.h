@@ -0,0 +1,78 @@
+/**
+ * @file      command_fetch_telemetry.h
+ *
+ * @brief     Definition of the command fetching the VBAT and temperature history.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_FETCH_TELEMETRY_H__
+#define __COMMAND_FETCH_TELEMETRY_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "environment_interface.h"
+#include "telemetry_sampler.h"
+
+/*!
+ * \brief Fetch the VBAT and temperature history, and optionally change the sampling period
+ *
+ * The payload is either empty, or the new sampling period in ms on 4 bytes,
+ * from TELEMETRY_SAMPLER_PERIOD_MIN_MS to TELEMETRY_SAMPLER_PERIOD_MAX_MS.
+ *
+ * The response holds, in little endian:
+ *   - 4 bytes: sampling period in ms
+ *   - 4 bytes: number of samples taken since the start
+ *   - 2 bytes: minimum and maximum VBAT in mV
+ *   - 2 bytes: minimum and maximum temperature in tenths of degree Celsius (signed)
+ *   - 1 byte: number of history entries
+ * It is followed by one RESP_CODE_TELEMETRY frame per history entry, from the
+ * oldest to the most recent one, each of them being:
+ *   - 4 bytes: delay since the sample in ms
+ *   - 2 bytes: VBAT in mV
+ *   - 2 bytes: temperature in tenths of degree Celsius (signed)
+ */
+class CommandFetchTelemetry : public CommandInterface
+{
+   public:
+    CommandFetchTelemetry( Hci& hci, EnvironmentInterface& environment, TelemetrySampler& telemetry_sampler );
+    virtual ~CommandFetchTelemetry( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   protected:
+    void SendHistoryEntry( const telemetry_sample_t& entry );
+
+   private:
+    Hci&                  hci;
+    EnvironmentInterface& environment;
+    TelemetrySampler&     telemetry_sampler;
+    uint32_t              new_period_ms;  //!< 0 to keep the current period
+};
+
+#endif  // __COMMAND_FETCH_TELEMETRY_H__
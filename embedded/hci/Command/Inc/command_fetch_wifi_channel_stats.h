@@ -0,0 +1,73 @@
+/**
+ * @file      command_fetch_wifi_channel_stats.h
+ *
+ * @brief     Definition of the command fetching the occupancy statistics of the Wi-Fi channels.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_FETCH_WIFI_CHANNEL_STATS_H__
+#define __COMMAND_FETCH_WIFI_CHANNEL_STATS_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "demo.h"
+
+/*!
+ * \brief Send the occupancy statistics of the Wi-Fi channels
+ *
+ * The optional 1-byte payload of the command is a flag: if non zero, the
+ * statistics are cleared once sent.
+ *
+ * The response is:
+ *   - 2 bytes: number of scans merged (little endian)
+ *   - 1 byte: number of channels
+ *   - for each channel, starting from channel 1:
+ *     - 2 bytes: number of scans including the channel (little endian)
+ *     - 2 bytes: number of detections (little endian)
+ *     - 1 byte: number of access points detected by the last scan
+ *     - 1 byte: maximum number of access points detected by a scan
+ *     - 1 byte: maximum RSSI (signed, dBm)
+ *     - 5 x 2 bytes: RSSI histogram (little endian)
+ *     - 4 bytes: estimated dwell time in us (little endian)
+ */
+class CommandFetchWifiChannelStats : public CommandInterface
+{
+   public:
+    CommandFetchWifiChannelStats( Hci& hci, Demo& demo_holder );
+    virtual ~CommandFetchWifiChannelStats( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   private:
+    Hci&  hci;
+    Demo& demo_holder;
+    bool  clear_after_fetch;
+};
+
+#endif  // __COMMAND_FETCH_WIFI_CHANNEL_STATS_H__
@@ -0,0 +1,69 @@
+/**
+ * @file      command_firmware_update_chunk.h
+ *
+ * @brief     Definition of the command writing a chunk of the LR1110 firmware.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_FIRMWARE_UPDATE_CHUNK_H__
+#define __COMMAND_FIRMWARE_UPDATE_CHUNK_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "device_firmware_update.h"
+
+/*!
+ * \brief Write the next chunk of the encrypted image to the flash of the LR1110
+ *
+ * The payload holds the offset of the chunk in the image in bytes on 4 bytes
+ * (little endian), followed by the chunk: 256 bytes, except for the last one.
+ * The response holds the status of the update on 1 byte, then the number of
+ * bytes of the image accepted so far on 4 bytes (little endian).
+ *
+ * The response is sent before the chunk is written, so that the host can send
+ * the next chunk while this one is written. A failed write is reported in the
+ * response to the next chunk.
+ */
+class CommandFirmwareUpdateChunk : public CommandInterface
+{
+   public:
+    CommandFirmwareUpdateChunk( Hci& hci, DeviceFirmwareUpdate& firmware_update );
+    virtual ~CommandFirmwareUpdateChunk( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   private:
+    Hci&                  hci;
+    DeviceFirmwareUpdate& firmware_update;
+    uint32_t              offset;
+    uint16_t              chunk_size;
+    uint8_t               chunk[DEVICE_FIRMWARE_UPDATE_CHUNK_SIZE_MAX];
+};
+
+#endif  // __COMMAND_FIRMWARE_UPDATE_CHUNK_H__
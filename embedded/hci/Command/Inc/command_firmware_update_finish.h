@@ -0,0 +1,66 @@
+/**
+ * @file      command_firmware_update_finish.h
+ *
+ * @brief     Definition of the command finishing the update of the LR1110 firmware.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __COMMAND_FIRMWARE_UPDATE_FINISH_H__
+#define __COMMAND_FIRMWARE_UPDATE_FINISH_H__
+
+#include "command_interface.h"
+#include "hci.h"
+#include "device_firmware_update.h"
+
+/*!
+ * \brief Check the written image and reboot the LR1110 on it
+ *
+ * The payload is empty. The response holds the status of the update on 1 byte,
+ * the 16 bytes of the hash of the flash content, then the version of the
+ * firmware the LR1110 rebooted on:
+ *   - hardware, type (1 byte each)
+ *   - firmware (2 bytes, little endian)
+ *
+ * The version is left to 0 if the update failed, in which case the LR1110
+ * stays in its bootloader.
+ */
+class CommandFirmwareUpdateFinish : public CommandInterface
+{
+   public:
+    CommandFirmwareUpdateFinish( Hci& hci, DeviceFirmwareUpdate& firmware_update );
+    virtual ~CommandFirmwareUpdateFinish( );
+
+    virtual uint16_t       GetComCode( );
+    virtual bool           ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size );
+    virtual CommandEvent_t Execute( );
+
+   private:
+    Hci&                  hci;
+    DeviceFirmwareUpdate& firmware_update;
+};
+
+#endif  // __COMMAND_FIRMWARE_UPDATE_FINISH_H__
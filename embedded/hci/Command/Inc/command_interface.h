@@ -47,6 +47,11 @@ typedef enum
     COMMAND_START_WIFI_COUNTRY_CODE_DEMO_EVENT,
     COMMAND_START_GNSS_AUTONOMOUS_DEMO_EVENT,
     COMMAND_START_GNSS_ASSISTED_DEMO_EVENT,
+    COMMAND_START_GNSS_SCHEDULER_DEMO_EVENT,
+    COMMAND_START_RADIO_SPECTRUM_DEMO_EVENT,
+    COMMAND_START_RADIO_CAD_DEMO_EVENT,
+    COMMAND_START_RADIO_PER_RX_DEMO_EVENT,
+    COMMAND_START_RADIO_PING_PONG_DEMO_EVENT,
     COMMAND_STOP_DEMO_EVENT,
     COMMAND_RESET_DEMO_EVENT,
 } CommandEvent_t;
@@ -51,7 +51,12 @@ class CommandStartDemo : public CommandBase
     bool ConfigureWifiCountryCode( const uint8_t* buffer, const uint16_t buffer_size );
     bool ConfigureGnssAutonomous( const uint8_t* buffer, const uint16_t buffer_size );
     bool ConfigureGnssAssisted( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureGnssScheduler( const uint8_t* buffer, const uint16_t buffer_size );
     bool ConfigureGnss( demo_gnss_settings_t* gnss_setting, const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureRadioSpectrum( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureRadioCad( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureRadioPerRx( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureRadioPingPong( const uint8_t* buffer, const uint16_t buffer_size );
 
    private:
     CommandBaseDemoId_t demo_id_to_start;
@@ -76,6 +76,36 @@ void CommandBase::SetEventStartDemo( CommandBaseDemoId_t demo_to_start )
         break;
     }
 
+    case COMMAND_BASE_DEMO_GNSS_SCHEDULER:
+    {
+        this->event = COMMAND_START_GNSS_SCHEDULER_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_SPECTRUM:
+    {
+        this->event = COMMAND_START_RADIO_SPECTRUM_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_CAD:
+    {
+        this->event = COMMAND_START_RADIO_CAD_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_PER_RX:
+    {
+        this->event = COMMAND_START_RADIO_PER_RX_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_PING_PONG:
+    {
+        this->event = COMMAND_START_RADIO_PING_PONG_DEMO_EVENT;
+        break;
+    }
+
     default:
     {
         this->event = COMMAND_NO_EVENT;
@@ -0,0 +1,100 @@
+/**
+ * @file      command_consumption_model.cpp
+ *
+ * @brief     Implementation of the command getting and setting the consumption model.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_consumption_model.h"
+#include "com_code.h"
+
+#define COMMAND_CONSUMPTION_MODEL_NB_COEFFICIENTS ( sizeof( demo_consumption_model_settings_t ) / sizeof( uint32_t ) )
+#define COMMAND_CONSUMPTION_MODEL_PAYLOAD_LENGTH ( 4 * COMMAND_CONSUMPTION_MODEL_NB_COEFFICIENTS )
+
+static_assert( sizeof( demo_consumption_model_settings_t ) ==
+                   COMMAND_CONSUMPTION_MODEL_NB_COEFFICIENTS * sizeof( uint32_t ),
+               "The consumption model must only hold 32-bit currents" );
+
+CommandConsumptionModel::CommandConsumptionModel( Hci& hci, Demo& demo_holder )
+    : hci( hci ), demo_holder( demo_holder ), has_coefficients( false )
+{
+}
+
+CommandConsumptionModel::~CommandConsumptionModel( ) {}
+
+uint16_t CommandConsumptionModel::GetComCode( ) { return COM_CODE_CONSUMPTION_MODEL; }
+
+bool CommandConsumptionModel::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( buffer_size == 0 )
+    {
+        this->has_coefficients = false;
+        return true;
+    }
+    else if( buffer_size == COMMAND_CONSUMPTION_MODEL_PAYLOAD_LENGTH )
+    {
+        uint32_t* coefficients = ( uint32_t* ) &this->coefficients;
+
+        for( uint8_t index = 0; index < COMMAND_CONSUMPTION_MODEL_NB_COEFFICIENTS; index++ )
+        {
+            const uint8_t* raw  = buffer + 4 * index;
+            coefficients[index] = raw[0] + ( raw[1] << 8 ) + ( raw[2] << 16 ) + ( ( uint32_t ) raw[3] << 24 );
+        }
+        this->has_coefficients = true;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+CommandEvent_t CommandConsumptionModel::Execute( )
+{
+    demo_consumption_model_settings_t model;
+    uint8_t                           buffer[COMMAND_CONSUMPTION_MODEL_PAYLOAD_LENGTH] = { 0 };
+
+    if( this->has_coefficients == true )
+    {
+        this->demo_holder.UpdateConfigConsumptionModel( &this->coefficients );
+    }
+
+    this->demo_holder.GetConfigConsumptionModel( &model );
+
+    const uint32_t* coefficients = ( const uint32_t* ) &model;
+    for( uint8_t index = 0; index < COMMAND_CONSUMPTION_MODEL_NB_COEFFICIENTS; index++ )
+    {
+        buffer[4 * index + 0] = ( uint8_t )( ( coefficients[index] & 0x000000FF ) >> 0 );
+        buffer[4 * index + 1] = ( uint8_t )( ( coefficients[index] & 0x0000FF00 ) >> 8 );
+        buffer[4 * index + 2] = ( uint8_t )( ( coefficients[index] & 0x00FF0000 ) >> 16 );
+        buffer[4 * index + 3] = ( uint8_t )( ( coefficients[index] & 0xFF000000 ) >> 24 );
+    }
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_CONSUMPTION_MODEL_PAYLOAD_LENGTH );
+
+    return COMMAND_NO_EVENT;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file      command_crypto_benchmark.cpp
+ *
+ * @brief     Implementation of the command running the crypto engine benchmark.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_crypto_benchmark.h"
+#include "com_code.h"
+
+// WORKAROUND: #include "stm32l4xx_ll_utils.h" is needed to get the LL_mDelay
+// later on
+#include "stm32l4xx_ll_utils.h"
+
+#define COMMAND_CRYPTO_BENCHMARK_RESPONSE_LENGTH ( 2 )
+#define COMMAND_CRYPTO_BENCHMARK_RESULT_LENGTH ( 19 )
+
+CommandCryptoBenchmark::CommandCryptoBenchmark( DeviceBase* device, Hci& hci, Demo& demo_holder,
+                                                const CommandCryptoSelect& crypto_select )
+    : hci( hci ), demo_holder( demo_holder ), crypto_select( crypto_select ), benchmark( device )
+{
+}
+
+CommandCryptoBenchmark::~CommandCryptoBenchmark( ) {}
+
+uint16_t CommandCryptoBenchmark::GetComCode( ) { return COM_CODE_CRYPTO_BENCHMARK; }
+
+bool CommandCryptoBenchmark::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( ( buffer_size < 4 ) || ( ( buffer_size % 2 ) != 0 ) ||
+        ( buffer_size > ( 2 + 2 * DEMO_CRYPTO_BENCHMARK_MAX_PAYLOAD_SIZES ) ) )
+    {
+        return false;
+    }
+
+    this->settings.nb_iterations    = buffer[0] + ( buffer[1] << 8 );
+    this->settings.nb_payload_sizes = ( buffer_size - 2 ) / 2;
+    for( uint8_t index = 0; index < this->settings.nb_payload_sizes; index++ )
+    {
+        const uint8_t* raw                  = buffer + 2 + 2 * index;
+        this->settings.payload_sizes[index] = raw[0] + ( raw[1] << 8 );
+    }
+
+    return DemoCryptoBenchmark::IsSettingsValid( this->settings );
+}
+
+CommandEvent_t CommandCryptoBenchmark::Execute( )
+{
+    uint8_t buffer[COMMAND_CRYPTO_BENCHMARK_RESPONSE_LENGTH] = { 0 };
+
+    if( this->demo_holder.IsRunning( ) == true )
+    {
+        buffer[0] = COMMAND_CRYPTO_BENCHMARK_STATUS_BUSY;
+        this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_CRYPTO_BENCHMARK_RESPONSE_LENGTH );
+        return COMMAND_NO_EVENT;
+    }
+
+    this->benchmark.Run( this->settings, this->crypto_select.GetSelectedElement( ) );
+
+    const demo_crypto_benchmark_results_t* results = this->benchmark.GetResults( );
+
+    buffer[0] = COMMAND_CRYPTO_BENCHMARK_STATUS_OK;
+    buffer[1] = results->nb_results;
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_CRYPTO_BENCHMARK_RESPONSE_LENGTH );
+
+    for( uint8_t index = 0; index < results->nb_results; index++ )
+    {
+        // WORKAROUND: using LL_mDelay(1) between frames, as for the Wi-Fi results
+        LL_mDelay( 1 );
+        this->SendResult( results->results[index] );
+    }
+
+    return COMMAND_NO_EVENT;
+}
+
+void CommandCryptoBenchmark::SendResult( const demo_crypto_benchmark_result_t& result )
+{
+    uint8_t        buffer[COMMAND_CRYPTO_BENCHMARK_RESULT_LENGTH] = { 0 };
+    const uint16_t values_16[] = { result.payload_size, result.nb_iterations, result.nb_errors };
+    const uint32_t values_32[] = { result.min_us, result.max_us, result.total_us };
+    uint8_t        index       = 0;
+
+    buffer[index++] = ( uint8_t ) result.primitive;
+    for( uint8_t value_index = 0; value_index < 3; value_index++ )
+    {
+        buffer[index++] = ( uint8_t )( ( values_16[value_index] & 0x00FF ) >> 0 );
+        buffer[index++] = ( uint8_t )( ( values_16[value_index] & 0xFF00 ) >> 8 );
+    }
+    for( uint8_t value_index = 0; value_index < 3; value_index++ )
+    {
+        buffer[index++] = ( uint8_t )( ( values_32[value_index] & 0x000000FF ) >> 0 );
+        buffer[index++] = ( uint8_t )( ( values_32[value_index] & 0x0000FF00 ) >> 8 );
+        buffer[index++] = ( uint8_t )( ( values_32[value_index] & 0x00FF0000 ) >> 16 );
+        buffer[index++] = ( uint8_t )( ( values_32[value_index] & 0xFF000000 ) >> 24 );
+    }
+
+    this->hci.SendResponse( RESP_CODE_CRYPTO_BENCHMARK, buffer, index );
+}
@@ -0,0 +1,173 @@
+/**
+ * @file      command_crypto_process.cpp
+ *
+ * @brief     Implementation of the command processing a batch of blocks with the crypto element.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_crypto_process.h"
+#include "com_code.h"
+#include "lr1110_crypto_engine.h"
+#include <string.h>
+
+#define COMMAND_CRYPTO_PROCESS_HEADER_LENGTH ( 2 )
+#define COMMAND_CRYPTO_PROCESS_AES_BLOCK_LENGTH ( 16 )
+#define COMMAND_CRYPTO_PROCESS_RESPONSE_MAX_LENGTH ( MAX_TRANSMITION_BUFFER - 4 )
+
+uint8_t CommandCryptoProcess::blocks[MAX_RECEPTION_BUFFER];
+uint8_t CommandCryptoProcess::response[MAX_TRANSMITION_BUFFER];
+
+CommandCryptoProcess::CommandCryptoProcess( DeviceBase* device, Hci& hci, Demo& demo_holder )
+    : device( device ),
+      hci( hci ),
+      demo_holder( demo_holder ),
+      operation( COMMAND_CRYPTO_OPERATION_AES_ENCRYPT ),
+      key_id( 0 ),
+      nb_blocks( 0 ),
+      blocks_length( 0 )
+{
+}
+
+CommandCryptoProcess::~CommandCryptoProcess( ) {}
+
+uint16_t CommandCryptoProcess::GetComCode( ) { return COM_CODE_CRYPTO_PROCESS; }
+
+bool CommandCryptoProcess::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( ( buffer_size <= COMMAND_CRYPTO_PROCESS_HEADER_LENGTH ) ||
+        ( buffer_size > COMMAND_CRYPTO_PROCESS_HEADER_LENGTH + sizeof( this->blocks ) ) ||
+        ( buffer[0] > COMMAND_CRYPTO_OPERATION_AES_CMAC ) )
+    {
+        return false;
+    }
+
+    this->operation     = ( command_crypto_operation_t ) buffer[0];
+    this->key_id        = buffer[1];
+    this->blocks_length = buffer_size - COMMAND_CRYPTO_PROCESS_HEADER_LENGTH;
+    memcpy( this->blocks, buffer + COMMAND_CRYPTO_PROCESS_HEADER_LENGTH, this->blocks_length );
+
+    // Walk the blocks once to check that their lengths add up to the payload, and that all their results fit in the
+    // response
+    uint16_t index           = 0;
+    uint16_t response_length = COMMAND_CRYPTO_PROCESS_HEADER_LENGTH;
+    uint16_t nb_blocks       = 0;
+    while( index < this->blocks_length )
+    {
+        const uint8_t block_length = this->blocks[index];
+        index += 1 + block_length;
+        response_length += 2 + this->GetOutputMaxLength( block_length );
+        nb_blocks++;
+    }
+
+    if( ( index != this->blocks_length ) || ( response_length > COMMAND_CRYPTO_PROCESS_RESPONSE_MAX_LENGTH ) ||
+        ( nb_blocks > UINT8_MAX ) )
+    {
+        return false;
+    }
+
+    this->nb_blocks = ( uint8_t ) nb_blocks;
+    return true;
+}
+
+CommandEvent_t CommandCryptoProcess::Execute( )
+{
+    if( this->demo_holder.IsRunning( ) == true )
+    {
+        this->response[0] = COMMAND_CRYPTO_STATUS_BUSY;
+        this->response[1] = 0;
+        this->hci.SendResponse( this->GetComCode( ), this->response, COMMAND_CRYPTO_PROCESS_HEADER_LENGTH );
+        return COMMAND_NO_EVENT;
+    }
+
+    uint16_t block_index    = 0;
+    uint16_t response_index = COMMAND_CRYPTO_PROCESS_HEADER_LENGTH;
+
+    this->response[0] = COMMAND_CRYPTO_STATUS_OK;
+    this->response[1] = this->nb_blocks;
+
+    for( uint8_t block = 0; block < this->nb_blocks; block++ )
+    {
+        const uint8_t block_length  = this->blocks[block_index];
+        uint8_t       output_length = 0;
+
+        const lr1110_crypto_status_t status = this->ProcessBlock(
+            this->blocks + block_index + 1, block_length, this->response + response_index + 2, &output_length );
+
+        this->response[response_index]     = ( uint8_t ) status;
+        this->response[response_index + 1] = output_length;
+
+        block_index += 1 + block_length;
+        response_index += 2 + output_length;
+    }
+
+    this->hci.SendResponse( this->GetComCode( ), this->response, response_index );
+
+    return COMMAND_NO_EVENT;
+}
+
+uint8_t CommandCryptoProcess::GetOutputMaxLength( const uint8_t block_length ) const
+{
+    return ( this->operation == COMMAND_CRYPTO_OPERATION_AES_CMAC ) ? LR1110_CRYPTO_MIC_LENGTH : block_length;
+}
+
+lr1110_crypto_status_t CommandCryptoProcess::ProcessBlock( const uint8_t* block, const uint8_t block_length,
+                                                           uint8_t* output, uint8_t* output_length )
+{
+    lr1110_crypto_status_t status = LR1110_CRYPTO_STATUS_ERROR_BUFFER_SIZE;
+
+    *output_length = 0;
+
+    switch( this->operation )
+    {
+    case COMMAND_CRYPTO_OPERATION_AES_ENCRYPT:
+    {
+        if( ( block_length == 0 ) || ( ( block_length % COMMAND_CRYPTO_PROCESS_AES_BLOCK_LENGTH ) != 0 ) )
+        {
+            break;
+        }
+        lr1110_crypto_aes_encrypt( this->device->GetRadio( ), &status, this->key_id, block, block_length, output );
+        break;
+    }
+    case COMMAND_CRYPTO_OPERATION_AES_CMAC:
+    {
+        if( block_length == 0 )
+        {
+            break;
+        }
+        lr1110_crypto_compute_aes_cmac( this->device->GetRadio( ), &status, this->key_id, block, block_length,
+                                        output );
+        break;
+    }
+    }
+
+    if( status == LR1110_CRYPTO_STATUS_SUCCESS )
+    {
+        *output_length = this->GetOutputMaxLength( block_length );
+    }
+
+    return status;
+}
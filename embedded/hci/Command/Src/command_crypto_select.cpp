@@ -0,0 +1,76 @@
+/**
+ * @file      command_crypto_select.cpp
+ *
+ * @brief     Implementation of the command selecting the crypto element.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_crypto_select.h"
+#include "com_code.h"
+#include "lr1110_crypto_engine.h"
+
+CommandCryptoSelect::CommandCryptoSelect( DeviceBase* device, Hci& hci, Demo& demo_holder )
+    : device( device ),
+      hci( hci ),
+      demo_holder( demo_holder ),
+      element( LR1110_CRYPTO_ELEMENT_CRYPTO_ENGINE ),
+      selected_element( LR1110_CRYPTO_ELEMENT_CRYPTO_ENGINE )
+{
+}
+
+CommandCryptoSelect::~CommandCryptoSelect( ) {}
+
+uint16_t CommandCryptoSelect::GetComCode( ) { return COM_CODE_CRYPTO_SELECT; }
+
+bool CommandCryptoSelect::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( ( buffer_size != 1 ) || ( buffer[0] > LR1110_CRYPTO_ELEMENT_SECURE_ELEMENT ) )
+    {
+        return false;
+    }
+
+    this->element = ( lr1110_crypto_element_t ) buffer[0];
+    return true;
+}
+
+CommandEvent_t CommandCryptoSelect::Execute( )
+{
+    if( this->demo_holder.IsRunning( ) == true )
+    {
+        this->hci.SendResponse( this->GetComCode( ), ( uint8_t ) COMMAND_CRYPTO_STATUS_BUSY );
+        return COMMAND_NO_EVENT;
+    }
+
+    lr1110_crypto_select( this->device->GetRadio( ), this->element );
+    this->selected_element = this->element;
+
+    this->hci.SendResponse( this->GetComCode( ), ( uint8_t ) COMMAND_CRYPTO_STATUS_OK );
+
+    return COMMAND_NO_EVENT;
+}
+
+lr1110_crypto_element_t CommandCryptoSelect::GetSelectedElement( ) const { return this->selected_element; }
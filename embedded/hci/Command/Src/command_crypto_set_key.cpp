@@ -0,0 +1,83 @@
+/**
+ * @file      command_crypto_set_key.cpp
+ *
+ * @brief     Implementation of the command setting a key of the crypto element.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_crypto_set_key.h"
+#include "com_code.h"
+#include "lr1110_crypto_engine.h"
+#include <string.h>
+
+#define COMMAND_CRYPTO_SET_KEY_PAYLOAD_LENGTH ( 1 + LR1110_CRYPTO_KEY_LENGTH )
+#define COMMAND_CRYPTO_SET_KEY_RESPONSE_LENGTH ( 2 )
+
+CommandCryptoSetKey::CommandCryptoSetKey( DeviceBase* device, Hci& hci, Demo& demo_holder )
+    : device( device ), hci( hci ), demo_holder( demo_holder ), key_id( 0 )
+{
+}
+
+CommandCryptoSetKey::~CommandCryptoSetKey( ) {}
+
+uint16_t CommandCryptoSetKey::GetComCode( ) { return COM_CODE_CRYPTO_SET_KEY; }
+
+bool CommandCryptoSetKey::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( buffer_size != COMMAND_CRYPTO_SET_KEY_PAYLOAD_LENGTH )
+    {
+        return false;
+    }
+
+    this->key_id = buffer[0];
+    memcpy( this->key, buffer + 1, LR1110_CRYPTO_KEY_LENGTH );
+    return true;
+}
+
+CommandEvent_t CommandCryptoSetKey::Execute( )
+{
+    uint8_t                buffer[COMMAND_CRYPTO_SET_KEY_RESPONSE_LENGTH] = { 0 };
+    lr1110_crypto_status_t status                                          = LR1110_CRYPTO_STATUS_ERROR;
+
+    if( this->demo_holder.IsRunning( ) == true )
+    {
+        buffer[0] = COMMAND_CRYPTO_STATUS_BUSY;
+    }
+    else
+    {
+        lr1110_crypto_set_key( this->device->GetRadio( ), &status, this->key_id, this->key );
+        buffer[0] = COMMAND_CRYPTO_STATUS_OK;
+    }
+    buffer[1] = ( uint8_t ) status;
+
+    // The key is not needed anymore once it reached the crypto element
+    memset( this->key, 0, LR1110_CRYPTO_KEY_LENGTH );
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_CRYPTO_SET_KEY_RESPONSE_LENGTH );
+
+    return COMMAND_NO_EVENT;
+}
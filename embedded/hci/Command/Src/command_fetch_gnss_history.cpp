@@ -0,0 +1,96 @@
+/**
+ * @file      command_fetch_gnss_history.cpp
+ *
+ * @brief     Implementation of the command fetching the NAV message history of the GNSS scheduler.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "command_fetch_gnss_history.h"
+#include "com_code.h"
+
+// WORKAROUND: #include "stm32l4xx_ll_utils.h" is needed to get the LL_mDelay
+// later on
+#include "stm32l4xx_ll_utils.h"
+
+#define COMMAND_FETCH_GNSS_HISTORY_HEADER_LENGTH ( 5 )
+
+CommandFetchGnssHistory::CommandFetchGnssHistory( Hci& hci, EnvironmentInterface& environment, Demo& demo_holder )
+    : hci( hci ), environment( environment ), demo_holder( demo_holder )
+{
+}
+
+CommandFetchGnssHistory::~CommandFetchGnssHistory( ) {}
+
+uint16_t CommandFetchGnssHistory::GetComCode( ) { return COM_CODE_FETCH_GNSS_HISTORY; }
+
+bool CommandFetchGnssHistory::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( buffer_size != 0 )
+    {
+        return false;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+CommandEvent_t CommandFetchGnssHistory::Execute( )
+{
+    const uint8_t n_entries = this->demo_holder.GetGnssHistoryCount( );
+    this->hci.SendResponse( this->GetComCode( ), n_entries );
+
+    for( uint8_t index = 0; index < n_entries; index++ )
+    {
+        this->SendHistoryEntry( *this->demo_holder.GetGnssHistoryEntry( index ) );
+
+        // WORKAROUND: same as for the Wi-Fi results, avoid back to back
+        // frames on the UART
+        LL_mDelay( 1 );
+    }
+    return COMMAND_NO_EVENT;
+}
+
+void CommandFetchGnssHistory::SendHistoryEntry( const demo_gnss_nav_history_entry_t& entry )
+{
+    const uint32_t local_measurement_delay =
+        this->environment.GetLocalTimeSeconds( ) - entry.local_instant_measurement;
+
+    uint8_t        buffer[COMMAND_FETCH_GNSS_HISTORY_HEADER_LENGTH + GNSS_DEMO_NAV_MESSAGE_MAX_LENGTH] = { 0 };
+    const uint16_t buffer_size = COMMAND_FETCH_GNSS_HISTORY_HEADER_LENGTH + entry.nav_message.size;
+
+    buffer[0] = ( uint8_t )( ( local_measurement_delay & 0x000000FF ) >> 0 );
+    buffer[1] = ( uint8_t )( ( local_measurement_delay & 0x0000FF00 ) >> 8 );
+    buffer[2] = ( uint8_t )( ( local_measurement_delay & 0x00FF0000 ) >> 16 );
+    buffer[3] = ( uint8_t )( ( local_measurement_delay & 0xFF000000 ) >> 24 );
+    buffer[4] = entry.nb_satellites;
+
+    memcpy( buffer + COMMAND_FETCH_GNSS_HISTORY_HEADER_LENGTH, entry.nav_message.message, entry.nav_message.size );
+
+    this->hci.SendResponse( RESP_CODE_GNSS_HISTORY_RESULT, buffer, buffer_size );
+}
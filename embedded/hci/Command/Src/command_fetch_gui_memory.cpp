@@ -0,0 +1,116 @@
+/**
+ * @file      command_fetch_gui_memory.cpp
+ *
+ * @brief     Implementation of the command fetching the LVGL memory pool usage measured by the GUI.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_fetch_gui_memory.h"
+#include "com_code.h"
+
+#define COMMAND_FETCH_GUI_MEMORY_HEADER_LENGTH ( 10 )
+#define COMMAND_FETCH_GUI_MEMORY_PAGE_LENGTH ( 10 )
+#define COMMAND_FETCH_GUI_MEMORY_BUFFER_LENGTH \
+    ( COMMAND_FETCH_GUI_MEMORY_HEADER_LENGTH + GUI_PAGE_COUNT * COMMAND_FETCH_GUI_MEMORY_PAGE_LENGTH )
+
+static uint8_t command_fetch_gui_memory_set_uint32( uint8_t* buffer, uint32_t value );
+
+CommandFetchGuiMemory::CommandFetchGuiMemory( Hci& hci, Gui& gui )
+    : hci( hci ), gui( gui ), reset_after_fetch( false )
+{
+}
+
+CommandFetchGuiMemory::~CommandFetchGuiMemory( ) {}
+
+uint16_t CommandFetchGuiMemory::GetComCode( ) { return COM_CODE_FETCH_GUI_MEMORY; }
+
+bool CommandFetchGuiMemory::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( buffer_size == 0 )
+    {
+        this->reset_after_fetch = false;
+        return true;
+    }
+    else if( buffer_size == 1 )
+    {
+        this->reset_after_fetch = ( buffer[0] != 0 );
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+CommandEvent_t CommandFetchGuiMemory::Execute( )
+{
+    const GuiMemoryMonitor& monitor                                        = this->gui.GetMemoryMonitor( );
+    uint8_t                 buffer[COMMAND_FETCH_GUI_MEMORY_BUFFER_LENGTH] = { 0 };
+    uint16_t                index                                          = 0;
+    uint8_t                 n_pages                                        = 0;
+
+    index += command_fetch_gui_memory_set_uint32( buffer + index, monitor.GetPoolSize( ) );
+    index += command_fetch_gui_memory_set_uint32( buffer + index, monitor.GetPeakUsedSize( ) );
+    buffer[index++] = monitor.GetImageCacheSize( );
+    index++;  // Number of pages, filled once known
+
+    for( uint8_t page = 0; page < GUI_PAGE_COUNT; page++ )
+    {
+        const GuiMemoryPageStats_t* stats = monitor.GetPageStats( ( guiPageType_t ) page );
+
+        if( stats->n_samples == 0 )
+        {
+            continue;
+        }
+
+        buffer[index++] = page;
+        index += command_fetch_gui_memory_set_uint32( buffer + index, stats->peak_used_size );
+        index += command_fetch_gui_memory_set_uint32( buffer + index, stats->min_free_biggest_size );
+        buffer[index++] = stats->peak_frag_pct;
+        n_pages++;
+    }
+    buffer[COMMAND_FETCH_GUI_MEMORY_HEADER_LENGTH - 1] = n_pages;
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, index );
+
+    if( this->reset_after_fetch == true )
+    {
+        this->gui.ResetMemoryMonitor( );
+    }
+
+    return COMMAND_NO_EVENT;
+}
+
+static uint8_t command_fetch_gui_memory_set_uint32( uint8_t* buffer, uint32_t value )
+{
+    buffer[0] = ( uint8_t )( ( value & 0x000000FF ) >> 0 );
+    buffer[1] = ( uint8_t )( ( value & 0x0000FF00 ) >> 8 );
+    buffer[2] = ( uint8_t )( ( value & 0x00FF0000 ) >> 16 );
+    buffer[3] = ( uint8_t )( ( value & 0xFF000000 ) >> 24 );
+
+    return 4;
+}
@@ -37,8 +37,21 @@
 // later on
 #include "stm32l4xx_ll_utils.h"
 
+#define COMMAND_FETCH_RESULT_AP_SUMMARY_HEADER_LENGTH ( 3 )
+#define COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRY_LENGTH ( 17 )
+#define COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRIES_PER_FRAME ( 16 )
+#define COMMAND_FETCH_RESULT_AP_SUMMARY_FRAME_MAX_LENGTH \
+    ( COMMAND_FETCH_RESULT_AP_SUMMARY_HEADER_LENGTH +     \
+      ( COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRY_LENGTH * COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRIES_PER_FRAME ) )
+#define COMMAND_FETCH_RESULT_ENERGY_MAX_PHASES ( 4 )
+#define COMMAND_FETCH_RESULT_ENERGY_FRAME_MAX_LENGTH ( 2 + 4 * COMMAND_FETCH_RESULT_ENERGY_MAX_PHASES )
+#define COMMAND_FETCH_RESULT_RADIO_CAD_FRAME_LENGTH ( 34 )
+#define COMMAND_FETCH_RESULT_RADIO_PER_RX_FRAME_LENGTH ( 24 )
+#define COMMAND_FETCH_RESULT_RADIO_PING_PONG_FRAME_LENGTH ( 33 )
+#define COMMAND_FETCH_RESULT_COUNT_WITH_TELEMETRY_LENGTH ( 7 )
+
 CommandFetchResult::CommandFetchResult( Hci& hci, EnvironmentInterface& environment, Demo& demo_holder )
-    : hci( hci ), environment( environment ), demo_holder( demo_holder )
+    : hci( hci ), environment( environment ), demo_holder( demo_holder ), content( COMMAND_FETCH_RESULT_LAST_SCAN )
 {
 }
 
@@ -48,26 +61,46 @@ uint16_t CommandFetchResult::GetComCode( ) { return COM_CODE_FETCH_RESULT; }
 
 bool CommandFetchResult::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
 {
-    if( buffer_size != 0 )
+    if( buffer_size == 0 )
     {
-        return false;
+        this->content = COMMAND_FETCH_RESULT_LAST_SCAN;
+        return true;
     }
-    else
+    else if( ( buffer_size == 1 ) && ( buffer[0] <= COMMAND_FETCH_RESULT_ENERGY ) )
     {
+        this->content = ( command_fetch_result_content_t ) buffer[0];
         return true;
     }
+    else
+    {
+        return false;
+    }
 }
 
 CommandEvent_t CommandFetchResult::Execute( )
 {
+    if( this->content == COMMAND_FETCH_RESULT_AP_SUMMARY )
+    {
+        const DemoWifiApTable& ap_table = *this->demo_holder.GetWifiApTable( );
+        this->hci.SendResponse( this->GetComCode( ), CommandFetchResult::GetWifiApSummaryFrameCount( ap_table ) );
+
+        this->FetchWifiApSummary( ap_table );
+        return COMMAND_NO_EVENT;
+    }
+    else if( this->content == COMMAND_FETCH_RESULT_ENERGY )
+    {
+        this->hci.SendResponse( this->GetComCode( ), 1 );
+
+        this->FetchEnergy( );
+        return COMMAND_NO_EVENT;
+    }
+
     switch( this->demo_holder.GetType( ) )
     {
     case DEMO_TYPE_WIFI:
     {
         const demo_wifi_scan_all_results_t& wifi_result = *( demo_wifi_scan_all_results_t* ) demo_holder.GetResults( );
-        const uint8_t                       n_results   = wifi_result.nbrResults;
-        const uint16_t                      response_code = this->GetComCode( );
-        this->hci.SendResponse( response_code, n_results );
+        this->SendResultCountWithTelemetry( wifi_result.nbrResults, wifi_result.telemetry );
 
         this->FetchWifiResults( wifi_result );
         break;
@@ -76,9 +109,7 @@ CommandEvent_t CommandFetchResult::Execute( )
     {
         const demo_gnss_all_results_t& gnss_autonomous_results =
             *( demo_gnss_all_results_t* ) demo_holder.GetResults( );
-        // const uint8_t  n_results     = gnss_autonomous_results.nb_result;
-        const uint16_t response_code = this->GetComCode( );
-        this->hci.SendResponse( response_code, 1 );
+        this->SendResultCountWithTelemetry( 1, gnss_autonomous_results.telemetry );
 
         this->FetchAutonomousGnssResults( gnss_autonomous_results );
         break;
@@ -86,19 +117,78 @@ CommandEvent_t CommandFetchResult::Execute( )
     case DEMO_TYPE_GNSS_ASSISTED:
     {
         const demo_gnss_all_results_t& gnss_assisted_results = *( demo_gnss_all_results_t* ) demo_holder.GetResults( );
-        // const uint8_t  n_results     = gnss_assisted_results.nb_result;
-        const uint16_t response_code = this->GetComCode( );
-        this->hci.SendResponse( response_code, 1 );
+        this->SendResultCountWithTelemetry( 1, gnss_assisted_results.telemetry );
 
         this->FetchAssistedGnssResults( gnss_assisted_results );
         break;
     }
+    case DEMO_TYPE_GNSS_SCHEDULER:
+    {
+        const demo_gnss_all_results_t& gnss_last_results = *( demo_gnss_all_results_t* ) demo_holder.GetResults( );
+        demo_gnss_scheduler_settings_t scheduler_settings;
+        this->demo_holder.GetConfigGnssScheduler( &scheduler_settings );
+        this->SendResultCountWithTelemetry( 1, gnss_last_results.telemetry );
+
+        if( scheduler_settings.scan_type == DEMO_GNSS_SCHEDULER_SCAN_ASSISTED )
+        {
+            this->FetchAssistedGnssResults( gnss_last_results );
+        }
+        else
+        {
+            this->FetchAutonomousGnssResults( gnss_last_results );
+        }
+        break;
+    }
+    case DEMO_TYPE_RADIO_CAD:
+    {
+        const demo_radio_cad_results_t& cad_results = *( demo_radio_cad_results_t* ) demo_holder.GetResults( );
+        this->hci.SendResponse( this->GetComCode( ), cad_results.nb_combinations );
+
+        this->FetchRadioCadResults( cad_results );
+        break;
+    }
+    case DEMO_TYPE_RADIO_PER_RX:
+    {
+        const demo_radio_per_results_t& per_results = *( demo_radio_per_results_t* ) demo_holder.GetResults( );
+        this->hci.SendResponse( this->GetComCode( ), 1 );
+
+        this->FetchRadioPerRxResults( per_results );
+        break;
+    }
+    case DEMO_TYPE_RADIO_PING_PONG:
+    {
+        const demo_ping_pong_results_t& ping_pong_results = *( demo_ping_pong_results_t* ) demo_holder.GetResults( );
+        this->hci.SendResponse( this->GetComCode( ), 1 );
+
+        this->FetchRadioPingPongResults( ping_pong_results );
+        break;
+    }
     default:
         break;
     }
     return COMMAND_NO_EVENT;
 }
 
+void CommandFetchResult::SendResultCountWithTelemetry( const uint8_t nb_results, const telemetry_sample_t& telemetry )
+{
+    // Age of the sample in seconds, saturated to 0xFFFF, so that the host can tell a stale sample
+    const uint32_t age_s =
+        ( ( uint32_t ) this->environment.GetLocalTimeMilliseconds( ) - telemetry.local_instant_ms ) / 1000;
+    const uint16_t age_saturated_s = ( age_s < 0xFFFF ) ? ( uint16_t ) age_s : 0xFFFF;
+
+    const uint8_t buffer[COMMAND_FETCH_RESULT_COUNT_WITH_TELEMETRY_LENGTH] = {
+        nb_results,
+        ( uint8_t )( ( telemetry.vbat_mv & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( telemetry.vbat_mv & 0xFF00 ) >> 8 ),
+        ( uint8_t )( ( ( uint16_t ) telemetry.temperature_dc & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( ( uint16_t ) telemetry.temperature_dc & 0xFF00 ) >> 8 ),
+        ( uint8_t )( ( age_saturated_s & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( age_saturated_s & 0xFF00 ) >> 8 ),
+    };
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_FETCH_RESULT_COUNT_WITH_TELEMETRY_LENGTH );
+}
+
 void CommandFetchResult::FetchWifiResults( const demo_wifi_scan_all_results_t& wifi_results )
 {
     for( uint8_t result_index = 0; result_index < wifi_results.nbrResults; result_index++ )
@@ -145,6 +235,172 @@ void CommandFetchResult::FetchWifiResults( const demo_wifi_scan_all_results_t& w
     }
 }
 
+void CommandFetchResult::FetchWifiApSummary( const DemoWifiApTable& ap_table )
+{
+    const uint32_t local_instant_s = this->environment.GetLocalTimeSeconds( );
+    const uint16_t nb_scans        = ap_table.GetNbScans( );
+    const uint8_t  nb_entries      = ap_table.GetCount( );
+    uint8_t        entry_index     = 0;
+
+    for( uint8_t frame_index = 0; frame_index < CommandFetchResult::GetWifiApSummaryFrameCount( ap_table );
+         frame_index++ )
+    {
+        uint8_t  buffer[COMMAND_FETCH_RESULT_AP_SUMMARY_FRAME_MAX_LENGTH];
+        uint16_t buffer_index        = COMMAND_FETCH_RESULT_AP_SUMMARY_HEADER_LENGTH;
+        uint8_t  nb_entries_in_frame = 0;
+
+        while( ( entry_index < nb_entries ) &&
+               ( nb_entries_in_frame < COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRIES_PER_FRAME ) )
+        {
+            const demo_wifi_ap_entry_t& entry = *ap_table.GetEntry( entry_index );
+
+            for( uint8_t mac_index = 0; mac_index < DEMO_TYPE_WIFI_MAC_ADDRESS_LENGTH; mac_index++ )
+            {
+                buffer[buffer_index++] = entry.mac_address[mac_index];
+            }
+            buffer[buffer_index++] = entry.channel;
+            buffer[buffer_index++] = entry.type;
+            buffer[buffer_index++] = ( uint8_t )( ( entry.nb_detections & 0x00FF ) >> 0 );
+            buffer[buffer_index++] = ( uint8_t )( ( entry.nb_detections & 0xFF00 ) >> 8 );
+            buffer[buffer_index++] = ( uint8_t ) entry.rssi_min;
+            buffer[buffer_index++] = ( uint8_t ) entry.rssi_max;
+            buffer[buffer_index++] = ( uint8_t ) DemoWifiApTable::GetRssiMean( entry );
+            buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index,
+                                                                    local_instant_s - entry.local_instant_last_seen_s );
+
+            entry_index++;
+            nb_entries_in_frame++;
+        }
+
+        buffer[0] = ( uint8_t )( ( nb_scans & 0x00FF ) >> 0 );
+        buffer[1] = ( uint8_t )( ( nb_scans & 0xFF00 ) >> 8 );
+        buffer[2] = nb_entries_in_frame;
+
+        hci.SendResponse( RESP_CODE_WIFI_AP_SUMMARY, buffer, buffer_index );
+
+        // WORKAROUND: using LL_mDelay(1) between frames, as for the Wi-Fi results
+        LL_mDelay( 1 );
+    }
+}
+
+uint8_t CommandFetchResult::GetWifiApSummaryFrameCount( const DemoWifiApTable& ap_table )
+{
+    const uint8_t nb_entries = ap_table.GetCount( );
+
+    // At least one frame is sent so that the number of scans is always reported
+    if( nb_entries == 0 )
+    {
+        return 1;
+    }
+    else
+    {
+        return ( nb_entries + COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRIES_PER_FRAME - 1 ) /
+               COMMAND_FETCH_RESULT_AP_SUMMARY_ENTRIES_PER_FRAME;
+    }
+}
+
+void CommandFetchResult::FetchEnergy( )
+{
+    const demo_type_t demo_type                                            = this->demo_holder.GetType( );
+    uint8_t           buffer[COMMAND_FETCH_RESULT_ENERGY_FRAME_MAX_LENGTH] = { 0 };
+    uint16_t          buffer_index                                         = 2;
+
+    switch( demo_type )
+    {
+    case DEMO_TYPE_WIFI:
+    case DEMO_TYPE_WIFI_COUNTRY_CODE:
+    {
+        const demo_wifi_energy_t& energy = ( ( demo_wifi_scan_all_results_t* ) demo_holder.GetResults( ) )->energy;
+
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, energy.detection_uas );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, energy.correlation_uas );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, energy.capture_uas );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, energy.demodulation_uas );
+        break;
+    }
+    case DEMO_TYPE_GNSS_AUTONOMOUS:
+    case DEMO_TYPE_GNSS_ASSISTED:
+    case DEMO_TYPE_GNSS_SCHEDULER:
+    {
+        const demo_gnss_energy_t& energy = ( ( demo_gnss_all_results_t* ) demo_holder.GetResults( ) )->energy;
+
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, energy.acquisition_uas );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, energy.computation_uas );
+        break;
+    }
+    default:
+        break;
+    }
+
+    buffer[0] = ( uint8_t ) demo_type;
+    buffer[1] = ( buffer_index - 2 ) / 4;
+
+    this->hci.SendResponse( RESP_CODE_ENERGY, buffer, buffer_index );
+}
+
+void CommandFetchResult::FetchRadioCadResults( const demo_radio_cad_results_t& cad_results )
+{
+    for( uint8_t index = 0; index < cad_results.nb_combinations; index++ )
+    {
+        const demo_radio_cad_combination_results_t& combination = cad_results.combinations[index];
+
+        uint8_t  buffer[COMMAND_FETCH_RESULT_RADIO_CAD_FRAME_LENGTH];
+        uint16_t buffer_index = 0;
+
+        buffer[buffer_index++] = index;
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.frequency_hz );
+        buffer[buffer_index++] = ( uint8_t ) combination.sf;
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.nb_cads );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.nb_detections );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.nb_false_alarms );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.cad_duration_us );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.rx_duration_ms );
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.energy_per_cad.cad_nas );
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, combination.energy_per_cad.rx_nas );
+
+        this->hci.SendResponse( RESP_CODE_RADIO_CAD, buffer, buffer_index );
+    }
+}
+
+void CommandFetchResult::FetchRadioPerRxResults( const demo_radio_per_results_t& per_results )
+{
+    uint8_t  buffer[COMMAND_FETCH_RESULT_RADIO_PER_RX_FRAME_LENGTH];
+    uint16_t buffer_index = 0;
+
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, per_results.count_rx_correct_packet );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, per_results.count_rx_wrong_packet );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, per_results.count_rx_timeout );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, per_results.count_rx_expected_packet );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, per_results.listening_duration_ms );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, per_results.average_current_ua );
+
+    this->hci.SendResponse( RESP_CODE_RADIO_PER_RX, buffer, buffer_index );
+}
+
+void CommandFetchResult::FetchRadioPingPongResults( const demo_ping_pong_results_t& ping_pong_results )
+{
+    uint8_t  buffer[COMMAND_FETCH_RESULT_RADIO_PING_PONG_FRAME_LENGTH];
+    uint16_t buffer_index = 0;
+
+    buffer[buffer_index++] = ( uint8_t ) ping_pong_results.mode;
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.count_tx );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.count_rx_correct_packet );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.count_rx_wrong_packet );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.count_rx_timeout );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.count_round_trip );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.round_trip_min_ms );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.round_trip_max_ms );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( buffer, buffer_index, ping_pong_results.round_trip_total_ms );
+
+    this->hci.SendResponse( RESP_CODE_RADIO_PING_PONG, buffer, buffer_index );
+}
+
 void CommandFetchResult::FetchAutonomousGnssResults( const demo_gnss_all_results_t& gnss_autonomous_results )
 {
     this->SendGnssResult( gnss_autonomous_results, RESP_CODE_GNSS_AUTONOMOUS_RESULT );
@@ -0,0 +1,136 @@
+/**
+ * @file      command_fetch_telemetry.cpp
+ *
+ * @brief     Implementation of the command fetching the VBAT and temperature history.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_fetch_telemetry.h"
+#include "com_code.h"
+
+// WORKAROUND: #include "stm32l4xx_ll_utils.h" is needed to get the LL_mDelay
+// later on
+#include "stm32l4xx_ll_utils.h"
+
+#define COMMAND_FETCH_TELEMETRY_SUMMARY_LENGTH ( 17 )
+#define COMMAND_FETCH_TELEMETRY_ENTRY_LENGTH ( 8 )
+
+CommandFetchTelemetry::CommandFetchTelemetry( Hci& hci, EnvironmentInterface& environment,
+                                              TelemetrySampler& telemetry_sampler )
+    : hci( hci ), environment( environment ), telemetry_sampler( telemetry_sampler ), new_period_ms( 0 )
+{
+}
+
+CommandFetchTelemetry::~CommandFetchTelemetry( ) {}
+
+uint16_t CommandFetchTelemetry::GetComCode( ) { return COM_CODE_FETCH_TELEMETRY; }
+
+bool CommandFetchTelemetry::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( buffer_size == 0 )
+    {
+        this->new_period_ms = 0;
+        return true;
+    }
+    else if( buffer_size == 4 )
+    {
+        const uint32_t period_ms = ( ( uint32_t ) buffer[0] << 0 ) + ( ( uint32_t ) buffer[1] << 8 ) +
+                                   ( ( uint32_t ) buffer[2] << 16 ) + ( ( uint32_t ) buffer[3] << 24 );
+        if( ( period_ms < TELEMETRY_SAMPLER_PERIOD_MIN_MS ) || ( period_ms > TELEMETRY_SAMPLER_PERIOD_MAX_MS ) )
+        {
+            return false;
+        }
+        this->new_period_ms = period_ms;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+CommandEvent_t CommandFetchTelemetry::Execute( )
+{
+    if( this->new_period_ms != 0 )
+    {
+        this->telemetry_sampler.SetPeriod( this->new_period_ms );
+    }
+
+    const uint32_t              period_ms  = this->telemetry_sampler.GetPeriod( );
+    const uint32_t              nb_samples = this->telemetry_sampler.GetNbSamples( );
+    const telemetry_extremes_t& extremes   = this->telemetry_sampler.GetExtremes( );
+    const uint8_t               n_entries  = this->telemetry_sampler.GetHistoryCount( );
+
+    const uint8_t summary[COMMAND_FETCH_TELEMETRY_SUMMARY_LENGTH] = {
+        ( uint8_t )( ( period_ms & 0x000000FF ) >> 0 ),
+        ( uint8_t )( ( period_ms & 0x0000FF00 ) >> 8 ),
+        ( uint8_t )( ( period_ms & 0x00FF0000 ) >> 16 ),
+        ( uint8_t )( ( period_ms & 0xFF000000 ) >> 24 ),
+        ( uint8_t )( ( nb_samples & 0x000000FF ) >> 0 ),
+        ( uint8_t )( ( nb_samples & 0x0000FF00 ) >> 8 ),
+        ( uint8_t )( ( nb_samples & 0x00FF0000 ) >> 16 ),
+        ( uint8_t )( ( nb_samples & 0xFF000000 ) >> 24 ),
+        ( uint8_t )( ( extremes.vbat_min_mv & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( extremes.vbat_min_mv & 0xFF00 ) >> 8 ),
+        ( uint8_t )( ( extremes.vbat_max_mv & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( extremes.vbat_max_mv & 0xFF00 ) >> 8 ),
+        ( uint8_t )( ( ( uint16_t ) extremes.temperature_min_dc & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( ( uint16_t ) extremes.temperature_min_dc & 0xFF00 ) >> 8 ),
+        ( uint8_t )( ( ( uint16_t ) extremes.temperature_max_dc & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( ( uint16_t ) extremes.temperature_max_dc & 0xFF00 ) >> 8 ),
+        n_entries,
+    };
+    this->hci.SendResponse( this->GetComCode( ), summary, COMMAND_FETCH_TELEMETRY_SUMMARY_LENGTH );
+
+    for( uint8_t index = 0; index < n_entries; index++ )
+    {
+        this->SendHistoryEntry( *this->telemetry_sampler.GetHistoryEntry( index ) );
+
+        // WORKAROUND: same as for the Wi-Fi results, avoid back to back
+        // frames on the UART
+        LL_mDelay( 1 );
+    }
+    return COMMAND_NO_EVENT;
+}
+
+void CommandFetchTelemetry::SendHistoryEntry( const telemetry_sample_t& entry )
+{
+    const uint32_t delay_ms = this->environment.GetLocalTimeMilliseconds( ) - entry.local_instant_ms;
+
+    const uint8_t buffer[COMMAND_FETCH_TELEMETRY_ENTRY_LENGTH] = {
+        ( uint8_t )( ( delay_ms & 0x000000FF ) >> 0 ),
+        ( uint8_t )( ( delay_ms & 0x0000FF00 ) >> 8 ),
+        ( uint8_t )( ( delay_ms & 0x00FF0000 ) >> 16 ),
+        ( uint8_t )( ( delay_ms & 0xFF000000 ) >> 24 ),
+        ( uint8_t )( ( entry.vbat_mv & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( entry.vbat_mv & 0xFF00 ) >> 8 ),
+        ( uint8_t )( ( ( uint16_t ) entry.temperature_dc & 0x00FF ) >> 0 ),
+        ( uint8_t )( ( ( uint16_t ) entry.temperature_dc & 0xFF00 ) >> 8 ),
+    };
+
+    this->hci.SendResponse( RESP_CODE_TELEMETRY, buffer, COMMAND_FETCH_TELEMETRY_ENTRY_LENGTH );
+}
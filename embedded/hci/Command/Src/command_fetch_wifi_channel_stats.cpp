@@ -0,0 +1,122 @@
+/**
+ * @file      command_fetch_wifi_channel_stats.cpp
+ *
+ * @brief     Implementation of the command fetching the occupancy statistics of the Wi-Fi channels.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_fetch_wifi_channel_stats.h"
+#include "com_code.h"
+
+#define COMMAND_FETCH_WIFI_CHANNEL_STATS_HEADER_LENGTH ( 3 )
+#define COMMAND_FETCH_WIFI_CHANNEL_STATS_CHANNEL_LENGTH ( 11 + 2 * DEMO_WIFI_CHANNEL_STATS_RSSI_BINS )
+#define COMMAND_FETCH_WIFI_CHANNEL_STATS_BUFFER_LENGTH \
+    ( COMMAND_FETCH_WIFI_CHANNEL_STATS_HEADER_LENGTH +  \
+      DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS * COMMAND_FETCH_WIFI_CHANNEL_STATS_CHANNEL_LENGTH )
+
+static uint8_t command_fetch_wifi_channel_stats_set_uint16( uint8_t* buffer, uint16_t value );
+static uint8_t command_fetch_wifi_channel_stats_set_uint32( uint8_t* buffer, uint32_t value );
+
+CommandFetchWifiChannelStats::CommandFetchWifiChannelStats( Hci& hci, Demo& demo_holder )
+    : hci( hci ), demo_holder( demo_holder ), clear_after_fetch( false )
+{
+}
+
+CommandFetchWifiChannelStats::~CommandFetchWifiChannelStats( ) {}
+
+uint16_t CommandFetchWifiChannelStats::GetComCode( ) { return COM_CODE_FETCH_WIFI_CHANNEL_STATS; }
+
+bool CommandFetchWifiChannelStats::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( buffer_size == 0 )
+    {
+        this->clear_after_fetch = false;
+        return true;
+    }
+    else if( buffer_size == 1 )
+    {
+        this->clear_after_fetch = ( buffer[0] != 0 );
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+CommandEvent_t CommandFetchWifiChannelStats::Execute( )
+{
+    const DemoWifiChannelStats& stats = *this->demo_holder.GetWifiChannelStats( );
+    uint8_t                     buffer[COMMAND_FETCH_WIFI_CHANNEL_STATS_BUFFER_LENGTH] = { 0 };
+    uint16_t                    index                                                  = 0;
+
+    index += command_fetch_wifi_channel_stats_set_uint16( buffer + index, stats.GetNbScans( ) );
+    buffer[index++] = DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS;
+
+    for( uint8_t channel = 1; channel <= DEMO_WIFI_CHANNEL_STATS_NB_CHANNELS; channel++ )
+    {
+        const demo_wifi_channel_stats_t* channel_stats = stats.GetChannel( channel );
+
+        index += command_fetch_wifi_channel_stats_set_uint16( buffer + index, channel_stats->nb_scans );
+        index += command_fetch_wifi_channel_stats_set_uint16( buffer + index, channel_stats->nb_detections );
+        buffer[index++] = channel_stats->nb_ap_last_scan;
+        buffer[index++] = channel_stats->nb_ap_max_per_scan;
+        buffer[index++] = ( uint8_t ) channel_stats->rssi_max;
+        for( uint8_t bin = 0; bin < DEMO_WIFI_CHANNEL_STATS_RSSI_BINS; bin++ )
+        {
+            index += command_fetch_wifi_channel_stats_set_uint16( buffer + index, channel_stats->rssi_histogram[bin] );
+        }
+        index += command_fetch_wifi_channel_stats_set_uint32( buffer + index, channel_stats->dwell_time_us );
+    }
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, index );
+
+    if( this->clear_after_fetch == true )
+    {
+        this->demo_holder.ClearWifiChannelStats( );
+    }
+
+    return COMMAND_NO_EVENT;
+}
+
+static uint8_t command_fetch_wifi_channel_stats_set_uint16( uint8_t* buffer, uint16_t value )
+{
+    buffer[0] = ( uint8_t )( ( value & 0x00FF ) >> 0 );
+    buffer[1] = ( uint8_t )( ( value & 0xFF00 ) >> 8 );
+
+    return 2;
+}
+
+static uint8_t command_fetch_wifi_channel_stats_set_uint32( uint8_t* buffer, uint32_t value )
+{
+    buffer[0] = ( uint8_t )( ( value & 0x000000FF ) >> 0 );
+    buffer[1] = ( uint8_t )( ( value & 0x0000FF00 ) >> 8 );
+    buffer[2] = ( uint8_t )( ( value & 0x00FF0000 ) >> 16 );
+    buffer[3] = ( uint8_t )( ( value & 0xFF000000 ) >> 24 );
+
+    return 4;
+}
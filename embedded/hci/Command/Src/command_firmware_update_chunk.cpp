@@ -0,0 +1,88 @@
+/**
+ * @file      command_firmware_update_chunk.cpp
+ *
+ * @brief     Implementation of the command writing a chunk of the LR1110 firmware.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_firmware_update_chunk.h"
+#include "com_code.h"
+#include <string.h>
+
+#define COMMAND_FIRMWARE_UPDATE_CHUNK_HEADER_LENGTH ( 4 )
+#define COMMAND_FIRMWARE_UPDATE_CHUNK_RESPONSE_LENGTH ( 5 )
+
+CommandFirmwareUpdateChunk::CommandFirmwareUpdateChunk( Hci& hci, DeviceFirmwareUpdate& firmware_update )
+    : hci( hci ), firmware_update( firmware_update ), offset( 0 ), chunk_size( 0 )
+{
+}
+
+CommandFirmwareUpdateChunk::~CommandFirmwareUpdateChunk( ) {}
+
+uint16_t CommandFirmwareUpdateChunk::GetComCode( ) { return COM_CODE_FIRMWARE_UPDATE_CHUNK; }
+
+bool CommandFirmwareUpdateChunk::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( ( buffer_size <= COMMAND_FIRMWARE_UPDATE_CHUNK_HEADER_LENGTH ) ||
+        ( buffer_size > COMMAND_FIRMWARE_UPDATE_CHUNK_HEADER_LENGTH + DEVICE_FIRMWARE_UPDATE_CHUNK_SIZE_MAX ) )
+    {
+        return false;
+    }
+
+    this->offset     = buffer[0] + ( buffer[1] << 8 ) + ( buffer[2] << 16 ) + ( ( uint32_t ) buffer[3] << 24 );
+    this->chunk_size = buffer_size - COMMAND_FIRMWARE_UPDATE_CHUNK_HEADER_LENGTH;
+    memcpy( this->chunk, buffer + COMMAND_FIRMWARE_UPDATE_CHUNK_HEADER_LENGTH, this->chunk_size );
+
+    return true;
+}
+
+CommandEvent_t CommandFirmwareUpdateChunk::Execute( )
+{
+    uint8_t buffer[COMMAND_FIRMWARE_UPDATE_CHUNK_RESPONSE_LENGTH] = { 0 };
+
+    const device_firmware_update_status_t status = this->firmware_update.CheckChunk( this->offset, this->chunk_size );
+    uint32_t                              nb_bytes_accepted = this->firmware_update.GetNbBytesWritten( );
+    if( status == DEVICE_FIRMWARE_UPDATE_STATUS_OK )
+    {
+        nb_bytes_accepted += this->chunk_size;
+    }
+
+    buffer[0] = ( uint8_t ) status;
+    buffer[1] = ( uint8_t )( ( nb_bytes_accepted & 0x000000FF ) >> 0 );
+    buffer[2] = ( uint8_t )( ( nb_bytes_accepted & 0x0000FF00 ) >> 8 );
+    buffer[3] = ( uint8_t )( ( nb_bytes_accepted & 0x00FF0000 ) >> 16 );
+    buffer[4] = ( uint8_t )( ( nb_bytes_accepted & 0xFF000000 ) >> 24 );
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_FIRMWARE_UPDATE_CHUNK_RESPONSE_LENGTH );
+
+    if( status == DEVICE_FIRMWARE_UPDATE_STATUS_OK )
+    {
+        this->firmware_update.WriteChunk( this->offset, this->chunk, this->chunk_size );
+    }
+
+    return COMMAND_NO_EVENT;
+}
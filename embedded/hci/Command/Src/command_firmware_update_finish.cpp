@@ -0,0 +1,69 @@
+/**
+ * @file      command_firmware_update_finish.cpp
+ *
+ * @brief     Implementation of the command finishing the update of the LR1110 firmware.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_firmware_update_finish.h"
+#include "com_code.h"
+#include <string.h>
+
+#define COMMAND_FIRMWARE_UPDATE_FINISH_RESPONSE_LENGTH ( 1 + LR1110_BL_HASH_LENGTH + 4 )
+
+CommandFirmwareUpdateFinish::CommandFirmwareUpdateFinish( Hci& hci, DeviceFirmwareUpdate& firmware_update )
+    : hci( hci ), firmware_update( firmware_update )
+{
+}
+
+CommandFirmwareUpdateFinish::~CommandFirmwareUpdateFinish( ) {}
+
+uint16_t CommandFirmwareUpdateFinish::GetComCode( ) { return COM_CODE_FIRMWARE_UPDATE_FINISH; }
+
+bool CommandFirmwareUpdateFinish::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    return buffer_size == 0;
+}
+
+CommandEvent_t CommandFirmwareUpdateFinish::Execute( )
+{
+    uint8_t                         buffer[COMMAND_FIRMWARE_UPDATE_FINISH_RESPONSE_LENGTH] = { 0 };
+    device_firmware_update_result_t result;
+
+    const device_firmware_update_status_t status = this->firmware_update.Finish( &result );
+
+    buffer[0] = ( uint8_t ) status;
+    memcpy( buffer + 1, result.hash, LR1110_BL_HASH_LENGTH );
+    buffer[1 + LR1110_BL_HASH_LENGTH + 0] = result.version.hw;
+    buffer[1 + LR1110_BL_HASH_LENGTH + 1] = result.version.type;
+    buffer[1 + LR1110_BL_HASH_LENGTH + 2] = ( uint8_t )( ( result.version.fw & 0x00FF ) >> 0 );
+    buffer[1 + LR1110_BL_HASH_LENGTH + 3] = ( uint8_t )( ( result.version.fw & 0xFF00 ) >> 8 );
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_FIRMWARE_UPDATE_FINISH_RESPONSE_LENGTH );
+
+    return COMMAND_NO_EVENT;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file      command_firmware_update_start.cpp
+ *
+ * @brief     Implementation of the command starting the update of the LR1110 firmware.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_firmware_update_start.h"
+#include "com_code.h"
+#include <string.h>
+
+#define COMMAND_FIRMWARE_UPDATE_START_PAYLOAD_LENGTH ( 4 )
+#define COMMAND_FIRMWARE_UPDATE_START_RESPONSE_LENGTH ( 5 )
+
+CommandFirmwareUpdateStart::CommandFirmwareUpdateStart( Hci& hci, Demo& demo_holder,
+                                                        DeviceFirmwareUpdate& firmware_update )
+    : hci( hci ),
+      demo_holder( demo_holder ),
+      firmware_update( firmware_update ),
+      image_size( 0 ),
+      has_expected_hash( false )
+{
+}
+
+CommandFirmwareUpdateStart::~CommandFirmwareUpdateStart( ) {}
+
+uint16_t CommandFirmwareUpdateStart::GetComCode( ) { return COM_CODE_FIRMWARE_UPDATE_START; }
+
+bool CommandFirmwareUpdateStart::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( ( buffer_size != COMMAND_FIRMWARE_UPDATE_START_PAYLOAD_LENGTH ) &&
+        ( buffer_size != COMMAND_FIRMWARE_UPDATE_START_PAYLOAD_LENGTH + LR1110_BL_HASH_LENGTH ) )
+    {
+        return false;
+    }
+
+    this->image_size = buffer[0] + ( buffer[1] << 8 ) + ( buffer[2] << 16 ) + ( ( uint32_t ) buffer[3] << 24 );
+
+    this->has_expected_hash = ( buffer_size > COMMAND_FIRMWARE_UPDATE_START_PAYLOAD_LENGTH );
+    if( this->has_expected_hash == true )
+    {
+        memcpy( this->expected_hash, buffer + COMMAND_FIRMWARE_UPDATE_START_PAYLOAD_LENGTH, LR1110_BL_HASH_LENGTH );
+    }
+
+    return true;
+}
+
+CommandEvent_t CommandFirmwareUpdateStart::Execute( )
+{
+    uint8_t                         buffer[COMMAND_FIRMWARE_UPDATE_START_RESPONSE_LENGTH] = { 0 };
+    lr1110_bootloader_version_t     version                                               = { 0 };
+    device_firmware_update_status_t status = DEVICE_FIRMWARE_UPDATE_STATUS_BUSY;
+
+    if( this->demo_holder.IsRunning( ) == false )
+    {
+        const uint8_t* expected_hash = ( this->has_expected_hash == true ) ? this->expected_hash : NULL;
+        status = this->firmware_update.Start( this->image_size, expected_hash, &version );
+    }
+
+    buffer[0] = ( uint8_t ) status;
+    buffer[1] = version.hw;
+    buffer[2] = version.type;
+    buffer[3] = ( uint8_t )( ( version.fw & 0x00FF ) >> 0 );
+    buffer[4] = ( uint8_t )( ( version.fw & 0xFF00 ) >> 8 );
+
+    this->hci.SendResponse( this->GetComCode( ), buffer, COMMAND_FIRMWARE_UPDATE_START_RESPONSE_LENGTH );
+
+    return COMMAND_NO_EVENT;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file      command_get_random.cpp
+ *
+ * @brief     Implementation of the command getting random bytes.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_get_random.h"
+#include "com_code.h"
+
+#define COMMAND_GET_RANDOM_NB_BYTES_MAX ( 255 )
+
+CommandGetRandom::CommandGetRandom( Hci& hci, EntropyPool& entropy_pool )
+    : hci( hci ), entropy_pool( entropy_pool ), nb_bytes( 0 )
+{
+}
+
+CommandGetRandom::~CommandGetRandom( ) {}
+
+uint16_t CommandGetRandom::GetComCode( ) { return COM_CODE_GET_RANDOM; }
+
+bool CommandGetRandom::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    if( ( buffer_size != 1 ) || ( buffer[0] == 0 ) )
+    {
+        return false;
+    }
+
+    this->nb_bytes = buffer[0];
+    return true;
+}
+
+CommandEvent_t CommandGetRandom::Execute( )
+{
+    uint8_t buffer[1 + COMMAND_GET_RANDOM_NB_BYTES_MAX] = { 0 };
+
+    if( this->entropy_pool.GetRandomBytes( buffer + 1, this->nb_bytes ) == false )
+    {
+        this->hci.SendResponse( this->GetComCode( ), ( uint8_t ) 0 );
+        return COMMAND_NO_EVENT;
+    }
+
+    buffer[0] = 1;
+    this->hci.SendResponse( this->GetComCode( ), buffer, 1 + this->nb_bytes );
+
+    // Do not leave the random bytes on the stack
+    EntropyPool::Wipe( buffer, sizeof( buffer ) );
+
+    return COMMAND_NO_EVENT;
+}
@@ -50,19 +50,26 @@ bool CommandSetDateLoc::ConfigureFromPayload( const uint8_t* buffer, const uint1
     int32_t                longitude             = 0;
     int32_t                latitude              = 0;
     int32_t                altitude              = 0;
-    if( buffer_size == 16 )
+    uint32_t               uncertainty_m         = 0;
+    if( ( buffer_size == 16 ) || ( buffer_size == 20 ) )
     {
         gnss_time = buffer[0] | ( buffer[1] << 8 ) | ( buffer[2] << 16 ) | ( buffer[3] << 24 );
         longitude = buffer[4] | ( buffer[5] << 8 ) | ( buffer[6] << 16 ) | ( buffer[7] << 24 );
         latitude  = buffer[8] | ( buffer[9] << 8 ) | ( buffer[10] << 16 ) | ( buffer[11] << 24 );
         altitude  = buffer[12] | ( buffer[13] << 8 ) | ( buffer[14] << 16 ) | ( buffer[15] << 24 );
 
+        // The uncertainty is optional, the default one of a manual position is used otherwise
+        if( buffer_size == 20 )
+        {
+            uncertainty_m = buffer[16] | ( buffer[17] << 8 ) | ( buffer[18] << 16 ) | ( buffer[19] << 24 );
+        }
+
         gnss_position.altitude  = ( float ) altitude / 1000.0f;
         gnss_position.latitude  = ( float ) latitude / 1000.0f;
         gnss_position.longitude = ( float ) longitude / 1000.0f;
 
         this->environment.SetTimeFromGpsEpoch( gnss_time );
-        this->environment.SetLocation( gnss_position );
+        this->environment.SetLocation( gnss_position, DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_MANUAL, uncertainty_m );
         configuration_success = true;
     }
     else
@@ -31,17 +31,22 @@
 
 #include "command_start_demo.h"
 #include "com_code.h"
+#include "lr1110_radio.h"
+
+static uint32_t command_start_demo_get_uint32( const uint8_t* buffer );
 
 CommandStartDemo::CommandStartDemo( DeviceBase* device, Hci& hci, Demo& demo_holder )
     : CommandBase( device, hci ), demo_id_to_start( COMMAND_BASE_NO_DEMO ), demo_holder( demo_holder )
 {
-    this->demo_settings.wifi_settings.channels     = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
-    this->demo_settings.wifi_settings.types        = DEMO_WIFI_TYPE_SCAN_DEFAULT;
-    this->demo_settings.wifi_settings.scan_mode    = DEMO_WIFI_MODE_DEFAULT;
-    this->demo_settings.wifi_settings.nbr_retrials = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
-    this->demo_settings.wifi_settings.max_results  = DEMO_WIFI_MAX_RESULTS_DEFAULT;
-    this->demo_settings.wifi_settings.timeout      = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
-    this->demo_settings.wifi_settings.result_type  = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_settings.wifi_settings.channels       = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
+    this->demo_settings.wifi_settings.types          = DEMO_WIFI_TYPE_SCAN_DEFAULT;
+    this->demo_settings.wifi_settings.scan_mode      = DEMO_WIFI_MODE_DEFAULT;
+    this->demo_settings.wifi_settings.nbr_retrials   = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
+    this->demo_settings.wifi_settings.max_results    = DEMO_WIFI_MAX_RESULTS_DEFAULT;
+    this->demo_settings.wifi_settings.timeout        = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
+    this->demo_settings.wifi_settings.result_type    = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_settings.wifi_settings.is_adaptive    = DEMO_WIFI_IS_ADAPTIVE_DEFAULT;
+    this->demo_settings.wifi_settings.time_budget_ms = DEMO_WIFI_TIME_BUDGET_IN_MS_DEFAULT;
 
     this->demo_settings.gnss_autonomous_settings.option        = DEMO_GNSS_AUTONOMOUS_OPTION_DEFAULT;
     this->demo_settings.gnss_autonomous_settings.capture_mode  = DEMO_GNSS_AUTONOMOUS_CAPTURE_MODE_DEFAULT;
@@ -50,6 +55,33 @@ CommandStartDemo::CommandStartDemo( DeviceBase* device, Hci& hci, Demo& demo_hol
     this->demo_settings.gnss_assisted_settings.option        = DEMO_GNSS_ASSISTED_OPTION_DEFAULT;
     this->demo_settings.gnss_assisted_settings.capture_mode  = DEMO_GNSS_ASSISTED_CAPTURE_MODE_DEFAULT;
     this->demo_settings.gnss_assisted_settings.nb_satellites = DEMO_GNSS_ASSISTED_N_SATELLLITE_DEFAULT;
+
+    this->demo_settings.gnss_scheduler_settings.scan_type  = DEMO_GNSS_SCHEDULER_SCAN_TYPE_DEFAULT;
+    this->demo_settings.gnss_scheduler_settings.interval_s = DEMO_GNSS_SCHEDULER_INTERVAL_S_DEFAULT;
+
+    this->demo_settings.radio_spectrum_settings.start_frequency_hz = DEMO_RADIO_SPECTRUM_START_FREQUENCY_DEFAULT;
+    this->demo_settings.radio_spectrum_settings.stop_frequency_hz  = DEMO_RADIO_SPECTRUM_STOP_FREQUENCY_DEFAULT;
+    this->demo_settings.radio_spectrum_settings.step_hz            = DEMO_RADIO_SPECTRUM_STEP_DEFAULT;
+    this->demo_settings.radio_spectrum_settings.nb_samples         = DEMO_RADIO_SPECTRUM_NB_SAMPLES_DEFAULT;
+    this->demo_settings.radio_spectrum_settings.nb_sweeps          = DEMO_RADIO_SPECTRUM_NB_SWEEPS_DEFAULT;
+
+    this->demo_settings.radio_cad_settings.sf_mask            = DEMO_RADIO_CAD_SF_MASK_DEFAULT;
+    this->demo_settings.radio_cad_settings.bw                 = DEMO_RADIO_CAD_BW_DEFAULT;
+    this->demo_settings.radio_cad_settings.start_frequency_hz = DEMO_RADIO_CAD_START_FREQUENCY_DEFAULT;
+    this->demo_settings.radio_cad_settings.channel_spacing_hz = DEMO_RADIO_CAD_CHANNEL_SPACING_DEFAULT;
+    this->demo_settings.radio_cad_settings.nb_channels        = DEMO_RADIO_CAD_NB_CHANNELS_DEFAULT;
+    this->demo_settings.radio_cad_settings.period_ms          = DEMO_RADIO_CAD_PERIOD_MS_DEFAULT;
+    this->demo_settings.radio_cad_settings.cad_symb_nb        = DEMO_RADIO_CAD_SYMB_NB_DEFAULT;
+    this->demo_settings.radio_cad_settings.cad_detect_peak    = DEMO_RADIO_CAD_DETECT_PEAK_DEFAULT;
+    this->demo_settings.radio_cad_settings.cad_detect_min     = DEMO_RADIO_CAD_DETECT_MIN_DEFAULT;
+    this->demo_settings.radio_cad_settings.nb_cads            = DEMO_RADIO_CAD_NB_CADS_DEFAULT;
+
+    this->demo_settings.radio_per_rx_settings.rx_period_ms    = DEMO_RADIO_PER_RX_PERIOD_MS_DEFAULT;
+    this->demo_settings.radio_per_rx_settings.sleep_period_ms = DEMO_RADIO_PER_SLEEP_PERIOD_MS_DEFAULT;
+
+    this->demo_settings.ping_pong_settings.timing              = DEMO_PING_PONG_TIMING_DEFAULT;
+    this->demo_settings.ping_pong_settings.turnaround_delay_ms = DEMO_PING_PONG_TURNAROUND_DELAY_MS_DEFAULT;
+    this->demo_settings.ping_pong_settings.guard_delay_ms      = DEMO_PING_PONG_GUARD_DELAY_MS_DEFAULT;
 }
 
 CommandStartDemo::~CommandStartDemo( ) {}
@@ -93,6 +125,36 @@ bool CommandStartDemo::ConfigureFromPayload( const uint8_t* buffer, const uint16
         break;
     }
 
+    case COMMAND_BASE_DEMO_GNSS_SCHEDULER:
+    {
+        success = this->ConfigureGnssScheduler( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_SPECTRUM:
+    {
+        success = this->ConfigureRadioSpectrum( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_CAD:
+    {
+        success = this->ConfigureRadioCad( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_PER_RX:
+    {
+        success = this->ConfigureRadioPerRx( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_PING_PONG:
+    {
+        success = this->ConfigureRadioPingPong( config_buffer, config_buffer_size );
+        break;
+    }
+
     default:
     {
         success = false;
@@ -113,7 +175,7 @@ bool CommandStartDemo::ConfigureFromPayload( const uint8_t* buffer, const uint16
 bool CommandStartDemo::ConfigureWifiScan( const uint8_t* buffer, const uint16_t buffer_size )
 {
     bool success = false;
-    if( buffer_size == 8 )
+    if( ( buffer_size == 8 ) || ( buffer_size == 11 ) )
     {
         const uint16_t           wifi_channel_mask = buffer[0] + buffer[1] * 256;
         const uint8_t            wifi_type_mask    = buffer[2];
@@ -122,14 +184,25 @@ bool CommandStartDemo::ConfigureWifiScan( const uint8_t* buffer, const uint16_t
         const uint16_t           wifi_timeout_ms   = buffer[5] + ( buffer[6] * 256 );
         const lr1110_wifi_mode_t wifi_mode         = ( lr1110_wifi_mode_t ) buffer[7];
 
-        this->demo_settings.wifi_settings.channels     = ( lr1110_wifi_channel_mask_t ) wifi_channel_mask;
-        this->demo_settings.wifi_settings.types        = ( lr1110_wifi_signal_type_scan_t ) wifi_type_mask;
-        this->demo_settings.wifi_settings.scan_mode    = wifi_mode;
-        this->demo_settings.wifi_settings.nbr_retrials = wifi_nbr_retrials;
-        this->demo_settings.wifi_settings.max_results  = wifi_max_results;
-        this->demo_settings.wifi_settings.timeout      = wifi_timeout_ms;
-        this->demo_settings.wifi_settings.result_type  = DEMO_WIFI_RESULT_TYPE_DEFAULT;
-        success                                        = true;
+        // Adaptive scan settings are optional to stay compatible with hosts sending the 8-byte payload
+        bool     wifi_is_adaptive    = DEMO_WIFI_IS_ADAPTIVE_DEFAULT;
+        uint16_t wifi_time_budget_ms = DEMO_WIFI_TIME_BUDGET_IN_MS_DEFAULT;
+        if( buffer_size == 11 )
+        {
+            wifi_is_adaptive    = ( buffer[8] != 0 );
+            wifi_time_budget_ms = buffer[9] + ( buffer[10] * 256 );
+        }
+
+        this->demo_settings.wifi_settings.channels       = ( lr1110_wifi_channel_mask_t ) wifi_channel_mask;
+        this->demo_settings.wifi_settings.types          = ( lr1110_wifi_signal_type_scan_t ) wifi_type_mask;
+        this->demo_settings.wifi_settings.scan_mode      = wifi_mode;
+        this->demo_settings.wifi_settings.nbr_retrials   = wifi_nbr_retrials;
+        this->demo_settings.wifi_settings.max_results    = wifi_max_results;
+        this->demo_settings.wifi_settings.timeout        = wifi_timeout_ms;
+        this->demo_settings.wifi_settings.result_type    = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+        this->demo_settings.wifi_settings.is_adaptive    = wifi_is_adaptive;
+        this->demo_settings.wifi_settings.time_budget_ms = wifi_time_budget_ms;
+        success                                          = true;
     }
     else
     {
@@ -173,11 +246,49 @@ bool CommandStartDemo::ConfigureGnssAssisted( const uint8_t* buffer, const uint1
     return success;
 }
 
+bool CommandStartDemo::ConfigureGnssScheduler( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size > 3 )
+    {
+        const uint8_t  scan_type  = buffer[0];
+        const uint16_t interval_s = buffer[1] + ( buffer[2] * 256 );
+
+        this->demo_settings.gnss_scheduler_settings.interval_s = interval_s;
+
+        switch( scan_type )
+        {
+        case DEMO_GNSS_SCHEDULER_SCAN_AUTONOMOUS:
+        {
+            this->demo_settings.gnss_scheduler_settings.scan_type = DEMO_GNSS_SCHEDULER_SCAN_AUTONOMOUS;
+            success = this->ConfigureGnss( &this->demo_settings.gnss_autonomous_settings, buffer + 3, buffer_size - 3 );
+            break;
+        }
+        case DEMO_GNSS_SCHEDULER_SCAN_ASSISTED:
+        {
+            this->demo_settings.gnss_scheduler_settings.scan_type = DEMO_GNSS_SCHEDULER_SCAN_ASSISTED;
+            success = this->ConfigureGnss( &this->demo_settings.gnss_assisted_settings, buffer + 3, buffer_size - 3 );
+            break;
+        }
+        default:
+            success = false;
+        }
+
+        // A null interval would re-arm the scans without any pause
+        success &= ( interval_s != 0 );
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
 bool CommandStartDemo::ConfigureGnss( demo_gnss_settings_t* gnss_setting, const uint8_t* buffer,
                                       const uint16_t buffer_size )
 {
     bool success = true;  // Keep it init to true as the implementation sets it to false as soon as a parameter fails
-    if( buffer_size == 5 )
+    if( ( buffer_size == 5 ) || ( buffer_size == 8 ) )
     {
         const uint8_t gnss_option             = buffer[0];
         const uint8_t gnss_capture_mode       = buffer[1];
@@ -214,6 +325,114 @@ bool CommandStartDemo::ConfigureGnss( demo_gnss_settings_t* gnss_setting, const
         gnss_setting->nb_satellites      = gnss_nb_satellite;
         gnss_setting->antenna_selection  = ( demo_gnss_antenna_selection_t ) gnss_antenna_selection;
         gnss_setting->constellation_mask = gnss_constellation_mask;
+
+        // The thresholds of the second scan decision are optional, the defaults are used otherwise
+        if( buffer_size == 8 )
+        {
+            gnss_setting->dual_scan_skip_nb_sv = buffer[5];
+            gnss_setting->dual_scan_cnr_min    = ( int8_t ) buffer[6];
+            gnss_setting->dual_scan_min_sv     = buffer[7];
+        }
+        else
+        {
+            gnss_setting->dual_scan_skip_nb_sv = DEMO_GNSS_DUAL_SCAN_SKIP_NB_SV_DEFAULT;
+            gnss_setting->dual_scan_cnr_min    = DEMO_GNSS_DUAL_SCAN_CNR_MIN_DEFAULT;
+            gnss_setting->dual_scan_min_sv     = DEMO_GNSS_DUAL_SCAN_MIN_SV_DEFAULT;
+        }
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureRadioSpectrum( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 15 )
+    {
+        demo_radio_spectrum_settings_t* spectrum_settings = &this->demo_settings.radio_spectrum_settings;
+
+        spectrum_settings->start_frequency_hz = command_start_demo_get_uint32( buffer );
+        spectrum_settings->stop_frequency_hz  = command_start_demo_get_uint32( buffer + 4 );
+        spectrum_settings->step_hz            = command_start_demo_get_uint32( buffer + 8 );
+        spectrum_settings->nb_samples         = buffer[12];
+        spectrum_settings->nb_sweeps          = buffer[13] + ( buffer[14] * 256 );
+
+        success = ( DemoRadioSpectrum::GetNbBins( *spectrum_settings ) != 0 ) && ( spectrum_settings->nb_samples != 0 );
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureRadioCad( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 20 )
+    {
+        demo_radio_cad_settings_t* cad_settings = &this->demo_settings.radio_cad_settings;
+
+        cad_settings->sf_mask            = buffer[0];
+        cad_settings->bw                 = ( lr1110_radio_lora_bw_t ) buffer[1];
+        cad_settings->start_frequency_hz = command_start_demo_get_uint32( buffer + 2 );
+        cad_settings->channel_spacing_hz = command_start_demo_get_uint32( buffer + 6 );
+        cad_settings->nb_channels        = buffer[10];
+        cad_settings->period_ms          = buffer[11] + ( buffer[12] * 256 );
+        cad_settings->cad_symb_nb        = buffer[13];
+        cad_settings->cad_detect_peak    = buffer[14];
+        cad_settings->cad_detect_min     = buffer[15];
+        cad_settings->nb_cads            = command_start_demo_get_uint32( buffer + 16 );
+
+        // The LR1110 listens to 1, 2, 4, 8 or 16 symbols
+        const bool is_cad_symb_nb_valid = ( cad_settings->cad_symb_nb != 0 ) && ( cad_settings->cad_symb_nb <= 16 ) &&
+                                          ( ( cad_settings->cad_symb_nb & ( cad_settings->cad_symb_nb - 1 ) ) == 0 );
+
+        success = ( DemoRadioCad::GetNbCombinations( *cad_settings ) != 0 ) && is_cad_symb_nb_valid &&
+                  ( lr1110_radio_get_lora_bw_in_hz( cad_settings->bw ) != 0 );
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureRadioPerRx( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 8 )
+    {
+        demo_radio_per_rx_settings_t* per_rx_settings = &this->demo_settings.radio_per_rx_settings;
+
+        per_rx_settings->rx_period_ms    = command_start_demo_get_uint32( buffer );
+        per_rx_settings->sleep_period_ms = command_start_demo_get_uint32( buffer + 4 );
+
+        success = DemoRadioPer::IsRxDutyCycleValid( *per_rx_settings );
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureRadioPingPong( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 5 )
+    {
+        demo_ping_pong_settings_t* ping_pong_settings = &this->demo_settings.ping_pong_settings;
+
+        ping_pong_settings->timing              = ( demo_ping_pong_timing_t ) buffer[0];
+        ping_pong_settings->turnaround_delay_ms = buffer[1] + ( buffer[2] << 8 );
+        ping_pong_settings->guard_delay_ms      = buffer[3] + ( buffer[4] << 8 );
+
+        success = ( ping_pong_settings->timing == DEMO_PING_PONG_TIMING_FIRMWARE ) ||
+                  ( ping_pong_settings->timing == DEMO_PING_PONG_TIMING_HARDWARE );
     }
     else
     {
@@ -249,7 +468,50 @@ bool CommandStartDemo::Job( )
         this->demo_holder.UpdateConfigAssistedGnss( &this->demo_settings.gnss_assisted_settings );
         break;
     }
+
+    case COMMAND_BASE_DEMO_GNSS_SCHEDULER:
+    {
+        this->demo_holder.UpdateConfigGnssScheduler( &this->demo_settings.gnss_scheduler_settings );
+        if( this->demo_settings.gnss_scheduler_settings.scan_type == DEMO_GNSS_SCHEDULER_SCAN_ASSISTED )
+        {
+            this->demo_holder.UpdateConfigAssistedGnss( &this->demo_settings.gnss_assisted_settings );
+        }
+        else
+        {
+            this->demo_holder.UpdateConfigAutonomousGnss( &this->demo_settings.gnss_autonomous_settings );
+        }
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_SPECTRUM:
+    {
+        this->demo_holder.UpdateConfigRadioSpectrum( &this->demo_settings.radio_spectrum_settings );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_CAD:
+    {
+        this->demo_holder.UpdateConfigRadioCad( &this->demo_settings.radio_cad_settings );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_PER_RX:
+    {
+        this->demo_holder.UpdateConfigRadioPerRx( &this->demo_settings.radio_per_rx_settings );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RADIO_PING_PONG:
+    {
+        this->demo_holder.UpdateConfigPingPong( &this->demo_settings.ping_pong_settings );
+        break;
+    }
     }
     this->SetEventStartDemo( this->demo_id_to_start );
     return true;
+}
+
+static uint32_t command_start_demo_get_uint32( const uint8_t* buffer )
+{
+    return buffer[0] + ( buffer[1] << 8 ) + ( buffer[2] << 16 ) + ( ( uint32_t ) buffer[3] << 24 );
 }
\ No newline at end of file
@@ -38,6 +38,10 @@
 #define LENGTH_SIZE 2
 #define LIMIT_OPERAND_RECEIVE_S ( 1 )
 
+// The UART serves a single HCI, the frame buffers are kept off the stack of main
+uint8_t Hci::buffer[MAX_RECEPTION_BUFFER];
+uint8_t Hci::buffer_tx[MAX_TRANSMITION_BUFFER];
+
 Hci::Hci( CommandFactory& factory, const EnvironmentInterface& environment )
     : can_run( false ),
       state( HCI_STATE_INIT ),
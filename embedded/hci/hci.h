@@ -37,7 +37,7 @@
 #include "environment_interface.h"
 #include <stdint.h>
 
-#define MAX_RECEPTION_BUFFER 64
+#define MAX_RECEPTION_BUFFER 512
 #define MAX_TRANSMITION_BUFFER 512
 
 typedef enum
@@ -93,9 +93,9 @@ class Hci
     uint16_t                    count_error;
     CommandInterface*           last_command_received;
     CommandFactory*             command_factory;
-    uint8_t                     buffer[MAX_RECEPTION_BUFFER];
+    static uint8_t              buffer[MAX_RECEPTION_BUFFER];
     uint16_t                    buffer_length;
-    uint8_t                     buffer_tx[MAX_TRANSMITION_BUFFER];
+    static uint8_t              buffer_tx[MAX_TRANSMITION_BUFFER];
     const EnvironmentInterface& environment;
     volatile time_t             operand_start_time;
 };
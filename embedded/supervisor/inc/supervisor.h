@@ -38,12 +38,13 @@
 #include "communication_manager.h"
 #include "configuration.h"
 #include "demo.h"
+#include "telemetry_sampler.h"
 
 class Supervisor
 {
    public:
     Supervisor( Gui* gui, DeviceBase* device, Demo* demo, EnvironmentInterface* environment,
-                CommunicationManager* communication_manager );
+                CommunicationManager* communication_manager, const TelemetrySampler* telemetry_sampler );
     virtual ~Supervisor( );
 
     void Init( );
@@ -63,6 +64,15 @@ class Supervisor
     void TransferResultToGui( const demo_gnss_all_results_t* result );
     void TransferResultToGui( const demo_ping_pong_results_t* result );
     void TransferResultToGui( const demo_radio_per_results_t* result );
+    void TransferResultToGui( const demo_radio_spectrum_results_t* result );
+
+    void TransfertDemoResultsToHost( );
+
+    /*!
+     * \brief Attach the latest telemetry sample to the results of the Wi-Fi and GNSS scans
+     */
+    void AttachTelemetryToDemoResults( );
+    void TransferTelemetryToGui( );
 
     void TransferResultToSerial( const demo_wifi_scan_all_results_t* result );
     void TransferResultToSerial( const demo_gnss_all_results_t* result );
@@ -93,7 +103,9 @@ class Supervisor
     DeviceBase*           device;
     version_handler_t     version_handler;
 
-    CommunicationManager* communication_manager;
+    CommunicationManager*   communication_manager;
+    const TelemetrySampler* telemetry_sampler;
+    uint32_t                nb_telemetry_samples_in_gui;
 };
 
 #endif  // __SUPERVISOR_H__
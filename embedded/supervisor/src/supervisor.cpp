@@ -46,13 +46,15 @@ extern void SupervisorInterruptHandlerDemo( void ) { Supervisor::InterruptHandle
 bool Supervisor::is_interrupt_raised = false;
 
 Supervisor::Supervisor( Gui* gui, DeviceBase* device, Demo* demo, EnvironmentInterface* environment,
-                        CommunicationManager* communication_manager )
+                        CommunicationManager* communication_manager, const TelemetrySampler* telemetry_sampler )
     : run_demo( false ),
       demo( demo ),
       gui( gui ),
       environment( environment ),
       device( device ),
-      communication_manager( communication_manager )
+      communication_manager( communication_manager ),
+      telemetry_sampler( telemetry_sampler ),
+      nb_telemetry_samples_in_gui( 0 )
 {
     version_handler.almanac_crc       = 0;
     version_handler.almanac_date      = 0;
@@ -93,17 +95,15 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
     // Wi-Fi
     gui_demo_settings->wifi_settings.channel_mask = demo_settings->wifi_settings.channels;
 
-    gui_demo_settings->wifi_settings.is_type_b =
-        ( demo_settings->wifi_settings.types == LR1110_WIFI_TYPE_SCAN_B ) ? true : false;
+    // An unknown type leaves every type button released rather than being shown as type B
+    uint8_t wifi_type_index = DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_wifi_type_table );
+    demo_configuration_find_index( demo_configuration_wifi_type_table, demo_settings->wifi_settings.types,
+                                   &wifi_type_index );
 
-    gui_demo_settings->wifi_settings.is_type_g =
-        ( demo_settings->wifi_settings.types == LR1110_WIFI_TYPE_SCAN_G ) ? true : false;
-
-    gui_demo_settings->wifi_settings.is_type_n =
-        ( demo_settings->wifi_settings.types == LR1110_WIFI_TYPE_SCAN_N ) ? true : false;
-
-    gui_demo_settings->wifi_settings.is_type_all =
-        ( demo_settings->wifi_settings.types == LR1110_WIFI_TYPE_SCAN_B_G_N ) ? true : false;
+    gui_demo_settings->wifi_settings.is_type_b   = ( wifi_type_index == 0 ) ? true : false;
+    gui_demo_settings->wifi_settings.is_type_g   = ( wifi_type_index == 1 ) ? true : false;
+    gui_demo_settings->wifi_settings.is_type_n   = ( wifi_type_index == 2 ) ? true : false;
+    gui_demo_settings->wifi_settings.is_type_all = ( wifi_type_index == 3 ) ? true : false;
 
     // GNSS autonomous
     gui_demo_settings->gnss_autonomous_settings.is_beidou_enabled =
@@ -135,11 +135,12 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
     // Radio
     gui_demo_settings->radio_settings.rf_freq_in_hz = demo_settings->radio_settings.rf_frequency;
 
-    gui_demo_settings->radio_settings.pwr_in_dbm = demo_settings->radio_settings.tx_power;
+    gui_demo_settings->radio_settings.pwr_in_dbm = demo_configuration_get_pa_pwr_in_dbm(
+        &demo_settings->radio_settings.pa_configuration, demo_settings->radio_settings.tx_power );
 
     gui_demo_settings->radio_settings.nb_of_packets = demo_settings->radio_settings.nb_of_packets;
 
-    gui_demo_settings->radio_settings.payload_length = demo_settings->radio_settings.nb_of_packets;
+    gui_demo_settings->radio_settings.payload_length = demo_settings->radio_settings.payload_length;
 
     gui_demo_settings->radio_settings.is_lora =
         ( demo_settings->radio_settings.pkt_type == LR1110_RADIO_PKT_TYPE_LORA ) ? true : false;
@@ -147,40 +148,17 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
     gui_demo_settings->radio_settings.is_hp_pa_enabled =
         ( demo_settings->radio_settings.pa_configuration.pa_sel == LR1110_RADIO_PA_SEL_HP ) ? true : false;
 
-    gui_demo_settings->radio_settings.lora.sf = demo_settings->radio_settings.modulation_lora.sf - 5;
+    demo_configuration_find_index( demo_configuration_lora_sf_table,
+                                   demo_settings->radio_settings.modulation_lora.sf,
+                                   &gui_demo_settings->radio_settings.lora.sf );
 
-    switch( demo_settings->radio_settings.modulation_lora.bw )
-    {
-    case LR1110_RADIO_LORA_BW_125:
-        gui_demo_settings->radio_settings.lora.bw = 0;
-        break;
-    case LR1110_RADIO_LORA_BW_250:
-        gui_demo_settings->radio_settings.lora.bw = 1;
-        break;
-    case LR1110_RADIO_LORA_BW_500:
-        gui_demo_settings->radio_settings.lora.bw = 2;
-        break;
-    default:
-        gui_demo_settings->radio_settings.lora.bw = 0;
-    }
+    demo_configuration_find_index( demo_configuration_lora_bw_table,
+                                   demo_settings->radio_settings.modulation_lora.bw,
+                                   &gui_demo_settings->radio_settings.lora.bw );
 
-    switch( demo_settings->radio_settings.modulation_lora.cr )
-    {
-    case LR1110_RADIO_LORA_CR_4_5:
-        gui_demo_settings->radio_settings.lora.cr = 0;
-        break;
-    case LR1110_RADIO_LORA_CR_4_6:
-        gui_demo_settings->radio_settings.lora.cr = 1;
-        break;
-    case LR1110_RADIO_LORA_CR_4_7:
-        gui_demo_settings->radio_settings.lora.cr = 2;
-        break;
-    case LR1110_RADIO_LORA_CR_4_8:
-        gui_demo_settings->radio_settings.lora.cr = 3;
-        break;
-    default:
-        gui_demo_settings->radio_settings.lora.cr = 0;
-    }
+    demo_configuration_find_index( demo_configuration_lora_cr_table,
+                                   demo_settings->radio_settings.modulation_lora.cr,
+                                   &gui_demo_settings->radio_settings.lora.cr );
 
     switch( demo_settings->radio_settings.packet_lora.iq )
     {
@@ -208,7 +186,7 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
         gui_demo_settings->radio_settings.lora.is_hdr_implicit = false;
         break;
     case LR1110_RADIO_LORA_PKT_IMPLICIT:
-        gui_demo_settings->radio_settings.lora.is_crc_activated = true;
+        gui_demo_settings->radio_settings.lora.is_hdr_implicit = true;
         break;
     }
 
@@ -216,24 +194,9 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
 
     gui_demo_settings->radio_settings.gfsk.fdev_in_hz = demo_settings->radio_settings.modulation_gfsk.fdev_in_hz;
 
-    switch( demo_settings->radio_settings.packet_gfsk.crc_type )
-    {
-    case LR1110_RADIO_GFSK_CRC_OFF:
-        gui_demo_settings->radio_settings.gfsk.crc = 0;
-        break;
-    case LR1110_RADIO_GFSK_CRC_1_BYTE:
-        gui_demo_settings->radio_settings.gfsk.crc = 1;
-        break;
-    case LR1110_RADIO_GFSK_CRC_2_BYTES:
-        gui_demo_settings->radio_settings.gfsk.crc = 2;
-        break;
-    case LR1110_RADIO_GFSK_CRC_1_BYTE_INV:
-        gui_demo_settings->radio_settings.gfsk.crc = 3;
-        break;
-    case LR1110_RADIO_GFSK_CRC_2_BYTES_INV:
-        gui_demo_settings->radio_settings.gfsk.crc = 4;
-        break;
-    }
+    demo_configuration_find_index( demo_configuration_gfsk_crc_table,
+                                   demo_settings->radio_settings.packet_gfsk.crc_type,
+                                   &gui_demo_settings->radio_settings.gfsk.crc );
 
     switch( demo_settings->radio_settings.packet_gfsk.dc_free )
     {
@@ -269,87 +232,22 @@ void Supervisor::ConvertSettingsFromGuiToDemo( const GuiRadioSetting_t* gui_sett
     demo_settings->pa_configuration.pa_sel =
         ( gui_settings->is_hp_pa_enabled == true ) ? LR1110_RADIO_PA_SEL_HP : LR1110_RADIO_PA_SEL_LP;
 
-    switch( gui_settings->pwr_in_dbm )
-    {
-    case 10:
-        demo_settings->tx_power                       = 14;
-        demo_settings->pa_configuration.pa_duty_cycle = 0;
-        demo_settings->pa_configuration.pa_hp_sel     = 0;
-        demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_DCDC;
-        break;
-    case 14:
-        if( demo_settings->pa_configuration.pa_sel == LR1110_RADIO_PA_SEL_LP )
-        {
-            demo_settings->tx_power                       = 14;
-            demo_settings->pa_configuration.pa_duty_cycle = 4;
-            demo_settings->pa_configuration.pa_hp_sel     = 0;
-            demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_DCDC;
-        }
-        else
-        {
-            demo_settings->tx_power                       = 22;
-            demo_settings->pa_configuration.pa_duty_cycle = 2;
-            demo_settings->pa_configuration.pa_hp_sel     = 2;
-            demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_VBAT;
-        }
-        break;
-    case 15:
-        demo_settings->tx_power                       = 14;
-        demo_settings->pa_configuration.pa_duty_cycle = 7;
-        demo_settings->pa_configuration.pa_hp_sel     = 0;
-        demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_DCDC;
-        break;
-    case 17:
-        demo_settings->tx_power                       = 22;
-        demo_settings->pa_configuration.pa_duty_cycle = 1;
-        demo_settings->pa_configuration.pa_hp_sel     = 5;
-        demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_VBAT;
-        break;
-    case 20:
-        demo_settings->tx_power                       = 22;
-        demo_settings->pa_configuration.pa_duty_cycle = 2;
-        demo_settings->pa_configuration.pa_hp_sel     = 7;
-        demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_VBAT;
-        break;
-    case 22:
-        demo_settings->tx_power                       = 22;
-        demo_settings->pa_configuration.pa_duty_cycle = 4;
-        demo_settings->pa_configuration.pa_hp_sel     = 7;
-        demo_settings->pa_configuration.pa_reg_supply = LR1110_RADIO_PA_REG_SUPPLY_VBAT;
-    }
+    const demo_configuration_pa_setting_t* pa_setting =
+        demo_configuration_get_pa_setting( demo_settings->pa_configuration.pa_sel, gui_settings->pwr_in_dbm );
 
-    demo_settings->modulation_lora.sf = ( lr1110_radio_lora_sf_t )( gui_settings->lora.sf + 5 );
+    demo_settings->tx_power                       = pa_setting->tx_power;
+    demo_settings->pa_configuration.pa_duty_cycle = pa_setting->pa_duty_cycle;
+    demo_settings->pa_configuration.pa_hp_sel     = pa_setting->pa_hp_sel;
+    demo_settings->pa_configuration.pa_reg_supply = pa_setting->pa_reg_supply;
 
-    switch( gui_settings->lora.bw )
-    {
-    case 0:
-        demo_settings->modulation_lora.bw = LR1110_RADIO_LORA_BW_125;
-        break;
-    case 1:
-        demo_settings->modulation_lora.bw = LR1110_RADIO_LORA_BW_250;
-        break;
-    case 2:
-        demo_settings->modulation_lora.bw = LR1110_RADIO_LORA_BW_500;
-        break;
-    default:
-        demo_settings->modulation_lora.bw = LR1110_RADIO_LORA_BW_125;
-    }
+    demo_settings->modulation_lora.sf =
+        demo_configuration_get_value( demo_configuration_lora_sf_table, gui_settings->lora.sf );
 
-    switch( gui_settings->lora.cr )
-    {
-    case 0:
-        demo_settings->modulation_lora.cr = LR1110_RADIO_LORA_CR_4_5;
-        break;
-    case 1:
-        demo_settings->modulation_lora.cr = LR1110_RADIO_LORA_CR_4_6;
-        break;
-    case 2:
-        demo_settings->modulation_lora.cr = LR1110_RADIO_LORA_CR_4_7;
-        break;
-    case 3:
-        demo_settings->modulation_lora.cr = LR1110_RADIO_LORA_CR_4_8;
-        break;
-    }
+    demo_settings->modulation_lora.bw =
+        demo_configuration_get_value( demo_configuration_lora_bw_table, gui_settings->lora.bw );
+
+    demo_settings->modulation_lora.cr =
+        demo_configuration_get_value( demo_configuration_lora_cr_table, gui_settings->lora.cr );
 
     demo_settings->packet_lora.iq =
         ( gui_settings->lora.is_iq_inverted == false ) ? LR1110_RADIO_LORA_IQ_STANDARD : LR1110_RADIO_LORA_IQ_INVERTED;
@@ -365,24 +263,8 @@ void Supervisor::ConvertSettingsFromGuiToDemo( const GuiRadioSetting_t* gui_sett
 
     demo_settings->modulation_gfsk.fdev_in_hz = gui_settings->gfsk.fdev_in_hz;
 
-    switch( gui_settings->gfsk.crc )
-    {
-    case 0:
-        demo_settings->packet_gfsk.crc_type = LR1110_RADIO_GFSK_CRC_OFF;
-        break;
-    case 1:
-        demo_settings->packet_gfsk.crc_type = LR1110_RADIO_GFSK_CRC_1_BYTE;
-        break;
-    case 2:
-        demo_settings->packet_gfsk.crc_type = LR1110_RADIO_GFSK_CRC_2_BYTES;
-        break;
-    case 3:
-        demo_settings->packet_gfsk.crc_type = LR1110_RADIO_GFSK_CRC_1_BYTE_INV;
-        break;
-    case 4:
-        demo_settings->packet_gfsk.crc_type = LR1110_RADIO_GFSK_CRC_2_BYTES_INV;
-        break;
-    }
+    demo_settings->packet_gfsk.crc_type =
+        demo_configuration_get_value( demo_configuration_gfsk_crc_table, gui_settings->gfsk.crc );
 
     demo_settings->packet_gfsk.dc_free = ( gui_settings->gfsk.is_dcfree_enabled == false )
                                              ? LR1110_RADIO_GFSK_DC_FREE_OFF
@@ -397,21 +279,19 @@ void Supervisor::ConvertSettingsFromGuiToDemo( const GuiWifiDemoSetting_t* gui_s
 {
     demo_settings->channels = gui_settings->channel_mask;
 
-    if( gui_settings->is_type_b == true )
-    {
-        demo_settings->types = LR1110_WIFI_TYPE_SCAN_B;
-    }
-    else if( gui_settings->is_type_g == true )
-    {
-        demo_settings->types = LR1110_WIFI_TYPE_SCAN_G;
-    }
-    else if( gui_settings->is_type_n == true )
-    {
-        demo_settings->types = LR1110_WIFI_TYPE_SCAN_N;
-    }
-    else if( gui_settings->is_type_all == true )
+    const bool is_type_selected[] = { gui_settings->is_type_b, gui_settings->is_type_g, gui_settings->is_type_n,
+                                      gui_settings->is_type_all };
+    static_assert( DEMO_CONFIGURATION_TABLE_SIZE( is_type_selected ) ==
+                       DEMO_CONFIGURATION_TABLE_SIZE( demo_configuration_wifi_type_table ),
+                   "GUI Wi-Fi types and table are not consistent" );
+
+    for( uint8_t index = 0; index < DEMO_CONFIGURATION_TABLE_SIZE( is_type_selected ); index++ )
     {
-        demo_settings->types = LR1110_WIFI_TYPE_SCAN_B_G_N;
+        if( is_type_selected[index] == true )
+        {
+            demo_settings->types = demo_configuration_wifi_type_table[index];
+            break;
+        }
     }
     demo_settings->result_type = DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE;
 }
@@ -457,6 +337,11 @@ void Supervisor::Runtime( )
     this->GuiRuntimeAndProcess( );
     this->CommunicationManagerRuntime( );
 
+    if( this->telemetry_sampler->GetNbSamples( ) != this->nb_telemetry_samples_in_gui )
+    {
+        this->TransferTelemetryToGui( );
+    }
+
     if( this->run_demo )
     {
         this->DemoRuntimeAndProcess( );
@@ -523,6 +408,12 @@ void Supervisor::GuiRuntimeAndProcess( )
         this->run_demo = true;
         break;
     }
+    case GUI_LAST_EVENT_START_DEMO_RADIO_SPECTRUM:
+    {
+        demo->Start( DEMO_TYPE_RADIO_SPECTRUM );
+        this->run_demo = true;
+        break;
+    }
     case GUI_LAST_EVENT_STOP_DEMO:
     {
         demo->Stop( );
@@ -545,6 +436,7 @@ void Supervisor::GuiRuntimeAndProcess( )
 
         case DEMO_TYPE_GNSS_AUTONOMOUS:
         case DEMO_TYPE_GNSS_ASSISTED:
+        case DEMO_TYPE_GNSS_SCHEDULER:
             TransferResultToSerial( ( ( demo_gnss_all_results_t* ) demo->GetResults( ) ) );
             break;
         default:
@@ -572,6 +464,12 @@ void Supervisor::GuiRuntimeAndProcess( )
             snprintf( new_reverse_geo_loc.latitude, GUI_RESULT_GEO_LOC_LATITUDE_LENGTH, "%.5f", latitude );
             snprintf( new_reverse_geo_loc.longitude, GUI_RESULT_GEO_LOC_LATITUDE_LENGTH, "%.5f", longitude );
             this->gui->UpdateReverseGeoCoding( new_reverse_geo_loc );
+
+            // The solved position is kept to assist the next GNSS scans
+            const environment_location_t solved_location = { latitude, longitude, altitude };
+            const uint32_t               uncertainty_m   = ( accuracy > 0 ) ? ( uint32_t ) accuracy : 0;
+            this->environment->SetLocation( solved_location, DEMO_GNSS_ASSISTANCE_POSITION_SOURCE_SOLVE,
+                                            uncertainty_m );
         }
         else
         {
@@ -636,15 +534,23 @@ void Supervisor::DemoRuntimeAndProcess( )
     {
         if( this->demo->HasIntermediateResults( ) )
         {
+            this->AttachTelemetryToDemoResults( );
             this->TransfertDemoResultsToGui( );
+            this->TransfertDemoResultsToHost( );
         }
         break;
     }
     case DEMO_STATUS_TERMINATED:
     {
+        const bool has_last_results = this->demo->HasIntermediateResults( );
+        this->AttachTelemetryToDemoResults( );
         demo->Stop( );
         this->run_demo = false;
         this->TransfertDemoResultsToGui( );
+        if( has_last_results )
+        {
+            this->TransfertDemoResultsToHost( );
+        }
         this->communication_manager->EventNotify( );
         break;
     }
@@ -716,6 +622,36 @@ void Supervisor::CommunicationManagerRuntime( )
             this->run_demo = true;
             break;
         }
+        case COMMAND_START_GNSS_SCHEDULER_DEMO_EVENT:
+        {
+            demo->Start( DEMO_TYPE_GNSS_SCHEDULER );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_RADIO_SPECTRUM_DEMO_EVENT:
+        {
+            demo->Start( DEMO_TYPE_RADIO_SPECTRUM );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_RADIO_CAD_DEMO_EVENT:
+        {
+            demo->Start( DEMO_TYPE_RADIO_CAD );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_RADIO_PER_RX_DEMO_EVENT:
+        {
+            demo->Start( DEMO_TYPE_RADIO_PER_RX );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_RADIO_PING_PONG_DEMO_EVENT:
+        {
+            demo->Start( DEMO_TYPE_RADIO_PING_PONG );
+            this->run_demo = true;
+            break;
+        }
         case COMMAND_STOP_DEMO_EVENT:
         {
             this->demo->Stop( );
@@ -789,6 +725,7 @@ void Supervisor::TransfertDemoResultsToGui( )
         break;
 
     case DEMO_TYPE_GNSS_ASSISTED:
+    case DEMO_TYPE_GNSS_SCHEDULER:
         this->TransferResultToGui( ( ( demo_gnss_all_results_t* ) demo->GetResults( ) ) );
         break;
 
@@ -801,11 +738,61 @@ void Supervisor::TransfertDemoResultsToGui( )
         this->TransferResultToGui( ( demo_radio_per_results_t* ) demo->GetResults( ) );
         break;
 
+    case DEMO_TYPE_RADIO_SPECTRUM:
+        this->TransferResultToGui( ( demo_radio_spectrum_results_t* ) demo->GetResults( ) );
+        break;
+
+    case DEMO_TYPE_RADIO_CAD:
+        // The CAD demo has no result page, its statistics are fetched by the host
+        break;
+
     default:
         this->communication_manager->Log( "Error: unknown demo type in result handling: 0x%x\n", demo_type );
     }
 }
 
+void Supervisor::TransfertDemoResultsToHost( )
+{
+    // Only the spectrum sweeps are streamed, the results of the other demos are fetched by the host
+    if( demo->GetType( ) == DEMO_TYPE_RADIO_SPECTRUM )
+    {
+        this->communication_manager->StreamRadioSpectrum( *( demo_radio_spectrum_results_t* ) demo->GetResults( ) );
+    }
+}
+
+void Supervisor::AttachTelemetryToDemoResults( )
+{
+    switch( demo->GetType( ) )
+    {
+    case DEMO_TYPE_WIFI:
+    case DEMO_TYPE_WIFI_COUNTRY_CODE:
+        ( ( demo_wifi_scan_all_results_t* ) demo->GetResults( ) )->telemetry = this->telemetry_sampler->GetLatest( );
+        break;
+
+    case DEMO_TYPE_GNSS_AUTONOMOUS:
+    case DEMO_TYPE_GNSS_ASSISTED:
+    case DEMO_TYPE_GNSS_SCHEDULER:
+        ( ( demo_gnss_all_results_t* ) demo->GetResults( ) )->telemetry = this->telemetry_sampler->GetLatest( );
+        break;
+
+    default:
+        break;
+    }
+}
+
+void Supervisor::TransferTelemetryToGui( )
+{
+    const telemetry_sample_t& latest = this->telemetry_sampler->GetLatest( );
+    GuiTelemetry_t            gui_telemetry;
+
+    gui_telemetry.is_sampled     = true;
+    gui_telemetry.vbat_mv        = latest.vbat_mv;
+    gui_telemetry.temperature_dc = latest.temperature_dc;
+
+    this->gui->UpdateTelemetry( gui_telemetry );
+    this->nb_telemetry_samples_in_gui = this->telemetry_sampler->GetNbSamples( );
+}
+
 void Supervisor::TransferResultToGui( const demo_wifi_scan_all_results_t* result )
 {
     GuiWifiResult_t guiWifiResults;
@@ -824,35 +811,76 @@ void Supervisor::TransferResultToGui( const demo_wifi_scan_all_results_t* result
         guiWifiResults.typeG.channel[id].nbMacAddr = 0;
     }
 
-    for( uint8_t index = 0; index < result->nbrResults; index++ )
-    {
-        const lr1110_wifi_mac_address_t* mac = &result->results[index].mac_address;
-        GuiWifiMacAddress_t              strMac;
-        GuiWifiResultChannel_t*          chan;
+    // The channels list the access points aggregated across the scans, with their mean RSSI. When a channel has more
+    // access points than the GUI can display, the strongest ones are kept
+    const DemoWifiApTable* ap_table = this->demo->GetWifiApTable( );
 
-        const demo_wifi_channel_t     wifi_chan = result->results[index].channel;
-        const demo_wifi_signal_type_t wifi_type = result->results[index].type;
+    guiWifiResults.nbApAggregated    = ap_table->GetCount( );
+    guiWifiResults.nbScansAggregated = ap_table->GetNbScans( );
 
-        snprintf( strMac, GUI_WIFI_STRING_LENGTH, "%02x:%02x:%02x:%02x:%02x:%02x", ( *mac )[0], ( *mac )[1],
-                  ( *mac )[2], ( *mac )[3], ( *mac )[4], ( *mac )[5] );
+    for( uint8_t index = 0; index < ap_table->GetCount( ); index++ )
+    {
+        const demo_wifi_ap_entry_t* entry = ap_table->GetEntry( index );
+        const int8_t                rssi  = DemoWifiApTable::GetRssiMean( *entry );
+        GuiWifiResultChannel_t*     chan;
+        uint8_t                     slot;
 
-        if( wifi_type == LR1110_WIFI_TYPE_RESULT_B )
+        if( ( entry->channel == 0 ) || ( entry->channel > GUI_WIFI_CHANNELS ) )
         {
-            chan = &guiWifiResults.typeB.channel[wifi_chan - 1];
+            continue;
+        }
+
+        if( entry->type == DEMO_WIFI_TYPE_B )
+        {
+            chan = &guiWifiResults.typeB.channel[entry->channel - 1];
         }
         else
         {
-            chan = &guiWifiResults.typeG.channel[wifi_chan - 1];
+            chan = &guiWifiResults.typeG.channel[entry->channel - 1];
         }
 
         if( chan->nbMacAddr < GUI_MAX_WIFI_MAC_ADDRESSES )
         {
-            memcpy( chan->data[chan->nbMacAddr].macAddr, strMac, GUI_WIFI_STRING_LENGTH );
-            snprintf( chan->data[chan->nbMacAddr].countryCode, GUI_WIFI_STRING_COUNTRY_CODE_LENGTH, "%c%c",
-                      result->results[index].country_code[0], result->results[index].country_code[1] );
-            chan->data[chan->nbMacAddr].rssi = result->results[index].rssi;
-            chan->nbMacAddr++;
+            slot = chan->nbMacAddr++;
         }
+        else
+        {
+            slot = 0;
+            for( uint8_t data_index = 1; data_index < GUI_MAX_WIFI_MAC_ADDRESSES; data_index++ )
+            {
+                if( chan->data[data_index].rssi < chan->data[slot].rssi )
+                {
+                    slot = data_index;
+                }
+            }
+
+            if( chan->data[slot].rssi >= rssi )
+            {
+                continue;
+            }
+        }
+
+        snprintf( chan->data[slot].macAddr, GUI_WIFI_STRING_LENGTH, "%02x:%02x:%02x:%02x:%02x:%02x",
+                  entry->mac_address[0], entry->mac_address[1], entry->mac_address[2], entry->mac_address[3],
+                  entry->mac_address[4], entry->mac_address[5] );
+        snprintf( chan->data[slot].countryCode, GUI_WIFI_STRING_COUNTRY_CODE_LENGTH, "%c%c", entry->country_code[0],
+                  entry->country_code[1] );
+        chan->data[slot].rssi         = rssi;
+        chan->data[slot].nbDetections = entry->nb_detections;
+    }
+
+    const DemoWifiChannelStats* channel_stats = this->demo->GetWifiChannelStats( );
+
+    guiWifiResults.channelsStats.nbScans = channel_stats->GetNbScans( );
+    for( uint8_t id = 0; id < GUI_WIFI_CHANNELS; id++ )
+    {
+        const demo_wifi_channel_stats_t* stats     = channel_stats->GetChannel( id + 1 );
+        GuiWifiChannelStats_t*           gui_stats = &guiWifiResults.channelsStats.channel[id];
+
+        gui_stats->nbScans        = stats->nb_scans;
+        gui_stats->nbDetections   = stats->nb_detections;
+        gui_stats->nbApMaxPerScan = stats->nb_ap_max_per_scan;
+        gui_stats->rssiMax        = stats->rssi_max;
     }
 
     this->gui->UpdateWifiDemoResult( guiWifiResults );
@@ -905,14 +933,35 @@ void Supervisor::TransferResultToGui( const demo_radio_per_results_t* result )
 {
     GuiRadioPerResult_t guiResult;
 
-    guiResult.count_tx                = result->count_tx;
-    guiResult.count_rx_correct_packet = result->count_rx_correct_packet;
-    guiResult.count_rx_timeout        = result->count_rx_timeout;
-    guiResult.count_rx_wrong_packet   = result->count_rx_wrong_packet;
+    guiResult.count_tx                 = result->count_tx;
+    guiResult.count_rx_correct_packet  = result->count_rx_correct_packet;
+    guiResult.count_rx_timeout         = result->count_rx_timeout;
+    guiResult.count_rx_wrong_packet    = result->count_rx_wrong_packet;
+    guiResult.count_rx_expected_packet = result->count_rx_expected_packet;
+    guiResult.average_current_ua       = result->average_current_ua;
 
     this->gui->UpdateRadioPerResult( guiResult );
 }
 
+void Supervisor::TransferResultToGui( const demo_radio_spectrum_results_t* result )
+{
+    GuiRadioSpectrumResult_t guiResult;
+
+    guiResult.sweep_index       = result->sweep_index;
+    guiResult.sweep_duration_ms = result->sweep_duration_ms;
+    guiResult.start_freq_in_hz  = result->start_frequency_hz;
+    guiResult.step_in_hz        = result->step_hz;
+    guiResult.nb_bins           = ( result->nb_bins < GUI_RADIO_SPECTRUM_MAX_BINS ) ? result->nb_bins
+                                                                                    : GUI_RADIO_SPECTRUM_MAX_BINS;
+    for( uint8_t index = 0; index < guiResult.nb_bins; index++ )
+    {
+        guiResult.peak_rssi[index]    = result->bins[index].peak_rssi;
+        guiResult.average_rssi[index] = result->bins[index].average_rssi;
+    }
+
+    this->gui->UpdateRadioSpectrumResult( guiResult );
+}
+
 GuiDemoStatus_t Supervisor::DemoGnssErrorCodeToGuiStatus( const demo_gnss_error_t error_code )
 {
     GuiDemoStatus_t gui_status = GUI_DEMO_STATUS_KO_UNKNOWN;
@@ -38,14 +38,124 @@
 #include "stm32l4xx_ll_bus.h"
 #include "stm32l4xx_ll_gpio.h"
 #include "stm32l4xx_ll_i2c.h"
+#include "callback.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*!
+ * \brief Maximum number of I2C requests waiting for the bus
+ */
+#define SYSTEM_I2C_REQUEST_QUEUE_SIZE ( 4 )
+
+/*!
+ * \brief Time a blocking I2C function waits for a place in the queue, then for the transfer on the bus, before failing
+ *
+ * A 255-byte read at 100 kHz takes about 25 ms.
+ */
+#define SYSTEM_I2C_REQUEST_TIMEOUT_MS ( 50 )
+
+typedef enum
+{
+    SYSTEM_I2C_REQUEST_IDLE,
+    SYSTEM_I2C_REQUEST_PENDING,
+    SYSTEM_I2C_REQUEST_ONGOING,
+    SYSTEM_I2C_REQUEST_DONE,
+    SYSTEM_I2C_REQUEST_ERROR,
+} system_i2c_request_status_t;
+
+/*!
+ * \brief I2C transaction handled by DMA
+ *
+ * A write phase of length_in bytes from buffer_in is followed, if length_out is not 0, by a read phase of length_out
+ * bytes to buffer_out started with a repeated start condition. The request and its buffers belong to the I2C driver
+ * from the submission until the status becomes SYSTEM_I2C_REQUEST_DONE or SYSTEM_I2C_REQUEST_ERROR.
+ *
+ * The done_callback, if any, is called from interrupt context once the status is updated.
+ */
+typedef struct
+{
+    uint8_t                              address;
+    const uint8_t*                       buffer_in;
+    uint8_t                              length_in;
+    uint8_t*                             buffer_out;
+    uint8_t                              length_out;
+    Callback_t                           done_callback;
+    volatile system_i2c_request_status_t status;
+} system_i2c_request_t;
+
 void system_i2c_init( void );
-void system_i2c_write( const uint8_t address, const uint8_t* buffer_in, const uint8_t length, const bool repeated );
-void system_i2c_read( const uint8_t address, uint8_t* buffer_out, const uint8_t length, const bool repeated );
+
+/*!
+ * \brief Write in a single I2C transaction, ended by a stop condition
+ *
+ * This function waits for the end of the transaction, at most SYSTEM_I2C_REQUEST_TIMEOUT_MS for a place in the queue
+ * then SYSTEM_I2C_REQUEST_TIMEOUT_MS for the transfer. A transfer that times out is aborted and the peripheral reset.
+ *
+ * \param [in] address Slave address
+ * \param [in] buffer_in Data to write
+ * \param [in] length Number of bytes to write
+ *
+ * \returns True if the transaction completed, false on bus error, NACK or timeout
+ */
+bool system_i2c_write( const uint8_t address, const uint8_t* buffer_in, const uint8_t length );
+
+/*!
+ * \brief Read in a single I2C transaction, ended by a stop condition
+ *
+ * Use system_i2c_write_read to read from a register address without releasing the bus. Waits like system_i2c_write.
+ *
+ * \param [in] address Slave address
+ * \param [out] buffer_out Buffer receiving the data read
+ * \param [in] length Number of bytes to read
+ *
+ * \returns True if the transaction completed, false on bus error, NACK or timeout
+ */
+bool system_i2c_read( const uint8_t address, uint8_t* buffer_out, const uint8_t length );
+
+/*!
+ * \brief Write then read in a single I2C transaction
+ *
+ * The read phase starts with a repeated start condition right after the write phase, so that the bus is not released
+ * in between. This is typically used to read a block of contiguous registers from a register address.
+ *
+ * This function waits for the end of the transaction like system_i2c_write. Use system_i2c_submit to not wait.
+ *
+ * \param [in] address Slave address
+ * \param [in] buffer_in Data to write (typically the first register address)
+ * \param [in] length_in Number of bytes to write
+ * \param [out] buffer_out Buffer receiving the data read
+ * \param [in] length_out Number of bytes to read
+ *
+ * \returns True if the transaction completed, false on bus error, NACK or timeout
+ */
+bool system_i2c_write_read( const uint8_t address, const uint8_t* buffer_in, const uint8_t length_in,
+                            uint8_t* buffer_out, const uint8_t length_out );
+
+/*!
+ * \brief Queue an I2C request, without waiting for it to be processed
+ *
+ * Can be called from interrupt context.
+ *
+ * \param [in] request Request to queue
+ *
+ * \returns True if the request is queued, false if the I2C bus is not initialized yet, the queue is full or the request
+ * is already queued
+ */
+bool system_i2c_submit( system_i2c_request_t* request );
+
+/*!
+ * \brief Check if a request is waiting for the bus or being processed
+ *
+ * \param [in] request Request to check
+ *
+ * \returns True if the request is queued or ongoing
+ */
+bool system_i2c_is_request_busy( const system_i2c_request_t* request );
+
+void system_i2c_ev_irq_handler( void );
+void system_i2c_er_irq_handler( void );
 
 #ifdef __cplusplus
 }
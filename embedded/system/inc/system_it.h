@@ -53,6 +53,8 @@ void DebugMon_Handler( void );
 void PendSV_Handler( void );
 void SysTick_Handler( void );
 void EXTI4_IRQHandler( void );
+void I2C1_EV_IRQHandler( void );
+void I2C1_ER_IRQHandler( void );
 
 #ifdef __cplusplus
 }
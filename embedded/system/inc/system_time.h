@@ -43,6 +43,14 @@ void     system_time_wait_ms( uint32_t time_in_ms );
 void     system_time_IncreaseTicker( void );
 uint32_t system_time_GetTicker( void );
 
+/*!
+ * \brief Get the number of core clock cycles counted by the DWT since the initialization
+ *
+ * The counter wraps around after about 53 s at 80 MHz: only use it to time short operations.
+ */
+uint32_t system_time_GetCycleCounter( void );
+uint32_t system_time_CyclesToUs( uint32_t cycles );
+
 #ifdef __cplusplus
 }
 #endif
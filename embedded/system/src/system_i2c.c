@@ -30,6 +30,30 @@
  */
 
 #include "system_i2c.h"
+#include "system_time.h"
+#include "stm32l4xx_ll_dma.h"
+
+#ifndef NULL
+#define NULL ( 0 )
+#endif
+
+#define SYSTEM_I2C_DMA_CHANNEL_RX LL_DMA_CHANNEL_6
+#define SYSTEM_I2C_DMA_CHANNEL_TX LL_DMA_CHANNEL_7
+
+static system_i2c_request_t* volatile request_queue[SYSTEM_I2C_REQUEST_QUEUE_SIZE];
+static volatile uint8_t               request_queue_head  = 0;
+static volatile uint8_t               request_queue_count = 0;
+static volatile bool                  request_has_failed  = false;
+static volatile bool                  is_bus_busy         = false;
+static volatile bool                  is_initialized      = false;
+
+static void system_i2c_start_next_request( void );
+static void system_i2c_start_write_phase( system_i2c_request_t* request );
+static void system_i2c_start_read_phase( system_i2c_request_t* request, const bool is_repeated_start );
+static void system_i2c_terminate_current_request( void );
+static void system_i2c_abort_current_request( void );
+static void system_i2c_reset_peripheral( void );
+static bool system_i2c_wait_request( system_i2c_request_t* request );
 
 void system_i2c_init( void )
 {
@@ -68,41 +92,286 @@ void system_i2c_init( void )
     I2C_InitStruct.OwnAddrSize     = LL_I2C_OWNADDRESS1_7BIT;
     LL_I2C_Init( I2C1, &I2C_InitStruct );
     LL_I2C_SetOwnAddress2( I2C1, 0, LL_I2C_OWNADDRESS2_NOMASK );
+
+    /* DMA2 channels 6 and 7 are used for I2C1 reception and transmission, DMA1 ones being used by USART2 */
+    LL_AHB1_GRP1_EnableClock( LL_AHB1_GRP1_PERIPH_DMA2 );
+
+    LL_DMA_ConfigTransfer( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX,
+                           LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_PRIORITY_MEDIUM | LL_DMA_MODE_NORMAL |
+                               LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE |
+                               LL_DMA_MDATAALIGN_BYTE );
+    LL_DMA_SetPeriphRequest( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX, LL_DMA_REQUEST_5 );
+
+    LL_DMA_ConfigTransfer( DMA2, SYSTEM_I2C_DMA_CHANNEL_RX,
+                           LL_DMA_DIRECTION_PERIPH_TO_MEMORY | LL_DMA_PRIORITY_MEDIUM | LL_DMA_MODE_NORMAL |
+                               LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE |
+                               LL_DMA_MDATAALIGN_BYTE );
+    LL_DMA_SetPeriphRequest( DMA2, SYSTEM_I2C_DMA_CHANNEL_RX, LL_DMA_REQUEST_5 );
+
+    LL_I2C_EnableDMAReq_TX( I2C1 );
+    LL_I2C_EnableDMAReq_RX( I2C1 );
+
+    /* End of phases and errors are handled on I2C events, the DMA only moves the data */
+    LL_I2C_EnableIT_TC( I2C1 );
+    LL_I2C_EnableIT_STOP( I2C1 );
+    LL_I2C_EnableIT_NACK( I2C1 );
+    LL_I2C_EnableIT_ERR( I2C1 );
+
+    NVIC_SetPriority( I2C1_EV_IRQn, 0 );
+    NVIC_EnableIRQ( I2C1_EV_IRQn );
+    NVIC_SetPriority( I2C1_ER_IRQn, 0 );
+    NVIC_EnableIRQ( I2C1_ER_IRQn );
+
+    is_initialized = true;
 }
 
-void system_i2c_write( const uint8_t address, const uint8_t* buffer_in, const uint8_t length, const bool repeated )
+bool system_i2c_write( const uint8_t address, const uint8_t* buffer_in, const uint8_t length )
 {
-    uint8_t i = 0;
+    system_i2c_request_t request = {
+        .address       = address,
+        .buffer_in     = buffer_in,
+        .length_in     = length,
+        .buffer_out    = NULL,
+        .length_out    = 0,
+        .done_callback = { .object = NULL, .callback = NULL },
+        .status        = SYSTEM_I2C_REQUEST_IDLE,
+    };
 
-    LL_I2C_HandleTransfer( I2C1, 0x70, LL_I2C_ADDRSLAVE_7BIT, length, LL_I2C_MODE_AUTOEND,
-                           LL_I2C_GENERATE_START_WRITE );
+    return system_i2c_wait_request( &request );
+}
+
+bool system_i2c_read( const uint8_t address, uint8_t* buffer_out, const uint8_t length )
+{
+    system_i2c_request_t request = {
+        .address       = address,
+        .buffer_in     = NULL,
+        .length_in     = 0,
+        .buffer_out    = buffer_out,
+        .length_out    = length,
+        .done_callback = { .object = NULL, .callback = NULL },
+        .status        = SYSTEM_I2C_REQUEST_IDLE,
+    };
+
+    return system_i2c_wait_request( &request );
+}
+
+bool system_i2c_write_read( const uint8_t address, const uint8_t* buffer_in, const uint8_t length_in,
+                            uint8_t* buffer_out, const uint8_t length_out )
+{
+    system_i2c_request_t request = {
+        .address       = address,
+        .buffer_in     = buffer_in,
+        .length_in     = length_in,
+        .buffer_out    = buffer_out,
+        .length_out    = length_out,
+        .done_callback = { .object = NULL, .callback = NULL },
+        .status        = SYSTEM_I2C_REQUEST_IDLE,
+    };
+
+    return system_i2c_wait_request( &request );
+}
+
+bool system_i2c_submit( system_i2c_request_t* request )
+{
+    const uint32_t primask      = __get_PRIMASK( );
+    bool           is_submitted = false;
+
+    __disable_irq( );
+    /* The touch interrupt may be enabled before the I2C bus is initialized */
+    if( ( is_initialized == true ) && ( request_queue_count < SYSTEM_I2C_REQUEST_QUEUE_SIZE ) &&
+        !system_i2c_is_request_busy( request ) )
+    {
+        request->status = SYSTEM_I2C_REQUEST_PENDING;
+        request_queue[( request_queue_head + request_queue_count ) % SYSTEM_I2C_REQUEST_QUEUE_SIZE] = request;
+        request_queue_count++;
+        if( is_bus_busy == false )
+        {
+            system_i2c_start_next_request( );
+        }
+        is_submitted = true;
+    }
+    __set_PRIMASK( primask );
+
+    return is_submitted;
+}
+
+bool system_i2c_is_request_busy( const system_i2c_request_t* request )
+{
+    return ( request->status == SYSTEM_I2C_REQUEST_PENDING ) || ( request->status == SYSTEM_I2C_REQUEST_ONGOING );
+}
+
+void system_i2c_ev_irq_handler( void )
+{
+    system_i2c_request_t* request = request_queue[request_queue_head];
+
+    /* A spurious event, or one raised just before a request is aborted, has no request to act on */
+    if( ( is_bus_busy == false ) || ( request_queue_count == 0 ) )
+    {
+        LL_I2C_ClearFlag_NACK( I2C1 );
+        LL_I2C_ClearFlag_STOP( I2C1 );
+        return;
+    }
 
-    /* Loop until STOP flag is raised  */
-    while( !LL_I2C_IsActiveFlag_STOP( I2C1 ) )
+    if( LL_I2C_IsActiveFlag_NACK( I2C1 ) )
     {
-        if( LL_I2C_IsActiveFlag_TXIS( I2C1 ) )
+        LL_I2C_ClearFlag_NACK( I2C1 );
+        request_has_failed = true;
+        /* In software end mode the STOP condition is not generated by hardware */
+        if( !LL_I2C_IsActiveFlag_STOP( I2C1 ) && LL_I2C_IsActiveFlag_BUSY( I2C1 ) )
         {
-            LL_I2C_TransmitData8( I2C1, buffer_in[i++] );
+            LL_I2C_GenerateStopCondition( I2C1 );
         }
     }
 
-    LL_I2C_ClearFlag_STOP( I2C1 );
+    if( LL_I2C_IsActiveFlag_TC( I2C1 ) )
+    {
+        /* Only raised at the end of the write phase of a write-read request */
+        LL_DMA_DisableChannel( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX );
+        system_i2c_start_read_phase( request, true );
+    }
+
+    if( LL_I2C_IsActiveFlag_STOP( I2C1 ) )
+    {
+        LL_I2C_ClearFlag_STOP( I2C1 );
+        system_i2c_terminate_current_request( );
+    }
+}
+
+void system_i2c_er_irq_handler( void )
+{
+    LL_I2C_ClearFlag_BERR( I2C1 );
+    LL_I2C_ClearFlag_ARLO( I2C1 );
+    LL_I2C_ClearFlag_OVR( I2C1 );
+    request_has_failed = true;
+
+    /* Reset the peripheral to release the bus, then go on with the next request */
+    system_i2c_reset_peripheral( );
+    system_i2c_terminate_current_request( );
 }
 
-void system_i2c_read( const uint8_t address, uint8_t* buffer_out, const uint8_t length, const bool repeated )
+static void system_i2c_start_next_request( void )
 {
-    uint8_t i = 0;
+    system_i2c_request_t* request = request_queue[request_queue_head];
+
+    is_bus_busy        = true;
+    request->status    = SYSTEM_I2C_REQUEST_ONGOING;
+    request_has_failed = false;
 
-    LL_I2C_HandleTransfer( I2C1, 0x70, LL_I2C_ADDRSLAVE_7BIT, length, LL_I2C_MODE_AUTOEND, LL_I2C_GENERATE_START_READ );
+    if( request->length_in > 0 )
+    {
+        system_i2c_start_write_phase( request );
+    }
+    else
+    {
+        system_i2c_start_read_phase( request, false );
+    }
+}
+
+static void system_i2c_start_write_phase( system_i2c_request_t* request )
+{
+    /* A read phase follows in software end mode: the TC event then starts it without releasing the bus */
+    const uint32_t end_mode = ( request->length_out > 0 ) ? LL_I2C_MODE_SOFTEND : LL_I2C_MODE_AUTOEND;
+
+    LL_DMA_ConfigAddresses( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX, ( uint32_t ) request->buffer_in,
+                            LL_I2C_DMA_GetRegAddr( I2C1, LL_I2C_DMA_REG_DATA_TRANSMIT ),
+                            LL_DMA_DIRECTION_MEMORY_TO_PERIPH );
+    LL_DMA_SetDataLength( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX, request->length_in );
+    LL_DMA_EnableChannel( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX );
+
+    LL_I2C_HandleTransfer( I2C1, request->address, LL_I2C_ADDRSLAVE_7BIT, request->length_in, end_mode,
+                           LL_I2C_GENERATE_START_WRITE );
+}
+
+static void system_i2c_start_read_phase( system_i2c_request_t* request, const bool is_repeated_start )
+{
+    LL_DMA_ConfigAddresses( DMA2, SYSTEM_I2C_DMA_CHANNEL_RX,
+                            LL_I2C_DMA_GetRegAddr( I2C1, LL_I2C_DMA_REG_DATA_RECEIVE ),
+                            ( uint32_t ) request->buffer_out, LL_DMA_DIRECTION_PERIPH_TO_MEMORY );
+    LL_DMA_SetDataLength( DMA2, SYSTEM_I2C_DMA_CHANNEL_RX, request->length_out );
+    LL_DMA_EnableChannel( DMA2, SYSTEM_I2C_DMA_CHANNEL_RX );
+
+    LL_I2C_HandleTransfer(
+        I2C1, request->address, LL_I2C_ADDRSLAVE_7BIT, request->length_out, LL_I2C_MODE_AUTOEND,
+        ( is_repeated_start == true ) ? LL_I2C_GENERATE_RESTART_7BIT_READ : LL_I2C_GENERATE_START_READ );
+}
+
+static void system_i2c_terminate_current_request( void )
+{
+    system_i2c_request_t* request = request_queue[request_queue_head];
+
+    LL_DMA_DisableChannel( DMA2, SYSTEM_I2C_DMA_CHANNEL_TX );
+    LL_DMA_DisableChannel( DMA2, SYSTEM_I2C_DMA_CHANNEL_RX );
+
+    if( ( is_bus_busy == false ) || ( request_queue_count == 0 ) )
+    {
+        return;
+    }
+
+    request_queue_head = ( request_queue_head + 1 ) % SYSTEM_I2C_REQUEST_QUEUE_SIZE;
+    request_queue_count--;
+    is_bus_busy        = false;
+
+    /* The callback may submit a new request, that is then started right away */
+    request->status = ( request_has_failed == true ) ? SYSTEM_I2C_REQUEST_ERROR : SYSTEM_I2C_REQUEST_DONE;
+    if( ( request->done_callback.object != NULL ) && ( request->done_callback.callback != NULL ) )
+    {
+        request->done_callback.callback( request->done_callback.object );
+    }
+
+    if( ( is_bus_busy == false ) && ( request_queue_count > 0 ) )
+    {
+        system_i2c_start_next_request( );
+    }
+}
+
+static void system_i2c_abort_current_request( void )
+{
+    const uint32_t primask = __get_PRIMASK( );
+
+    __disable_irq( );
+    if( is_bus_busy == true )
+    {
+        request_has_failed = true;
+        system_i2c_reset_peripheral( );
+        system_i2c_terminate_current_request( );
+    }
+    __set_PRIMASK( primask );
+}
+
+static void system_i2c_reset_peripheral( void )
+{
+    /* Clearing PE resets the transfer state machine and the flags, and releases SCL and SDA */
+    LL_I2C_Disable( I2C1 );
+    while( LL_I2C_IsEnabled( I2C1 ) )
+    {
+    }
+    LL_I2C_Enable( I2C1 );
+}
+
+static bool system_i2c_wait_request( system_i2c_request_t* request )
+{
+    /* Not to be called from interrupt context, otherwise neither the queue nor the ticker would be processed */
+    uint32_t start_ms = system_time_GetTicker( );
+
+    while( !system_i2c_submit( request ) )
+    {
+        if( ( system_time_GetTicker( ) - start_ms ) > SYSTEM_I2C_REQUEST_TIMEOUT_MS )
+        {
+            return false;
+        }
+    }
 
-    /* Loop until STOP flag is raised  */
-    while( !LL_I2C_IsActiveFlag_STOP( I2C1 ) )
+    /* The request may be queued behind others: a timeout fails the transfer on the bus, which is the request or one
+     * ahead of it, so that the queue always moves on */
+    start_ms = system_time_GetTicker( );
+    while( system_i2c_is_request_busy( request ) )
     {
-        if( LL_I2C_IsActiveFlag_RXNE( I2C1 ) )
+        if( ( system_time_GetTicker( ) - start_ms ) > SYSTEM_I2C_REQUEST_TIMEOUT_MS )
         {
-            buffer_out[i++] = LL_I2C_ReceiveData8( I2C1 );
+            system_i2c_abort_current_request( );
+            start_ms = system_time_GetTicker( );
         }
     }
 
-    LL_I2C_ClearFlag_STOP( I2C1 );
+    return ( request->status == SYSTEM_I2C_REQUEST_DONE ) ? true : false;
 }
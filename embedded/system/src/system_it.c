@@ -37,6 +37,7 @@
 #include "system_time.h"
 #include "system_lptim.h"
 #include "system_uart.h"
+#include "system_i2c.h"
 
 extern void SupervisorInterruptHandlerGui( bool is_down );
 extern void SupervisorInterruptHandlerDemo( void );
@@ -211,6 +212,20 @@ void DMA1_Channel6_IRQHandler( void )
     }
 }
 
+/**
+ * @brief  This function handles I2C1 event interrupt request.
+ * @param  None
+ * @retval None
+ */
+void I2C1_EV_IRQHandler( void ) { system_i2c_ev_irq_handler( ); }
+
+/**
+ * @brief  This function handles I2C1 error interrupt request.
+ * @param  None
+ * @retval None
+ */
+void I2C1_ER_IRQHandler( void ) { system_i2c_er_irq_handler( ); }
+
 /**
  * @brief This function handles LPTIM1 global interrupt.
  */
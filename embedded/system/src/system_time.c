@@ -35,10 +35,21 @@
 
 volatile static uint32_t ticker = 0;
 
-void system_time_init( void ) { LL_SYSTICK_EnableIT( ); }
+void system_time_init( void )
+{
+    LL_SYSTICK_EnableIT( );
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
 
 void system_time_wait_ms( uint32_t time_in_ms ) { LL_mDelay( time_in_ms ); }
 
 void system_time_IncreaseTicker( void ) { ticker++; }
 
 uint32_t system_time_GetTicker( void ) { return ticker; }
+
+uint32_t system_time_GetCycleCounter( void ) { return DWT->CYCCNT; }
+
+uint32_t system_time_CyclesToUs( uint32_t cycles ) { return cycles / ( SystemCoreClock / 1000000 ); }
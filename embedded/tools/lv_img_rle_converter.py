@@ -0,0 +1,234 @@
+"""
+Convert an LVGL true color C image into a run-length encoded C image
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import argparse
+import re
+import sys
+
+RUN_LENGTH_MAX = 128
+REPEAT_FLAG = 0x80
+DEPTH_16_BLOCK_START = "#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0"
+
+C_FILE_TEMPLATE = """/**
+ * @file      {name}.c
+ *
+ * @brief     Run-length encoded {name} image.
+ *
+ * Generated by embedded/tools/lv_img_rle_converter.py, do not edit.
+ * See lv_img_rle.h for the description of the format.
+ */
+
+#include "{header}"
+#include "lv_img_rle.h"
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TEST uint8_t {name}_map[] = {{
+{data}
+}};
+
+const lv_img_dsc_t {name} = {{
+    .header.always_zero = 0,
+    .header.w           = {width},
+    .header.h           = {height},
+    .data_size          = {size},
+    .header.cf          = LV_IMG_CF_RLE,
+    .data               = {name}_map,
+}};
+"""
+
+
+class ConverterException(Exception):
+    pass
+
+
+def read_lvgl_true_color_image(source):
+    """Extract the RGB565 pixels, width and height of an LVGL C image"""
+    lines = source.splitlines()
+    try:
+        start = lines.index(DEPTH_16_BLOCK_START) + 1
+    except ValueError:
+        raise ConverterException(
+            "No '{}' block found in source".format(DEPTH_16_BLOCK_START)
+        )
+    end = lines.index("#endif", start)
+    data_bytes = [
+        int(value, 16)
+        for line in lines[start:end]
+        for value in re.findall(r"0x[0-9a-fA-F]{2}", line)
+    ]
+    pixels = [
+        data_bytes[index] | (data_bytes[index + 1] << 8)
+        for index in range(0, len(data_bytes) - 1, 2)
+    ]
+
+    width_match = re.search(r"\.header\.w\s*=\s*(\d+)", source)
+    height_match = re.search(r"\.header\.h\s*=\s*(\d+)", source)
+    if not width_match or not height_match:
+        raise ConverterException("Image width or height not found in source")
+    width = int(width_match.group(1))
+    height = int(height_match.group(1))
+    if len(pixels) != width * height:
+        raise ConverterException(
+            "Found {} pixels, expected {}x{}".format(len(pixels), width, height)
+        )
+    return pixels, width, height
+
+
+def encode_row(row):
+    """Run-length encode one row of RGB565 pixels"""
+    encoded = bytearray()
+    literals = list()
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:RUN_LENGTH_MAX]
+            del literals[:RUN_LENGTH_MAX]
+            encoded.append(len(chunk) - 1)
+            for pixel in chunk:
+                encoded.extend((pixel & 0xFF, pixel >> 8))
+
+    index = 0
+    while index < len(row):
+        run = 1
+        while (
+            index + run < len(row)
+            and row[index + run] == row[index]
+            and run < RUN_LENGTH_MAX
+        ):
+            run += 1
+        # A run of two pixels costs as much as two literals, but breaks the
+        # current literal sequence, so only longer runs are worth encoding
+        if run > 2:
+            flush_literals()
+            encoded.append(REPEAT_FLAG | (run - 1))
+            encoded.extend((row[index] & 0xFF, row[index] >> 8))
+        else:
+            literals.extend(row[index : index + run])
+        index += run
+    flush_literals()
+    return encoded
+
+
+def encode_image(pixels, width, height):
+    """Build the row offset table followed by the encoded rows"""
+    rows = [
+        encode_row(pixels[row * width : (row + 1) * width]) for row in range(height)
+    ]
+    offset = 2 * height
+    table = bytearray()
+    for row in rows:
+        if offset > 0xFFFF:
+            raise ConverterException("Encoded image too large for 16-bit offsets")
+        table.extend((offset & 0xFF, offset >> 8))
+        offset += len(row)
+    return table + b"".join(rows)
+
+
+def decode_image(encoded, width, height):
+    """Decode an encoded image back to RGB565 pixels, used to check the output"""
+    pixels = list()
+    for row in range(height):
+        index = encoded[2 * row] | (encoded[2 * row + 1] << 8)
+        row_pixels = list()
+        while len(row_pixels) < width:
+            control = encoded[index]
+            count = (control & ~REPEAT_FLAG) + 1
+            index += 1
+            if control & REPEAT_FLAG:
+                row_pixels.extend([encoded[index] | (encoded[index + 1] << 8)] * count)
+                index += 2
+            else:
+                for _ in range(count):
+                    row_pixels.append(encoded[index] | (encoded[index + 1] << 8))
+                    index += 2
+        pixels.extend(row_pixels)
+    return pixels
+
+
+def format_c_array(encoded, bytes_per_line=16):
+    return "\n".join(
+        "    "
+        + " ".join(
+            "0x{:02x},".format(value) for value in encoded[index : index + bytes_per_line]
+        )
+        for index in range(0, len(encoded), bytes_per_line)
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert an LVGL true color C image (as generated by the LVGL "
+        "image converter) into a run-length encoded image for lv_img_rle"
+    )
+    parser.add_argument("input", help="LVGL C image file")
+    parser.add_argument("output", help="Run-length encoded C image file")
+    parser.add_argument("name", help="Name of the lv_img_dsc_t variable")
+    parser.add_argument(
+        "--header",
+        help="Header declaring the image (default: <name>.h)",
+        default=None,
+    )
+    args = parser.parse_args()
+
+    with open(args.input, "r") as input_file:
+        source = input_file.read()
+
+    try:
+        pixels, width, height = read_lvgl_true_color_image(source)
+        encoded = encode_image(pixels, width, height)
+        if decode_image(encoded, width, height) != pixels:
+            raise ConverterException("Decoded image differs from source")
+    except ConverterException as converter_exception:
+        print("Error: {}".format(converter_exception), file=sys.stderr)
+        sys.exit(1)
+
+    with open(args.output, "w") as output_file:
+        output_file.write(
+            C_FILE_TEMPLATE.format(
+                name=args.name,
+                header=args.header or "{}.h".format(args.name),
+                data=format_c_array(encoded),
+                width=width,
+                height=height,
+                size=len(encoded),
+            )
+        )
+
+    print(
+        "{}x{} image: {} bytes raw, {} bytes encoded ({:.1f}%)".format(
+            width,
+            height,
+            2 * len(pixels),
+            len(encoded),
+            100.0 * len(encoded) / (2 * len(pixels)),
+        )
+    )
+
+
+if __name__ == "__main__":
+    main()
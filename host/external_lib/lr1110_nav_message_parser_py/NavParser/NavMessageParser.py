@@ -1,5 +1,8 @@
 from .navParser.navParser import NavParser
-from .navParser.baseTypes import GnssSolverDestination
+from .navParser.baseTypes import GnssSolverDestination, NavParserException
+from .navParser.core import NavMessageConsumerBitsExtractionOutOfBound
+from collections import namedtuple
+from itertools import islice
 
 
 class NavMessageParserException(Exception):
@@ -16,7 +19,14 @@ class NotGnssSolverDestinationException(NavMessageParserException):
         )
 
 
+NavMessageParseResult = namedtuple(
+    "NavMessageParseResult", ["nav_message", "parsed_nav_message", "parse_error"]
+)
+
+
 class NavMessageParser:
+    DEFAULT_BATCH_SIZE = 256
+
     def __init__(self):
         pass
 
@@ -26,6 +36,44 @@ class NavMessageParser:
         satellites_description = NavMessageParser._parse_nav_message(nav_message_raw)
         return satellites_description
 
+    @staticmethod
+    def parse_batch(nav_messages):
+        """ Parse a list of NAV message strings
+
+        Returns one NavMessageParseResult per NAV message, in the same order.
+        A NAV message that cannot be decoded does not stop the batch: its
+        parse_error is set instead of parsed_nav_message.
+        """
+        results = list()
+        for nav_message in nav_messages:
+            try:
+                parsed_nav_message = NavMessageParser.parse(nav_message)
+            except (
+                ValueError,
+                NavParserException,
+                NavMessageConsumerBitsExtractionOutOfBound,
+            ) as error:
+                results.append(NavMessageParseResult(nav_message, None, error))
+            else:
+                results.append(
+                    NavMessageParseResult(nav_message, parsed_nav_message, None)
+                )
+        return results
+
+    @staticmethod
+    def iterate_parse(nav_messages, batch_size=DEFAULT_BATCH_SIZE):
+        """ Lazily parse NAV message strings from any iterable
+
+        NAV messages are pulled from the iterable batch_size at a time, so
+        memory use does not depend on the total number of NAV messages.
+        """
+        nav_messages_iterator = iter(nav_messages)
+        while True:
+            batch = list(islice(nav_messages_iterator, batch_size))
+            if not batch:
+                break
+            yield from NavMessageParser.parse_batch(batch)
+
     @staticmethod
     def _parse_nav_message(nav_message):
         parsed_nav_message = NavParser.parse(nav_message)
@@ -17,5 +17,6 @@ from .navParser import (
     NavParser
 )
 from .NavMessageParser import (
-    NavMessageParser
+    NavMessageParser,
+    NavMessageParseResult
 )
\ No newline at end of file
@@ -25,6 +25,7 @@ from .IdentifiableElement import (
 )
 
 from .exceptions import (
+    NavParserException,
     NavParserDestinationIdUnknownException,
     NavParserGnssSolverFrameTypeUnknownException,
     NavParserHostStatusUnknownException,
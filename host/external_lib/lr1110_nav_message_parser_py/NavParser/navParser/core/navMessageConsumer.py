@@ -20,6 +20,9 @@ class NavMessageConsumerBitsExtractionOutOfBound(NavMessageConsumerException):
 class NavMessageConsumer:
     def __init__(self, nav_message_raw):
         self.__nav_message_raw = nav_message_raw
+        # The payload is converted to integer once, instead of once per consumed field
+        self.__nav_message_integer = int.from_bytes(nav_message_raw, byteorder="little")
+        self.__nav_message_n_bits = len(nav_message_raw) * 8
         self.bit_location = 0
 
     @property
@@ -28,7 +31,7 @@ class NavMessageConsumer:
 
     @property
     def remaining_bits(self):
-        return (len(self.__nav_message_raw) * 8) - self.bit_location
+        return self.__nav_message_n_bits - self.bit_location
 
     @staticmethod
     def extract_bits_from_payload(payload, bit_position, n_bits):
@@ -59,8 +62,14 @@ class NavMessageConsumer:
         return payload_extracted
 
     def consume_field(self, n_bits_field):
-        field_value = NavMessageConsumer.extract_bits_from_payload(
-            self.__nav_message_raw, self.bit_location, n_bits_field
+        if (self.bit_location + n_bits_field) > self.__nav_message_n_bits:
+            raise NavMessageConsumerBitsExtractionOutOfBound(
+                len(self.__nav_message_raw), self.bit_location, n_bits_field
+            )
+        field_integer = (self.__nav_message_integer >> self.bit_location) & (
+            (1 << n_bits_field) - 1
         )
         self.bit_location += n_bits_field
-        return field_value
+        return field_integer.to_bytes(
+            length=ceil(n_bits_field / 8), byteorder="little"
+        )
@@ -100,10 +100,12 @@ class FieldTestConfiguration(AppConfigurationBase):
     def __init__(self):
         self.deactivate_wifi_requests = None
         self.user_defined_coordinate = None
+        self.max_in_flight_requests = None
 
     def _set_from_arguments(self, args):
         super()._set_from_arguments(args)
         self.deactivate_wifi_requests = args.no_wifi
+        self.max_in_flight_requests = args.max_in_flight_requests
         if args.user_defined_location:
             self.user_defined_coordinate = Coordinate.from_string(
                 args.user_defined_location
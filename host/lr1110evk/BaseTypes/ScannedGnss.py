@@ -28,6 +28,7 @@ Define GNSS Scan result class
 """
 
 from datetime import timedelta
+from .Telemetry import Telemetry
 import re
 
 
@@ -108,16 +109,24 @@ class ScannedGnss:
     """
 
     regexp_csv = re.compile(
-        "^(?P<nav_message>[A-Za-z0-9]+), ?(?P<elapsed_s>[0-9]+), ?(?P<radio_timing_ms>[0-9]+), ?(?P<computation_timing_ms>[0-9]+)$"
+        "^(?P<nav_message>[A-Za-z0-9]+), ?(?P<elapsed_s>[0-9]+), ?(?P<radio_timing_ms>[0-9]+), ?(?P<computation_timing_ms>[0-9]+)"
+        + Telemetry.REGEXP_CSV_SUFFIX
+        + "$"
     )
 
     def __init__(
-        self, nav_message, instant_scan, radio_timing_ms, computation_timing_ms
+        self,
+        nav_message,
+        instant_scan,
+        radio_timing_ms,
+        computation_timing_ms,
+        telemetry=None,
     ):
         self.__nav_message = nav_message
         self.__instant_scan = instant_scan
         self.__radio_timing_ms = radio_timing_ms
         self.__computation_timing_ms = computation_timing_ms
+        self.__telemetry = telemetry
 
     @property
     def nav_message(self):
@@ -135,6 +144,10 @@ class ScannedGnss:
     def computation_timing_ms(self):
         return self.__computation_timing_ms
 
+    @property
+    def telemetry(self):
+        return self.__telemetry
+
     @staticmethod
     def from_bytes(raw_bytes, instant_scan_received):
         # 1. Local measurement delay
@@ -164,6 +177,7 @@ class ScannedGnss:
         This factory method try to build a ScannedGnss object out of
         a CSV line. The expected schema of the CSV line is:
         '<NAV_MESSAGE>,<ELAPSED_TIME_CAPTURE_PRINT> (ms)'
+        optionally followed by ',<VBAT_MV>,<TEMPERATURE_C>'
 
         A ScannedGnssMalformedCsvLineException exception is raised if
         the line does not respect the expected formatting.
@@ -187,6 +201,7 @@ class ScannedGnss:
                 instant_scan=instant_scan_corrected,
                 radio_timing_ms=radio_timing_ms,
                 computation_timing_ms=computation_timing_ms,
+                telemetry=Telemetry.from_csv_match(match_mac_line),
             )
             return gnss
         else:
@@ -28,6 +28,7 @@ Define Wi-Fi MAC address scan result class
 """
 
 from .WifiChannels import WifiChannels
+from .Telemetry import Telemetry
 import re
 
 
@@ -72,11 +73,15 @@ class ScannedMacAddress:
             the MAC address has been discovered
         wifi_type (str): The wifi type reported
         rssi (int): The RSSI [dBm] reported
+        telemetry (Telemetry): The VBAT and temperature attached to the scan,
+            None if unknown
 
     """
 
     regexp_csv = re.compile(
-        "^(?P<mac_address>[A-Za-z0-9:]+), ?(?P<channel>CHANNEL_[0-9]+), ?(?P<wifi_type>TYPE_[BG]), ?(?P<rssi>-?[0-9]+), ?(?P<timing_demodulation>[0-9]+), ?(?P<timing_capture>[0-9]+), ?(?P<timing_correlation>[0-9]+), ?(?P<timing_detection>[0-9]+)$"
+        "^(?P<mac_address>[A-Za-z0-9:]+), ?(?P<channel>CHANNEL_[0-9]+), ?(?P<wifi_type>TYPE_[BG]), ?(?P<rssi>-?[0-9]+), ?(?P<timing_demodulation>[0-9]+), ?(?P<timing_capture>[0-9]+), ?(?P<timing_correlation>[0-9]+), ?(?P<timing_detection>[0-9]+)"
+        + Telemetry.REGEXP_CSV_SUFFIX
+        + "$"
     )
 
     def __init__(
@@ -90,6 +95,7 @@ class ScannedMacAddress:
         timing_correlation,
         timing_detection,
         instant_scan,
+        telemetry=None,
     ):
         self.__mac_address = mac_address
         self.__rssi = rssi
@@ -100,6 +106,7 @@ class ScannedMacAddress:
         self.__timing_correlation = timing_correlation
         self.__timing_detection = timing_detection
         self.__instant_scan = instant_scan
+        self.__telemetry = telemetry
 
     @property
     def mac_address(self):
@@ -137,6 +144,10 @@ class ScannedMacAddress:
     def instant_scan(self):
         return self.__instant_scan
 
+    @property
+    def telemetry(self):
+        return self.__telemetry
+
     @staticmethod
     def from_csv_line(date_scan, csv_line):
         """ Factory method from a CSV-like line
@@ -144,6 +155,7 @@ class ScannedMacAddress:
         This factory method try to build a ScannedMacAddress object out of
         a CSV line. The expected schema of the CSV line is:
         '<MAC-ADDRESS>,<CHANNEL-NAME>,<WIFI-TYPE-NAME>,<RSSI>,<TIMING_DEMODULATION>,<TIMING_CAPTURE>,<TIMING_CORRELATION>,<TIMING_DEMODULATION>,<TIMING_DETECTION>'
+        optionally followed by ',<VBAT_MV>,<TEMPERATURE_C>'
 
         A ScannedMacAddressMalformedCsvLineException exception is raised if
         the line does not respect the expected formatting.
@@ -174,6 +186,7 @@ class ScannedMacAddress:
                 timing_correlation,
                 timing_detection,
                 date_scan,
+                Telemetry.from_csv_match(match_mac_line),
             )
             return mac
         else:
@@ -0,0 +1,110 @@
+"""
+Define the VBAT and temperature measured by the LR1110
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+
+class Telemetry:
+    """ Describes the VBAT and temperature measured by the LR1110
+
+    The embedded side converts the raw values with the typical Vana of the
+    LR1110, so they are estimates.
+
+    Attributes:
+        vbat_mv (int): The supply voltage [mV]
+        temperature_c (float): The temperature [°C]
+        age_s (int): Age of the sample when the results were fetched [s],
+            None if unknown. 65535 means 65535 s or more
+
+    """
+
+    LENGTH = 4
+    AGE_LENGTH = 2
+    REGEXP_CSV_SUFFIX = (
+        "(?:, ?(?P<vbat_mv>[0-9]+), ?(?P<temperature_c>-?[0-9]+\\.[0-9]))?"
+    )
+
+    def __init__(self, vbat_mv, temperature_c, age_s=None):
+        self.__vbat_mv = vbat_mv
+        self.__temperature_c = temperature_c
+        self.__age_s = age_s
+
+    @property
+    def vbat_mv(self):
+        return self.__vbat_mv
+
+    @property
+    def temperature_c(self):
+        return self.__temperature_c
+
+    @property
+    def age_s(self):
+        return self.__age_s
+
+    @staticmethod
+    def from_bytes(raw_bytes):
+        """ Factory method from VBAT [mV] and temperature [0.1 °C] on 2 bytes each
+
+        They may be followed by the age of the sample [s] on 2 bytes.
+        None is returned if the board reports no sample, with a VBAT of 0 mV.
+        """
+        vbat_mv = int.from_bytes(raw_bytes[0:2], byteorder="little")
+        temperature_dc = int.from_bytes(raw_bytes[2:4], byteorder="little", signed=True)
+        age_s = None
+        if len(raw_bytes) >= Telemetry.LENGTH + Telemetry.AGE_LENGTH:
+            age_s = int.from_bytes(
+                raw_bytes[Telemetry.LENGTH : Telemetry.LENGTH + Telemetry.AGE_LENGTH],
+                byteorder="little",
+            )
+        if vbat_mv == 0:
+            return None
+        return Telemetry(
+            vbat_mv=vbat_mv, temperature_c=temperature_dc / 10, age_s=age_s
+        )
+
+    @staticmethod
+    def from_csv_match(match):
+        """ Factory method from a match of a regexp ending with REGEXP_CSV_SUFFIX
+
+        None is returned if the line holds no telemetry.
+        """
+        if match.group("vbat_mv") is None:
+            return None
+        return Telemetry(
+            vbat_mv=int(match.group("vbat_mv")),
+            temperature_c=float(match.group("temperature_c")),
+        )
+
+    def to_csv_fields(self):
+        return [str(self.vbat_mv), "{:.1f}".format(self.temperature_c)]
+
+    def __str__(self):
+        if self.age_s is None:
+            return "VBAT {} mV, {:.1f} C".format(self.vbat_mv, self.temperature_c)
+        return "VBAT {} mV, {:.1f} C, sampled {} s ago".format(
+            self.vbat_mv, self.temperature_c, self.age_s
+        )
@@ -1,4 +1,5 @@
 from .Coordinate import Coordinate
+from .Telemetry import Telemetry
 from .ScannedGnss import (
     ScannedGnss,
     ScannedGnssMalformedCsvLineException,
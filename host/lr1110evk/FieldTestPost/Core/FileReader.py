@@ -63,10 +63,23 @@ class FileReader:
         scanned_results = list()
         version = None
         with open(filename, "r") as f:
-            lines = f.readlines()
+            for item in FileReader.generate_items_from_lines(f):
+                if isinstance(item, Version):
+                    version = item
+                else:
+                    scanned_results.append(item)
+        return scanned_results, version
+
+    @staticmethod
+    def generate_items_from_lines(lines):
+        """Lazily yield a Version for each version line and a ResultLine for each result line
+
+        lines can be any iterable of strings, like an opened file or a pipe, so
+        that the content never needs to be fully loaded in memory.
+        """
         for line in lines:
             if line.startswith(FileReader.VERSION_TOKEN):
-                version = Version.from_metadata(line[len(FileReader.VERSION_TOKEN) :])
+                yield Version.from_metadata(line[len(FileReader.VERSION_TOKEN) :])
             else:
                 try:
                     result_line = FileReader.get_scan_info_and_job_data_from_line(line)
@@ -76,8 +89,7 @@ class FileReader:
                     )
                     result_line = None
                 if result_line:
-                    scanned_results.append(result_line)
-        return scanned_results, version
+                    yield result_line
 
     @staticmethod
     def get_scan_info_and_job_data_from_line(str_line):
@@ -117,3 +129,16 @@ class FileReader:
         sorted_result_lines = sorted(result_lines, key=group_key)
         key_scan_result_groups = groupby(sorted_result_lines, group_key)
         return key_scan_result_groups
+
+    @staticmethod
+    def generate_consecutive_result_groups(result_lines):
+        """Group result lines of the same job without sorting them first
+
+        Contrary to generate_result_groups, result_lines is consumed lazily, which
+        requires the lines of one job to be consecutive, as written by ResultLogger.
+        """
+
+        def group_key(res):
+            return res.job_counter
+
+        return groupby(result_lines, group_key)
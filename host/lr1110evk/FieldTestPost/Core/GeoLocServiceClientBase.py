@@ -36,6 +36,7 @@ from .Geocoding import GeocodingBuilder
 from lr1110evk.BaseTypes import Coordinate
 import requests
 from json import loads
+from threading import local
 
 
 class GeoLocServiceClientBaseException(Exception):
@@ -74,6 +75,9 @@ class GeoLocServiceClientBase:
     def __init__(self, server_address, authentication_token):
         self.__server_address = server_address
         self.authentication_token = authentication_token
+        # One HTTP session per thread so that connections are kept alive
+        # between requests without sharing a session between threads
+        self.__thread_sessions = local()
 
     @classmethod
     def get_default_base_url(cls):
@@ -134,8 +138,15 @@ class GeoLocServiceClientBase:
     def build_response(self, http_code, response_text):
         raise NotImplementedError
 
+    def get_session(self):
+        try:
+            return self.__thread_sessions.session
+        except AttributeError:
+            self.__thread_sessions.session = requests.Session()
+            return self.__thread_sessions.session
+
     def produce_response_from_request(self, request_data):
-        response = requests.post(
+        response = self.get_session().post(
             self.server_address,
             headers=self.build_header_from_authentication_token(
                 self.authentication_token
@@ -0,0 +1,117 @@
+"""
+Define request pipeline for field test post processing
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from concurrent.futures import ThreadPoolExecutor
+from collections import deque
+from .RequestSender import SolverContactException
+from .ResponseBase import ResponseNoCoordinateException
+from .GeoLocServiceClientBase import (
+    GeoLocServiceBadResponseStatus,
+    GeoLocServiceTimeoutException,
+)
+
+
+class RequestPipelineException(Exception):
+    pass
+
+
+class RequestPipelineBadMaxInFlight(RequestPipelineException):
+    def __init__(self, max_in_flight):
+        self.max_in_flight = max_in_flight
+
+    def __str__(self):
+        return "Maximum number of in-flight requests must be at least 1, got {}".format(
+            self.max_in_flight
+        )
+
+
+class RequestPipeline:
+    """Send the requests of a scan group iterator concurrently
+
+    At most max_in_flight requests are waiting for a server response at any
+    time, while the scan groups that follow are parsed and turned into
+    requests. Results are yielded in the same order as the scan groups, so the
+    output does not depend on server response times.
+    """
+
+    DEFAULT_MAX_IN_FLIGHT = 8
+    SOLVER_EXCEPTIONS = (
+        ResponseNoCoordinateException,
+        GeoLocServiceBadResponseStatus,
+        GeoLocServiceTimeoutException,
+        SolverContactException,
+    )
+
+    def __init__(self, request_sender, max_in_flight=DEFAULT_MAX_IN_FLIGHT):
+        if max_in_flight < 1:
+            raise RequestPipelineBadMaxInFlight(max_in_flight)
+        self.request_sender = request_sender
+        self.max_in_flight = max_in_flight
+
+    def solve(self, request):
+        # Solver exceptions are returned instead of raised so that one failing
+        # request does not stop the processing of the following ones
+        try:
+            return self.request_sender.send_request(request)
+        except RequestPipeline.SOLVER_EXCEPTIONS as solver_exception:
+            return solver_exception
+
+    def process(self, scan_request_iterator):
+        """Yield (scan_info, request, coordinate_or_exception) in scan group order
+
+        coordinate_or_exception is None for scan groups without request.
+        """
+        pending = deque()
+        n_in_flight = 0
+        with ThreadPoolExecutor(
+            max_workers=self.max_in_flight, thread_name_prefix="RequestPipeline"
+        ) as executor:
+            for scan_info, request in scan_request_iterator:
+                if request:
+                    future = executor.submit(self.solve, request)
+                    n_in_flight += 1
+                else:
+                    future = None
+                pending.append((scan_info, request, future))
+                # Block on the oldest request only when the window is full
+                while pending and (
+                    pending[0][2] is None or n_in_flight >= self.max_in_flight
+                ):
+                    scan_info_done, request_done, future_done = pending.popleft()
+                    if future_done is not None:
+                        n_in_flight -= 1
+                    yield self.get_result(scan_info_done, request_done, future_done)
+            while pending:
+                yield self.get_result(*pending.popleft())
+
+    @staticmethod
+    def get_result(scan_info, request, future):
+        if future is None:
+            return scan_info, request, None
+        return scan_info, request, future.result()
@@ -0,0 +1,193 @@
+"""
+Define a stand-in geolocation server answering Wi-Fi and GNSS solver requests locally
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from http.server import HTTPServer, BaseHTTPRequestHandler
+from socketserver import ThreadingMixIn
+from threading import Thread, Lock
+from json import loads, dumps
+from hashlib import sha256
+import random
+import time
+
+
+class StandInGeoLocServerBadLatency(Exception):
+    def __init__(self, latency_min_s, latency_max_s):
+        self.latency_min_s = latency_min_s
+        self.latency_max_s = latency_max_s
+
+    def __str__(self):
+        return "Latency range must satisfy 0 <= min <= max, got [{}, {}] s".format(
+            self.latency_min_s, self.latency_max_s
+        )
+
+
+class StandInGeoLocServerHttp(ThreadingMixIn, HTTPServer):
+    daemon_threads = True
+
+
+class StandInGeoLocRequestHandler(BaseHTTPRequestHandler):
+    # HTTP/1.1 keeps the connections of the client sessions alive
+    protocol_version = "HTTP/1.1"
+    # Headers and body are written separately: without this, delayed
+    # acknowledgements add tens of milliseconds to every response
+    disable_nagle_algorithm = True
+
+    def do_POST(self):
+        content_length = int(self.headers.get("Content-Length", 0))
+        request_body = self.rfile.read(content_length)
+        stand_in_server = self.server.stand_in_server
+        time.sleep(stand_in_server.draw_latency())
+        try:
+            response_dict = stand_in_server.build_response_dict(
+                self.path, loads(request_body)
+            )
+        except ValueError:
+            self.send_answer(400, {"error": "Malformed request"})
+            return
+        self.send_answer(200, response_dict)
+
+    def send_answer(self, http_code, response_dict):
+        response_body = dumps(response_dict).encode()
+        self.send_response(http_code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(response_body)))
+        self.end_headers()
+        self.wfile.write(response_body)
+
+    def log_message(self, format, *args):
+        # Keep the benchmark output readable
+        pass
+
+
+class StandInGeoLocServer:
+    """Answer GLS Wi-Fi and DAS GNSS solver requests on the local host
+
+    Each request is answered after a latency drawn uniformly in
+    [latency_min_s, latency_max_s] from a seeded generator. The coordinate
+    returned is derived from a hash of the request body, so the same request
+    always gets the same answer whatever the order it is received in. Requests
+    whose path ends with the GNSS path get a DAS formatted response, all the
+    others get a GLS formatted one.
+    """
+
+    DEFAULT_LATENCY_MIN_S = 0.010
+    DEFAULT_LATENCY_MAX_S = 0.060
+    DEFAULT_SEED = 0
+    GNSS_PATH = "uplink/send"
+    ACCURACY_M = 20
+
+    def __init__(
+        self,
+        port=0,
+        latency_min_s=DEFAULT_LATENCY_MIN_S,
+        latency_max_s=DEFAULT_LATENCY_MAX_S,
+        seed=DEFAULT_SEED,
+    ):
+        if not 0 <= latency_min_s <= latency_max_s:
+            raise StandInGeoLocServerBadLatency(latency_min_s, latency_max_s)
+        self.latency_min_s = latency_min_s
+        self.latency_max_s = latency_max_s
+        self.__random = random.Random(seed)
+        self.__random_lock = Lock()
+        self.__http_server = StandInGeoLocServerHttp(
+            ("127.0.0.1", port), StandInGeoLocRequestHandler
+        )
+        self.__http_server.stand_in_server = self
+        self.__thread = None
+
+    @property
+    def port(self):
+        return self.__http_server.server_address[1]
+
+    @property
+    def base_url(self):
+        return "http://127.0.0.1"
+
+    def draw_latency(self):
+        with self.__random_lock:
+            return self.__random.uniform(self.latency_min_s, self.latency_max_s)
+
+    @staticmethod
+    def coordinate_from_request(request_dict):
+        digest = sha256(dumps(request_dict, sort_keys=True).encode()).digest()
+        latitude = int.from_bytes(digest[0:4], "big") / 2 ** 32 * 180 - 90
+        longitude = int.from_bytes(digest[4:8], "big") / 2 ** 32 * 360 - 180
+        altitude = int.from_bytes(digest[8:10], "big") / 2 ** 16 * 1000
+        return latitude, longitude, altitude
+
+    def build_response_dict(self, path, request_dict):
+        latitude, longitude, altitude = self.coordinate_from_request(request_dict)
+        if path.endswith(StandInGeoLocServer.GNSS_PATH):
+            return {
+                "result": {
+                    dev_eui: {
+                        "result": {
+                            "position_solution": {
+                                "llh": [latitude, longitude, altitude],
+                                "accuracy": StandInGeoLocServer.ACCURACY_M,
+                            },
+                            "log_messages": [],
+                        }
+                    }
+                    for dev_eui in request_dict
+                }
+            }
+        return {
+            "result": {
+                "latitude": latitude,
+                "longitude": longitude,
+                "altitude": altitude,
+                "accuracy": StandInGeoLocServer.ACCURACY_M,
+            }
+        }
+
+    def start(self):
+        self.__thread = Thread(
+            target=self.__http_server.serve_forever,
+            name="StandInGeoLocServer",
+            daemon=True,
+        )
+        self.__thread.start()
+
+    def serve_forever(self):
+        self.__http_server.serve_forever()
+
+    def stop(self):
+        if self.__thread:
+            self.__http_server.shutdown()
+            self.__thread.join()
+            self.__thread = None
+        self.__http_server.server_close()
+
+    def __enter__(self):
+        self.start()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.stop()
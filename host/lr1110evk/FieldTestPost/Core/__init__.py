@@ -4,6 +4,7 @@ from .RequestSender import (
     NoNavMessageException,
     SolverContactException,
 )
+from .RequestPipeline import RequestPipeline, RequestPipelineException
 from .GeoLocServiceClientBase import (
     GeoLocServiceClientGnss,
     GeoLocServiceClientWifi,
@@ -18,3 +19,4 @@ from .ResponseBase import (
     ResponseBaseException,
 )
 from .RequestBase import RequestGnssPerDeviceFake, RequestWifiGls
+from .StandInGeoLocServer import StandInGeoLocServer, StandInGeoLocServerBadLatency
@@ -32,6 +32,7 @@ from lr1110evk.AppConfiguration import FieldTestConfiguration
 from .Core import (
     FileReader,
     RequestSender,
+    RequestPipeline,
     SolverContactException,
     GeoLocServiceClientGnss,
     GeoLocServiceClientWifi,
@@ -102,6 +103,7 @@ def post_analyzis_fetch_results():
     default_wifi_server_base = GeoLocServiceClientWifi.get_default_base_url()
     default_gnss_server_base = GeoLocServiceClientGnss.get_default_base_url()
     default_dry_run = False
+    default_max_in_flight_requests = RequestPipeline.DEFAULT_MAX_IN_FLIGHT
 
     version = pkg_resources.get_distribution("lr1110evk").version
     parser = ArgumentParser()
@@ -162,6 +164,15 @@ def post_analyzis_fetch_results():
         ),
         default=default_dry_run,
     )
+    parser.add_argument(
+        "-j",
+        "--max-in-flight-requests",
+        type=int,
+        help="Maximum number of requests waiting for a server response at the same time. Results are written in scan order whatever this value (default={})".format(
+            default_max_in_flight_requests
+        ),
+        default=default_max_in_flight_requests,
+    )
     parser.add_argument(
         "--no_wifi",
         "-W",
@@ -211,13 +222,8 @@ def post_analyzis_fetch_results():
     if kml_file:
         kml = kmlOutput("LR1110", f"{kml_file}")
 
-    for scan_request in scan_request_iterator:
-        request = scan_request[1]
-        scan_info = scan_request[0]
-        init_date = scan_info[0].date
-        job_counter = scan_info[0].job_counter
-        job_id = scan_info[0].job_id
-        if configuration.dry_run:
+    if configuration.dry_run:
+        for scan_info, request in scan_request_iterator:
             if request:
                 print(
                     "Dry run: would have send the following on server '{}'\nHeader:\n{}\n\nData:\n{}".format(
@@ -228,73 +234,77 @@ def post_analyzis_fetch_results():
                         request,
                     )
                 )
-            continue
-        if not request:
-            result = SolverExceptionResult(
-                date=init_date,
-                job_counter=job_counter,
-                job_id=job_id,
-                exception=f"Exception during scan: '{scan_info}'",
-            )
-        else:
-            try:
-                coordinate = request_sender.send_request(request)
-            except ResponseNoCoordinateException as excp:
-                print("Exception: {}\n  -> Request: {}\n".format(excp, request))
+    else:
+        request_pipeline = RequestPipeline(
+            request_sender, configuration.max_in_flight_requests
+        )
+
+        for scan_info, request, solver_outcome in request_pipeline.process(
+            scan_request_iterator
+        ):
+            init_date = scan_info[0].date
+            job_counter = scan_info[0].job_counter
+            job_id = scan_info[0].job_id
+            if not request:
                 result = SolverExceptionResult(
                     date=init_date,
                     job_counter=job_counter,
                     job_id=job_id,
-                    exception=excp,
+                    exception=f"Exception during scan: '{scan_info}'",
+                )
+            elif isinstance(solver_outcome, GeoLocServiceTimeoutException):
+                print(
+                    "Exception: Timeout {}\n  -> Request: {}\n".format(
+                        solver_outcome, request
+                    )
                 )
-            except GeoLocServiceBadResponseStatus as excp_geoloc:
-                print("Exception: {}\n  -> Request: {}\n".format(excp_geoloc, request))
                 result = SolverExceptionResult(
                     date=init_date,
                     job_counter=job_counter,
                     job_id=job_id,
-                    exception=excp_geoloc,
+                    exception=solver_outcome,
                 )
-            except GeoLocServiceTimeoutException as excp_timeout:
+            elif isinstance(solver_outcome, SolverContactException):
                 print(
-                    "Exception: Timeout {}\n  -> Request: {}\n".format(
-                        excp_timeout, request
+                    "Exception: Solver contact failed: '{}'\n  -> Request: {}\n".format(
+                        solver_outcome, request
                     )
                 )
                 result = SolverExceptionResult(
                     date=init_date,
                     job_counter=job_counter,
                     job_id=job_id,
-                    exception=excp_timeout,
+                    exception=solver_outcome,
                 )
-            except SolverContactException as excp_solver_contact:
+            elif isinstance(
+                solver_outcome,
+                (ResponseNoCoordinateException, GeoLocServiceBadResponseStatus),
+            ):
                 print(
-                    "Exception: Solver contact failed: '{}'\n  -> Request: {}\n".format(
-                        excp_solver_contact, request
-                    )
+                    "Exception: {}\n  -> Request: {}\n".format(solver_outcome, request)
                 )
                 result = SolverExceptionResult(
                     date=init_date,
                     job_counter=job_counter,
                     job_id=job_id,
-                    exception=excp_solver_contact,
+                    exception=solver_outcome,
                 )
             else:
                 result = SolverResultCoordinate(
                     date=init_date,
                     job_counter=job_counter,
                     job_id=job_id,
-                    coordinate=coordinate,
+                    coordinate=solver_outcome,
                 )
                 if kml_file:
                     store_result_to_kml(scan_info, init_date, kml, result)
 
-        with open(output_file, "a") as f:
-            f.write(
-                "[{result.date}] [{result.job_counter} - {result.job_id}] {result.information}\n".format(
-                    result=result,
+            with open(output_file, "a") as f:
+                f.write(
+                    "[{result.date}] [{result.job_counter} - {result.job_id}] {result.information}\n".format(
+                        result=result,
+                    )
                 )
-            )
 
     if kml_file:
         if configuration.user_defined_coordinate:
@@ -34,6 +34,7 @@ from ..SerialExchange.Commands import (
     WifiEnableMode,
     GnssAntennaSelection,
     GnssConstellation,
+    CommandStartGnssBase,
 )
 from ..BaseTypes import Coordinate, WifiChannels
 from copy import copy
@@ -47,22 +48,30 @@ class Job:
     WIFI_MAX_RESULT_PER_SCAN_KEY = "wifi_max_result_per_scan"
     WIFI_TIMEOUT_KEY = "wifi_timeout"
     WIFI_MODE_KEY = "wifi_mode"
+    WIFI_ADAPTIVE_KEY = "wifi_adaptive"
+    WIFI_TIME_BUDGET_KEY = "wifi_time_budget"
     GNSS_AUTONOMOUS_ENABLE_KEY = "gnss_autonomous_enable"
     GNSS_AUTONOMOUS_OPTION_KEY = "gnss_autonomous_option"
     GNSS_AUTONOMOUS_CAPTURE_MODE_KEY = "gnss_autonomous_capture_mode"
     GNSS_AUTONOMOUS_NB_SATELLITE_KEY = "gnss_autonomous_nb_satellite"
     GNSS_AUTONOMOUS_ANTENNA_SELECTION = "gnss_autonomous_antenna_selection"
     GNSS_AUTONOMOUS_CONSTELLATIONS_KEY = "gnss_autonomous_constellations"
+    GNSS_AUTONOMOUS_DUAL_SCAN_KEY = "gnss_autonomous_dual_scan"
     GNSS_ASSISTED_ENABLE_KEY = "gnss_assisted_enable"
     GNSS_ASSISTED_OPTION_KEY = "gnss_assisted_option"
     GNSS_ASSISTED_CAPTURE_MODE_KEY = "gnss_assisted_capture_mode"
     GNSS_ASSISTED_NB_SATELLITE_KEY = "gnss_assisted_nb_satellite"
     GNSS_ASSISTED_ANTENNA_SELECTION = "gnss_assisted_antenna_selection"
     GNSS_ASSISTED_CONSTELLATIONS_KEY = "gnss_assisted_constellations"
+    GNSS_ASSISTED_DUAL_SCAN_KEY = "gnss_assisted_dual_scan"
+    DUAL_SCAN_SKIP_NB_SV_KEY = "skip_nb_sv"
+    DUAL_SCAN_CNR_MIN_KEY = "cnr_min"
+    DUAL_SCAN_MIN_SV_KEY = "min_sv"
     ASSISTED_COORDINATE_KEY = "assisted_coordinate"
     LATITUDE_KEY = "latitude"
     LONGITUDE_KEY = "longitude"
     ALTITUDE_KEY = "altitude"
+    UNCERTAINTY_KEY = "uncertainty"
     JOB_NAME_KEY = "name"
     N_ITERATIONS_KEY = "n_iterations"
     RESET_BEFORE_JOB_START_KEY = "reset_before_job_start"
@@ -82,19 +91,24 @@ class Job:
         self.wifi_max_results = 0
         self.wifi_timeout = 0
         self.wifi_mode = WifiMode.beacon_only
+        self.wifi_adaptive = False
+        self.wifi_time_budget = 0
         self.gnss_autonomous_enable = gnss_autonomous_enable
         self.gnss_autonomous_option = GnssOption.default
         self.gnss_autonomous_capture_mode = GnssCaptureMode.single
         self.gnss_autonomous_nb_satellite = 0
         self.gnss_autonomous_antenna_selection = GnssAntennaSelection.no_selection
         self.gnss_autonomous_constellation_mask = b"\x00"
+        self.gnss_autonomous_dual_scan = None
         self.gnss_assisted_enable = gnss_assisted_enable
         self.gnss_assisted_option = GnssOption.default
         self.gnss_assisted_capture_mode = GnssCaptureMode.single
         self.gnss_assisted_nb_satellite = 0
         self.gnss_assisted_antenna_selection = GnssAntennaSelection.no_selection
         self.gnss_assisted_constellation_mask = b"\x00"
+        self.gnss_assisted_dual_scan = None
         self.assisted_coordinate = Coordinate(0, 0, 0)
+        self.assisted_uncertainty = None
         self.id = 0
         self.name = name
         self.n_iterations = n_iteration
@@ -107,6 +121,7 @@ class Job:
             altitude=coordinate_dict[Job.ALTITUDE_KEY],
         )
         self.assisted_coordinate = assisted_coordinate
+        self.assisted_uncertainty = coordinate_dict.get(Job.UNCERTAINTY_KEY, None)
 
     def SetWifiChannelsFromJobDict(self, wifi_channel_names):
         self.wifi_channels = [
@@ -133,6 +148,11 @@ class Job:
             constellations
         )
 
+    def SetGnssAutonomousDualScanFromJobDict(self, dual_scan_dict):
+        self.gnss_autonomous_dual_scan = Job.dual_scan_thresholds_from_dict(
+            dual_scan_dict
+        )
+
     def SetGnssAssistedOptionFromJobDict(self, assisted_option):
         self.gnss_assisted_option = GnssOption[assisted_option]
 
@@ -147,6 +167,11 @@ class Job:
             constellations
         )
 
+    def SetGnssAssistedDualScanFromJobDict(self, dual_scan_dict):
+        self.gnss_assisted_dual_scan = Job.dual_scan_thresholds_from_dict(
+            dual_scan_dict
+        )
+
     def SetJobElement(self, element_key, element_value):
         SETTERS = {
             Job.WIFI_API_KEY: lambda obj, value: Job.SetWifiEnableMode(obj, value),
@@ -166,6 +191,12 @@ class Job:
             Job.WIFI_MODE_KEY: lambda obj, value: Job.SetWifiModeFromJobDict(
                 obj, value
             ),
+            Job.WIFI_ADAPTIVE_KEY: lambda obj, value: setattr(
+                obj, "wifi_adaptive", value
+            ),
+            Job.WIFI_TIME_BUDGET_KEY: lambda obj, value: setattr(
+                obj, "wifi_time_budget", value
+            ),
             Job.GNSS_AUTONOMOUS_OPTION_KEY: lambda obj, value: Job.SetGnssAutonomousOptionFromJobDict(
                 obj, value
             ),
@@ -181,6 +212,9 @@ class Job:
             Job.GNSS_AUTONOMOUS_CONSTELLATIONS_KEY: lambda obj, value: Job.SetGnssAutonomousConstellationMaskFromJobDict(
                 obj, value
             ),
+            Job.GNSS_AUTONOMOUS_DUAL_SCAN_KEY: lambda obj, value: Job.SetGnssAutonomousDualScanFromJobDict(
+                obj, value
+            ),
             Job.GNSS_ASSISTED_OPTION_KEY: lambda obj, value: Job.SetGnssAssistedOptionFromJobDict(
                 obj, value
             ),
@@ -196,6 +230,9 @@ class Job:
             Job.GNSS_ASSISTED_CONSTELLATIONS_KEY: lambda obj, value: Job.SetGnssAssistedConstellationMaskFromJobDict(
                 obj, value
             ),
+            Job.GNSS_ASSISTED_DUAL_SCAN_KEY: lambda obj, value: Job.SetGnssAssistedDualScanFromJobDict(
+                obj, value
+            ),
             Job.ASSISTED_COORDINATE_KEY: lambda obj, value: Job.SetCoordinatesFromJobDict(
                 obj, value
             ),
@@ -250,6 +287,27 @@ class Job:
     def job_dict_is_wifi(job_dict):
         return Job.WIFI_CHANNELS_KEY in job_dict
 
+    @staticmethod
+    def dual_scan_thresholds_from_dict(dual_scan_dict):
+        """ Get the (skip_nb_sv, cnr_min, min_sv) thresholds of the dual scan
+
+        The thresholds missing from the dictionary take the firmware defaults.
+        """
+        return (
+            dual_scan_dict.get(
+                Job.DUAL_SCAN_SKIP_NB_SV_KEY,
+                CommandStartGnssBase.DUAL_SCAN_SKIP_NB_SV_DEFAULT,
+            ),
+            dual_scan_dict.get(
+                Job.DUAL_SCAN_CNR_MIN_KEY,
+                CommandStartGnssBase.DUAL_SCAN_CNR_MIN_DEFAULT,
+            ),
+            dual_scan_dict.get(
+                Job.DUAL_SCAN_MIN_SV_KEY,
+                CommandStartGnssBase.DUAL_SCAN_MIN_SV_DEFAULT,
+            ),
+        )
+
     @staticmethod
     def job_dict_is_gnss_autonomous(job_dict):
         return Job.GNSS_AUTONOMOUS_OPTION_KEY in job_dict
@@ -170,6 +170,8 @@ class JobExecutor:
             )
         nbr_result_to_fetch = fetch_result_response.nbr_results
         results = self.receive_results(nbr_result_to_fetch)
+        for result in results:
+            result.telemetry = fetch_result_response.telemetry
         return results
 
     def execute_job(self, job):
@@ -292,6 +294,8 @@ class JobExecutor:
                 start_command.wifi_max_results_per_scan = job.wifi_max_results
                 start_command.wifi_timeout = job.wifi_timeout
                 start_command.wifi_mode = job.wifi_mode
+                start_command.wifi_adaptive = job.wifi_adaptive
+                start_command.wifi_time_budget_ms = job.wifi_time_budget
                 return start_command
             elif job.wifi_enable_mode == WifiEnableMode.country_code:
                 start_command = CommandStartWifiCountryCode()
@@ -310,6 +314,12 @@ class JobExecutor:
             start_command.gnss_constellation_mask = (
                 job.gnss_autonomous_constellation_mask
             )
+            if job.gnss_autonomous_dual_scan is not None:
+                (
+                    start_command.gnss_dual_scan_skip_nb_sv,
+                    start_command.gnss_dual_scan_cnr_min,
+                    start_command.gnss_dual_scan_min_sv,
+                ) = job.gnss_autonomous_dual_scan
             return start_command
         elif job.has_gnss_assisted:
             start_command = CommandStartGnssAssisted()
@@ -318,6 +328,12 @@ class JobExecutor:
             start_command.gnss_nb_satellite = job.gnss_assisted_nb_satellite
             start_command.gnss_antenna_selection = job.gnss_assisted_antenna_selection
             start_command.gnss_constellation_mask = job.gnss_assisted_constellation_mask
+            if job.gnss_assisted_dual_scan is not None:
+                (
+                    start_command.gnss_dual_scan_skip_nb_sv,
+                    start_command.gnss_dual_scan_cnr_min,
+                    start_command.gnss_dual_scan_min_sv,
+                ) = job.gnss_assisted_dual_scan
             return start_command
 
     @staticmethod
@@ -329,6 +345,7 @@ class JobExecutor:
             longitude=job.assisted_coordinate.longitude,
             altitude=job.assisted_coordinate.altitude,
         )
+        command_set_date_loc.gps_assisted_uncertainty_m = job.assisted_uncertainty
         return command_set_date_loc
 
     def wait_event_or_timeout(self, timeout_s):
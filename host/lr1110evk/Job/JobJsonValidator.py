@@ -99,12 +99,21 @@ class WifiJobDocument(CommonJobDocument):
     wifi_max_result_per_scan = NumberField(minimum=0, multiple=1)
     wifi_timeout = NumberField(minimum=0, multiple=1)
     wifi_mode = WifiModeField()
+    wifi_adaptive = BooleanField()
+    wifi_time_budget = NumberField(multiple_of=1, minimum=0, maximum=65535)
 
 
 class AssistedCoordinateDocument(Document):
     latitude = NumberField()
     longitude = NumberField()
     altitude = NumberField()
+    uncertainty = NumberField(multiple_of=1, minimum=0, maximum=4294967295)
+
+
+class GnssDualScanDocument(Document):
+    skip_nb_sv = NumberField(multiple_of=1, minimum=0, maximum=255)
+    cnr_min = NumberField(multiple_of=1, minimum=-128, maximum=127)
+    min_sv = NumberField(multiple_of=1, minimum=0, maximum=255)
 
 
 class GnssAutonomousDocument(CommonJobDocument):
@@ -113,6 +122,7 @@ class GnssAutonomousDocument(CommonJobDocument):
     gnss_autonomous_nb_satellite = NumberField(multiple_of=1, minimum=0, maximum=255)
     gnss_autonomous_antenna_selection = GnssAntennaSelectionField()
     gnss_autonomous_constellations = ArrayField(GnssConstellationField())
+    gnss_autonomous_dual_scan = DocumentField(GnssDualScanDocument)
 
 
 class GnssAssistedDocument(CommonJobDocument):
@@ -121,6 +131,7 @@ class GnssAssistedDocument(CommonJobDocument):
     gnss_assisted_nb_satellite = NumberField(multiple_of=1, minimum=0, maximum=255)
     gnss_assisted_antenna_selection = GnssAntennaSelectionField()
     gnss_assisted_constellations = ArrayField(GnssConstellationField())
+    gnss_assisted_dual_scan = DocumentField(GnssDualScanDocument)
     assisted_coordinate = DocumentField(AssistedCoordinateDocument)
 
 
@@ -140,23 +140,20 @@ class ResultLogger(Logger):
         timing_capture = str(mac_address_object.timing_capture)
         timing_correlation = str(mac_address_object.timing_correlation)
         timing_detection = str(mac_address_object.timing_detection)
-
-        wifi_message = "[{} - {}] {}".format(
-            job_counter,
-            job_id,
-            ", ".join(
-                [
-                    mac_address,
-                    wifi_channel,
-                    wifi_type,
-                    rssi,
-                    timing_demodulation,
-                    timing_capture,
-                    timing_correlation,
-                    timing_detection,
-                ]
-            ),
-        )
+        fields = [
+            mac_address,
+            wifi_channel,
+            wifi_type,
+            rssi,
+            timing_demodulation,
+            timing_capture,
+            timing_correlation,
+            timing_detection,
+        ]
+        if wifi_scan.telemetry is not None:
+            fields.extend(wifi_scan.telemetry.to_csv_fields())
+
+        wifi_message = "[{} - {}] {}".format(job_counter, job_id, ", ".join(fields))
         self.log(wifi_message, wifi_date)
 
     def log_gnss(self, gnss_scan, job_id, job_counter):
@@ -165,17 +162,14 @@ class ResultLogger(Logger):
         gnss_radio_timing = str(gnss_scan.gnss_scan.radio_timing_ms)
         gnss_computation_timing = str(gnss_scan.gnss_scan.computation_timing_ms)
         elapsed_s = "0"
-
-        gnss_message = "[{} - {}] {}".format(
-            job_counter,
-            job_id,
-            ", ".join(
-                [
-                    gnss_nav_message,
-                    elapsed_s,
-                    gnss_radio_timing,
-                    gnss_computation_timing,
-                ]
-            ),
-        )
+        fields = [
+            gnss_nav_message,
+            elapsed_s,
+            gnss_radio_timing,
+            gnss_computation_timing,
+        ]
+        if gnss_scan.telemetry is not None:
+            fields.extend(gnss_scan.telemetry.to_csv_fields())
+
+        gnss_message = "[{} - {}] {}".format(job_counter, job_id, ", ".join(fields))
         self.log(gnss_message, gnss_date)
@@ -0,0 +1,166 @@
+"""
+Define the job updating the firmware of the LR1110
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from queue import Empty
+from ..SerialExchange import (
+    CommandFirmwareUpdateStart,
+    CommandFirmwareUpdateChunk,
+    CommandFirmwareUpdateFinish,
+    CommunicationHandler,
+    CommunicationHandlerNoResponse,
+    FirmwareUpdateStatus,
+)
+
+
+class UpdateFirmwareException(Exception):
+    pass
+
+
+class UpdateFirmwareWrongResponseException(UpdateFirmwareException):
+    def __init__(self, response_received):
+        self.response_received = response_received
+
+    def __str__(self):
+        return "Received unexpected response while updating firmware: {}".format(
+            self.response_received
+        )
+
+
+class UpdateFirmwareFailure(UpdateFirmwareException):
+    def __init__(self, step, status):
+        self.step = step
+        self.status = status
+
+    def __str__(self):
+        return "Firmware update failure reported while {}: {}".format(
+            self.step, self.status.name
+        )
+
+
+class UpdateFirmwareJob:
+    # Erasing the flash of the LR1110 and rebooting it take a few seconds
+    LONG_RESPONSE_TIMEOUT_S = 10
+    PROGRESS_STEP_PERCENT = 10
+
+    def __init__(
+        self,
+        communication_handler: CommunicationHandler,
+        firmware_image: bytes,
+        expected_hash: bytes = None,
+        logger=None,
+    ):
+        """Write firmware_image, an encrypted LR1110 image, through the bootloader
+
+        firmware_image is the sequence of the 32-bit words of the image, each in
+        big endian. If given, expected_hash is checked against the hash of the
+        flash content before rebooting the LR1110
+        """
+        self.firmware_image = firmware_image
+        self.expected_hash = expected_hash
+        self.communication_handler = communication_handler
+        self.logger = logger
+        self.bootloader_response = None
+        self.finish_response = None
+
+    def log(self, info):
+        if self.logger:
+            self.logger.log(info)
+
+    def execute_update(self):
+        self.start_update()
+        self.push_image()
+        self.finish_update()
+
+    def start_update(self):
+        self.log("Erasing the flash of the LR1110...")
+        image_size = len(self.firmware_image)
+        command = CommandFirmwareUpdateStart(image_size, self.expected_hash)
+        response = self.exchange_with_long_timeout(command)
+        if response.status != FirmwareUpdateStatus.ok:
+            raise UpdateFirmwareFailure("starting", response.status)
+        self.bootloader_response = response
+        self.log("Bootloader ready: {}".format(response))
+
+    def push_image(self):
+        """Send the chunks of the image, one ahead of the one being written
+
+        The embedded side acknowledges a chunk before writing it, so sending the
+        next chunk on each acknowledgement lets it arrive during the write
+        """
+        image = self.firmware_image
+        chunk_size = CommandFirmwareUpdateChunk.CHUNK_SIZE
+        commands = [
+            CommandFirmwareUpdateChunk(offset, image[offset : offset + chunk_size])
+            for offset in range(0, len(image), chunk_size)
+        ]
+        self.log("Writing {} chunks...".format(len(commands)))
+        next_progress_percent = UpdateFirmwareJob.PROGRESS_STEP_PERCENT
+        self.communication_handler.send_one_command(commands[0])
+        for index, command in enumerate(commands):
+            response = self.communication_handler.wait_and_handle_response()
+            if not self.is_exchange_valid(command, response):
+                raise UpdateFirmwareWrongResponseException(response)
+            if response.status != FirmwareUpdateStatus.ok:
+                raise UpdateFirmwareFailure(
+                    "writing chunk at offset {}".format(command.offset), response.status
+                )
+            if index + 1 < len(commands):
+                self.communication_handler.send_one_command(commands[index + 1])
+            progress_percent = 100 * response.nb_bytes_accepted / len(image)
+            if progress_percent >= next_progress_percent:
+                self.log("{:.0f}%".format(progress_percent))
+                next_progress_percent += UpdateFirmwareJob.PROGRESS_STEP_PERCENT
+        self.log("Writing terminated")
+
+    def finish_update(self):
+        self.log("Checking and rebooting...")
+        response = self.exchange_with_long_timeout(CommandFirmwareUpdateFinish())
+        self.finish_response = response
+        if response.status != FirmwareUpdateStatus.ok:
+            raise UpdateFirmwareFailure("checking", response.status)
+        self.log("Update terminated: {}".format(response))
+
+    def exchange_with_long_timeout(self, command):
+        self.communication_handler.send_one_command(command)
+        try:
+            get_response = (
+                self.communication_handler.get_response_from_fifo_and_filter_out_log
+            )
+            response = get_response(timeout=UpdateFirmwareJob.LONG_RESPONSE_TIMEOUT_S)
+        except Empty:
+            raise CommunicationHandlerNoResponse(
+                UpdateFirmwareJob.LONG_RESPONSE_TIMEOUT_S
+            )
+        if not self.is_exchange_valid(command, response):
+            raise UpdateFirmwareWrongResponseException(response)
+        return response
+
+    @staticmethod
+    def is_exchange_valid(command, response):
+        return command.get_com_code() == response.get_response_code()
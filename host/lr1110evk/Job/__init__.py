@@ -10,3 +10,8 @@ from .UpdateAlmanacJob import (
     UpdateAlmanacWrongResponseException,
     UpdateAlmanacJob,
 )
+from .UpdateFirmwareJob import (
+    UpdateFirmwareFailure,
+    UpdateFirmwareWrongResponseException,
+    UpdateFirmwareJob,
+)
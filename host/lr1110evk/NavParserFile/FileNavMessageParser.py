@@ -28,35 +28,37 @@ Define NAV message library integration class
 """
 
 from NavParser import NavMessageConsumerBitsExtractionOutOfBound, NavMessageParser
+from NavParser.NavMessageParser import NotGnssSolverDestinationException
 from lr1110evk.FieldTestPost.Core.FileReader import FileReader
-from lr1110evk.BaseTypes import ScannedGnss
+from lr1110evk.BaseTypes import ScannedGnss, Version
 from lr1110evk.Job.Logger import ResultLogger
 from collections import namedtuple
+from itertools import islice
+from sys import stdin
 
 
 class FileNavMessageParserException(Exception):
     pass
 
 
-class NotGnssSolverDestinationException(FileNavMessageParserException):
-    def __init__(self, destination):
-        self.actual_destination = destination
-
-    def __str__(self):
-        return "The NAV message must be destinated to GNSS solver, but its actual destination is {}".format(
-            self.actual_destination.get_name()
-        )
-
-
 class FileNavMessageParserInterpreter:
     ParsedGnssNavMessage = namedtuple(
         "ParsedGnssNavMessage", ["date", "job_counter", "job_id", "parsed_info"]
     )
 
+    STDIN_FILENAME = "-"
+    # Interpreted messages are written by blocks instead of the Logger default
+    # which reopens the output file every few entries
+    OUTPUT_BUFFER_LIMIT = 4096
+    GnssJob = namedtuple("GnssJob", ["job_counter", "job_id", "gnss_data"])
+
     def __init__(self, input_filename, output_filename=None):
         self.input_filename = input_filename
         if output_filename:
             self.output_logger = ResultLogger(output_filename)
+            self.output_logger.buffer_limit = (
+                FileNavMessageParserInterpreter.OUTPUT_BUFFER_LIMIT
+            )
         else:
             self.output_logger = None
 
@@ -73,47 +75,91 @@ class FileNavMessageParserInterpreter:
             print(message)
 
     def parse_file(self):
-        scanned_results, version = FileReader.parse_file(self.input_filename)
-        self.log_or_print_metadata(version)
-        key_scan_result_groups = FileReader.generate_result_groups(scanned_results)
+        if self.input_filename == FileNavMessageParserInterpreter.STDIN_FILENAME:
+            self.parse_lines(stdin)
+        else:
+            with open(self.input_filename, "r") as f:
+                self.parse_lines(f)
+        if self.output_logger:
+            self.output_logger.terminate()
+
+    def parse_lines(self, lines):
+        # Lines are consumed lazily and NAV messages are decoded by batches, so
+        # memory use does not grow with the size of the input
+        gnss_jobs = self.generate_gnss_jobs(
+            self.generate_result_lines_and_log_version(lines)
+        )
+        while True:
+            batch = list(islice(gnss_jobs, NavMessageParser.DEFAULT_BATCH_SIZE))
+            if not batch:
+                break
+            parse_results = NavMessageParser.parse_batch(
+                [gnss_job.gnss_data.nav_message for gnss_job in batch]
+            )
+            for gnss_job, parse_result in zip(batch, parse_results):
+                self.log_gnss_job(gnss_job, parse_result)
+
+    def generate_result_lines_and_log_version(self, lines):
+        for item in FileReader.generate_items_from_lines(lines):
+            if isinstance(item, Version):
+                self.log_or_print_metadata(item)
+            else:
+                yield item
+
+    def generate_gnss_jobs(self, result_lines):
+        key_scan_result_groups = FileReader.generate_consecutive_result_groups(
+            result_lines
+        )
         for key_scan_group in key_scan_result_groups:
-            # key = key_scan_group[0]
             group_result_lines = list(key_scan_group[1])
-            # date = group_result_lines[0].date
-            scan_info = [grp.scan_info for grp in group_result_lines]
-            job_id = group_result_lines[0].job_id
-            job_counter = group_result_lines[0].job_counter
-            scan_info_types = {scan.__class__ for scan in scan_info}
-            if not ScannedGnss in scan_info_types:
+            gnss_data = [
+                grp.scan_info
+                for grp in group_result_lines
+                if isinstance(grp.scan_info, ScannedGnss)
+            ]
+            if not gnss_data:
                 continue
-
-            # external_data = [data for data in scan_info if isinstance(
-            #     data, ExternalCoordinate)]
-            gnss_data = [data for data in scan_info if isinstance(data, ScannedGnss)][0]
-
-            gnss_date = gnss_data.instant_scan
-            parsed_nav = NavMessageParser.parse(gnss_data.nav_message)
+            yield FileNavMessageParserInterpreter.GnssJob(
+                job_counter=group_result_lines[0].job_counter,
+                job_id=group_result_lines[0].job_id,
+                gnss_data=gnss_data[0],
+            )
+
+    def log_gnss_job(self, gnss_job, parse_result):
+        job_counter = gnss_job.job_counter
+        job_id = gnss_job.job_id
+        gnss_data = gnss_job.gnss_data
+        gnss_date = gnss_data.instant_scan
+
+        if parse_result.parse_error:
+            failure = parse_result.parse_error
+        else:
             try:
-                svid_vs_cn = NavMessageParser.get_cn_vs_from_parsed_message(parsed_nav)
-            except NotGnssSolverDestinationException:
-                continue
-            except NavMessageConsumerBitsExtractionOutOfBound:
-                #  Unrecognize nav message format
-                message_to_log = "[{} - {}] {}".format(
-                    job_counter, job_id, ", ".join([gnss_data.nav_message, "0"])
-                )
-                self.log_or_print(message_to_log, gnss_date)
-                message_to_log = "[{} - {}] Failure: bit extraction out of bound".format(
-                    job_counter, job_id
+                svid_vs_cn = NavMessageParser.get_cn_vs_from_parsed_message(
+                    parse_result.parsed_nav_message
                 )
-                self.log_or_print(message_to_log, gnss_date)
-            else:
-                message_to_log = "[{} - {}] {}".format(
-                    job_counter, job_id, ", ".join([gnss_data.nav_message, "0"])
+            except NotGnssSolverDestinationException:
+                return
+            failure = None
+
+        message_to_log = "[{} - {}] {}".format(
+            job_counter, job_id, ", ".join([gnss_data.nav_message, "0"])
+        )
+        self.log_or_print(message_to_log, gnss_date)
+        if isinstance(failure, NavMessageConsumerBitsExtractionOutOfBound):
+            #  Unrecognize nav message format
+            message_to_log = "[{} - {}] Failure: bit extraction out of bound".format(
+                job_counter, job_id
+            )
+            self.log_or_print(message_to_log, gnss_date)
+        elif failure:
+            message_to_log = "[{} - {}] Failure: {}".format(
+                job_counter, job_id, failure
+            )
+            self.log_or_print(message_to_log, gnss_date)
+        else:
+            for sv_id, c_n in svid_vs_cn.items():
+                message_to_log = "[{} - {}] SV_id: {}, C/N: {}".format(
+                    job_counter, job_id, sv_id, c_n
                 )
                 self.log_or_print(message_to_log, gnss_date)
-                for sv_id, c_n in svid_vs_cn.items():
-                    message_to_log = "[{} - {}] SV_id: {}, C/N: {}".format(
-                        job_counter, job_id, sv_id, c_n
-                    )
-                    self.log_or_print(message_to_log, gnss_date)
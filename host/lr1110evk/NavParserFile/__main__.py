@@ -51,7 +51,7 @@ def entry_point_nav_parser_file():
     )
     parser.add_argument(
         "input_file",
-        help="File to read to extract and interpret NAV messages (or NAV message if -m is provided). Format of the file content is the same as the one provided by Lr1110FieldTest output",
+        help="File to read to extract and interpret NAV messages (or NAV message if -m is provided). Format of the file content is the same as the one provided by Lr1110FieldTest output. Use '-' to read from standard input",
     )
     args = parser.parse_args()
 
@@ -0,0 +1,155 @@
+"""
+Define the commands using the crypto element of the LR1110
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from enum import Enum, unique
+from .CommandBase import CommandBase
+
+
+@unique
+class CryptoElement(Enum):
+    crypto_engine = b"\x00"
+    secure_element = b"\x01"
+
+
+@unique
+class CryptoOperation(Enum):
+    aes_encrypt = b"\x00"
+    aes_cmac = b"\x01"
+
+
+class CommandCryptoSelect(CommandBase):
+    def __init__(self, element=CryptoElement.crypto_engine):
+        super().__init__()
+        self.element = element
+
+    @staticmethod
+    def get_com_code():
+        return b"\x0F\x00"
+
+    def payload_to_bytes(self):
+        return self.element.value
+
+
+class CommandCryptoSetKey(CommandBase):
+    KEY_LENGTH = 16
+
+    def __init__(self, key_id, key):
+        """Set the 16-byte key at index key_id of the selected crypto element
+
+        key_id follows lr1110_crypto_keys_idx_t of the LR1110 driver
+        """
+        super().__init__()
+        if len(key) != CommandCryptoSetKey.KEY_LENGTH:
+            raise ValueError(
+                "Key must be {} bytes long".format(CommandCryptoSetKey.KEY_LENGTH)
+            )
+        self.key_id = key_id
+        self.key = bytes(key)
+
+    @staticmethod
+    def get_com_code():
+        return b"\x10\x00"
+
+    def payload_to_bytes(self):
+        return self.key_id.to_bytes(1, byteorder="little") + self.key
+
+
+class CommandCryptoProcess(CommandBase):
+    # Must follow the HCI buffers of the embedded side
+    MAX_PAYLOAD_LENGTH = 507
+    MAX_RESPONSE_PAYLOAD_LENGTH = 508
+    HEADER_LENGTH = 2
+    AES_BLOCK_LENGTH = 16
+    MIC_LENGTH = 4
+    MAX_BLOCK_LENGTH = 255
+    MAX_NB_BLOCKS = 255
+
+    def __init__(self, operation, key_id, blocks):
+        """Apply operation with the key at index key_id to each of blocks
+
+        The blocks must fit in one frame, see batches to split a longer list
+        """
+        super().__init__()
+        self.operation = operation
+        self.key_id = key_id
+        self.blocks = [bytes(block) for block in blocks]
+        if not CommandCryptoProcess.fits_in_one_frame(operation, self.blocks):
+            raise ValueError("The blocks do not fit in one frame")
+
+    @staticmethod
+    def get_com_code():
+        return b"\x11\x00"
+
+    @staticmethod
+    def get_output_max_length(operation, block):
+        if operation == CryptoOperation.aes_cmac:
+            return CommandCryptoProcess.MIC_LENGTH
+        return len(block)
+
+    @staticmethod
+    def fits_in_one_frame(operation, blocks):
+        if not 0 < len(blocks) <= CommandCryptoProcess.MAX_NB_BLOCKS:
+            return False
+        if any(len(block) > CommandCryptoProcess.MAX_BLOCK_LENGTH for block in blocks):
+            return False
+        payload_length = CommandCryptoProcess.HEADER_LENGTH + sum(
+            1 + len(block) for block in blocks
+        )
+        response_length = CommandCryptoProcess.HEADER_LENGTH + sum(
+            2 + CommandCryptoProcess.get_output_max_length(operation, block)
+            for block in blocks
+        )
+        return (
+            payload_length <= CommandCryptoProcess.MAX_PAYLOAD_LENGTH
+            and response_length <= CommandCryptoProcess.MAX_RESPONSE_PAYLOAD_LENGTH
+        )
+
+    @staticmethod
+    def batches(operation, key_id, blocks):
+        """Split blocks into as few commands as possible, keeping their order"""
+        batch = list()
+        for block in blocks:
+            if not CommandCryptoProcess.fits_in_one_frame(operation, [block]):
+                raise ValueError("Block of {} bytes too long".format(len(block)))
+            if not CommandCryptoProcess.fits_in_one_frame(operation, batch + [block]):
+                yield CommandCryptoProcess(operation, key_id, batch)
+                batch = list()
+            batch.append(block)
+        if batch:
+            yield CommandCryptoProcess(operation, key_id, batch)
+
+    def payload_to_bytes(self):
+        return (
+            self.operation.value
+            + self.key_id.to_bytes(1, byteorder="little")
+            + b"".join(
+                len(block).to_bytes(1, byteorder="little") + block
+                for block in self.blocks
+            )
+        )
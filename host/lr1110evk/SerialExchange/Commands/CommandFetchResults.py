@@ -31,12 +31,23 @@ from .CommandBase import CommandBase
 
 
 class CommandFetchResults(CommandBase):
-    def __init__(self):
+    CONTENT_LAST_SCAN = 0x00
+    CONTENT_AP_SUMMARY = 0x01
+    CONTENT_ENERGY = 0x02
+
+    def __init__(self, ap_summary=False, energy=False):
         super().__init__()
+        self.ap_summary = ap_summary
+        self.energy = energy
 
     @staticmethod
     def get_com_code():
         return b"\x03\x00"
 
     def payload_to_bytes(self):
+        # The embedded side keeps accepting the empty payload for the last scan results
+        if self.ap_summary:
+            return bytes([CommandFetchResults.CONTENT_AP_SUMMARY])
+        if self.energy:
+            return bytes([CommandFetchResults.CONTENT_ENERGY])
         return b""
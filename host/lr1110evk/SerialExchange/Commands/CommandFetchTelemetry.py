@@ -0,0 +1,60 @@
+"""
+Define the command fetching the VBAT and temperature history
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .CommandBase import CommandBase
+
+
+class CommandFetchTelemetry(CommandBase):
+    PERIOD_MIN_MS = 1000
+    PERIOD_MAX_MS = 3600000
+
+    def __init__(self, period_ms=None):
+        """period_ms changes the sampling period before the fetch if not None"""
+        super().__init__()
+        if period_ms is not None and not (
+            CommandFetchTelemetry.PERIOD_MIN_MS
+            <= period_ms
+            <= CommandFetchTelemetry.PERIOD_MAX_MS
+        ):
+            raise ValueError(
+                "Sampling period must be between {} and {} ms".format(
+                    CommandFetchTelemetry.PERIOD_MIN_MS,
+                    CommandFetchTelemetry.PERIOD_MAX_MS,
+                )
+            )
+        self.period_ms = period_ms
+
+    @staticmethod
+    def get_com_code():
+        return b"\x16\x00"
+
+    def payload_to_bytes(self):
+        if self.period_ms is None:
+            return b""
+        return self.period_ms.to_bytes(4, byteorder="little")
@@ -0,0 +1,85 @@
+"""
+Define the commands updating the firmware of the LR1110
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .CommandBase import CommandBase
+
+
+class CommandFirmwareUpdateStart(CommandBase):
+    HASH_LENGTH = 16
+
+    def __init__(self, image_size, expected_hash=None):
+        """Reset the LR1110 into its bootloader and erase its flash
+
+        image_size is the size in bytes of the encrypted image. If given,
+        expected_hash is compared to the hash of the flash content once the image
+        is written
+        """
+        super().__init__()
+        if expected_hash is not None and len(expected_hash) != self.HASH_LENGTH:
+            raise ValueError("Hash must be {} bytes long".format(self.HASH_LENGTH))
+        self.image_size = image_size
+        self.expected_hash = expected_hash
+
+    @staticmethod
+    def get_com_code():
+        return b"\x12\x00"
+
+    def payload_to_bytes(self):
+        payload = self.image_size.to_bytes(4, byteorder="little")
+        if self.expected_hash is not None:
+            payload += bytes(self.expected_hash)
+        return payload
+
+
+class CommandFirmwareUpdateChunk(CommandBase):
+    CHUNK_SIZE = 256
+
+    def __init__(self, offset, chunk):
+        super().__init__()
+        self.offset = offset
+        self.chunk = chunk
+
+    @staticmethod
+    def get_com_code():
+        return b"\x13\x00"
+
+    def payload_to_bytes(self):
+        return self.offset.to_bytes(4, byteorder="little") + self.chunk
+
+
+class CommandFirmwareUpdateFinish(CommandBase):
+    def __init__(self):
+        super().__init__()
+
+    @staticmethod
+    def get_com_code():
+        return b"\x14\x00"
+
+    def payload_to_bytes(self):
+        return b""
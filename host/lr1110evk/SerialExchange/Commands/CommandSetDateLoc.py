@@ -36,6 +36,7 @@ class CommandSetDateLoc(CommandBase):
     def __init__(self):
         self._gps_time = None
         self._gps_assisted_location = None
+        self._gps_assisted_uncertainty_m = None
 
     @staticmethod
     def get_com_code():
@@ -53,7 +54,13 @@ class CommandSetDateLoc(CommandBase):
                 self._gps_assisted_location.altitude,
             ]
         )
-        return gnss_seconds + longitude + latitude + altitude
+        payload = gnss_seconds + longitude + latitude + altitude
+        # Without uncertainty, the device uses the default one of a manual position
+        if self._gps_assisted_uncertainty_m is not None:
+            payload += int(self._gps_assisted_uncertainty_m).to_bytes(
+                4, byteorder="little"
+            )
+        return payload
 
     @property
     def gps_time(self):
@@ -70,3 +77,11 @@ class CommandSetDateLoc(CommandBase):
     @gps_assisted_location.setter
     def gps_assisted_location(self, location):
         self._gps_assisted_location = location
+
+    @property
+    def gps_assisted_uncertainty_m(self):
+        return self._gps_assisted_uncertainty_m
+
+    @gps_assisted_uncertainty_m.setter
+    def gps_assisted_uncertainty_m(self, uncertainty_m):
+        self._gps_assisted_uncertainty_m = uncertainty_m
@@ -32,6 +32,12 @@ from .CommandBase import CommandBase
 from enum import Enum, unique
 
 
+@unique
+class PingPongTiming(Enum):
+    firmware = b"\x00"
+    hardware = b"\x01"
+
+
 @unique
 class GnssOption(Enum):
     default = b"\x00"
@@ -57,6 +63,19 @@ class GnssConstellation(Enum):
     beidou = b"\x02"
 
 
+@unique
+class GnssSchedulerScanType(Enum):
+    autonomous = b"\x00"
+    assisted = b"\x01"
+
+
+@unique
+class LoraBandwidth(Enum):
+    bw_125_khz = b"\x04"
+    bw_250_khz = b"\x05"
+    bw_500_khz = b"\x06"
+
+
 @unique
 class WifiMode(Enum):
     beacon_only = b"\x01"
@@ -125,6 +144,8 @@ class CommandStartWifiScan(CommandStartWifiBase):
         super().__init__()
         self.wifi_types = list()
         self.wifi_mode = None
+        self.wifi_adaptive = False
+        self.wifi_time_budget_ms = 0
 
     def config_payload_to_byte(self):
         wifi_channel_mask_bytes = CommandStartWifiBase.channel_list_to_bit_mask(
@@ -140,7 +161,7 @@ class CommandStartWifiScan(CommandStartWifiBase):
         wifi_timeout_bytes = self.wifi_timeout.to_bytes(2, byteorder="little")
         wifi_mode_byte = self.wifi_mode.value
 
-        return (
+        payload = (
             wifi_channel_mask_bytes
             + wifi_type_mask_byte
             + wifi_nbr_retrials_bytes
@@ -148,6 +169,13 @@ class CommandStartWifiScan(CommandStartWifiBase):
             + wifi_timeout_bytes
             + wifi_mode_byte
         )
+        # The adaptive settings are only sent when enabled, so that firmwares
+        # not supporting them keep accepting the command
+        if self.wifi_adaptive:
+            payload += b"\x01" + self.wifi_time_budget_ms.to_bytes(
+                2, byteorder="little"
+            )
+        return payload
 
 
 class CommandStartWifiCountryCode(CommandStartWifiBase):
@@ -175,12 +203,23 @@ class CommandStartWifiCountryCode(CommandStartWifiBase):
 
 
 class CommandStartGnssBase(CommandStart):
+    # Defaults of the firmware for the second scan decision of a dual scan
+    DUAL_SCAN_SKIP_NB_SV_DEFAULT = 6
+    DUAL_SCAN_CNR_MIN_DEFAULT = 35
+    DUAL_SCAN_MIN_SV_DEFAULT = 0
+
     def __init__(self):
         self.gnss_option = None
         self.gnss_capture_mode = None
         self.gnss_nb_satellite = None
         self.gnss_antenna_selection = None
         self.gnss_constellation_mask = None
+        # Thresholds of the second scan decision of a dual scan. They are sent as
+        # a group: the ones left to None take the defaults of the firmware, and
+        # none is sent if all are None
+        self.gnss_dual_scan_skip_nb_sv = None
+        self.gnss_dual_scan_cnr_min = None
+        self.gnss_dual_scan_min_sv = None
 
     def config_payload_to_byte(self):
         gnss_option = self.gnss_option.value
@@ -189,13 +228,50 @@ class CommandStartGnssBase(CommandStart):
         gnss_antenna_selection = self.gnss_antenna_selection.value
         gnss_constellation_mask = self.gnss_constellation_mask
 
-        return (
+        payload = (
             gnss_option
             + gnss_capture_mode
             + gnss_nb_satellite
             + gnss_antenna_selection
             + gnss_constellation_mask
         )
+        if self.has_dual_scan_thresholds():
+            skip_nb_sv, cnr_min, min_sv = self.get_dual_scan_thresholds()
+            payload += (
+                skip_nb_sv.to_bytes(1, byteorder="little")
+                + cnr_min.to_bytes(1, byteorder="little", signed=True)
+                + min_sv.to_bytes(1, byteorder="little")
+            )
+        return payload
+
+    def has_dual_scan_thresholds(self):
+        return any(
+            threshold is not None
+            for threshold in (
+                self.gnss_dual_scan_skip_nb_sv,
+                self.gnss_dual_scan_cnr_min,
+                self.gnss_dual_scan_min_sv,
+            )
+        )
+
+    def get_dual_scan_thresholds(self):
+        def value_or_default(value, default):
+            return default if value is None else value
+
+        return (
+            value_or_default(
+                self.gnss_dual_scan_skip_nb_sv,
+                CommandStartGnssBase.DUAL_SCAN_SKIP_NB_SV_DEFAULT,
+            ),
+            value_or_default(
+                self.gnss_dual_scan_cnr_min,
+                CommandStartGnssBase.DUAL_SCAN_CNR_MIN_DEFAULT,
+            ),
+            value_or_default(
+                self.gnss_dual_scan_min_sv,
+                CommandStartGnssBase.DUAL_SCAN_MIN_SV_DEFAULT,
+            ),
+        )
 
 
 class CommandStartGnssAutonomous(CommandStartGnssBase):
@@ -204,3 +280,105 @@ class CommandStartGnssAutonomous(CommandStartGnssBase):
 
 class CommandStartGnssAssisted(CommandStartGnssBase):
     DEMO_ID = b"\x04"
+
+
+class CommandStartGnssScheduler(CommandStartGnssBase):
+    DEMO_ID = b"\x05"
+
+    def __init__(self):
+        super().__init__()
+        self.scan_type = None
+        self.interval_s = None
+
+    def config_payload_to_byte(self):
+        scan_type = self.scan_type.value
+        interval_s = self.interval_s.to_bytes(2, byteorder="little")
+
+        return scan_type + interval_s + super().config_payload_to_byte()
+
+
+class CommandStartRadioSpectrum(CommandStart):
+    DEMO_ID = b"\x06"
+
+    def __init__(self):
+        super().__init__()
+        self.start_frequency_hz = None
+        self.stop_frequency_hz = None
+        self.step_hz = None
+        self.nb_samples = None
+        self.nb_sweeps = None
+
+    def config_payload_to_byte(self):
+        start_frequency_hz = self.start_frequency_hz.to_bytes(4, byteorder="little")
+        stop_frequency_hz = self.stop_frequency_hz.to_bytes(4, byteorder="little")
+        step_hz = self.step_hz.to_bytes(4, byteorder="little")
+        nb_samples = self.nb_samples.to_bytes(1, byteorder="little")
+        nb_sweeps = self.nb_sweeps.to_bytes(2, byteorder="little")
+
+        return start_frequency_hz + stop_frequency_hz + step_hz + nb_samples + nb_sweeps
+
+
+class CommandStartRadioCad(CommandStart):
+    DEMO_ID = b"\x07"
+
+    def __init__(self):
+        super().__init__()
+        self.spreading_factors = None
+        self.bandwidth = None
+        self.start_frequency_hz = None
+        self.channel_spacing_hz = None
+        self.nb_channels = None
+        self.period_ms = None
+        self.cad_symb_nb = None
+        self.cad_detect_peak = None
+        self.cad_detect_min = None
+        self.nb_cads = None
+
+    def config_payload_to_byte(self):
+        sf_mask = 0
+        for spreading_factor in self.spreading_factors:
+            sf_mask |= 1 << (spreading_factor - 5)
+
+        return (
+            sf_mask.to_bytes(1, byteorder="little")
+            + self.bandwidth.value
+            + self.start_frequency_hz.to_bytes(4, byteorder="little")
+            + self.channel_spacing_hz.to_bytes(4, byteorder="little")
+            + self.nb_channels.to_bytes(1, byteorder="little")
+            + self.period_ms.to_bytes(2, byteorder="little")
+            + self.cad_symb_nb.to_bytes(1, byteorder="little")
+            + self.cad_detect_peak.to_bytes(1, byteorder="little")
+            + self.cad_detect_min.to_bytes(1, byteorder="little")
+            + self.nb_cads.to_bytes(4, byteorder="little")
+        )
+
+
+class CommandStartRadioPerRx(CommandStart):
+    DEMO_ID = b"\x08"
+
+    def __init__(self):
+        super().__init__()
+        self.rx_period_ms = None
+        self.sleep_period_ms = None
+
+    def config_payload_to_byte(self):
+        rx_period_ms = self.rx_period_ms.to_bytes(4, byteorder="little")
+        sleep_period_ms = self.sleep_period_ms.to_bytes(4, byteorder="little")
+
+        return rx_period_ms + sleep_period_ms
+
+
+class CommandStartRadioPingPong(CommandStart):
+    DEMO_ID = b"\x09"
+
+    def __init__(self):
+        super().__init__()
+        self.timing = None
+        self.turnaround_delay_ms = None
+        self.guard_delay_ms = None
+
+    def config_payload_to_byte(self):
+        turnaround_delay_ms = self.turnaround_delay_ms.to_bytes(2, byteorder="little")
+        guard_delay_ms = self.guard_delay_ms.to_bytes(2, byteorder="little")
+
+        return self.timing.value + turnaround_delay_ms + guard_delay_ms
@@ -1,4 +1,21 @@
 from .CommandFetchResults import CommandFetchResults
+from .CommandFetchGnssHistory import CommandFetchGnssHistory
+from .CommandFetchGuiMemory import CommandFetchGuiMemory
+from .CommandFetchWifiChannelStats import CommandFetchWifiChannelStats
+from .CommandConsumptionModel import CommandConsumptionModel
+from .CommandCryptoBenchmark import CommandCryptoBenchmark
+from .CommandCrypto import (
+    CommandCryptoSelect,
+    CommandCryptoSetKey,
+    CommandCryptoProcess,
+    CryptoElement,
+    CryptoOperation,
+)
+from .CommandFirmwareUpdate import (
+    CommandFirmwareUpdateStart,
+    CommandFirmwareUpdateChunk,
+    CommandFirmwareUpdateFinish,
+)
 from .CommandReset import CommandReset
 from .CommandSetDateLoc import CommandSetDateLoc
 from .CommandStart import (
@@ -6,6 +23,15 @@ from .CommandStart import (
     CommandStartWifiCountryCode,
     CommandStartGnssAutonomous,
     CommandStartGnssAssisted,
+    CommandStartGnssBase,
+    CommandStartGnssScheduler,
+    CommandStartRadioSpectrum,
+    CommandStartRadioCad,
+    CommandStartRadioPerRx,
+    CommandStartRadioPingPong,
+    PingPongTiming,
+    GnssSchedulerScanType,
+    LoraBandwidth,
     GnssOption,
     GnssCaptureMode,
     GnssConstellation,
@@ -15,6 +41,8 @@ from .CommandStart import (
 )
 from .CommandStatus import CommandStatus
 from .CommandGetVersion import CommandGetVersion
+from .CommandGetRandom import CommandGetRandom
+from .CommandFetchTelemetry import CommandFetchTelemetry
 from .CommandGetAlmanacDates import CommandGetAlmanacDates
 from .CommandUpdateAlmanac import CommandUpdateAlmanac
 from .CommandCheckAlmanacUpdate import CommandCheckAlmanacUpdate
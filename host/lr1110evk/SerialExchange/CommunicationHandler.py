@@ -34,6 +34,7 @@ from .Responses import (
     ResponseConfigureAck,
     ResponseFetchResult,
     ResponseWifiResult,
+    ResponseWifiApSummary,
     ResponseGnssAutonomousResult,
     ResponseGnssAssistedResult,
     ResponseReset,
@@ -44,6 +45,27 @@ from .Responses import (
     ResponseAlmanacDates,
     ResponseUpdateAlmanac,
     ResponseCheckAlmanacUpdate,
+    ResponseFetchGnssHistory,
+    ResponseGnssHistoryResult,
+    ResponseFetchGuiMemory,
+    ResponseFetchWifiChannelStats,
+    ResponseConsumptionModel,
+    ResponseEnergy,
+    ResponseRadioSpectrum,
+    ResponseRadioCadResult,
+    ResponseRadioPerRxResult,
+    ResponseRadioPingPongResult,
+    ResponseCryptoBenchmark,
+    ResponseCryptoBenchmarkResult,
+    ResponseCryptoSelect,
+    ResponseCryptoSetKey,
+    ResponseCryptoProcess,
+    ResponseFirmwareUpdateStart,
+    ResponseFirmwareUpdateChunk,
+    ResponseFirmwareUpdateFinish,
+    ResponseGetRandom,
+    ResponseFetchTelemetry,
+    ResponseTelemetryEntry,
 )
 
 
@@ -82,6 +104,7 @@ class CommunicationHandler:
         ResponseConfigureAck,
         ResponseFetchResult,
         ResponseWifiResult,
+        ResponseWifiApSummary,
         ResponseGnssAutonomousResult,
         ResponseGnssAssistedResult,
         ResponseReset,
@@ -92,6 +115,27 @@ class CommunicationHandler:
         ResponseAlmanacDates,
         ResponseUpdateAlmanac,
         ResponseCheckAlmanacUpdate,
+        ResponseFetchGnssHistory,
+        ResponseGnssHistoryResult,
+        ResponseFetchGuiMemory,
+        ResponseFetchWifiChannelStats,
+        ResponseConsumptionModel,
+        ResponseEnergy,
+        ResponseRadioSpectrum,
+        ResponseRadioCadResult,
+        ResponseRadioPerRxResult,
+        ResponseRadioPingPongResult,
+        ResponseCryptoBenchmark,
+        ResponseCryptoBenchmarkResult,
+        ResponseCryptoSelect,
+        ResponseCryptoSetKey,
+        ResponseCryptoProcess,
+        ResponseFirmwareUpdateStart,
+        ResponseFirmwareUpdateChunk,
+        ResponseFirmwareUpdateFinish,
+        ResponseGetRandom,
+        ResponseFetchTelemetry,
+        ResponseTelemetryEntry,
     ]
 
     def __init__(self, serial_handler, logger):
@@ -0,0 +1,130 @@
+"""
+Define incremental frame decoder for serial exchange
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .Responses import ResponseRaw
+
+
+class FrameDecoder:
+    """Incrementally rebuild response frames from a stream of received chunks
+
+    Each frame is made of a 2-byte response code, a 2-byte little endian payload
+    length and the payload itself. Received chunks are appended to an internal
+    buffer, and every complete frame is extracted as a ResponseRaw. Incomplete
+    frames stay buffered until the next chunk completes them.
+    """
+
+    RESP_CODE_SIZE = 2
+    PAYLOAD_LENGTH_SIZE = 2
+    HEADER_SIZE = RESP_CODE_SIZE + PAYLOAD_LENGTH_SIZE
+    # The !TEST_HOST message does not follow the frame format: it is the
+    # 2-byte "!T" response code followed by 9 bytes without length field
+    TEST_HOST_RESP_CODE = b"!T"
+    TEST_HOST_PAYLOAD_SIZE = 9
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.frame_receive_time = None
+
+    def has_pending_data(self):
+        return len(self.buffer) > 0
+
+    def reset(self):
+        self.buffer.clear()
+        self.frame_receive_time = None
+
+    def get_pending_frame_size(self):
+        """Return the expected size of the buffered frame, or the header size if not known yet"""
+        if self.buffer.startswith(FrameDecoder.TEST_HOST_RESP_CODE):
+            return FrameDecoder.RESP_CODE_SIZE + FrameDecoder.TEST_HOST_PAYLOAD_SIZE
+        if len(self.buffer) < FrameDecoder.HEADER_SIZE:
+            return FrameDecoder.HEADER_SIZE
+        return FrameDecoder.HEADER_SIZE + int.from_bytes(
+            self.buffer[FrameDecoder.RESP_CODE_SIZE : FrameDecoder.HEADER_SIZE],
+            byteorder="little",
+        )
+
+    def feed(self, data, receive_time):
+        """Append a received chunk and return the list of completed ResponseRaw
+
+        The reception time of a frame is the time of the chunk that carried its
+        first byte.
+        """
+        if not data:
+            return []
+        if not self.buffer:
+            self.frame_receive_time = receive_time
+        self.buffer += data
+
+        responses = list()
+        offset = 0
+        buffer_length = len(self.buffer)
+        while True:
+            frame_boundaries = self.get_frame_boundaries(offset, buffer_length)
+            if frame_boundaries is None:
+                break
+            payload_start, frame_end = frame_boundaries
+            responses.append(
+                ResponseRaw(
+                    resp_code=bytes(
+                        self.buffer[offset : offset + FrameDecoder.RESP_CODE_SIZE]
+                    ),
+                    payload=bytes(self.buffer[payload_start:frame_end]),
+                    receive_time=self.frame_receive_time,
+                )
+            )
+            offset = frame_end
+            # Frames following the first one of this chunk were started in it
+            self.frame_receive_time = receive_time
+
+        if offset > 0:
+            del self.buffer[:offset]
+        return responses
+
+    def get_frame_boundaries(self, offset, buffer_length):
+        """Return (payload_start, frame_end) of the frame at offset, or None if incomplete"""
+        if buffer_length - offset < FrameDecoder.RESP_CODE_SIZE:
+            return None
+        if (
+            self.buffer[offset : offset + FrameDecoder.RESP_CODE_SIZE]
+            == FrameDecoder.TEST_HOST_RESP_CODE
+        ):
+            payload_start = offset + FrameDecoder.RESP_CODE_SIZE
+            payload_size = FrameDecoder.TEST_HOST_PAYLOAD_SIZE
+        else:
+            if buffer_length - offset < FrameDecoder.HEADER_SIZE:
+                return None
+            payload_start = offset + FrameDecoder.HEADER_SIZE
+            payload_size = int.from_bytes(
+                self.buffer[offset + FrameDecoder.RESP_CODE_SIZE : payload_start],
+                byteorder="little",
+            )
+        frame_end = payload_start + payload_size
+        if frame_end > buffer_length:
+            return None
+        return payload_start, frame_end
@@ -0,0 +1,87 @@
+"""
+Define consumption model response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from collections import namedtuple
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+# Must follow demo_consumption_model_settings_t of the embedded demo
+ConsumptionModel = namedtuple(
+    "ConsumptionModel",
+    [
+        "wifi_dcdc_detection_ua",
+        "wifi_dcdc_correlation_ua",
+        "wifi_dcdc_capture_ua",
+        "wifi_dcdc_demodulation_ua",
+        "wifi_ldo_detection_ua",
+        "wifi_ldo_correlation_ua",
+        "wifi_ldo_capture_ua",
+        "wifi_ldo_demodulation_ua",
+        "gnss_dcdc_acquisition_ua",
+        "gnss_dcdc_computation_ua",
+        "radio_dcdc_cad_ua",
+        "radio_dcdc_rx_ua",
+        "radio_sleep_ua",
+    ],
+)
+
+
+class ResponseConsumptionModel(ResponseBase):
+    CURRENT_LENGTH = 4
+
+    def __init__(self, receive_time, consumption_model):
+        super().__init__(receive_time)
+        self.consumption_model = consumption_model
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0D\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        nb_currents = len(ConsumptionModel._fields)
+        if len(payload) != nb_currents * ResponseConsumptionModel.CURRENT_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        length = ResponseConsumptionModel.CURRENT_LENGTH
+        currents = [
+            int.from_bytes(payload[offset : offset + length], byteorder="little")
+            for offset in range(0, len(payload), length)
+        ]
+        return ResponseConsumptionModel(
+            receive_time=response_raw.receive_time,
+            consumption_model=ConsumptionModel(*currents),
+        )
+
+    def __str__(self):
+        return "ConsumptionModel({})".format(
+            ", ".join(
+                "{}={}".format(name, current)
+                for name, current in self.consumption_model._asdict().items()
+            )
+        )
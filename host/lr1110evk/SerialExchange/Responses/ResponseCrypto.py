@@ -0,0 +1,180 @@
+"""
+Define the responses of the commands using the crypto element of the LR1110
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from collections import namedtuple
+from enum import Enum, unique
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class CryptoCommandStatus:
+    OK = 0
+    BUSY = 1
+
+
+# Must follow lr1110_crypto_status_t of the LR1110 driver
+@unique
+class CryptoStatus(Enum):
+    success = 0x00
+    error_fail_cmac = 0x01
+    error_invalid_key_id = 0x03
+    error_buffer_size = 0x05
+    error = 0x06
+
+
+CryptoBlockResult = namedtuple("CryptoBlockResult", ["status", "output"])
+
+
+def get_crypto_status(response_raw, value):
+    try:
+        return CryptoStatus(value)
+    except ValueError:
+        raise ResponseMalformedException(response_raw)
+
+
+class ResponseCryptoSelect(ResponseBase):
+    def __init__(self, receive_time, status):
+        super().__init__(receive_time)
+        self.status = status
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0F\x00"
+
+    @property
+    def is_ok(self):
+        return self.status == CryptoCommandStatus.OK
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != 1:
+            raise ResponseMalformedException(response_raw)
+        return ResponseCryptoSelect(
+            receive_time=response_raw.receive_time, status=payload[0]
+        )
+
+    def __str__(self):
+        return "CryptoSelect: {}".format(
+            "ok" if self.is_ok else "refused, a demo is running"
+        )
+
+
+class ResponseCryptoSetKey(ResponseBase):
+    def __init__(self, receive_time, status, crypto_status):
+        super().__init__(receive_time)
+        self.status = status
+        self.crypto_status = crypto_status
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x10\x00"
+
+    @property
+    def is_ok(self):
+        return (
+            self.status == CryptoCommandStatus.OK
+            and self.crypto_status == CryptoStatus.success
+        )
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != 2:
+            raise ResponseMalformedException(response_raw)
+        return ResponseCryptoSetKey(
+            receive_time=response_raw.receive_time,
+            status=payload[0],
+            crypto_status=get_crypto_status(response_raw, payload[1]),
+        )
+
+    def __str__(self):
+        if self.status != CryptoCommandStatus.OK:
+            return "CryptoSetKey: refused, a demo is running"
+        return "CryptoSetKey: {}".format(self.crypto_status.name)
+
+
+class ResponseCryptoProcess(ResponseBase):
+    HEADER_LENGTH = 2
+
+    def __init__(self, receive_time, status, block_results):
+        super().__init__(receive_time)
+        self.status = status
+        self.block_results = block_results
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x11\x00"
+
+    @property
+    def is_ok(self):
+        return self.status == CryptoCommandStatus.OK
+
+    @property
+    def nb_failed_blocks(self):
+        return sum(
+            1
+            for block_result in self.block_results
+            if block_result.status != CryptoStatus.success
+        )
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseCryptoProcess.HEADER_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        block_results = list()
+        index = ResponseCryptoProcess.HEADER_LENGTH
+        for _ in range(payload[1]):
+            if index + 2 > len(payload):
+                raise ResponseMalformedException(response_raw)
+            status = get_crypto_status(response_raw, payload[index])
+            output_length = payload[index + 1]
+            index += 2
+            if index + output_length > len(payload):
+                raise ResponseMalformedException(response_raw)
+            block_results.append(
+                CryptoBlockResult(
+                    status=status, output=bytes(payload[index : index + output_length])
+                )
+            )
+            index += output_length
+        if index != len(payload):
+            raise ResponseMalformedException(response_raw)
+        return ResponseCryptoProcess(
+            receive_time=response_raw.receive_time,
+            status=payload[0],
+            block_results=block_results,
+        )
+
+    def __str__(self):
+        if not self.is_ok:
+            return "CryptoProcess: refused, a demo is running"
+        return "CryptoProcess: {} block(s), {} failed".format(
+            len(self.block_results), self.nb_failed_blocks
+        )
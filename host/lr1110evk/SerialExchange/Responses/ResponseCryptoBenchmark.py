@@ -0,0 +1,159 @@
+"""
+Define the responses of the crypto engine benchmark
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from enum import Enum, unique
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+# Must follow demo_crypto_benchmark_primitive_t of the embedded demo
+@unique
+class CryptoBenchmarkPrimitive(Enum):
+    spi_reference = 0
+    aes_encrypt = 1
+    aes_decrypt = 2
+    aes_cmac_compute = 3
+    aes_cmac_verify = 4
+    derive_key = 5
+
+
+class ResponseCryptoBenchmark(ResponseBase):
+    FRAME_LENGTH = 2
+    STATUS_OK = 0
+    STATUS_BUSY = 1
+
+    def __init__(self, receive_time, status, nb_results):
+        super().__init__(receive_time)
+        self.status = status
+        self.nb_results = nb_results
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0E\x00"
+
+    @property
+    def is_ok(self):
+        return self.status == ResponseCryptoBenchmark.STATUS_OK
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseCryptoBenchmark.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        return ResponseCryptoBenchmark(
+            receive_time=response_raw.receive_time,
+            status=payload[0],
+            nb_results=payload[1],
+        )
+
+    def __str__(self):
+        return "CryptoBenchmark: {}, {} result(s)".format(
+            "ok" if self.is_ok else "refused, a demo is running", self.nb_results
+        )
+
+
+class ResponseCryptoBenchmarkResult(ResponseBase):
+    FRAME_LENGTH = 19
+
+    def __init__(
+        self,
+        receive_time,
+        primitive,
+        payload_size,
+        nb_iterations,
+        nb_errors,
+        min_us,
+        max_us,
+        total_us,
+    ):
+        super().__init__(receive_time)
+        self.primitive = primitive
+        self.payload_size = payload_size
+        self.nb_iterations = nb_iterations
+        self.nb_errors = nb_errors
+        self.min_us = min_us
+        self.max_us = max_us
+        self.total_us = total_us
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x8C\x00"
+
+    @property
+    def average_us(self):
+        if self.nb_iterations == 0:
+            return None
+        return self.total_us / self.nb_iterations
+
+    @property
+    def throughput_kbps(self):
+        """Payload bytes processed per second, in kbit/s
+
+        The payload of the key derivation is its nonce
+        """
+        if self.payload_size == 0 or self.total_us == 0:
+            return None
+        return (8 * self.payload_size * self.nb_iterations) / (self.total_us / 1000)
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseCryptoBenchmarkResult.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        try:
+            primitive = CryptoBenchmarkPrimitive(payload[0])
+        except ValueError:
+            raise ResponseMalformedException(response_raw)
+
+        def get_uint(offset, length):
+            return int.from_bytes(payload[offset : offset + length], byteorder="little")
+
+        return ResponseCryptoBenchmarkResult(
+            receive_time=response_raw.receive_time,
+            primitive=primitive,
+            payload_size=get_uint(1, 2),
+            nb_iterations=get_uint(3, 2),
+            nb_errors=get_uint(5, 2),
+            min_us=get_uint(7, 4),
+            max_us=get_uint(11, 4),
+            total_us=get_uint(15, 4),
+        )
+
+    def __str__(self):
+        return (
+            "CryptoBenchmarkResult {} {} bytes: {} iteration(s), {} error(s), "
+            "min {} us, max {} us, total {} us".format(
+                self.primitive.name,
+                self.payload_size,
+                self.nb_iterations,
+                self.nb_errors,
+                self.min_us,
+                self.max_us,
+                self.total_us,
+            )
+        )
@@ -0,0 +1,101 @@
+"""
+Define energy response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseEnergy(ResponseBase):
+    HEADER_LENGTH = 2
+    ENERGY_LENGTH = 4
+
+    # Must follow demo_type_t and the phases sent by CommandFetchResult::FetchEnergy
+    WIFI_PHASES = ["detection", "correlation", "capture", "demodulation"]
+    GNSS_PHASES = ["acquisition", "computation"]
+    PHASES_PER_DEMO_TYPE = {
+        1: WIFI_PHASES,
+        2: WIFI_PHASES,
+        3: GNSS_PHASES,
+        4: GNSS_PHASES,
+        9: GNSS_PHASES,
+    }
+
+    def __init__(self, receive_time, demo_type, energy_per_phase_uas):
+        super().__init__(receive_time)
+        self.demo_type = demo_type
+        self.energy_per_phase_uas = energy_per_phase_uas
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x87\x00"
+
+    @property
+    def total_energy_uas(self):
+        return sum(self.energy_per_phase_uas.values())
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseEnergy.HEADER_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        demo_type = payload[0]
+        nb_phases = payload[1]
+        if len(payload) != (
+            ResponseEnergy.HEADER_LENGTH + nb_phases * ResponseEnergy.ENERGY_LENGTH
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        phase_names = ResponseEnergy.PHASES_PER_DEMO_TYPE.get(demo_type, list())
+        energy_per_phase_uas = dict()
+        for index in range(nb_phases):
+            start = ResponseEnergy.HEADER_LENGTH + index * ResponseEnergy.ENERGY_LENGTH
+            name = (
+                phase_names[index]
+                if index < len(phase_names)
+                else "phase_{}".format(index)
+            )
+            energy_per_phase_uas[name] = int.from_bytes(
+                payload[start : start + ResponseEnergy.ENERGY_LENGTH],
+                byteorder="little",
+            )
+
+        return ResponseEnergy(
+            receive_time=response_raw.receive_time,
+            demo_type=demo_type,
+            energy_per_phase_uas=energy_per_phase_uas,
+        )
+
+    def __str__(self):
+        return "Energy(demo type {}): {} uas ({})".format(
+            self.demo_type,
+            self.total_energy_uas,
+            ", ".join(
+                "{}={}".format(name, energy)
+                for name, energy in self.energy_per_phase_uas.items()
+            ),
+        )
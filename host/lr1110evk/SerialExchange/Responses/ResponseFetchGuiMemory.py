@@ -0,0 +1,139 @@
+"""
+Define fetch GUI memory response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase
+from collections import namedtuple
+
+GuiMemoryPageStats = namedtuple(
+    "GuiMemoryPageStats",
+    ["page_id", "page_name", "peak_used_size", "min_free_biggest_size", "peak_frag_pct"],
+)
+
+
+class ResponseFetchGuiMemory(ResponseBase):
+    HEADER_LENGTH = 10
+    PAGE_LENGTH = 10
+
+    # Must follow guiPageType_t of the embedded GUI
+    PAGE_NAMES = [
+        "none",
+        "splashscreen",
+        "about",
+        "menu",
+        "menu_radio_test_modes",
+        "radio_test_modes_config",
+        "radio_tx_cw",
+        "radio_per",
+        "radio_ping_pong",
+        "menu_demo",
+        "wifi_test",
+        "wifi_results",
+        "wifi_config",
+        "gnss_autonomous_test",
+        "gnss_autonomous_results",
+        "gnss_autonomous_config",
+        "gnss_assisted_test",
+        "gnss_assisted_results",
+        "gnss_assisted_config",
+        "wifi_channels",
+        "radio_spectrum",
+    ]
+
+    def __init__(
+        self, receive_time, pool_size, peak_used_size, image_cache_size, pages
+    ):
+        super().__init__(receive_time)
+        self.pool_size = pool_size
+        self.peak_used_size = peak_used_size
+        self.image_cache_size = image_cache_size
+        self.pages = pages
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0B\x00"
+
+    @classmethod
+    def page_name_from_id(cls, page_id):
+        try:
+            return cls.PAGE_NAMES[page_id]
+        except IndexError:
+            return "page_{}".format(page_id)
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        pool_size = int.from_bytes(payload[0:4], byteorder="little")
+        peak_used_size = int.from_bytes(payload[4:8], byteorder="little")
+        image_cache_size = payload[8]
+        nbr_pages = payload[9]
+
+        pages = list()
+        for page_index in range(nbr_pages):
+            start = cls.HEADER_LENGTH + page_index * cls.PAGE_LENGTH
+            page_bytes = payload[start : start + cls.PAGE_LENGTH]
+            page_id = page_bytes[0]
+            pages.append(
+                GuiMemoryPageStats(
+                    page_id=page_id,
+                    page_name=cls.page_name_from_id(page_id),
+                    peak_used_size=int.from_bytes(page_bytes[1:5], byteorder="little"),
+                    min_free_biggest_size=int.from_bytes(
+                        page_bytes[5:9], byteorder="little"
+                    ),
+                    peak_frag_pct=page_bytes[9],
+                )
+            )
+
+        return ResponseFetchGuiMemory(
+            receive_time=response_raw.receive_time,
+            pool_size=pool_size,
+            peak_used_size=peak_used_size,
+            image_cache_size=image_cache_size,
+            pages=pages,
+        )
+
+    def __str__(self):
+        lines = [
+            "LVGL pool: {} bytes, peak used {} bytes ({:.0f}%), image cache {} entrie(s)".format(
+                self.pool_size,
+                self.peak_used_size,
+                100.0 * self.peak_used_size / self.pool_size if self.pool_size else 0,
+                self.image_cache_size,
+            )
+        ]
+        for page in self.pages:
+            lines.append(
+                "  {:<26} peak used {:>6} bytes, smallest biggest free block {:>6} bytes, peak fragmentation {:>3}%".format(
+                    page.page_name,
+                    page.peak_used_size,
+                    page.min_free_biggest_size,
+                    page.peak_frag_pct,
+                )
+            )
+        return "\n".join(lines)
@@ -28,12 +28,15 @@ Define result fetching serial response class
 """
 
 from .ResponseBase import ResponseBase
+from lr1110evk.BaseTypes import Telemetry
 
 
 class ResponseFetchResult(ResponseBase):
-    def __init__(self, receive_time, nbr_results):
+    def __init__(self, receive_time, nbr_results, telemetry=None):
+        """telemetry is only sent with the results of the Wi-Fi and GNSS scans"""
         super().__init__(receive_time)
         self.nbr_results = nbr_results
+        self.telemetry = telemetry
 
     @classmethod
     def get_response_code(cls):
@@ -45,10 +48,17 @@ class ResponseFetchResult(ResponseBase):
         nbr_results = int.from_bytes(
             response_raw.payload_bytes[0:1], byteorder="little"
         )
+        telemetry = None
+        if len(response_raw.payload_bytes) >= 1 + Telemetry.LENGTH:
+            telemetry = Telemetry.from_bytes(response_raw.payload_bytes[1:])
         response_result = ResponseFetchResult(
-            receive_time=receive_time, nbr_results=nbr_results
+            receive_time=receive_time, nbr_results=nbr_results, telemetry=telemetry
         )
         return response_result
 
     def __str__(self):
-        return "{} result(s) to be fetched".format(self.nbr_results)
+        if self.telemetry is None:
+            return "{} result(s) to be fetched".format(self.nbr_results)
+        return "{} result(s) to be fetched ({})".format(
+            self.nbr_results, self.telemetry
+        )
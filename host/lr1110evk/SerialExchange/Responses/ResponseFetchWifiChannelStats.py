@@ -0,0 +1,112 @@
+"""
+Define fetch Wi-Fi channel statistics serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+from collections import namedtuple
+
+WifiChannelStats = namedtuple(
+    "WifiChannelStats",
+    [
+        "channel",
+        "nb_scans",
+        "nb_detections",
+        "nb_ap_last_scan",
+        "nb_ap_max_per_scan",
+        "rssi_max",
+        "rssi_histogram",
+        "dwell_time_us",
+    ],
+)
+
+
+class ResponseFetchWifiChannelStats(ResponseBase):
+    HEADER_LENGTH = 3
+    RSSI_BINS = 5
+    CHANNEL_LENGTH = 11 + 2 * RSSI_BINS
+
+    # Lower edge of each RSSI histogram bin, in dBm
+    RSSI_BIN_EDGES = [None, -90, -80, -70, -60]
+
+    def __init__(self, receive_time, nb_scans, channels):
+        super().__init__(receive_time)
+        self.nb_scans = nb_scans
+        self.channels = channels
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0C\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseFetchWifiChannelStats.HEADER_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        receive_time = response_raw.receive_time
+        nb_scans = int.from_bytes(payload[0:2], byteorder="little")
+        nb_channels = payload[2]
+        if len(payload) != (
+            ResponseFetchWifiChannelStats.HEADER_LENGTH
+            + nb_channels * ResponseFetchWifiChannelStats.CHANNEL_LENGTH
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        channels = list()
+        for index in range(nb_channels):
+            start = (
+                ResponseFetchWifiChannelStats.HEADER_LENGTH
+                + index * ResponseFetchWifiChannelStats.CHANNEL_LENGTH
+            )
+            raw = payload[start : start + ResponseFetchWifiChannelStats.CHANNEL_LENGTH]
+            histogram_end = 7 + 2 * ResponseFetchWifiChannelStats.RSSI_BINS
+            channels.append(
+                WifiChannelStats(
+                    channel=index + 1,
+                    nb_scans=int.from_bytes(raw[0:2], byteorder="little"),
+                    nb_detections=int.from_bytes(raw[2:4], byteorder="little"),
+                    nb_ap_last_scan=raw[4],
+                    nb_ap_max_per_scan=raw[5],
+                    rssi_max=int.from_bytes(raw[6:7], byteorder="little", signed=True),
+                    rssi_histogram=[
+                        int.from_bytes(raw[offset : offset + 2], byteorder="little")
+                        for offset in range(7, histogram_end, 2)
+                    ],
+                    dwell_time_us=int.from_bytes(
+                        raw[histogram_end : histogram_end + 4], byteorder="little"
+                    ),
+                )
+            )
+
+        return ResponseFetchWifiChannelStats(
+            receive_time=receive_time, nb_scans=nb_scans, channels=channels
+        )
+
+    def __str__(self):
+        return "Wi-Fi channel statistics over {} scan(s): {} channel(s)".format(
+            self.nb_scans, len(self.channels)
+        )
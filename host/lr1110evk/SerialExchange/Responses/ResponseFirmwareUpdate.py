@@ -0,0 +1,164 @@
+"""
+Define the responses of the commands updating the firmware of the LR1110
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from enum import Enum, unique
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+# Must follow device_firmware_update_status_t of the embedded side
+@unique
+class FirmwareUpdateStatus(Enum):
+    ok = 0
+    busy = 1
+    not_started = 2
+    not_in_bootloader = 3
+    wrong_image_size = 4
+    wrong_offset = 5
+    wrong_chunk_size = 6
+    write_failed = 7
+    incomplete = 8
+    hash_mismatch = 9
+    not_in_transceiver = 10
+
+
+def get_firmware_update_status(response_raw, value):
+    try:
+        return FirmwareUpdateStatus(value)
+    except ValueError:
+        raise ResponseMalformedException(response_raw)
+
+
+def get_version_string(hw, type, fw):
+    return "hw 0x{:02X}, type 0x{:02X}, fw 0x{:04X}".format(hw, type, fw)
+
+
+class ResponseFirmwareUpdateStart(ResponseBase):
+    FRAME_LENGTH = 5
+
+    def __init__(self, receive_time, status, version_hw, version_type, version_fw):
+        super().__init__(receive_time)
+        self.status = status
+        self.version_hw = version_hw
+        self.version_type = version_type
+        self.version_fw = version_fw
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x12\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseFirmwareUpdateStart.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        return ResponseFirmwareUpdateStart(
+            receive_time=response_raw.receive_time,
+            status=get_firmware_update_status(response_raw, payload[0]),
+            version_hw=payload[1],
+            version_type=payload[2],
+            version_fw=int.from_bytes(payload[3:5], byteorder="little"),
+        )
+
+    def __str__(self):
+        return "FirmwareUpdateStart: {}, bootloader {}".format(
+            self.status.name,
+            get_version_string(self.version_hw, self.version_type, self.version_fw),
+        )
+
+
+class ResponseFirmwareUpdateChunk(ResponseBase):
+    FRAME_LENGTH = 5
+
+    def __init__(self, receive_time, status, nb_bytes_accepted):
+        super().__init__(receive_time)
+        self.status = status
+        self.nb_bytes_accepted = nb_bytes_accepted
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x13\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseFirmwareUpdateChunk.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        return ResponseFirmwareUpdateChunk(
+            receive_time=response_raw.receive_time,
+            status=get_firmware_update_status(response_raw, payload[0]),
+            nb_bytes_accepted=int.from_bytes(payload[1:5], byteorder="little"),
+        )
+
+    def __str__(self):
+        return "FirmwareUpdateChunk: {}, {} bytes accepted".format(
+            self.status.name, self.nb_bytes_accepted
+        )
+
+
+class ResponseFirmwareUpdateFinish(ResponseBase):
+    HASH_LENGTH = 16
+    FRAME_LENGTH = 1 + HASH_LENGTH + 4
+
+    def __init__(
+        self, receive_time, status, hash, version_hw, version_type, version_fw
+    ):
+        super().__init__(receive_time)
+        self.status = status
+        self.hash = hash
+        self.version_hw = version_hw
+        self.version_type = version_type
+        self.version_fw = version_fw
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x14\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseFirmwareUpdateFinish.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        version_index = 1 + ResponseFirmwareUpdateFinish.HASH_LENGTH
+        return ResponseFirmwareUpdateFinish(
+            receive_time=response_raw.receive_time,
+            status=get_firmware_update_status(response_raw, payload[0]),
+            hash=bytes(payload[1:version_index]),
+            version_hw=payload[version_index],
+            version_type=payload[version_index + 1],
+            version_fw=int.from_bytes(
+                payload[version_index + 2 : version_index + 4], byteorder="little"
+            ),
+        )
+
+    def __str__(self):
+        return "FirmwareUpdateFinish: {}, hash {}, firmware {}".format(
+            self.status.name,
+            self.hash.hex(),
+            get_version_string(self.version_hw, self.version_type, self.version_fw),
+        )
@@ -0,0 +1,61 @@
+"""
+Define the response holding random bytes from the embedded generator
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseGetRandom(ResponseBase):
+    def __init__(self, receive_time, is_seeded, random_bytes):
+        """is_seeded is False, and random_bytes empty, until the generator got entropy from the LR1110"""
+        super().__init__(receive_time)
+        self.is_seeded = is_seeded
+        self.random_bytes = random_bytes
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x15\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < 1 or payload[0] > 1:
+            raise ResponseMalformedException(response_raw)
+        # No random byte is sent until the generator is seeded
+        if payload[0] == 1 and len(payload) < 2:
+            raise ResponseMalformedException(response_raw)
+        return ResponseGetRandom(
+            receive_time=response_raw.receive_time,
+            is_seeded=payload[0] == 1,
+            random_bytes=bytes(payload[1:]),
+        )
+
+    def __str__(self):
+        return "GetRandom: {} bytes{}".format(
+            len(self.random_bytes), "" if self.is_seeded else " (not seeded yet)"
+        )
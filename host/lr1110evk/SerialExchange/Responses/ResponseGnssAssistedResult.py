@@ -35,6 +35,8 @@ class ResponseGnssAssistedResult(ResponseBase):
     def __init__(self, receive_time, gnss_scan):
         super().__init__(receive_time)
         self.gnss_scan = gnss_scan
+        # Attached from the fetch result response by the job executor
+        self.telemetry = None
 
     @classmethod
     def from_response_raw(cls, response_raw):
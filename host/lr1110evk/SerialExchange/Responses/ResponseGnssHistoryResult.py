@@ -0,0 +1,67 @@
+"""
+Define GNSS history entry serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from datetime import timedelta
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseGnssHistoryResult(ResponseBase):
+    HEADER_LENGTH = 5
+
+    def __init__(self, receive_time, instant_scan, nb_satellites, nav_message):
+        super().__init__(receive_time)
+        self.instant_scan = instant_scan
+        self.nb_satellites = nb_satellites
+        self.nav_message = nav_message
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseGnssHistoryResult.HEADER_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        receive_time = response_raw.receive_time
+        elapsed_s = int.from_bytes(payload[0:4], byteorder="little")
+        nb_satellites = int.from_bytes(payload[4:5], byteorder="little")
+        nav_message = payload[ResponseGnssHistoryResult.HEADER_LENGTH :].hex()
+        response_history = ResponseGnssHistoryResult(
+            receive_time=receive_time,
+            instant_scan=receive_time - timedelta(seconds=elapsed_s),
+            nb_satellites=nb_satellites,
+            nav_message=nav_message,
+        )
+        return response_history
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x85\x00"
+
+    def __str__(self):
+        return "GnssHistoryResult({}): {} - {} satellite(s) - {}".format(
+            self.reception_time, self.nav_message, self.nb_satellites, self.instant_scan
+        )
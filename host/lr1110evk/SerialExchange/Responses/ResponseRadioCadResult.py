@@ -0,0 +1,110 @@
+"""
+Define radio CAD result response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseRadioCadResult(ResponseBase):
+    FRAME_LENGTH = 34
+
+    def __init__(
+        self,
+        receive_time,
+        combination_index,
+        frequency_hz,
+        spreading_factor,
+        nb_cads,
+        nb_detections,
+        nb_false_alarms,
+        cad_duration_us,
+        rx_duration_ms,
+        cad_energy_nas,
+        rx_energy_nas,
+    ):
+        super().__init__(receive_time)
+        self.combination_index = combination_index
+        self.frequency_hz = frequency_hz
+        self.spreading_factor = spreading_factor
+        self.nb_cads = nb_cads
+        self.nb_detections = nb_detections
+        self.nb_false_alarms = nb_false_alarms
+        self.cad_duration_us = cad_duration_us
+        self.rx_duration_ms = rx_duration_ms
+        self.cad_energy_nas = cad_energy_nas
+        self.rx_energy_nas = rx_energy_nas
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x89\x00"
+
+    @property
+    def energy_per_cad_nas(self):
+        return self.cad_energy_nas + self.rx_energy_nas
+
+    @property
+    def false_alarm_rate(self):
+        if self.nb_cads == 0:
+            return None
+        return self.nb_false_alarms / self.nb_cads
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseRadioCadResult.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+
+        def get_uint32(offset):
+            return int.from_bytes(payload[offset : offset + 4], byteorder="little")
+
+        return ResponseRadioCadResult(
+            receive_time=response_raw.receive_time,
+            combination_index=payload[0],
+            frequency_hz=get_uint32(1),
+            spreading_factor=payload[5],
+            nb_cads=get_uint32(6),
+            nb_detections=get_uint32(10),
+            nb_false_alarms=get_uint32(14),
+            cad_duration_us=get_uint32(18),
+            rx_duration_ms=get_uint32(22),
+            cad_energy_nas=get_uint32(26),
+            rx_energy_nas=get_uint32(30),
+        )
+
+    def __str__(self):
+        return (
+            "RadioCad(SF{} at {:.3f} MHz): {} CAD(s), {} detection(s), "
+            "{} false alarm(s), {} nas per CAD".format(
+                self.spreading_factor,
+                self.frequency_hz / 1e6,
+                self.nb_cads,
+                self.nb_detections,
+                self.nb_false_alarms,
+                self.energy_per_cad_nas,
+            )
+        )
@@ -0,0 +1,99 @@
+"""
+Define radio PER RX result response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseRadioPerRxResult(ResponseBase):
+    FRAME_LENGTH = 24
+
+    def __init__(
+        self,
+        receive_time,
+        nb_correct_packets,
+        nb_wrong_packets,
+        nb_timeouts,
+        nb_expected_packets,
+        listening_duration_ms,
+        average_current_ua,
+    ):
+        super().__init__(receive_time)
+        self.nb_correct_packets = nb_correct_packets
+        self.nb_wrong_packets = nb_wrong_packets
+        self.nb_timeouts = nb_timeouts
+        self.nb_expected_packets = nb_expected_packets
+        self.listening_duration_ms = listening_duration_ms
+        self.average_current_ua = average_current_ua
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x8A\x00"
+
+    @property
+    def capture_rate(self):
+        """Ratio of the packets sent that were received correctly
+
+        None until a packet carrying a sequence number was received
+        """
+        if self.nb_expected_packets == 0:
+            return None
+        return self.nb_correct_packets / self.nb_expected_packets
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseRadioPerRxResult.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+
+        def get_uint32(offset):
+            return int.from_bytes(payload[offset : offset + 4], byteorder="little")
+
+        return ResponseRadioPerRxResult(
+            receive_time=response_raw.receive_time,
+            nb_correct_packets=get_uint32(0),
+            nb_wrong_packets=get_uint32(4),
+            nb_timeouts=get_uint32(8),
+            nb_expected_packets=get_uint32(12),
+            listening_duration_ms=get_uint32(16),
+            average_current_ua=get_uint32(20),
+        )
+
+    def __str__(self):
+        capture_rate = self.capture_rate
+        return (
+            "RadioPerRx: {} correct, {} wrong, {} timeout(s), capture rate {}, "
+            "{} uA in {} ms".format(
+                self.nb_correct_packets,
+                self.nb_wrong_packets,
+                self.nb_timeouts,
+                "-" if capture_rate is None else "{:.2%}".format(capture_rate),
+                self.average_current_ua,
+                self.listening_duration_ms,
+            )
+        )
@@ -0,0 +1,127 @@
+"""
+Define the ping-pong statistics response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseRadioPingPongResult(ResponseBase):
+    FRAME_LENGTH = 33
+    MODE_SLAVE = 0
+    MODE_MASTER = 1
+
+    def __init__(
+        self,
+        receive_time,
+        mode,
+        nb_tx,
+        nb_correct_packets,
+        nb_wrong_packets,
+        nb_timeouts,
+        nb_round_trips,
+        round_trip_min_ms,
+        round_trip_max_ms,
+        round_trip_total_ms,
+    ):
+        super().__init__(receive_time)
+        self.mode = mode
+        self.nb_tx = nb_tx
+        self.nb_correct_packets = nb_correct_packets
+        self.nb_wrong_packets = nb_wrong_packets
+        self.nb_timeouts = nb_timeouts
+        self.nb_round_trips = nb_round_trips
+        self.round_trip_min_ms = round_trip_min_ms
+        self.round_trip_max_ms = round_trip_max_ms
+        self.round_trip_total_ms = round_trip_total_ms
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x8B\x00"
+
+    @property
+    def is_master(self):
+        return self.mode == ResponseRadioPingPongResult.MODE_MASTER
+
+    @property
+    def round_trip_average_ms(self):
+        """Average time from the start of a ping to the reception of its pong
+
+        None until the master received a pong
+        """
+        if self.nb_round_trips == 0:
+            return None
+        return self.round_trip_total_ms / self.nb_round_trips
+
+    @property
+    def round_trip_jitter_ms(self):
+        """Spread between the longest and the shortest round trip"""
+        if self.nb_round_trips == 0:
+            return None
+        return self.round_trip_max_ms - self.round_trip_min_ms
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseRadioPingPongResult.FRAME_LENGTH:
+            raise ResponseMalformedException(response_raw)
+
+        def get_uint32(offset):
+            return int.from_bytes(payload[offset : offset + 4], byteorder="little")
+
+        return ResponseRadioPingPongResult(
+            receive_time=response_raw.receive_time,
+            mode=payload[0],
+            nb_tx=get_uint32(1),
+            nb_correct_packets=get_uint32(5),
+            nb_wrong_packets=get_uint32(9),
+            nb_timeouts=get_uint32(13),
+            nb_round_trips=get_uint32(17),
+            round_trip_min_ms=get_uint32(21),
+            round_trip_max_ms=get_uint32(25),
+            round_trip_total_ms=get_uint32(29),
+        )
+
+    def __str__(self):
+        round_trip_average_ms = self.round_trip_average_ms
+        if round_trip_average_ms is None:
+            round_trip = "no round trip"
+        else:
+            round_trip = "round trip {:.1f} ms (min {} ms, max {} ms)".format(
+                round_trip_average_ms, self.round_trip_min_ms, self.round_trip_max_ms
+            )
+        return (
+            "RadioPingPong {}: {} sent, {} correct, {} wrong, {} timeout(s), "
+            "{}".format(
+                "master" if self.is_master else "slave",
+                self.nb_tx,
+                self.nb_correct_packets,
+                self.nb_wrong_packets,
+                self.nb_timeouts,
+                round_trip,
+            )
+        )
@@ -0,0 +1,127 @@
+"""
+Define radio spectrum response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class RadioSpectrumBin:
+    def __init__(self, center_frequency_hz, peak_rssi, average_rssi):
+        self.center_frequency_hz = center_frequency_hz
+        self.peak_rssi = peak_rssi
+        self.average_rssi = average_rssi
+
+    def __str__(self):
+        return "{:.3f} MHz: peak {} dBm, average {} dBm".format(
+            self.center_frequency_hz / 1e6, self.peak_rssi, self.average_rssi
+        )
+
+
+class ResponseRadioSpectrum(ResponseBase):
+    HEADER_LENGTH = 17
+    BIN_LENGTH = 2
+
+    def __init__(
+        self,
+        receive_time,
+        sweep_index,
+        sweep_duration_ms,
+        start_frequency_hz,
+        step_hz,
+        bins,
+    ):
+        super().__init__(receive_time)
+        self.sweep_index = sweep_index
+        self.sweep_duration_ms = sweep_duration_ms
+        self.start_frequency_hz = start_frequency_hz
+        self.step_hz = step_hz
+        self.bins = bins
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x88\x00"
+
+    @property
+    def max_bin(self):
+        if not self.bins:
+            return None
+        return max(self.bins, key=lambda spectrum_bin: spectrum_bin.peak_rssi)
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseRadioSpectrum.HEADER_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        sweep_index = int.from_bytes(payload[0:4], byteorder="little")
+        start_frequency_hz = int.from_bytes(payload[4:8], byteorder="little")
+        step_hz = int.from_bytes(payload[8:12], byteorder="little")
+        sweep_duration_ms = int.from_bytes(payload[12:16], byteorder="little")
+        nb_bins = payload[16]
+        if len(payload) != (
+            ResponseRadioSpectrum.HEADER_LENGTH
+            + nb_bins * ResponseRadioSpectrum.BIN_LENGTH
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        bins = list()
+        for index in range(nb_bins):
+            start = (
+                ResponseRadioSpectrum.HEADER_LENGTH
+                + index * ResponseRadioSpectrum.BIN_LENGTH
+            )
+            bins.append(
+                RadioSpectrumBin(
+                    center_frequency_hz=start_frequency_hz
+                    + index * step_hz
+                    + step_hz // 2,
+                    peak_rssi=int.from_bytes(
+                        payload[start : start + 1], byteorder="little", signed=True
+                    ),
+                    average_rssi=int.from_bytes(
+                        payload[start + 1 : start + 2], byteorder="little", signed=True
+                    ),
+                )
+            )
+
+        return ResponseRadioSpectrum(
+            receive_time=response_raw.receive_time,
+            sweep_index=sweep_index,
+            sweep_duration_ms=sweep_duration_ms,
+            start_frequency_hz=start_frequency_hz,
+            step_hz=step_hz,
+            bins=bins,
+        )
+
+    def __str__(self):
+        max_bin = self.max_bin
+        return "RadioSpectrum(sweep {}, {} ms, {} bins): max {}".format(
+            self.sweep_index,
+            self.sweep_duration_ms,
+            len(self.bins),
+            max_bin if max_bin else "none",
+        )
@@ -0,0 +1,143 @@
+"""
+Define the responses holding the VBAT and temperature history
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from datetime import timedelta
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseFetchTelemetry(ResponseBase):
+    LENGTH = 17
+
+    def __init__(
+        self,
+        receive_time,
+        period_ms,
+        nb_samples,
+        vbat_min_mv,
+        vbat_max_mv,
+        temperature_min_c,
+        temperature_max_c,
+        nb_entries,
+    ):
+        """The extremes are None if no sample was taken yet
+
+        nb_entries ResponseTelemetryEntry follow this response.
+        """
+        super().__init__(receive_time)
+        self.period_ms = period_ms
+        self.nb_samples = nb_samples
+        self.vbat_min_mv = vbat_min_mv
+        self.vbat_max_mv = vbat_max_mv
+        self.temperature_min_c = temperature_min_c
+        self.temperature_max_c = temperature_max_c
+        self.nb_entries = nb_entries
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x16\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseFetchTelemetry.LENGTH:
+            raise ResponseMalformedException(response_raw)
+
+        def to_temperature_c(raw_bytes):
+            return int.from_bytes(raw_bytes, byteorder="little", signed=True) / 10
+
+        nb_samples = int.from_bytes(payload[4:8], byteorder="little")
+        if nb_samples > 0:
+            vbat_min_mv = int.from_bytes(payload[8:10], byteorder="little")
+            vbat_max_mv = int.from_bytes(payload[10:12], byteorder="little")
+            temperature_min_c = to_temperature_c(payload[12:14])
+            temperature_max_c = to_temperature_c(payload[14:16])
+        else:
+            vbat_min_mv = None
+            vbat_max_mv = None
+            temperature_min_c = None
+            temperature_max_c = None
+        return ResponseFetchTelemetry(
+            receive_time=response_raw.receive_time,
+            period_ms=int.from_bytes(payload[0:4], byteorder="little"),
+            nb_samples=nb_samples,
+            vbat_min_mv=vbat_min_mv,
+            vbat_max_mv=vbat_max_mv,
+            temperature_min_c=temperature_min_c,
+            temperature_max_c=temperature_max_c,
+            nb_entries=payload[16],
+        )
+
+    def __str__(self):
+        if self.nb_samples == 0:
+            return "Telemetry: no sample yet (period {} ms)".format(self.period_ms)
+        return (
+            "Telemetry: {} sample(s) every {} ms - VBAT {} .. {} mV - "
+            "temperature {:.1f} .. {:.1f} C".format(
+                self.nb_samples,
+                self.period_ms,
+                self.vbat_min_mv,
+                self.vbat_max_mv,
+                self.temperature_min_c,
+                self.temperature_max_c,
+            )
+        )
+
+
+class ResponseTelemetryEntry(ResponseBase):
+    LENGTH = 8
+
+    def __init__(self, receive_time, instant_sample, vbat_mv, temperature_c):
+        super().__init__(receive_time)
+        self.instant_sample = instant_sample
+        self.vbat_mv = vbat_mv
+        self.temperature_c = temperature_c
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x8D\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseTelemetryEntry.LENGTH:
+            raise ResponseMalformedException(response_raw)
+        receive_time = response_raw.receive_time
+        elapsed_ms = int.from_bytes(payload[0:4], byteorder="little")
+        temperature_dc = int.from_bytes(payload[6:8], byteorder="little", signed=True)
+        return ResponseTelemetryEntry(
+            receive_time=receive_time,
+            instant_sample=receive_time - timedelta(milliseconds=elapsed_ms),
+            vbat_mv=int.from_bytes(payload[4:6], byteorder="little"),
+            temperature_c=temperature_dc / 10,
+        )
+
+    def __str__(self):
+        return "TelemetryEntry({}): VBAT {} mV - {:.1f} C".format(
+            self.instant_sample, self.vbat_mv, self.temperature_c
+        )
@@ -0,0 +1,123 @@
+"""
+Define Wi-Fi access point summary serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from datetime import timedelta
+from collections import namedtuple
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+WifiApSummaryEntry = namedtuple(
+    "WifiApSummaryEntry",
+    [
+        "mac_address",
+        "channel",
+        "wifi_type",
+        "nb_detections",
+        "rssi_min",
+        "rssi_max",
+        "rssi_mean",
+        "instant_last_seen",
+    ],
+)
+
+
+class ResponseWifiApSummary(ResponseBase):
+    HEADER_LENGTH = 3
+    ENTRY_LENGTH = 17
+
+    # Must follow demo_wifi_signal_type_t of the embedded demo
+    WIFI_TYPE_NAMES = ["TYPE_B", "TYPE_G", "TYPE_N"]
+
+    def __init__(self, receive_time, nb_scans, entries):
+        super().__init__(receive_time)
+        self.nb_scans = nb_scans
+        self.entries = entries
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x86\x00"
+
+    @classmethod
+    def wifi_type_name(cls, wifi_type):
+        try:
+            return cls.WIFI_TYPE_NAMES[wifi_type]
+        except IndexError:
+            return "TYPE_UNKNOWN({})".format(wifi_type)
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseWifiApSummary.HEADER_LENGTH:
+            raise ResponseMalformedException(response_raw)
+        receive_time = response_raw.receive_time
+        nb_scans = int.from_bytes(payload[0:2], byteorder="little")
+        nb_entries = payload[2]
+        expected_length = (
+            ResponseWifiApSummary.HEADER_LENGTH
+            + nb_entries * ResponseWifiApSummary.ENTRY_LENGTH
+        )
+        if len(payload) != expected_length:
+            raise ResponseMalformedException(response_raw)
+
+        entries = list()
+        for index in range(nb_entries):
+            start = (
+                ResponseWifiApSummary.HEADER_LENGTH
+                + index * ResponseWifiApSummary.ENTRY_LENGTH
+            )
+            raw_entry = payload[start : start + ResponseWifiApSummary.ENTRY_LENGTH]
+            last_seen_s = int.from_bytes(raw_entry[13:17], byteorder="little")
+            entries.append(
+                WifiApSummaryEntry(
+                    mac_address=":".join(
+                        ["{:02x}".format(mm) for mm in raw_entry[0:6]]
+                    ),
+                    channel=raw_entry[6],
+                    wifi_type=ResponseWifiApSummary.wifi_type_name(raw_entry[7]),
+                    nb_detections=int.from_bytes(raw_entry[8:10], byteorder="little"),
+                    rssi_min=int.from_bytes(
+                        raw_entry[10:11], byteorder="little", signed=True
+                    ),
+                    rssi_max=int.from_bytes(
+                        raw_entry[11:12], byteorder="little", signed=True
+                    ),
+                    rssi_mean=int.from_bytes(
+                        raw_entry[12:13], byteorder="little", signed=True
+                    ),
+                    instant_last_seen=receive_time - timedelta(seconds=last_seen_s),
+                )
+            )
+
+        return ResponseWifiApSummary(
+            receive_time=receive_time, nb_scans=nb_scans, entries=entries
+        )
+
+    def __str__(self):
+        return "WifiApSummary({}): {} access point(s) over {} scan(s)".format(
+            self.reception_time, len(self.entries), self.nb_scans
+        )
@@ -35,6 +35,8 @@ class ResponseWifiResult(ResponseBase):
     def __init__(self, receive_time, mac_address):
         super().__init__(receive_time)
         self.mac_address = mac_address
+        # Attached from the fetch result response by the job executor
+        self.telemetry = None
 
     @classmethod
     def from_response_raw(cls, response_raw):
@@ -4,13 +4,47 @@ from .ResponseResetAck import ResponseReset
 from .ResponseConfigureAck import ResponseConfigureAck
 from .ResponseEvent import ResponseEvent
 from .ResponseFetchResult import ResponseFetchResult
+from .ResponseFetchGnssHistory import ResponseFetchGnssHistory
+from .ResponseGnssHistoryResult import ResponseGnssHistoryResult
+from .ResponseFetchGuiMemory import ResponseFetchGuiMemory, GuiMemoryPageStats
+from .ResponseFetchWifiChannelStats import (
+    ResponseFetchWifiChannelStats,
+    WifiChannelStats,
+)
+from .ResponseConsumptionModel import ResponseConsumptionModel, ConsumptionModel
+from .ResponseCryptoBenchmark import (
+    ResponseCryptoBenchmark,
+    ResponseCryptoBenchmarkResult,
+    CryptoBenchmarkPrimitive,
+)
+from .ResponseCrypto import (
+    ResponseCryptoSelect,
+    ResponseCryptoSetKey,
+    ResponseCryptoProcess,
+    CryptoStatus,
+    CryptoBlockResult,
+)
+from .ResponseFirmwareUpdate import (
+    ResponseFirmwareUpdateStart,
+    ResponseFirmwareUpdateChunk,
+    ResponseFirmwareUpdateFinish,
+    FirmwareUpdateStatus,
+)
+from .ResponseEnergy import ResponseEnergy
+from .ResponseRadioSpectrum import ResponseRadioSpectrum, RadioSpectrumBin
+from .ResponseRadioCadResult import ResponseRadioCadResult
+from .ResponseRadioPerRxResult import ResponseRadioPerRxResult
+from .ResponseRadioPingPongResult import ResponseRadioPingPongResult
 from .ResponseGnssAssistedResult import ResponseGnssAssistedResult
 from .ResponseLog import ResponseLog
 from .ResponseSetDateLocAck import ResponseSetDateLoc
 from .ResponseStartAck import ResponseStartAck
 from .ResponseStatus import ResponseStatus
 from .ResponseWifiResult import ResponseWifiResult
+from .ResponseWifiApSummary import ResponseWifiApSummary, WifiApSummaryEntry
 from .ResponseVersion import ResponseVersion
+from .ResponseGetRandom import ResponseGetRandom
+from .ResponseTelemetry import ResponseFetchTelemetry, ResponseTelemetryEntry
 from .ResponseAlmanacDates import ResponseAlmanacDates
 from .ResponseUpdateAlmanac import ResponseUpdateAlmanac
 from .ResponseCheckAlmanacUpdate import ResponseCheckAlmanacUpdate
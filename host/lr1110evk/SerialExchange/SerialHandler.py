@@ -32,7 +32,7 @@ from serial.tools import list_ports
 from serial.serialutil import SerialException
 from threading import Thread, Event
 from queue import Queue
-from .Responses import ResponseRaw
+from .FrameDecoder import FrameDecoder
 from datetime import datetime
 
 
@@ -88,6 +88,7 @@ class SerialHandler:
     DISCOVER_PORT_REGEXP = "(STM.*)|(374B)"
     SERIAL_BAUDRATE = 921600
     SERIAL_READ_TIMEOUT_S = 1
+    SERIAL_READ_CHUNK_SIZE = 4096
     TEST_HOST_MESSAGE = b"!TEST_HOST"
     TEST_HOST_FIELD_TEST_RESPONSE = b"fieldglog\x00"
 
@@ -98,6 +99,7 @@ class SerialHandler:
         )
         self.read_thread_run = Event()
         self.response_fifo = Queue()
+        self.frame_decoder = FrameDecoder()
         self.is_embedded_set_to_field_test = Event()
 
     def set_serial_port(self, device):
@@ -140,15 +142,15 @@ class SerialHandler:
 
     def read_command(self):
         while not self.read_thread_run.is_set():
-            received_response = False
             try:
-                received_response = self.read_one_response_or_none()
+                received_responses = self.read_available_responses()
             except SerialHandlerExceptionReadTimeout:
                 print("Error: timeout on received command")
+                continue
             except SerialHandlerExceptionDisconnect:
                 print("Critical error: serial lost device. Did it got disconnected?")
                 break
-            if received_response:
+            for received_response in received_responses:
                 if received_response.resp_code == SerialHandler.TEST_HOST_MESSAGE[0:2]:
                     self.send_swith_embedded_to_field_test_mode_response()
                     self.is_embedded_set_to_field_test.set()
@@ -157,36 +159,28 @@ class SerialHandler:
                     self.response_fifo.put(received_response)
         print("[Serial Handler] Leaving runtime")
 
-    def read_n_bytes_or_timeout(self, n_bytes):
+    def read_available_chunk(self):
+        # Block until at least one byte is received (or timeout), then get
+        # everything already buffered by the driver in the same call
         try:
-            data_read = self.serial_port.read(n_bytes)
+            n_bytes_to_read = min(
+                max(self.serial_port.in_waiting, 1), SerialHandler.SERIAL_READ_CHUNK_SIZE
+            )
+            data_read = self.serial_port.read(n_bytes_to_read)
         except SerialException:
             raise SerialHandlerExceptionDisconnect()
-        if len(data_read) < n_bytes:
-            raise SerialHandlerExceptionReadTimeout(n_bytes, data_read)
         return data_read
 
-    def read_one_response_or_none(self):
-        try:
-            resp_code = self.read_n_bytes_or_timeout(2)
-        except SerialHandlerExceptionReadTimeout:
-            # It is ok to timeout on reception of the resp_code,
-            # but once the resp_code is received, it is an exception
-            # to not receive the complete commands
-            return None
-        receive_time = datetime.utcnow()
-        # Dirty trick to receive the !TEST_HOST command
-        if resp_code == b"!T":
-            payload_size = 9
-        else:
-            payload_size = int.from_bytes(
-                self.read_n_bytes_or_timeout(2), byteorder="little"
-            )
-        if payload_size > 0:
-            payload = self.serial_port.read(payload_size)
-        else:
-            payload = b""
-        response = ResponseRaw(
-            resp_code=resp_code, payload=payload, receive_time=receive_time
-        )
-        return response
+    def read_available_responses(self):
+        data_read = self.read_available_chunk()
+        if not data_read:
+            # It is ok to timeout while waiting for a new frame,
+            # but once a frame is started, it is an exception
+            # to not receive it completely
+            if self.frame_decoder.has_pending_data():
+                expected_n_bytes = self.frame_decoder.get_pending_frame_size()
+                pending_data = bytes(self.frame_decoder.buffer)
+                self.frame_decoder.reset()
+                raise SerialHandlerExceptionReadTimeout(expected_n_bytes, pending_data)
+            return []
+        return self.frame_decoder.feed(data_read, datetime.utcnow())
@@ -12,11 +12,31 @@ from .Commands import (
     CommandStartWifiCountryCode,
     CommandStartGnssAutonomous,
     CommandStartGnssAssisted,
+    CommandStartRadioSpectrum,
+    CommandStartRadioCad,
+    CommandStartRadioPerRx,
+    CommandStartRadioPingPong,
+    PingPongTiming,
+    LoraBandwidth,
     CommandStatus,
     CommandGetVersion,
     CommandGetAlmanacDates,
     CommandUpdateAlmanac,
     CommandCheckAlmanacUpdate,
+    CommandFetchGuiMemory,
+    CommandFetchWifiChannelStats,
+    CommandConsumptionModel,
+    CommandCryptoBenchmark,
+    CommandCryptoSelect,
+    CommandCryptoSetKey,
+    CommandCryptoProcess,
+    CryptoElement,
+    CryptoOperation,
+    CommandFirmwareUpdateStart,
+    CommandFirmwareUpdateChunk,
+    CommandFirmwareUpdateFinish,
+    CommandGetRandom,
+    CommandFetchTelemetry,
 )
 from .Responses import (
     ResponseRaw,
@@ -31,10 +51,38 @@ from .Responses import (
     ResponseStartAck,
     ResponseStatus,
     ResponseWifiResult,
+    ResponseWifiApSummary,
+    WifiApSummaryEntry,
     ResponseVersion,
     ResponseAlmanacDates,
     ResponseUpdateAlmanac,
     ResponseCheckAlmanacUpdate,
+    ResponseFetchGuiMemory,
+    ResponseFetchWifiChannelStats,
+    WifiChannelStats,
+    ResponseConsumptionModel,
+    ConsumptionModel,
+    ResponseEnergy,
+    ResponseRadioSpectrum,
+    RadioSpectrumBin,
+    ResponseRadioCadResult,
+    ResponseRadioPerRxResult,
+    ResponseRadioPingPongResult,
+    ResponseCryptoBenchmark,
+    ResponseCryptoBenchmarkResult,
+    CryptoBenchmarkPrimitive,
+    ResponseCryptoSelect,
+    ResponseCryptoSetKey,
+    ResponseCryptoProcess,
+    CryptoStatus,
+    CryptoBlockResult,
+    ResponseFirmwareUpdateStart,
+    ResponseFirmwareUpdateChunk,
+    ResponseFirmwareUpdateFinish,
+    FirmwareUpdateStatus,
+    ResponseGetRandom,
+    ResponseFetchTelemetry,
+    ResponseTelemetryEntry,
 )
 from .SerialHandler import (
     SerialHandler,
@@ -0,0 +1,202 @@
+"""
+Run the crypto engine benchmark and display the time spent in each primitive
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from queue import Empty
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommunicationHandlerNoResponse,
+    CommandCryptoBenchmark,
+    ResponseCryptoBenchmark,
+    ResponseCryptoBenchmarkResult,
+    CryptoBenchmarkPrimitive,
+)
+
+
+def run_crypto_benchmark(communication_handler, command, timeout_s):
+    """Send the benchmark command and collect its results
+
+    The embedded side only answers once all the calls are done, hence the
+    timeout longer than the one of the usual exchanges
+    """
+    communication_handler.send_one_command(command)
+    try:
+        get_response = communication_handler.get_response_from_fifo_and_filter_out_log
+        response = get_response(timeout=timeout_s)
+    except Empty:
+        raise CommunicationHandlerNoResponse(timeout_s)
+    if response.get_response_code() != ResponseCryptoBenchmark.get_response_code():
+        raise CommunicationHandlerException("Unexpected response: {}".format(response))
+    if not response.is_ok:
+        raise CommunicationHandlerException(str(response))
+    results = list()
+    for _ in range(response.nb_results):
+        response = communication_handler.wait_and_handle_response()
+        response_code = response.get_response_code()
+        if response_code == ResponseCryptoBenchmarkResult.get_response_code():
+            results.append(response)
+    return results
+
+
+def format_results(results):
+    """Build one line per result, with the share of the SPI reference in it
+
+    The SPI reference moves the same payload to and from the LR1110 without
+    computing anything, so it gives the part of a call spent on the bus
+    """
+    spi_reference_us = {
+        result.payload_size: result.average_us
+        for result in results
+        if result.primitive == CryptoBenchmarkPrimitive.spi_reference
+    }
+    lines = [
+        "{:<18}{:>6}{:>10}{:>8}{:>8}{:>8}{:>12}{:>6}".format(
+            "Primitive", "Bytes", "Avg (us)", "Min", "Max", "Errors", "kbit/s", "SPI"
+        )
+    ]
+    for result in results:
+        average_us = result.average_us
+        throughput_kbps = result.throughput_kbps
+        spi_share = "-"
+        if (
+            result.primitive != CryptoBenchmarkPrimitive.spi_reference
+            and result.payload_size in spi_reference_us
+            and average_us
+        ):
+            spi_us = spi_reference_us[result.payload_size]
+            spi_share = "{:.0%}".format(spi_us / average_us)
+        lines.append(
+            "{:<18}{:>6}{:>10}{:>8}{:>8}{:>8}{:>12}{:>6}".format(
+                result.primitive.name,
+                result.payload_size,
+                "-" if average_us is None else "{:.1f}".format(average_us),
+                result.min_us,
+                result.max_us,
+                result.nb_errors,
+                "-" if throughput_kbps is None else "{:.1f}".format(throughput_kbps),
+                spi_share,
+            )
+        )
+    return lines
+
+
+def entry_point_crypto_benchmark():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+    default_iterations = 100
+    default_payload_sizes = [16, 64, 128, 240]
+    default_timeout_s = 120
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Time the primitives of the LR1110 crypto engine from the MCU, "
+        "SPI transfers included. The benchmark is refused while a demo is running"
+    )
+    parser.add_argument(
+        "-n",
+        "--iterations",
+        help="Number of calls timed per primitive and payload size, up to 1000 "
+        "(default={})".format(default_iterations),
+        type=int,
+        default=default_iterations,
+    )
+    parser.add_argument(
+        "-s",
+        "--payload-sizes",
+        help="Payload sizes in bytes, up to 4 multiples of 16 up to 240 "
+        "(default={})".format(" ".join(str(size) for size in default_payload_sizes)),
+        type=int,
+        nargs="+",
+        default=default_payload_sizes,
+    )
+    parser.add_argument(
+        "-t",
+        "--timeout",
+        help="Time to wait for the end of the benchmark in s (default={})".format(
+            default_timeout_s
+        ),
+        type=float,
+        default=default_timeout_s,
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    if not 1 <= len(args.payload_sizes) <= 4 or any(
+        size <= 0 or size > 240 or size % 16 != 0 for size in args.payload_sizes
+    ):
+        parser.error("payload sizes must be 1 to 4 multiples of 16 up to 240")
+    if not 1 <= args.iterations <= 1000:
+        parser.error("iterations must be between 1 and 1000")
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    command = CommandCryptoBenchmark(args.iterations, args.payload_sizes)
+
+    try:
+        results = run_crypto_benchmark(communication_handler, command, args.timeout)
+        for line in format_results(results):
+            log_logger.log(line)
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log("Crypto benchmark failed: {}".format(communication_exception))
+    finally:
+        communication_handler.stop()
+        log_logger.terminate()
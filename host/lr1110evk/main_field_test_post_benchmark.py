@@ -0,0 +1,247 @@
+"""
+Benchmark the pipelined FieldTestPost request path against the serial one on a stand-in server
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+import random
+import time
+from argparse import ArgumentParser
+from collections import namedtuple
+from datetime import datetime
+from .BaseTypes import ScannedMacAddress, WifiChannels
+from .FieldTestPost.Core import (
+    RequestSender,
+    RequestPipeline,
+    RequestWifiGls,
+    GeoLocServiceClientGnss,
+    GeoLocServiceClientWifi,
+    StandInGeoLocServer,
+)
+
+
+BenchmarkConfiguration = namedtuple(
+    "BenchmarkConfiguration",
+    ["wifi_server", "gnss_server", "deactivate_wifi_requests", "verbosity"],
+)
+
+BenchmarkResult = namedtuple("BenchmarkResult", ["duration_s", "outcomes"])
+
+
+def build_wifi_requests(nb_requests, seed):
+    generator = random.Random(seed)
+    requests = list()
+    for _ in range(nb_requests):
+        request = RequestWifiGls()
+        for _ in range(generator.randint(3, 12)):
+            request.macs.append(
+                ScannedMacAddress(
+                    mac_address=":".join(
+                        "{:02X}".format(generator.randint(0, 255)) for _ in range(6)
+                    ),
+                    wifi_channel=generator.choice(WifiChannels.WIFI_CHANNELS),
+                    wifi_type="B",
+                    rssi=generator.randint(-95, -30),
+                    timing_demodulation=0,
+                    timing_capture=0,
+                    timing_correlation=0,
+                    timing_detection=0,
+                    instant_scan=datetime.now(),
+                )
+            )
+        requests.append(request)
+    return requests
+
+
+def build_request_sender(stand_in_server):
+    wifi_server = GeoLocServiceClientWifi.from_token_and_url_info(
+        authentication_token="stand-in",
+        baseUrl=stand_in_server.base_url,
+        port=stand_in_server.port,
+        version=GeoLocServiceClientWifi.get_default_url_version(),
+        path=GeoLocServiceClientWifi.get_default_url_path(),
+    )
+    gnss_server = GeoLocServiceClientGnss.from_token_and_url_info(
+        authentication_token="stand-in",
+        baseUrl=stand_in_server.base_url,
+        port=stand_in_server.port,
+        version=GeoLocServiceClientGnss.get_default_url_version(),
+        path=GeoLocServiceClientGnss.get_default_url_path(),
+    )
+    configuration = BenchmarkConfiguration(
+        wifi_server=wifi_server,
+        gnss_server=gnss_server,
+        deactivate_wifi_requests=False,
+        verbosity=False,
+    )
+    return RequestSender(configuration)
+
+
+def run_serial(request_sender, requests):
+    # Request path used by FieldTestPost before the pipeline: each request waits
+    # for its response before the next one is sent. solve() only turns solver
+    # exceptions into results, as the pipelined path does
+    request_pipeline = RequestPipeline(request_sender, 1)
+    start = time.perf_counter()
+    outcomes = [request_pipeline.solve(request) for request in requests]
+    return BenchmarkResult(duration_s=time.perf_counter() - start, outcomes=outcomes)
+
+
+def run_pipelined(request_sender, requests, max_in_flight):
+    request_pipeline = RequestPipeline(request_sender, max_in_flight)
+    start = time.perf_counter()
+    outcomes = [
+        solver_outcome
+        for _, _, solver_outcome in request_pipeline.process(
+            (index, request) for index, request in enumerate(requests)
+        )
+    ]
+    return BenchmarkResult(duration_s=time.perf_counter() - start, outcomes=outcomes)
+
+
+def serve_stand_in_server(stand_in_server):
+    print(
+        "Stand-in geolocation server listening on {}:{}\n"
+        "Point FieldTestPost at it with: -s {base} -p {port} -t {base} -q {port}".format(
+            stand_in_server.base_url,
+            stand_in_server.port,
+            base=stand_in_server.base_url,
+            port=stand_in_server.port,
+        )
+    )
+    try:
+        stand_in_server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stand_in_server.stop()
+
+
+def entry_point_field_test_post_benchmark():
+    default_nb_requests = 200
+    default_max_in_flight = RequestPipeline.DEFAULT_MAX_IN_FLIGHT
+    default_latency_min_ms = StandInGeoLocServer.DEFAULT_LATENCY_MIN_S * 1000
+    default_latency_max_ms = StandInGeoLocServer.DEFAULT_LATENCY_MAX_S * 1000
+    default_seed = StandInGeoLocServer.DEFAULT_SEED
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Compare the serial and the pipelined FieldTestPost request "
+        "paths against a local stand-in geolocation server, without network access"
+    )
+    parser.add_argument(
+        "-n",
+        "--nb-requests",
+        type=int,
+        help="Number of Wi-Fi requests to solve (default={})".format(
+            default_nb_requests
+        ),
+        default=default_nb_requests,
+    )
+    parser.add_argument(
+        "-j",
+        "--max-in-flight-requests",
+        type=int,
+        help="Maximum number of in-flight requests of the pipelined path (default={})".format(
+            default_max_in_flight
+        ),
+        default=default_max_in_flight,
+    )
+    parser.add_argument(
+        "--latency-min-ms",
+        type=float,
+        help="Minimum response latency of the stand-in server (default={})".format(
+            default_latency_min_ms
+        ),
+        default=default_latency_min_ms,
+    )
+    parser.add_argument(
+        "--latency-max-ms",
+        type=float,
+        help="Maximum response latency of the stand-in server (default={})".format(
+            default_latency_max_ms
+        ),
+        default=default_latency_max_ms,
+    )
+    parser.add_argument(
+        "--seed",
+        type=int,
+        help="Seed of the requests and latencies (default={})".format(default_seed),
+        default=default_seed,
+    )
+    parser.add_argument(
+        "--serve",
+        type=int,
+        metavar="PORT",
+        help="Only run the stand-in server on this port, for FieldTestPost runs on real result files",
+        default=None,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    stand_in_server = StandInGeoLocServer(
+        port=args.serve if args.serve is not None else 0,
+        latency_min_s=args.latency_min_ms / 1000,
+        latency_max_s=args.latency_max_ms / 1000,
+        seed=args.seed,
+    )
+
+    if args.serve is not None:
+        serve_stand_in_server(stand_in_server)
+        return
+
+    requests = build_wifi_requests(args.nb_requests, args.seed)
+    with stand_in_server:
+        request_sender = build_request_sender(stand_in_server)
+        serial_result = run_serial(request_sender, requests)
+        pipelined_result = run_pipelined(
+            request_sender, requests, args.max_in_flight_requests
+        )
+
+    same_results = [str(outcome) for outcome in serial_result.outcomes] == [
+        str(outcome) for outcome in pipelined_result.outcomes
+    ]
+    print(
+        "{} requests, latency {}-{} ms\n"
+        " - serial:                  {:.2f} s\n"
+        " - pipelined ({} in flight): {:.2f} s\n"
+        " - speed-up:                x{:.1f}\n"
+        " - same results, same order: {}".format(
+            args.nb_requests,
+            args.latency_min_ms,
+            args.latency_max_ms,
+            serial_result.duration_s,
+            args.max_in_flight_requests,
+            pipelined_result.duration_s,
+            serial_result.duration_s / pipelined_result.duration_s,
+            same_results,
+        )
+    )
+
+
+if __name__ == "__main__":
+    entry_point_field_test_post_benchmark()
@@ -0,0 +1,159 @@
+"""
+Update the firmware of the LR1110 through the embedded bootloader
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import re
+import pkg_resources
+from argparse import ArgumentParser
+from .Job import (
+    UpdateFirmwareFailure,
+    UpdateFirmwareWrongResponseException,
+    UpdateFirmwareJob,
+    Logger,
+)
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    SerialHanlerEmbeddedNotSetException,
+)
+
+
+def read_firmware_image(filename):
+    """Read an encrypted LR1110 image as a sequence of big endian 32-bit words
+
+    The image is either the C header distributed with the firmware, holding an
+    array of 32-bit words, or a binary file already holding the words in big
+    endian
+    """
+    if filename.endswith(".h"):
+        with open(filename, "r") as image_file:
+            content = image_file.read()
+        array_content = content[content.index("{") : content.rindex("}")]
+        return b"".join(
+            int(word, 16).to_bytes(4, byteorder="big")
+            for word in re.findall(r"0x[0-9a-fA-F]{1,8}", array_content)
+        )
+    with open(filename, "rb") as image_file:
+        return image_file.read()
+
+
+def entry_point_update_firmware():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Write an encrypted firmware image to the LR1110 of the board. "
+        "The LR1110 stays in its bootloader if the update fails, run the command "
+        "again to retry"
+    )
+    parser.add_argument(
+        "image",
+        help="Encrypted firmware image: C header as distributed, or binary file of "
+        "big endian 32-bit words",
+    )
+    parser.add_argument(
+        "-e",
+        "--expected-hash",
+        help="Hash of the flash content expected once the image is written, as 32 "
+        "hexadecimal digits. Without it the hash is only displayed",
+        default=None,
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    expected_hash = None
+    if args.expected_hash:
+        try:
+            expected_hash = bytes.fromhex(args.expected_hash)
+        except ValueError:
+            parser.error("expected hash must be made of hexadecimal digits")
+        if len(expected_hash) != 16:
+            parser.error("expected hash must be 16 bytes long")
+
+    firmware_image = read_firmware_image(args.image)
+    if not firmware_image or len(firmware_image) % 4 != 0:
+        parser.error("image must hold a whole number of 32-bit words")
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    log_logger.log("Image of {} bytes read".format(len(firmware_image)))
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    update_firmware_job = UpdateFirmwareJob(
+        communication_handler=communication_handler,
+        firmware_image=firmware_image,
+        expected_hash=expected_hash,
+        logger=log_logger,
+    )
+
+    try:
+        update_firmware_job.execute_update()
+    except UpdateFirmwareFailure as failure:
+        log_logger.log(str(failure))
+    except UpdateFirmwareWrongResponseException as wrong_response:
+        log_logger.log(str(wrong_response))
+    except SerialHanlerEmbeddedNotSetException:
+        log_logger.log(
+            "Embedded seems connected but did not respond. Have you reset it?"
+        )
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log("Firmware update failed: {}".format(communication_exception))
+    finally:
+        communication_handler.stop()
+        log_logger.log("Bye")
+        log_logger.terminate()
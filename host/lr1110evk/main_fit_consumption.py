@@ -0,0 +1,298 @@
+"""
+Fit the currents of the consumption model from bench measurements
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import csv
+import math
+import pkg_resources
+from argparse import ArgumentParser
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandConsumptionModel,
+    ResponseConsumptionModel,
+)
+
+KIND_KEY = "kind"
+REG_MODE_KEY = "reg_mode"
+CHARGE_KEY = "charge_uas"
+
+# For each kind of scan and regulator: the duration columns of the measures, their
+# unit in seconds, and the current of the model they calibrate
+FIT_GROUPS = {
+    ("wifi", "dcdc"): [
+        ("detection_us", 1e-6, "wifi_dcdc_detection_ua"),
+        ("correlation_us", 1e-6, "wifi_dcdc_correlation_ua"),
+        ("capture_us", 1e-6, "wifi_dcdc_capture_ua"),
+        ("demodulation_us", 1e-6, "wifi_dcdc_demodulation_ua"),
+    ],
+    ("wifi", "ldo"): [
+        ("detection_us", 1e-6, "wifi_ldo_detection_ua"),
+        ("correlation_us", 1e-6, "wifi_ldo_correlation_ua"),
+        ("capture_us", 1e-6, "wifi_ldo_capture_ua"),
+        ("demodulation_us", 1e-6, "wifi_ldo_demodulation_ua"),
+    ],
+    ("gnss", "dcdc"): [
+        ("acquisition_ms", 1e-3, "gnss_dcdc_acquisition_ua"),
+        ("computation_ms", 1e-3, "gnss_dcdc_computation_ua"),
+    ],
+    ("cad", "dcdc"): [
+        ("cad_us", 1e-6, "radio_dcdc_cad_ua"),
+        ("rx_us", 1e-6, "radio_dcdc_rx_ua"),
+    ],
+}
+
+
+class FitConsumptionException(Exception):
+    pass
+
+
+def load_measures(csv_file):
+    """Group the measures of a CSV file per kind of scan and regulator
+
+    Each row is a scan or a CAD, with its kind (wifi, gnss or cad), the regulator
+    used (dcdc or ldo), the duration of its phases as reported by the board, and the
+    charge measured on the bench in uas.
+    """
+    measures = dict()
+    for row in csv.DictReader(csv_file):
+        group = (row[KIND_KEY].strip().lower(), row[REG_MODE_KEY].strip().lower())
+        if group not in FIT_GROUPS:
+            raise FitConsumptionException(
+                "Unsupported scan {} with regulator {}".format(*group)
+            )
+        durations_s = [
+            float(row[column]) * unit_s for column, unit_s, _ in FIT_GROUPS[group]
+        ]
+        measures.setdefault(group, list()).append(
+            (durations_s, float(row[CHARGE_KEY]))
+        )
+    return measures
+
+
+def solve_least_squares(durations, charges, columns):
+    """Solve the normal equations restricted to columns by Gauss-Jordan elimination"""
+    size = len(columns)
+    matrix = [
+        [sum(row[i] * row[j] for row in durations) for j in columns]
+        + [sum(row[i] * charge for row, charge in zip(durations, charges))]
+        for i in columns
+    ]
+    for pivot_index in range(size):
+        best = max(range(pivot_index, size), key=lambda r: abs(matrix[r][pivot_index]))
+        if abs(matrix[best][pivot_index]) < 1e-18:
+            raise FitConsumptionException(
+                "The phases cannot be told apart with these measures: vary their "
+                "durations independently"
+            )
+        matrix[pivot_index], matrix[best] = matrix[best], matrix[pivot_index]
+        pivot = matrix[pivot_index][pivot_index]
+        matrix[pivot_index] = [value / pivot for value in matrix[pivot_index]]
+        for row_index in range(size):
+            if row_index != pivot_index:
+                factor = matrix[row_index][pivot_index]
+                matrix[row_index] = [
+                    value - factor * pivot_value
+                    for value, pivot_value in zip(
+                        matrix[row_index], matrix[pivot_index]
+                    )
+                ]
+    return {column: matrix[index][size] for index, column in enumerate(columns)}
+
+
+def fit_currents(measures):
+    """Fit non-negative phase currents, in uA, to the measured charges
+
+    Phases never exercised by the measures are not fitted and reported as None.
+    A phase whose current comes out negative is forced to zero and the others are
+    fitted again.
+    """
+    durations = [durations_s for durations_s, _ in measures]
+    charges = [charge for _, charge in measures]
+    nb_phases = len(durations[0])
+    columns = [
+        index for index in range(nb_phases) if any(row[index] > 0 for row in durations)
+    ]
+    if len(measures) < len(columns):
+        raise FitConsumptionException(
+            "{} measure(s) for {} phase(s) to fit".format(len(measures), len(columns))
+        )
+
+    solution = dict()
+    while columns:
+        solution = solve_least_squares(durations, charges, columns)
+        negative_columns = [column for column in columns if solution[column] < 0]
+        if not negative_columns:
+            break
+        columns.remove(min(negative_columns, key=lambda column: solution[column]))
+
+    currents = [None] * nb_phases
+    for index in range(nb_phases):
+        if any(row[index] > 0 for row in durations):
+            currents[index] = solution.get(index, 0.0)
+    return currents
+
+
+def fit_residuals(measures, currents):
+    errors = [
+        charge
+        - sum(
+            duration * (current or 0) for duration, current in zip(durations, currents)
+        )
+        for durations, charge in measures
+    ]
+    rms = math.sqrt(sum(error ** 2 for error in errors) / len(errors))
+    # The relative error is undefined for the measures without charge, None if
+    # no measure has a charge
+    worst_relative = max(
+        (
+            abs(error) / charge
+            for error, (_, charge) in zip(errors, measures)
+            if charge
+        ),
+        default=None,
+    )
+    return rms, worst_relative
+
+
+def entry_point_fit_consumption():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Fit the currents of the consumption model of the board from "
+        "bench measurements, and optionally load them on the board"
+    )
+    parser.add_argument(
+        "measures",
+        help="CSV file with the columns {}, {}, the phase durations ({}) and {}".format(
+            KIND_KEY,
+            REG_MODE_KEY,
+            ", ".join(
+                sorted(
+                    {column for group in FIT_GROUPS.values() for column, _, _ in group}
+                )
+            ),
+            CHARGE_KEY,
+        ),
+    )
+    parser.add_argument(
+        "-a",
+        "--apply",
+        help="Replace the fitted currents of the consumption model of the board",
+        action="store_true",
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    fitted_currents = dict()
+    try:
+        with open(args.measures, newline="") as csv_file:
+            measures = load_measures(csv_file)
+        for group, group_measures in sorted(measures.items()):
+            currents = fit_currents(group_measures)
+            rms, worst_relative = fit_residuals(group_measures, currents)
+            worst_relative_str = (
+                "n/a" if worst_relative is None else "{:.1%}".format(worst_relative)
+            )
+            log_logger.log(
+                "{} {}: {} measure(s), residual RMS {:.1f} uas, worst {}".format(
+                    group[0], group[1], len(group_measures), rms, worst_relative_str
+                )
+            )
+            for (column, _, field), current in zip(FIT_GROUPS[group], currents):
+                if current is None:
+                    log_logger.log("  {}: not exercised by {}".format(field, column))
+                    continue
+                log_logger.log("  {}: {:.0f} uA".format(field, current))
+                fitted_currents[field] = current
+    except (OSError, KeyError, ValueError, FitConsumptionException) as fit_exception:
+        log_logger.log("Failed to fit the consumption model: {}".format(fit_exception))
+        log_logger.terminate()
+        return
+
+    if not args.apply:
+        log_logger.terminate()
+        return
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    try:
+        # The currents not fitted keep the value of the board
+        _, response = communication_handler.handle_exchange(CommandConsumptionModel())
+        if (
+            response.get_response_code()
+            != ResponseConsumptionModel.get_response_code()
+        ):
+            raise CommunicationHandlerException(
+                "Unexpected response: {}".format(response)
+            )
+        consumption_model = response.consumption_model._replace(**fitted_currents)
+        _, response = communication_handler.handle_exchange(
+            CommandConsumptionModel(consumption_model)
+        )
+        log_logger.log(str(response))
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log(
+            "Failed to load the consumption model: {}".format(communication_exception)
+        )
+    finally:
+        communication_handler.stop()
+        log_logger.terminate()
@@ -0,0 +1,197 @@
+"""
+Fetch the LVGL memory usage of the GUI and generate a memory profile header
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandFetchGuiMemory,
+    ResponseFetchGuiMemory,
+)
+
+LVGL_MEM_SIZE_MIN = 2 * 1024
+LVGL_MEM_SIZE_GRANULARITY = 1024
+
+PROFILE_HEADER_TEMPLATE = """/**
+ * @file      gui_memory_profile.h
+ *
+ * @brief     LVGL memory profile, generated by GuiMemoryProfile. Do not edit.
+ *
+ * Measured pool size: {pool_size} bytes, peak used: {peak_used_size} bytes, margin: {margin}%
+{pages} */
+
+#ifndef __GUI_MEMORY_PROFILE_H__
+#define __GUI_MEMORY_PROFILE_H__
+
+#define GUI_MEMORY_PROFILE_MEM_SIZE ( {mem_size}U )
+#define GUI_MEMORY_PROFILE_IMG_CACHE_SIZE ( {img_cache_size} )
+
+#endif  // __GUI_MEMORY_PROFILE_H__
+"""
+
+
+def compute_pool_size(peak_used_size, margin_percent):
+    pool_size = peak_used_size * (100 + margin_percent) // 100
+    pool_size = (
+        (pool_size + LVGL_MEM_SIZE_GRANULARITY - 1)
+        // LVGL_MEM_SIZE_GRANULARITY
+        * LVGL_MEM_SIZE_GRANULARITY
+    )
+    return max(pool_size, LVGL_MEM_SIZE_MIN)
+
+
+def generate_profile_header(response, margin_percent, img_cache_size):
+    pages = "".join(
+        " *   {}: peak used {} bytes, peak fragmentation {}%\n".format(
+            page.page_name, page.peak_used_size, page.peak_frag_pct
+        )
+        for page in response.pages
+    )
+    return PROFILE_HEADER_TEMPLATE.format(
+        pool_size=response.pool_size,
+        peak_used_size=response.peak_used_size,
+        margin=margin_percent,
+        pages=pages,
+        mem_size=compute_pool_size(response.peak_used_size, margin_percent),
+        img_cache_size=img_cache_size,
+    )
+
+
+def entry_point_gui_memory_profile():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+    default_margin = 25
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Fetch the LVGL memory pool usage measured on each GUI page. "
+        "Browse the pages to profile on the board before running it."
+    )
+    parser.add_argument(
+        "-o",
+        "--output",
+        help="Generate the memory profile header to this file (to be placed in "
+        "embedded/gui/inc/gui_memory_profile.h, and built with GUI_MEMORY_PROFILE=1)",
+        default=None,
+    )
+    parser.add_argument(
+        "-m",
+        "--margin",
+        help="Margin over the peak used size in percent, to absorb the fragmentation "
+        "(default={})".format(default_margin),
+        type=int,
+        default=default_margin,
+    )
+    parser.add_argument(
+        "-c",
+        "--image-cache-size",
+        help="Number of entries of the LVGL image cache in the profile (default=same "
+        "as the current firmware)",
+        type=int,
+        default=None,
+    )
+    parser.add_argument(
+        "-r",
+        "--reset",
+        help="Reset the measurements on the board once fetched",
+        action="store_true",
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    try:
+        _, response = communication_handler.handle_exchange(
+            CommandFetchGuiMemory(reset_after_fetch=args.reset)
+        )
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log("Failed to fetch GUI memory: {}".format(communication_exception))
+        log_logger.terminate()
+        return
+    finally:
+        communication_handler.stop()
+
+    if response.get_response_code() != ResponseFetchGuiMemory.get_response_code():
+        log_logger.log("Unexpected response: {}".format(response))
+        log_logger.terminate()
+        return
+
+    log_logger.log(str(response))
+
+    if args.output:
+        img_cache_size = (
+            args.image_cache_size
+            if args.image_cache_size is not None
+            else response.image_cache_size
+        )
+        with open(args.output, "w") as output_file:
+            output_file.write(
+                generate_profile_header(response, args.margin, img_cache_size)
+            )
+        log_logger.log(
+            "Profile written to {}: pool {} bytes, image cache {} entrie(s)".format(
+                args.output,
+                compute_pool_size(response.peak_used_size, args.margin),
+                img_cache_size,
+            )
+        )
+    log_logger.terminate()
@@ -0,0 +1,301 @@
+"""
+Run the channel activity detection demo and display its statistics
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from queue import Empty
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandStartRadioCad,
+    CommandFetchResults,
+    CommandConsumptionModel,
+    CommandReset,
+    LoraBandwidth,
+    ResponseStartAck,
+    ResponseEvent,
+    ResponseFetchResult,
+    ResponseRadioCadResult,
+    ResponseConsumptionModel,
+)
+
+BANDWIDTHS = {
+    "125": LoraBandwidth.bw_125_khz,
+    "250": LoraBandwidth.bw_250_khz,
+    "500": LoraBandwidth.bw_500_khz,
+}
+
+
+def fetch_cad_results(communication_handler):
+    _, response = communication_handler.handle_exchange(CommandFetchResults())
+    if response.get_response_code() != ResponseFetchResult.get_response_code():
+        raise CommunicationHandlerException("Unexpected response: {}".format(response))
+    results = list()
+    for _ in range(response.nbr_results):
+        response = communication_handler.wait_and_handle_response()
+        if response.get_response_code() == ResponseRadioCadResult.get_response_code():
+            results.append(response)
+    return results
+
+
+def format_cad_results(results, period_ms, rx_current_ua):
+    """Tabulate the CAD statistics and the average current they draw
+
+    Each combination runs one CAD every period_ms times the number of combinations,
+    so the energy per CAD over that interval gives its average current.
+    """
+    lines = [
+        "SF | Frequency (MHz) |   CADs | detections | false alarms | FA rate | "
+        "CAD (us) | nas/CAD | avg current (uA)"
+    ]
+    interval_ms = period_ms * len(results)
+    total_current_ua = 0
+    for result in results:
+        current_ua = result.energy_per_cad_nas / interval_ms if interval_ms else 0
+        total_current_ua += current_ua
+        false_alarm_rate = result.false_alarm_rate
+        lines.append(
+            "{:2d} | {:15.3f} | {:6d} | {:10d} | {:12d} | {:>7} | {:8d} | {:7d} | "
+            "{:.1f}".format(
+                result.spreading_factor,
+                result.frequency_hz / 1e6,
+                result.nb_cads,
+                result.nb_detections,
+                result.nb_false_alarms,
+                "-"
+                if false_alarm_rate is None
+                else "{:.2%}".format(false_alarm_rate),
+                result.cad_duration_us,
+                result.energy_per_cad_nas,
+                current_ua,
+            )
+        )
+    lines.append(
+        "Average current of the CADs: {:.1f} uA, continuous reception: {} uA".format(
+            total_current_ua,
+            "unknown" if rx_current_ua is None else rx_current_ua,
+        )
+    )
+    return "\n".join(lines)
+
+
+def entry_point_radio_cad():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+    default_spreading_factors = [7]
+    default_bandwidth = "125"
+    default_start_frequency_hz = 868200000
+    default_channel_spacing_hz = 200000
+    default_nb_channels = 1
+    default_period_ms = 100
+    default_cad_symb_nb = 2
+    default_cad_detect_peak = 0x32
+    default_cad_detect_min = 0x0A
+    default_nb_cads = 0
+    default_interval_s = 10
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Run LoRa channel activity detections periodically on the board "
+        "and display the detections, the false alarms and the energy per CAD. Run "
+        "the PER transmitter on another board as the known transmitter"
+    )
+    parser.add_argument(
+        "--sf",
+        help="Spreading factors to run CADs with (default={})".format(
+            default_spreading_factors
+        ),
+        type=int,
+        nargs="+",
+        choices=range(5, 13),
+        default=default_spreading_factors,
+    )
+    parser.add_argument(
+        "--bw",
+        help="LoRa bandwidth in kHz (default={})".format(default_bandwidth),
+        choices=BANDWIDTHS.keys(),
+        default=default_bandwidth,
+    )
+    parser.add_argument(
+        "--start",
+        help="Frequency of the first channel in Hz (default={})".format(
+            default_start_frequency_hz
+        ),
+        type=int,
+        default=default_start_frequency_hz,
+    )
+    parser.add_argument(
+        "--spacing",
+        help="Spacing between the channels in Hz (default={})".format(
+            default_channel_spacing_hz
+        ),
+        type=int,
+        default=default_channel_spacing_hz,
+    )
+    parser.add_argument(
+        "--channels",
+        help="Number of channels, up to 4 (default={})".format(default_nb_channels),
+        type=int,
+        default=default_nb_channels,
+    )
+    parser.add_argument(
+        "--period",
+        help="Time between two CADs in ms (default={})".format(default_period_ms),
+        type=int,
+        default=default_period_ms,
+    )
+    parser.add_argument(
+        "--symbols",
+        help="Symbols listened to by a CAD: 1, 2, 4, 8 or 16 (default={})".format(
+            default_cad_symb_nb
+        ),
+        type=int,
+        default=default_cad_symb_nb,
+    )
+    parser.add_argument(
+        "--detect-peak",
+        help="CAD peak detection ratio (default={})".format(default_cad_detect_peak),
+        type=int,
+        default=default_cad_detect_peak,
+    )
+    parser.add_argument(
+        "--detect-min",
+        help="CAD minimum correlation power (default={})".format(
+            default_cad_detect_min
+        ),
+        type=int,
+        default=default_cad_detect_min,
+    )
+    parser.add_argument(
+        "--cads",
+        help="Number of CADs to run, 0 to run until interrupted (default={})".format(
+            default_nb_cads
+        ),
+        type=int,
+        default=default_nb_cads,
+    )
+    parser.add_argument(
+        "-i",
+        "--interval",
+        help="Time between two displays of the statistics in s (default={})".format(
+            default_interval_s
+        ),
+        type=float,
+        default=default_interval_s,
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    command = CommandStartRadioCad()
+    command.spreading_factors = args.sf
+    command.bandwidth = BANDWIDTHS[args.bw]
+    command.start_frequency_hz = args.start
+    command.channel_spacing_hz = args.spacing
+    command.nb_channels = args.channels
+    command.period_ms = args.period
+    command.cad_symb_nb = args.symbols
+    command.cad_detect_peak = args.detect_peak
+    command.cad_detect_min = args.detect_min
+    command.nb_cads = args.cads
+
+    try:
+        rx_current_ua = None
+        _, response = communication_handler.handle_exchange(CommandConsumptionModel())
+        if (
+            response.get_response_code()
+            == ResponseConsumptionModel.get_response_code()
+        ):
+            rx_current_ua = response.consumption_model.radio_dcdc_rx_ua
+
+        _, response = communication_handler.handle_exchange(command)
+        if (
+            response.get_response_code() != ResponseStartAck.get_response_code()
+            or not response.ack_status
+        ):
+            log_logger.log("CAD demo not started: {}".format(response))
+            return
+
+        is_terminated = False
+        while not is_terminated:
+            try:
+                get_response = (
+                    communication_handler.get_response_from_fifo_and_filter_out_log
+                )
+                response = get_response(timeout=args.interval)
+                is_terminated = (
+                    response.get_response_code() == ResponseEvent.get_response_code()
+                )
+            except Empty:
+                pass
+            log_logger.log(
+                format_cad_results(
+                    fetch_cad_results(communication_handler), args.period, rx_current_ua
+                )
+            )
+    except KeyboardInterrupt:
+        communication_handler.send_one_command(CommandReset())
+        communication_handler.empty_fifo()
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log("CAD demo failed: {}".format(communication_exception))
+    finally:
+        communication_handler.stop()
+        log_logger.terminate()
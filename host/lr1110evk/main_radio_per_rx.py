@@ -0,0 +1,162 @@
+"""
+Run the PER receiver with an RX duty cycle and display its capture rate
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from queue import Empty
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandStartRadioPerRx,
+    CommandFetchResults,
+    CommandReset,
+    ResponseStartAck,
+    ResponseFetchResult,
+    ResponseRadioPerRxResult,
+)
+
+
+def fetch_per_rx_result(communication_handler):
+    _, response = communication_handler.handle_exchange(CommandFetchResults())
+    if response.get_response_code() != ResponseFetchResult.get_response_code():
+        raise CommunicationHandlerException("Unexpected response: {}".format(response))
+    result = None
+    for _ in range(response.nbr_results):
+        response = communication_handler.wait_and_handle_response()
+        if response.get_response_code() == ResponseRadioPerRxResult.get_response_code():
+            result = response
+    return result
+
+
+def entry_point_radio_per_rx():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+    default_rx_period_ms = 10
+    default_sleep_period_ms = 0
+    default_interval_s = 10
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Run the PER receiver on the board, listening with an RX duty "
+        "cycle, and display the rate of packets captured against the estimated "
+        "average current. Run the PER transmitter on another board with a preamble "
+        "longer than the sleep period plus the RX period"
+    )
+    parser.add_argument(
+        "--rx-period",
+        help="RX period of the duty cycle in ms (default={})".format(
+            default_rx_period_ms
+        ),
+        type=int,
+        default=default_rx_period_ms,
+    )
+    parser.add_argument(
+        "--sleep-period",
+        help="Sleep period of the duty cycle in ms, 0 to listen continuously "
+        "(default={})".format(default_sleep_period_ms),
+        type=int,
+        default=default_sleep_period_ms,
+    )
+    parser.add_argument(
+        "-i",
+        "--interval",
+        help="Time between two displays of the statistics in s (default={})".format(
+            default_interval_s
+        ),
+        type=float,
+        default=default_interval_s,
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    command = CommandStartRadioPerRx()
+    command.rx_period_ms = args.rx_period
+    command.sleep_period_ms = args.sleep_period
+
+    try:
+        _, response = communication_handler.handle_exchange(command)
+        if (
+            response.get_response_code() != ResponseStartAck.get_response_code()
+            or not response.ack_status
+        ):
+            log_logger.log("PER receiver not started: {}".format(response))
+            return
+
+        while True:
+            try:
+                get_response = (
+                    communication_handler.get_response_from_fifo_and_filter_out_log
+                )
+                get_response(timeout=args.interval)
+            except Empty:
+                pass
+            result = fetch_per_rx_result(communication_handler)
+            if result is not None:
+                log_logger.log(str(result))
+    except KeyboardInterrupt:
+        communication_handler.send_one_command(CommandReset())
+        communication_handler.empty_fifo()
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log("PER receiver failed: {}".format(communication_exception))
+    finally:
+        communication_handler.stop()
+        log_logger.terminate()
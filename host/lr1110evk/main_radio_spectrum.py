@@ -0,0 +1,201 @@
+"""
+Stream and display the RSSI spectrum swept by the board
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from queue import Empty
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandStartRadioSpectrum,
+    CommandReset,
+    ResponseStartAck,
+    ResponseEvent,
+    ResponseRadioSpectrum,
+)
+
+BAR_CHART_WIDTH = 40
+RSSI_FLOOR_DBM = -130
+RSSI_CEILING_DBM = -30
+SPECTRUM_TIMEOUT_S = 5
+
+
+def format_spectrum(response):
+    lines = [str(response), "Frequency (MHz) | peak |  avg |"]
+    for spectrum_bin in response.bins:
+        clamped_peak = min(
+            max(spectrum_bin.peak_rssi, RSSI_FLOOR_DBM), RSSI_CEILING_DBM
+        )
+        bar_length = int(
+            round(
+                BAR_CHART_WIDTH
+                * (clamped_peak - RSSI_FLOOR_DBM)
+                / (RSSI_CEILING_DBM - RSSI_FLOOR_DBM)
+            )
+        )
+        lines.append(
+            "{:15.3f} | {:4d} | {:4d} | {}".format(
+                spectrum_bin.center_frequency_hz / 1e6,
+                spectrum_bin.peak_rssi,
+                spectrum_bin.average_rssi,
+                "#" * bar_length,
+            ).rstrip()
+        )
+    return "\n".join(lines)
+
+
+def entry_point_radio_spectrum():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+    default_start_frequency_hz = 863000000
+    default_stop_frequency_hz = 870000000
+    default_step_hz = 125000
+    default_nb_samples = 4
+    default_nb_sweeps = 10
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Sweep the RSSI over a frequency range with the board and display "
+        "each sweep as it is streamed back"
+    )
+    parser.add_argument(
+        "--start",
+        help="Start frequency of the sweep in Hz (default={})".format(
+            default_start_frequency_hz
+        ),
+        type=int,
+        default=default_start_frequency_hz,
+    )
+    parser.add_argument(
+        "--stop",
+        help="Stop frequency of the sweep in Hz (default={})".format(
+            default_stop_frequency_hz
+        ),
+        type=int,
+        default=default_stop_frequency_hz,
+    )
+    parser.add_argument(
+        "--step",
+        help="Width of one frequency bin in Hz (default={})".format(default_step_hz),
+        type=int,
+        default=default_step_hz,
+    )
+    parser.add_argument(
+        "--samples",
+        help="Number of RSSI samples taken per bin (default={})".format(
+            default_nb_samples
+        ),
+        type=int,
+        default=default_nb_samples,
+    )
+    parser.add_argument(
+        "--sweeps",
+        help="Number of sweeps to run, 0 to sweep until interrupted "
+        "(default={})".format(default_nb_sweeps),
+        type=int,
+        default=default_nb_sweeps,
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    command = CommandStartRadioSpectrum()
+    command.start_frequency_hz = args.start
+    command.stop_frequency_hz = args.stop
+    command.step_hz = args.step
+    command.nb_samples = args.samples
+    command.nb_sweeps = args.sweeps
+
+    try:
+        _, response = communication_handler.handle_exchange(command)
+        if (
+            response.get_response_code() != ResponseStartAck.get_response_code()
+            or not response.ack_status
+        ):
+            log_logger.log("Radio spectrum demo not started: {}".format(response))
+            return
+
+        while True:
+            try:
+                get_response = (
+                    communication_handler.get_response_from_fifo_and_filter_out_log
+                )
+                response = get_response(timeout=SPECTRUM_TIMEOUT_S)
+            except Empty:
+                log_logger.log("No sweep received for {} s".format(SPECTRUM_TIMEOUT_S))
+                break
+            if (
+                response.get_response_code()
+                == ResponseRadioSpectrum.get_response_code()
+            ):
+                log_logger.log(format_spectrum(response))
+            elif response.get_response_code() == ResponseEvent.get_response_code():
+                break
+            else:
+                log_logger.log("Unexpected response: {}".format(response))
+    except KeyboardInterrupt:
+        communication_handler.send_one_command(CommandReset())
+        communication_handler.empty_fifo()
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log("Radio spectrum demo failed: {}".format(communication_exception))
+    finally:
+        communication_handler.stop()
+        log_logger.terminate()
@@ -0,0 +1,132 @@
+"""
+Fetch the VBAT and temperature history sampled by the board
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandFetchTelemetry,
+    ResponseFetchTelemetry,
+    ResponseTelemetryEntry,
+)
+
+
+def fetch_telemetry(communication_handler, period_ms):
+    _, response = communication_handler.handle_exchange(
+        CommandFetchTelemetry(period_ms=period_ms)
+    )
+    if response.get_response_code() != ResponseFetchTelemetry.get_response_code():
+        raise ValueError("Unexpected response: {}".format(response))
+    entries = list()
+    for _ in range(response.nb_entries):
+        entry = communication_handler.wait_and_handle_response()
+        if entry.get_response_code() != ResponseTelemetryEntry.get_response_code():
+            raise ValueError("Unexpected response: {}".format(entry))
+        entries.append(entry)
+    return response, entries
+
+
+def format_telemetry_entries(entries):
+    lines = ["Instant                    | VBAT (mV) | Temperature (C)"]
+    for entry in entries:
+        lines.append(
+            "{:26} | {:9d} | {:15.1f}".format(
+                str(entry.instant_sample), entry.vbat_mv, entry.temperature_c
+            )
+        )
+    return "\n".join(lines)
+
+
+def entry_point_telemetry():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Fetch the VBAT and temperature history sampled by the board "
+        "while its radio is idle"
+    )
+    parser.add_argument(
+        "-p",
+        "--period-ms",
+        help="Change the sampling period before fetching, from {} to {} ms".format(
+            CommandFetchTelemetry.PERIOD_MIN_MS, CommandFetchTelemetry.PERIOD_MAX_MS
+        ),
+        type=int,
+        default=None,
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    try:
+        response, entries = fetch_telemetry(communication_handler, args.period_ms)
+    except (CommunicationHandlerException, ValueError) as fetch_exception:
+        log_logger.log("Failed to fetch the telemetry: {}".format(fetch_exception))
+        log_logger.terminate()
+        return
+    finally:
+        communication_handler.stop()
+
+    log_logger.log(str(response))
+    log_logger.log(format_telemetry_entries(entries))
+    log_logger.terminate()
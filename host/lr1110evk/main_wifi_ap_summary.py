@@ -0,0 +1,141 @@
+"""
+Fetch the Wi-Fi access points aggregated by the scans run on the board
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandFetchResults,
+    ResponseFetchResult,
+    ResponseWifiApSummary,
+)
+
+
+def fetch_wifi_ap_summary(communication_handler):
+    """Return the number of scans merged and the entries of all the summary frames"""
+    _, response = communication_handler.handle_exchange(
+        CommandFetchResults(ap_summary=True)
+    )
+    if response.get_response_code() != ResponseFetchResult.get_response_code():
+        raise CommunicationHandlerException("Unexpected response: {}".format(response))
+    nb_scans = 0
+    entries = list()
+    for _ in range(response.nbr_results):
+        response = communication_handler.wait_and_handle_response()
+        if response.get_response_code() != ResponseWifiApSummary.get_response_code():
+            raise CommunicationHandlerException(
+                "Unexpected response: {}".format(response)
+            )
+        nb_scans = response.nb_scans
+        entries.extend(response.entries)
+    return nb_scans, entries
+
+
+def format_wifi_ap_summary(nb_scans, entries):
+    lines = [
+        "{} access point(s) over {} scan(s)".format(len(entries), nb_scans),
+        "MAC address       | Ch | Type   | detections | RSSI min/mean/max | last seen",
+    ]
+    for entry in sorted(entries, key=lambda entry: entry.nb_detections, reverse=True):
+        lines.append(
+            "{} | {:2d} | {:6} | {:10d} | {:5d} {:5d} {:5d} | {}".format(
+                entry.mac_address,
+                entry.channel,
+                entry.wifi_type,
+                entry.nb_detections,
+                entry.rssi_min,
+                entry.rssi_mean,
+                entry.rssi_max,
+                entry.instant_last_seen.strftime("%H:%M:%S"),
+            )
+        )
+    return "\n".join(lines)
+
+
+def entry_point_wifi_ap_summary():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Fetch the Wi-Fi access points aggregated, by MAC address, over "
+        "the Wi-Fi scans run on the board"
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    try:
+        nb_scans, entries = fetch_wifi_ap_summary(communication_handler)
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log(
+            "Failed to fetch the Wi-Fi access point summary: {}".format(
+                communication_exception
+            )
+        )
+        log_logger.terminate()
+        return
+    finally:
+        communication_handler.stop()
+
+    log_logger.log(format_wifi_ap_summary(nb_scans, entries))
+    log_logger.terminate()
@@ -0,0 +1,153 @@
+"""
+Fetch and display the Wi-Fi channel occupancy statistics of the board
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+import pkg_resources
+from argparse import ArgumentParser
+from .Job import Logger
+from .SerialExchange import (
+    SerialHandler,
+    CommunicationHandler,
+    CommunicationHandlerException,
+    CommandFetchWifiChannelStats,
+    ResponseFetchWifiChannelStats,
+)
+
+BAR_CHART_WIDTH = 30
+
+
+def mean_ap_per_scan(channel_stats):
+    if channel_stats.nb_scans == 0:
+        return None
+    return channel_stats.nb_detections / channel_stats.nb_scans
+
+
+def format_channel_stats(response):
+    means = [mean_ap_per_scan(channel) for channel in response.channels]
+    max_mean = max([mean for mean in means if mean is not None], default=0)
+    lines = [
+        "Ch | scans | mean APs/scan | max APs/scan | max RSSI | "
+        "RSSI histogram (<-90 .. >=-60) | dwell (ms)"
+    ]
+    for channel, mean in zip(response.channels, means):
+        if mean is None:
+            lines.append("{:2d} | not scanned".format(channel.channel))
+            continue
+        bar_length = (
+            int(round(BAR_CHART_WIDTH * mean / max_mean)) if max_mean > 0 else 0
+        )
+        lines.append(
+            "{:2d} | {:5d} | {:13.1f} | {:12d} | {:8} | {:31} | {:10.1f} {}".format(
+                channel.channel,
+                channel.nb_scans,
+                mean,
+                channel.nb_ap_max_per_scan,
+                channel.rssi_max if channel.nb_detections > 0 else "-",
+                " ".join(str(count) for count in channel.rssi_histogram),
+                channel.dwell_time_us / 1000,
+                "#" * bar_length,
+            ).rstrip()
+        )
+    return "\n".join(lines)
+
+
+def entry_point_wifi_channel_stats():
+    default_device = "/dev/ttyACM0"
+    default_baud = 921600
+    default_log_filename = "log.log"
+
+    version = pkg_resources.get_distribution("lr1110evk").version
+    parser = ArgumentParser(
+        description="Fetch the per-channel occupancy statistics accumulated by the "
+        "Wi-Fi scans run on the board"
+    )
+    parser.add_argument(
+        "-c",
+        "--clear",
+        help="Clear the statistics on the board once fetched",
+        action="store_true",
+    )
+    parser.add_argument(
+        "-d",
+        "--device-address",
+        help="Address of the device connecting the lr1110 (default={})".format(
+            default_device
+        ),
+        default=default_device,
+    )
+    parser.add_argument(
+        "-b",
+        "--device-baud",
+        help="Baud for communication with the lr1110 (default={})".format(default_baud),
+        default=default_baud,
+    )
+    parser.add_argument(
+        "-l",
+        "--log-filename",
+        help="File to use to store the log (default={})".format(default_log_filename),
+        default=default_log_filename,
+    )
+    parser.add_argument("--version", action="version", version=version)
+    args = parser.parse_args()
+
+    log_logger = Logger(args.log_filename)
+    log_logger.print_also_on_stdin = True
+
+    serial_handler = SerialHandler()
+    serial_handler.set_serial_port(args.device_address)
+
+    communication_handler = CommunicationHandler(serial_handler, log_logger)
+    communication_handler.start()
+    communication_handler.wait_embedded_to_be_configured_for_field_test(3)
+
+    try:
+        _, response = communication_handler.handle_exchange(
+            CommandFetchWifiChannelStats(clear_after_fetch=args.clear)
+        )
+    except CommunicationHandlerException as communication_exception:
+        log_logger.log(
+            "Failed to fetch Wi-Fi channel statistics: {}".format(
+                communication_exception
+            )
+        )
+        log_logger.terminate()
+        return
+    finally:
+        communication_handler.stop()
+
+    if (
+        response.get_response_code()
+        != ResponseFetchWifiChannelStats.get_response_code()
+    ):
+        log_logger.log("Unexpected response: {}".format(response))
+        log_logger.terminate()
+        return
+
+    log_logger.log(str(response))
+    log_logger.log(format_channel_stats(response))
+    log_logger.terminate()
@@ -34,6 +34,18 @@ setup(
             "NavParser = lr1110evk.NavParserFile.__main__:entry_point_nav_parser_file",
             "UsbConnectionCheck = lr1110evk.SerialExchange.SerialHandlerConnectionTest:entry_point_connection_tester",
             "AlmanacUpdate = lr1110evk.main_almanac_update:entry_point_update_almanac",
+            "GuiMemoryProfile = lr1110evk.main_gui_memory_profile:entry_point_gui_memory_profile",
+            "WifiChannelStats = lr1110evk.main_wifi_channel_stats:entry_point_wifi_channel_stats",
+            "WifiApSummary = lr1110evk.main_wifi_ap_summary:entry_point_wifi_ap_summary",
+            "FitConsumption = lr1110evk.main_fit_consumption:entry_point_fit_consumption",
+            "RadioSpectrum = lr1110evk.main_radio_spectrum:entry_point_radio_spectrum",
+            "RadioCad = lr1110evk.main_radio_cad:entry_point_radio_cad",
+            "RadioPerRx = lr1110evk.main_radio_per_rx:entry_point_radio_per_rx",
+            "RadioPingPong = lr1110evk.main_radio_ping_pong:entry_point_radio_ping_pong",
+            "CryptoBenchmark = lr1110evk.main_crypto_benchmark:entry_point_crypto_benchmark",
+            "FirmwareUpdate = lr1110evk.main_firmware_update:entry_point_update_firmware",
+            "Telemetry = lr1110evk.main_telemetry:entry_point_telemetry",
+            "FieldTestPostBenchmark = lr1110evk.main_field_test_post_benchmark:entry_point_field_test_post_benchmark",
         ]
     },
 )